@@ -0,0 +1,17 @@
+#include "bench_allocations.hpp"
+
+#include <cstdlib>
+#include <new>
+
+size_t allocationCount = 0;
+
+void* operator new(size_t size)
+{
+	++allocationCount;
+	if (auto ptr = std::malloc(size ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
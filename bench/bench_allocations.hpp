@@ -0,0 +1,11 @@
+#ifndef BENCH_ALLOCATIONS_HPP
+#define BENCH_ALLOCATIONS_HPP
+
+#include <cstddef>
+
+//calls of the global operator new, counted by the replacement in bench_allocations.cpp.
+//it is defined in its own translation unit: seen next to the malloc in operator new, the free in
+//operator delete is reported by gcc as a mismatched deallocation
+extern size_t allocationCount;
+
+#endif
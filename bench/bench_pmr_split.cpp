@@ -0,0 +1,97 @@
+//split/parse workload: csv lines are split into fields and the numeric ones parsed,
+//with the default allocator and with UPmrString on a monotonic_buffer_resource arena.
+//the replace workload grows every line, so the result is built in a new buffer of the line's allocator
+//build: g++ -std=c++20 -O2 -I../include bench_pmr_split.cpp bench_allocations.cpp
+
+#include <usting/ustring.hpp>
+
+#include "bench_allocations.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <memory_resource>
+
+//lines long enough that most fields do not fit in the small string buffer
+static UString makeInput(size_t lineCount)
+{
+	UString res;
+	for (size_t i = 0; i < lineCount; ++i)
+	{
+		res += UString::fromIntegral(i * 7919 % 100000);
+		res += ",customer name number ";
+		res += UString::fromIntegral(i);
+		res += ",street address with a house number,";
+		res += UString::fromIntegral(i % 977);
+		res += '\n';
+	}
+	return res;
+}
+
+template <class String, class Alloc>
+static long long parse(const UString& input, const Alloc& alloc)
+{
+	long long sum = 0;
+	const String text(UStringView(input), alloc);
+	for (auto line : text.lazySplit(UChar('\n'), false, false))
+	{
+		const String row(line, alloc);
+		for (const auto& field : row.split(String(",", alloc)))
+			sum += field.template toIntegral<int>();
+	}
+	return sum;
+}
+
+template <class String, class Alloc>
+static long long replaceSeparators(const UString& input, const Alloc& alloc)
+{
+	long long size = 0;
+	const String text(UStringView(input), alloc);
+	const String before(",", alloc);
+	const String after(" <,> ", alloc);
+	for (auto line : text.lazySplit(UChar('\n'), false, false))
+	{
+		String row(line, alloc);
+		row.replace(before, after);
+		size += row.size();
+	}
+	return size;
+}
+
+template <class Body>
+static void run(const char* name, int iterations, Body body)
+{
+	long long sum = 0;
+	const auto startCount = allocationCount;
+	const auto start = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; ++i)
+		sum += body();
+
+	const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+	std::printf("%-6s %8.2f ms/iter %10zu allocations/iter (%lld)\n", name, time.count() / iterations,
+		(allocationCount - startCount) / iterations, sum);
+}
+
+int main()
+{
+	const auto input = makeInput(20000);
+	const int iterations = 20;
+
+	run("std", iterations, [&input] { return parse<UString>(input, std::allocator<UChar>()); });
+
+	//the arena takes one buffer allocated up front and frees everything at once at the end of an iteration
+	std::vector<std::byte> buffer(64 << 20);
+	run("arena", iterations, [&input, &buffer]
+		{
+			std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+			return parse<UPmrString>(input, std::pmr::polymorphic_allocator<UChar>(&arena));
+		});
+
+	run("std", iterations, [&input] { return replaceSeparators<UString>(input, std::allocator<UChar>()); });
+	run("arena", iterations, [&input, &buffer]
+		{
+			std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+			return replaceSeparators<UPmrString>(input, std::pmr::polymorphic_allocator<UChar>(&arena));
+		});
+}
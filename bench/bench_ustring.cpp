@@ -0,0 +1,809 @@
+
+//benchmarks of the UString operations. every operation runs on generated ascii and multilingual texts of several
+//sizes, next to std::u16string and a naive loop where they have an equivalent. the results are written as json,
+//one record per operation, implementation, corpus and size, with the throughput in MB/s of input and the heap
+//allocations per operation, so that builds can be compared over time.
+//build: cmake -S . -B build && cmake --build build --target ustring_bench
+//run: ustring_bench [--quick] [--filter op] [--out file.json]
+
+#include <usting/ustring.hpp>
+#include <usting/ustringbuilder.hpp>
+
+#include "bench_allocations.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+//results are added here so that the work is not optimized away
+static volatile size_t sink = 0;
+
+//the compiler has to assume that memory changed, so a call on the same input is not hoisted out of the timing loop
+static inline void clobberMemory()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : : "memory");
+#endif
+}
+
+static std::u16string_view u16(UStringView str) { return str.toUtf16View(); }
+
+//inputs
+
+//words the texts are made of. the multilingual ones take 1, 2, 3 and 4 bytes in utf-8 and have surrogate pairs
+static const std::u8string_view asciiWords[] = {
+	u8"the", u8"quick", u8"brown", u8"fox", u8"jumps", u8"over", u8"lazy", u8"dog", u8"Lorem", u8"ipsum",
+	u8"dolor", u8"sit", u8"amet", u8"consectetur", u8"adipiscing", u8"elit", u8"sed", u8"do", u8"eiusmod",
+	u8"tempor", u8"Incididunt", u8"ut", u8"labore", u8"et", u8"dolore", u8"magna", u8"aliqua" };
+static const std::u8string_view multilingualWords[] = {
+	u8"the", u8"quick", u8"brown", u8"fox", u8"Straße", u8"Größe", u8"café", u8"naïve", u8"Привет", u8"мир",
+	u8"строка", u8"Ελληνικά", u8"κείμενο", u8"日本語", u8"文字列", u8"中文", u8"한국어", u8"עברית", u8"العربية",
+	u8"😀", u8"🚀", u8"𝄞", u8"Ünïcödé", u8"ÉCOLE" };
+
+struct Input
+{
+	const char* corpus;
+	size_t size;
+
+	//words joined by spaces and line breaks, the needle is at the end of text and at the start of headText,
+	//so find and rfind read the whole text
+	UString text;
+	UString headText;
+	UString needle;
+	UString upperNeedle;
+	//the first word of the corpus, replaced by a longer one
+	UString word;
+	UString upperWord;
+	UString replacement;
+	UString separator;
+	std::vector<UStringView> words;
+	UString firstThird, secondThird, lastThird;
+
+	std::u16string text16;
+	std::u16string headText16;
+	std::u16string needle16;
+	std::u16string upperNeedle16;
+	std::u16string word16;
+	std::u16string replacement16;
+	std::u16string firstThird16, secondThird16, lastThird16;
+
+	std::string utf8;
+	std::u32string utf32;
+	std::wstring wide;
+	//only for the ascii corpus
+	std::string latin;
+
+	size_t bytes() const { return text.size() * sizeof(char16_t); }
+};
+
+static UString makeText(std::span<const std::u8string_view> pool, size_t size, std::mt19937& random)
+{
+	UString res;
+	res.reserve(size);
+	std::uniform_int_distribution<size_t> pick(0, pool.size() - 1);
+	for (size_t wordCount = 1;; ++wordCount)
+	{
+		const auto word = UString::fromUtf8(pool[pick(random)]);
+		if (res.size() + word.size() + 1 > size)
+			break;
+		res += word;
+		res += wordCount % 12 == 0 ? '\n' : ' ';
+	}
+	while (res.size() < size)
+		res += ' ';
+	return res;
+}
+
+static Input makeInput(bool multilingual, size_t size)
+{
+	//the same texts on every run
+	std::mt19937 random(uint32_t(size) * 2 + multilingual);
+	const std::span<const std::u8string_view> pool = multilingual ? std::span<const std::u8string_view>(multilingualWords)
+		: std::span<const std::u8string_view>(asciiWords);
+
+	Input res;
+	res.corpus = multilingual ? "multilingual" : "ascii";
+	res.size = size;
+	res.needle = multilingual ? UString::fromUtf8(u8"жёлтый") : UString("zephyr");
+	res.upperNeedle = res.needle.toUpper();
+	res.word = UString::fromUtf8(pool[0]);
+	res.upperWord = res.word.toUpper();
+	res.replacement = UString("replacement");
+	res.separator = UString(" ");
+
+	const auto body = makeText(pool, size - std::min(size, res.needle.size()), random);
+	res.text = body + res.needle;
+	res.headText = res.needle + body;
+	res.words = res.text.splitView(res.separator, false, false);
+	const auto third = res.text.size() / 3;
+	res.firstThird = res.text.substr(0, third);
+	res.secondThird = res.text.substr(third, third);
+	res.lastThird = res.text.substr(third * 2, res.text.size() - third * 2);
+
+	res.text16 = res.text.toUtf16();
+	res.headText16 = res.headText.toUtf16();
+	res.needle16 = res.needle.toUtf16();
+	res.upperNeedle16 = res.upperNeedle.toUtf16();
+	res.word16 = res.word.toUtf16();
+	res.replacement16 = res.replacement.toUtf16();
+	res.firstThird16 = res.firstThird.toUtf16();
+	res.secondThird16 = res.secondThird.toUtf16();
+	res.lastThird16 = res.lastThird.toUtf16();
+
+	const auto utf8 = res.text.toUtf8();
+	res.utf8.assign((const char*)utf8.data(), utf8.size());
+	res.utf32 = res.text.toUtf32();
+	res.wide = res.text.toWString();
+	if (multilingual == false)
+		res.latin = res.text.toLatin();
+	return res;
+}
+
+//numbers separated by spaces, for parsing and formatting
+struct NumericInput
+{
+	size_t size;
+	UString integers;
+	UString floats;
+	std::vector<UStringView> integerFields;
+	std::vector<UStringView> floatFields;
+	std::vector<std::string> integerLatin;
+	std::vector<std::string> floatLatin;
+	std::vector<int64_t> integerValues;
+	std::vector<double> floatValues;
+};
+
+static NumericInput makeNumericInput(size_t size)
+{
+	std::mt19937 random{ uint32_t(size) };
+	std::uniform_int_distribution<int64_t> integer(-1000000000, 1000000000);
+	std::uniform_real_distribution<double> real(-1e6, 1e6);
+
+	NumericInput res;
+	res.size = size;
+	while (res.integers.size() < size)
+	{
+		res.integerValues.push_back(integer(random));
+		res.integers.appendIntegral(res.integerValues.back());
+		res.integers += ' ';
+	}
+	while (res.floats.size() < size)
+	{
+		res.floatValues.push_back(real(random));
+		res.floats.appendFloatingPoint(res.floatValues.back());
+		res.floats += ' ';
+	}
+	res.integerFields = res.integers.splitView(UString(" "), false, false);
+	res.floatFields = res.floats.splitView(UString(" "), false, false);
+	for (auto field : res.integerFields)
+		res.integerLatin.push_back(UString(field).toLatin());
+	for (auto field : res.floatFields)
+		res.floatLatin.push_back(UString(field).toLatin());
+	return res;
+}
+
+//naive baselines: a unit or a code point at a time, the way it is written without a library
+
+static size_t naiveFind(std::u16string_view text, std::u16string_view needle)
+{
+	for (size_t i = 0; i + needle.size() <= text.size(); ++i)
+	{
+		size_t j = 0;
+		while (j < needle.size() && text[i + j] == needle[j])
+			++j;
+		if (j == needle.size())
+			return i;
+	}
+	return std::u16string_view::npos;
+}
+
+static size_t naiveRfind(std::u16string_view text, std::u16string_view needle)
+{
+	for (size_t i = text.size() - needle.size() + 1; i-- > 0;)
+	{
+		size_t j = 0;
+		while (j < needle.size() && text[i + j] == needle[j])
+			++j;
+		if (j == needle.size())
+			return i;
+	}
+	return std::u16string_view::npos;
+}
+
+static bool equalIgnoringCase(char16_t c0, char16_t c1)
+{
+	return UChar(c0).toLower() == UChar(c1).toLower();
+}
+
+static std::vector<std::u16string> naiveSplit(std::u16string_view text, char16_t separator)
+{
+	std::vector<std::u16string> res;
+	std::u16string piece;
+	for (const auto c : text)
+	{
+		if (c != separator)
+		{
+			piece += c;
+		}
+		else if (piece.empty() == false)
+		{
+			res.push_back(piece);
+			piece.clear();
+		}
+	}
+	if (piece.empty() == false)
+		res.push_back(piece);
+	return res;
+}
+
+static std::u16string naiveReplace(std::u16string_view text, std::u16string_view before, std::u16string_view after)
+{
+	std::u16string res;
+	for (size_t i = 0; i < text.size();)
+	{
+		if (text.compare(i, before.size(), before) == 0)
+		{
+			res += after;
+			i += before.size();
+		}
+		else
+		{
+			res += text[i++];
+		}
+	}
+	return res;
+}
+
+//empty on invalid utf-8
+static std::u16string naiveUtf8ToUtf16(std::string_view src)
+{
+	std::u16string res;
+	const auto ptr = (const unsigned char*)src.data();
+	for (size_t i = 0; i < src.size();)
+	{
+		uint32_t cp = ptr[i];
+		size_t length = cp < 0x80 ? 1 : cp < 0xE0 ? 2 : cp < 0xF0 ? 3 : 4;
+		if (i + length > src.size())
+			return std::u16string();
+		if (length > 1)
+		{
+			cp &= 0x3F >> (length - 1);
+			for (size_t j = 1; j < length; ++j)
+			{
+				if ((ptr[i + j] & 0xC0) != 0x80)
+					return std::u16string();
+				cp = (cp << 6) | (ptr[i + j] & 0x3F);
+			}
+		}
+		if (cp >= 0x10000)
+		{
+			res += char16_t(0xD800 + ((cp - 0x10000) >> 10));
+			res += char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF));
+		}
+		else
+		{
+			res += char16_t(cp);
+		}
+		i += length;
+	}
+	return res;
+}
+
+static uint32_t codePointAt(std::u16string_view src, size_t& i)
+{
+	const uint32_t c = src[i++];
+	if (c >= 0xD800 && c < 0xDC00 && i < src.size())
+		return 0x10000 + ((c - 0xD800) << 10) + (src[i++] - 0xDC00);
+	return c;
+}
+
+static std::string naiveUtf16ToUtf8(std::u16string_view src)
+{
+	std::string res;
+	for (size_t i = 0; i < src.size();)
+	{
+		const auto cp = codePointAt(src, i);
+		if (cp < 0x80)
+		{
+			res += char(cp);
+		}
+		else if (cp < 0x800)
+		{
+			res += char(0xC0 | (cp >> 6));
+			res += char(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000)
+		{
+			res += char(0xE0 | (cp >> 12));
+			res += char(0x80 | ((cp >> 6) & 0x3F));
+			res += char(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			res += char(0xF0 | (cp >> 18));
+			res += char(0x80 | ((cp >> 12) & 0x3F));
+			res += char(0x80 | ((cp >> 6) & 0x3F));
+			res += char(0x80 | (cp & 0x3F));
+		}
+	}
+	return res;
+}
+
+static bool naiveIsValidUtf16(std::u16string_view src)
+{
+	for (size_t i = 0; i < src.size(); ++i)
+	{
+		if (src[i] >= 0xD800 && src[i] < 0xDC00)
+		{
+			if (i + 1 == src.size() || src[i + 1] < 0xDC00 || src[i + 1] >= 0xE000)
+				return false;
+			++i;
+		}
+		else if (src[i] >= 0xDC00 && src[i] < 0xE000)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static std::u32string naiveUtf16ToUtf32(std::u16string_view src)
+{
+	std::u32string res;
+	for (size_t i = 0; i < src.size();)
+		res += char32_t(codePointAt(src, i));
+	return res;
+}
+
+static std::u16string naiveUtf32ToUtf16(std::u32string_view src)
+{
+	std::u16string res;
+	for (const auto cp : src)
+	{
+		if (cp >= 0x10000)
+		{
+			res += char16_t(0xD800 + ((cp - 0x10000) >> 10));
+			res += char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF));
+		}
+		else
+		{
+			res += char16_t(cp);
+		}
+	}
+	return res;
+}
+
+static int64_t naiveParseInt(std::u16string_view src)
+{
+	size_t i = 0;
+	const bool negative = src.size() != 0 && src[0] == u'-';
+	if (negative)
+		++i;
+	int64_t res = 0;
+	for (; i < src.size() && src[i] >= u'0' && src[i] <= u'9'; ++i)
+		res = res * 10 + (src[i] - u'0');
+	return negative ? -res : res;
+}
+
+static void naiveAppendInt(std::u16string& out, int64_t value)
+{
+	char16_t digits[24];
+	size_t count = 0;
+	uint64_t rest = value < 0 ? 0 - uint64_t(value) : uint64_t(value);
+	do
+	{
+		digits[count++] = char16_t(u'0' + rest % 10);
+		rest /= 10;
+	} while (rest != 0);
+	if (value < 0)
+		out += u'-';
+	while (count != 0)
+		out += digits[--count];
+}
+
+//measuring
+
+struct Result
+{
+	std::string op;
+	const char* impl;
+	const char* corpus;
+	size_t size;
+	size_t bytes;
+	size_t iterations;
+	double nsPerOp;
+	double allocationsPerOp;
+};
+
+class Runner
+{
+	std::vector<Result> results;
+	std::string filter;
+	double minSeconds;
+
+public:
+	Runner(std::string filter, double minSeconds) : filter(std::move(filter)), minSeconds(minSeconds) {}
+
+	bool enabled(std::string_view op) const { return op.find(filter) != std::string_view::npos; }
+
+	//body returns something that depends on the whole result. the iteration count grows until a batch takes minSeconds
+	template <class Body>
+	void run(const char* op, const char* impl, const char* corpus, size_t size, size_t bytes, Body body)
+	{
+		if (enabled(op) == false)
+			return;
+
+		sink = sink + body();
+		size_t iterations = 1;
+		for (;;)
+		{
+			const auto startCount = allocationCount;
+			const auto start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < iterations; ++i)
+			{
+				sink = sink + body();
+				clobberMemory();
+			}
+			const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+			const auto allocations = allocationCount - startCount;
+
+			if (time.count() >= minSeconds || iterations >= (size_t(1) << 32))
+			{
+				results.push_back({ op, impl, corpus, size, bytes, iterations, time.count() * 1e9 / double(iterations),
+					double(allocations) / double(iterations) });
+				const auto& res = results.back();
+				std::fprintf(stderr, "%-16s %-6s %-12s %8zu %12.1f ns %10.1f MB/s %8.2f allocations\n", op, impl, corpus, size,
+					res.nsPerOp, megabytesPerSecond(res), res.allocationsPerOp);
+				return;
+			}
+			//aims a bit past minSeconds so that the next batch is usually the last one
+			const double scale = time.count() > 0 ? minSeconds * 1.4 / time.count() : 100;
+			iterations = size_t(double(iterations) * std::clamp(scale, 2.0, 100.0));
+		}
+	}
+
+	static double megabytesPerSecond(const Result& res) { return res.nsPerOp > 0 ? double(res.bytes) * 1e3 / res.nsPerOp : 0; }
+
+	void writeJson(std::FILE* out, bool quick) const
+	{
+#if defined(USTRING_SSE2)
+		const char* simd = ustring_detail::hasAvx2() ? "avx2" : "sse2";
+#else
+		const char* simd = "none";
+#endif
+		std::fprintf(out, "{\n\t\"library\": \"ustring\",\n\t\"simd\": \"%s\",\n\t\"quick\": %s,\n\t\"results\": [", simd, quick ? "true" : "false");
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const auto& res = results[i];
+			std::fprintf(out, "%s\n\t\t{ \"op\": \"%s\", \"impl\": \"%s\", \"corpus\": \"%s\", \"size\": %zu, \"bytes\": %zu, "
+				"\"iterations\": %zu, \"ns_per_op\": %.2f, \"mb_per_s\": %.2f, \"allocations_per_op\": %.3f }",
+				i == 0 ? "" : ",", res.op.c_str(), res.impl, res.corpus, res.size, res.bytes, res.iterations, res.nsPerOp,
+				megabytesPerSecond(res), res.allocationsPerOp);
+		}
+		std::fprintf(out, "\n\t]\n}\n");
+	}
+};
+
+//operations. size is in utf-16 units, throughput is counted in bytes of the input
+
+static void benchText(Runner& runner, const Input& in)
+{
+	const auto corpus = in.corpus;
+	const auto size = in.size;
+	const auto bytes = in.bytes();
+
+	//construction and concatenation
+	runner.run("construct", "ustring", corpus, size, bytes, [&] { return UString(UStringView(in.text16)).size(); });
+	runner.run("construct", "std", corpus, size, bytes, [&] { return std::u16string(in.text16).size(); });
+	runner.run("copy", "ustring", corpus, size, bytes, [&] { return UString(in.text).size(); });
+	runner.run("copy", "std", corpus, size, bytes, [&] { return std::u16string(in.text16).size(); });
+	runner.run("append", "ustring", corpus, size, bytes, [&]
+		{
+			UString res;
+			for (const auto word : in.words)
+				res += word;
+			return res.size();
+		});
+	runner.run("append", "std", corpus, size, bytes, [&]
+		{
+			std::u16string res;
+			for (const auto word : in.words)
+				res += u16(word);
+			return res.size();
+		});
+	runner.run("concat", "ustring", corpus, size, bytes, [&] { return (in.firstThird + in.secondThird + in.lastThird).size(); });
+	runner.run("concat", "std", corpus, size, bytes, [&] { return (in.firstThird16 + in.secondThird16 + in.lastThird16).size(); });
+	runner.run("concat_builder", "ustring", corpus, size, bytes, [&]
+		{
+			const UString res = in.firstThird % in.secondThird % in.lastThird;
+			return res.size();
+		});
+
+	//search
+	runner.run("find", "ustring", corpus, size, bytes, [&] { return in.text.find(in.needle); });
+	runner.run("find", "std", corpus, size, bytes, [&] { return in.text16.find(in.needle16); });
+	runner.run("find", "naive", corpus, size, bytes, [&] { return naiveFind(in.text16, in.needle16); });
+	runner.run("find_icase", "ustring", corpus, size, bytes, [&] { return in.text.find(in.upperNeedle, 0, true); });
+	runner.run("find_icase", "std", corpus, size, bytes, [&]
+		{
+			return size_t(std::search(in.text16.begin(), in.text16.end(), in.upperNeedle16.begin(), in.upperNeedle16.end(),
+				equalIgnoringCase) - in.text16.begin());
+		});
+	runner.run("rfind", "ustring", corpus, size, bytes, [&] { return in.headText.rfind(in.needle); });
+	runner.run("rfind", "std", corpus, size, bytes, [&] { return in.headText16.rfind(in.needle16); });
+	runner.run("rfind", "naive", corpus, size, bytes, [&] { return naiveRfind(in.headText16, in.needle16); });
+	runner.run("rfind_icase", "ustring", corpus, size, bytes, [&] { return in.headText.rfind(in.upperNeedle, 0, true); });
+	runner.run("rfind_icase", "std", corpus, size, bytes, [&]
+		{
+			return size_t(std::find_end(in.headText16.begin(), in.headText16.end(), in.upperNeedle16.begin(), in.upperNeedle16.end(),
+				equalIgnoringCase) - in.headText16.begin());
+		});
+
+	//split on spaces, empty pieces dropped
+	runner.run("split", "ustring", corpus, size, bytes, [&] { return in.text.split(in.separator, false, false).size(); });
+	runner.run("split", "std", corpus, size, bytes, [&]
+		{
+			std::vector<std::u16string> res;
+			for (size_t start = 0; start < in.text16.size();)
+			{
+				const auto end = std::min(in.text16.find(u' ', start), in.text16.size());
+				if (end != start)
+					res.push_back(in.text16.substr(start, end - start));
+				start = end + 1;
+			}
+			return res.size();
+		});
+	runner.run("split", "naive", corpus, size, bytes, [&] { return naiveSplit(in.text16, u' ').size(); });
+	runner.run("split_view", "ustring", corpus, size, bytes, [&] { return in.text.splitView(in.separator, false, false).size(); });
+	runner.run("split_lazy", "ustring", corpus, size, bytes, [&]
+		{
+			size_t count = 0;
+			for (const auto piece : in.text.lazySplit(UChar(' '), false, false))
+				count += piece.size();
+			return count;
+		});
+
+	//replace a word with a longer one
+	runner.run("replace", "ustring", corpus, size, bytes, [&]
+		{
+			UString res(in.text);
+			res.replace(in.word, in.replacement);
+			return res.size();
+		});
+	runner.run("replace", "std", corpus, size, bytes, [&]
+		{
+			std::u16string res;
+			size_t start = 0;
+			for (size_t found; (found = in.text16.find(in.word16, start)) != std::u16string::npos; start = found + in.word16.size())
+			{
+				res.append(in.text16, start, found - start);
+				res += in.replacement16;
+			}
+			res.append(in.text16, start);
+			return res.size();
+		});
+	runner.run("replace", "naive", corpus, size, bytes, [&] { return naiveReplace(in.text16, in.word16, in.replacement16).size(); });
+	runner.run("replace_icase", "ustring", corpus, size, bytes, [&]
+		{
+			UString res(in.text);
+			res.replace(in.upperWord, in.replacement, true);
+			return res.size();
+		});
+
+	//case conversion, the naive one maps each unit on its own
+	runner.run("to_upper", "ustring", corpus, size, bytes, [&] { return in.text.toUpper().size(); });
+	runner.run("to_upper", "naive", corpus, size, bytes, [&]
+		{
+			std::u16string res(in.text16.size(), u'\0');
+			for (size_t i = 0; i < res.size(); ++i)
+				res[i] = char16_t(UChar(in.text16[i]).toUpper().toChar16());
+			return res.size();
+		});
+	runner.run("to_lower", "ustring", corpus, size, bytes, [&] { return in.text.toLower().size(); });
+	runner.run("to_lower", "naive", corpus, size, bytes, [&]
+		{
+			std::u16string res(in.text16.size(), u'\0');
+			for (size_t i = 0; i < res.size(); ++i)
+				res[i] = char16_t(UChar(in.text16[i]).toLower().toChar16());
+			return res.size();
+		});
+	runner.run("case_fold", "ustring", corpus, size, bytes, [&] { return in.text.caseFold().size(); });
+
+	//encoding conversions, the throughput of the from_ ones is counted in bytes of their input
+	const auto utf8Bytes = in.utf8.size();
+	runner.run("from_utf8", "ustring", corpus, size, utf8Bytes, [&] { return UString::fromUtf8(in.utf8).size(); });
+	runner.run("from_utf8", "naive", corpus, size, utf8Bytes, [&] { return naiveUtf8ToUtf16(in.utf8).size(); });
+	runner.run("to_utf8", "ustring", corpus, size, bytes, [&] { return in.text.toUtf8().size(); });
+	runner.run("to_utf8", "naive", corpus, size, bytes, [&] { return naiveUtf16ToUtf8(in.text16).size(); });
+	runner.run("validate_utf8", "ustring", corpus, size, utf8Bytes, [&] { return validateUtf8(in.utf8); });
+	runner.run("validate_utf8", "naive", corpus, size, utf8Bytes, [&] { return naiveUtf8ToUtf16(in.utf8).size(); });
+	runner.run("validate_utf16", "ustring", corpus, size, bytes, [&] { return size_t(in.text.isValidUtf16()); });
+	runner.run("validate_utf16", "naive", corpus, size, bytes, [&] { return size_t(naiveIsValidUtf16(in.text16)); });
+	runner.run("from_utf32", "ustring", corpus, size, in.utf32.size() * 4, [&] { return UString::fromUtf32(in.utf32).size(); });
+	runner.run("from_utf32", "naive", corpus, size, in.utf32.size() * 4, [&] { return naiveUtf32ToUtf16(in.utf32).size(); });
+	runner.run("to_utf32", "ustring", corpus, size, bytes, [&] { return in.text.toUtf32().size(); });
+	runner.run("to_utf32", "naive", corpus, size, bytes, [&] { return naiveUtf16ToUtf32(in.text16).size(); });
+	runner.run("from_wstring", "ustring", corpus, size, in.wide.size() * sizeof(wchar_t), [&] { return UString::fromWString(in.wide).size(); });
+	runner.run("to_wstring", "ustring", corpus, size, bytes, [&] { return in.text.toWString().size(); });
+	if (in.latin.empty() == false)
+	{
+		runner.run("from_latin1", "ustring", corpus, size, in.latin.size(), [&] { return UString::fromLatin(in.latin).size(); });
+		runner.run("from_latin1", "naive", corpus, size, in.latin.size(), [&]
+			{
+				std::u16string res;
+				for (const auto c : in.latin)
+					res += char16_t((unsigned char)c);
+				return res.size();
+			});
+		runner.run("to_latin1", "ustring", corpus, size, bytes, [&] { return in.text.toLatin().size(); });
+	}
+}
+
+static void benchNumbers(Runner& runner, const NumericInput& in)
+{
+	const auto corpus = "numeric";
+	const auto size = in.size;
+	const auto integerBytes = in.integers.size() * sizeof(char16_t);
+	const auto floatBytes = in.floats.size() * sizeof(char16_t);
+
+	runner.run("parse_int", "ustring", corpus, size, integerBytes, [&]
+		{
+			int64_t sum = 0;
+			for (const auto field : in.integerFields)
+				sum += field.parseIntegral<int64_t>().value;
+			return size_t(sum);
+		});
+	runner.run("parse_int", "std", corpus, size, integerBytes, [&]
+		{
+			int64_t sum = 0;
+			for (const auto& field : in.integerLatin)
+			{
+				int64_t value = 0;
+				std::from_chars(field.data(), field.data() + field.size(), value);
+				sum += value;
+			}
+			return size_t(sum);
+		});
+	runner.run("parse_int", "naive", corpus, size, integerBytes, [&]
+		{
+			int64_t sum = 0;
+			for (const auto field : in.integerFields)
+				sum += naiveParseInt(u16(field));
+			return size_t(sum);
+		});
+	runner.run("parse_float", "ustring", corpus, size, floatBytes, [&]
+		{
+			double sum = 0;
+			for (const auto field : in.floatFields)
+				sum += field.parseFloatingPoint<double>().value;
+			return size_t(sum);
+		});
+	runner.run("parse_float", "std", corpus, size, floatBytes, [&]
+		{
+			double sum = 0;
+			for (const auto& field : in.floatLatin)
+			{
+				double value = 0;
+				std::from_chars(field.data(), field.data() + field.size(), value);
+				sum += value;
+			}
+			return size_t(sum);
+		});
+
+	//std and naive write the same text into a std::u16string, to_chars output is widened through a buffer
+	runner.run("format_int", "ustring", corpus, size, integerBytes, [&]
+		{
+			UString res;
+			for (const auto value : in.integerValues)
+			{
+				res.appendIntegral(value);
+				res += ' ';
+			}
+			return res.size();
+		});
+	runner.run("format_int", "std", corpus, size, integerBytes, [&]
+		{
+			std::u16string res;
+			char buffer[32];
+			char16_t wide[32];
+			for (const auto value : in.integerValues)
+			{
+				const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+				std::copy(buffer, end, wide);
+				res.append(wide, end - buffer);
+				res += u' ';
+			}
+			return res.size();
+		});
+	runner.run("format_int", "naive", corpus, size, integerBytes, [&]
+		{
+			std::u16string res;
+			for (const auto value : in.integerValues)
+			{
+				naiveAppendInt(res, value);
+				res += u' ';
+			}
+			return res.size();
+		});
+	runner.run("format_float", "ustring", corpus, size, floatBytes, [&]
+		{
+			UString res;
+			for (const auto value : in.floatValues)
+			{
+				res.appendFloatingPoint(value);
+				res += ' ';
+			}
+			return res.size();
+		});
+	runner.run("format_float", "std", corpus, size, floatBytes, [&]
+		{
+			std::u16string res;
+			char buffer[64];
+			char16_t wide[64];
+			for (const auto value : in.floatValues)
+			{
+				const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+				std::copy(buffer, end, wide);
+				res.append(wide, end - buffer);
+				res += u' ';
+			}
+			return res.size();
+		});
+}
+
+int main(int argc, char** argv)
+{
+	bool quick = false;
+	std::string filter;
+	const char* outPath = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg = argv[i];
+		if (arg == "--quick")
+			quick = true;
+		else if (arg == "--filter" && i + 1 < argc)
+			filter = argv[++i];
+		else if (arg == "--out" && i + 1 < argc)
+			outPath = argv[++i];
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--quick] [--filter op] [--out file.json]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	//from a few units, where the call overhead shows, to texts well past the caches
+	const std::vector<size_t> sizes = quick ? std::vector<size_t>{ 16, 4096, 65536 } : std::vector<size_t>{ 16, 256, 4096, 65536, 1 << 20 };
+	Runner runner(filter, quick ? 0.01 : 0.1);
+
+	for (const auto size : sizes)
+	{
+		for (const bool multilingual : { false, true })
+			benchText(runner, makeInput(multilingual, size));
+		benchNumbers(runner, makeNumericInput(size));
+	}
+
+	std::FILE* out = stdout;
+	if (outPath != nullptr && (out = std::fopen(outPath, "w")) == nullptr)
+	{
+		std::fprintf(stderr, "cannot open %s\n", outPath);
+		return 1;
+	}
+	runner.writeJson(out, quick);
+	if (out != stdout)
+		std::fclose(out);
+}
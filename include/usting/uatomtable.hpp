@@ -0,0 +1,273 @@
+#ifndef UATOMTABLE_HPP
+#define UATOMTABLE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <new>
+#include <vector>
+#include <span>
+#include <initializer_list>
+#include <algorithm>
+#include <functional>
+
+#include "ustring.hpp"
+
+namespace ustring_detail
+{
+	//interned string: hash, size and characters in one allocation, never moved or freed while its table lives
+	struct AtomEntry
+	{
+		size_t hash;
+		size_t size;
+
+		const UChar* chars() const noexcept { return reinterpret_cast<const UChar*>(this + 1); }
+
+		static AtomEntry* create(UStringView str, size_t hash)
+		{
+			auto res = new (::operator new(sizeof(AtomEntry) + (str.size() + 1) * sizeof(UChar))) AtomEntry{ hash, str.size() };
+			auto chars = reinterpret_cast<UChar*>(res + 1);
+			if (str.empty() == false)
+				std::char_traits<UChar>::copy(chars, str.data(), str.size());
+			chars[str.size()] = UChar();
+			return res;
+		}
+
+		static void destroy(AtomEntry* entry) noexcept
+		{
+			entry->~AtomEntry();
+			::operator delete(entry);
+		}
+	};
+}
+
+//handle of a string interned by UAtomTable: equality is a pointer compare and the hash is precomputed.
+//atoms are compared by identity, so only atoms of the same table can be compared
+class UAtom
+{
+	friend class UAtomTable;
+
+	const ustring_detail::AtomEntry* entry = nullptr;
+
+	explicit UAtom(const ustring_detail::AtomEntry* entry) noexcept : entry(entry) {}
+
+public:
+	constexpr UAtom() noexcept = default;
+
+	//null atom: default constructed or not found by UAtomTable::find
+	bool isNull() const noexcept { return entry == nullptr; }
+	explicit operator bool() const noexcept { return entry != nullptr; }
+
+	size_t hash() const noexcept { return entry ? entry->hash : 0; }
+	size_t size() const noexcept { return entry ? entry->size : 0; }
+	//null terminated, valid while the table lives
+	const UChar* data() const noexcept { return entry ? entry->chars() : nullptr; }
+	UStringView view() const noexcept { return UStringView(data(), size()); }
+	operator UStringView() const noexcept { return view(); }
+	UString toUString() const { return UString(view()); }
+
+	friend bool operator==(UAtom atom0, UAtom atom1) noexcept { return atom0.entry == atom1.entry; }
+	//identity order, stable while the table lives but not alphabetical
+	friend std::strong_ordering operator<=>(UAtom atom0, UAtom atom1) noexcept { return std::compare_three_way()(atom0.entry, atom1.entry); }
+};
+
+template <>
+struct std::hash<UAtom>
+{
+	size_t operator()(UAtom atom) const noexcept { return atom.hash(); }
+};
+
+//thread-safe intern pool mapping strings to UAtom handles. strings are never removed.
+//the map is split into shards by hash, each an open addressing table of entry pointers:
+//lookups (find, and intern of a present string) take no lock, inserting locks one shard
+class UAtomTable
+{
+	typedef ustring_detail::AtomEntry Entry;
+
+	static constexpr unsigned shardBits = 6;
+	static constexpr size_t shardCount = size_t(1) << shardBits;
+	static constexpr size_t initialCapacity = 16;
+
+	struct Table
+	{
+		size_t mask;
+		std::unique_ptr<std::atomic<const Entry*>[]> slots;
+
+		explicit Table(size_t capacity) : mask(capacity - 1), slots(new std::atomic<const Entry*>[capacity])
+		{
+			for (size_t i = 0; i < capacity; ++i)
+				slots[i].store(nullptr, std::memory_order_relaxed);
+		}
+	};
+
+	struct alignas(64) Shard
+	{
+		std::atomic<Table*> table{ nullptr };
+		std::mutex mutex;
+		std::atomic<size_t> count{ 0 };
+		//replaced tables are kept until the destructor: a reader may still be probing them
+		std::vector<std::unique_ptr<Table>> tables;
+	};
+
+	Shard shards[shardCount];
+
+	//high bits pick the shard, low bits the slot
+	static size_t shardOf(size_t hash) noexcept { return hash >> (sizeof(size_t) * 8 - shardBits); }
+
+	static const Entry* lookup(const Shard& shard, UStringView str, size_t hash) noexcept;
+	//shard must be locked
+	static const Entry* insert(Shard& shard, UStringView str, size_t hash);
+
+public:
+	UAtomTable();
+	~UAtomTable();
+
+	UAtomTable(const UAtomTable&) = delete;
+	UAtomTable& operator=(const UAtomTable&) = delete;
+
+	//atom of str, adds it if it is not in the table yet
+	UAtom intern(UStringView str);
+	//atoms of all strings in the same order, each shard is locked once for all its new strings
+	std::vector<UAtom> intern(std::span<const UStringView> strs);
+	std::vector<UAtom> intern(std::span<const UString> strs);
+	std::vector<UAtom> intern(std::initializer_list<UStringView> strs) { return intern(std::span<const UStringView>(strs.begin(), strs.size())); }
+
+	//never adds, a null atom if str is not interned
+	UAtom find(UStringView str) const noexcept;
+	bool contains(UStringView str) const noexcept { return find(str).isNull() == false; }
+
+	size_t size() const noexcept;
+};
+
+inline UAtomTable::UAtomTable()
+{
+	for (auto& shard : shards)
+	{
+		shard.tables.push_back(std::make_unique<Table>(initialCapacity));
+		shard.table.store(shard.tables.back().get(), std::memory_order_relaxed);
+	}
+}
+
+inline UAtomTable::~UAtomTable()
+{
+	//every entry is in the current table of its shard exactly once
+	for (auto& shard : shards)
+	{
+		const auto table = shard.table.load(std::memory_order_relaxed);
+		for (size_t i = 0; i <= table->mask; ++i)
+			if (auto entry = table->slots[i].load(std::memory_order_relaxed))
+				Entry::destroy(const_cast<Entry*>(entry));
+	}
+}
+
+inline const ustring_detail::AtomEntry* UAtomTable::lookup(const Shard& shard, UStringView str, size_t hash) noexcept
+{
+	//slots are filled once and never cleared, so an empty slot ends the probe
+	const auto table = shard.table.load(std::memory_order_acquire);
+	for (size_t i = hash & table->mask;; i = (i + 1) & table->mask)
+	{
+		const auto entry = table->slots[i].load(std::memory_order_acquire);
+		if (entry == nullptr)
+			return nullptr;
+		if (entry->hash == hash && UStringView(entry->chars(), entry->size) == str)
+			return entry;
+	}
+}
+
+inline const ustring_detail::AtomEntry* UAtomTable::insert(Shard& shard, UStringView str, size_t hash)
+{
+	//another thread may have added it after the lock-free lookup
+	if (auto entry = lookup(shard, str, hash))
+		return entry;
+
+	auto table = shard.table.load(std::memory_order_relaxed);
+	//load factor at most 1/2
+	const auto count = shard.count.load(std::memory_order_relaxed);
+	if ((count + 1) * 2 > table->mask + 1)
+	{
+		auto grown = std::make_unique<Table>((table->mask + 1) * 2);
+		for (size_t i = 0; i <= table->mask; ++i)
+		{
+			const auto entry = table->slots[i].load(std::memory_order_relaxed);
+			if (entry == nullptr)
+				continue;
+			auto j = entry->hash & grown->mask;
+			while (grown->slots[j].load(std::memory_order_relaxed) != nullptr)
+				j = (j + 1) & grown->mask;
+			grown->slots[j].store(entry, std::memory_order_relaxed);
+		}
+		table = grown.get();
+		shard.tables.push_back(std::move(grown));
+		shard.table.store(table, std::memory_order_release);
+	}
+
+	const auto entry = Entry::create(str, hash);
+	auto i = hash & table->mask;
+	while (table->slots[i].load(std::memory_order_relaxed) != nullptr)
+		i = (i + 1) & table->mask;
+	table->slots[i].store(entry, std::memory_order_release);
+	shard.count.store(count + 1, std::memory_order_relaxed);
+	return entry;
+}
+
+inline UAtom UAtomTable::intern(UStringView str)
+{
+	const auto hash = UStringHash()(str);
+	auto& shard = shards[shardOf(hash)];
+	if (auto entry = lookup(shard, str, hash))
+		return UAtom(entry);
+
+	std::lock_guard lock(shard.mutex);
+	return UAtom(insert(shard, str, hash));
+}
+
+inline std::vector<UAtom> UAtomTable::intern(std::span<const UStringView> strs)
+{
+	std::vector<UAtom> res(strs.size());
+	std::vector<size_t> hashes(strs.size());
+	std::vector<size_t> missing;
+
+	for (size_t i = 0; i < strs.size(); ++i)
+	{
+		hashes[i] = UStringHash()(strs[i]);
+		if (auto entry = lookup(shards[shardOf(hashes[i])], strs[i], hashes[i]))
+			res[i] = UAtom(entry);
+		else
+			missing.push_back(i);
+	}
+
+	//new strings grouped by shard, in input order within a shard
+	std::stable_sort(missing.begin(), missing.end(), [&hashes](size_t i, size_t j) { return shardOf(hashes[i]) < shardOf(hashes[j]); });
+	for (size_t first = 0; first < missing.size();)
+	{
+		auto& shard = shards[shardOf(hashes[missing[first]])];
+		std::lock_guard lock(shard.mutex);
+		auto last = first;
+		for (; last < missing.size() && &shards[shardOf(hashes[missing[last]])] == &shard; ++last)
+			res[missing[last]] = UAtom(insert(shard, strs[missing[last]], hashes[missing[last]]));
+		first = last;
+	}
+	return res;
+}
+
+inline std::vector<UAtom> UAtomTable::intern(std::span<const UString> strs)
+{
+	const std::vector<UStringView> views(strs.begin(), strs.end());
+	return intern(std::span<const UStringView>(views));
+}
+
+inline UAtom UAtomTable::find(UStringView str) const noexcept
+{
+	const auto hash = UStringHash()(str);
+	return UAtom(lookup(shards[shardOf(hash)], str, hash));
+}
+
+inline size_t UAtomTable::size() const noexcept
+{
+	size_t res = 0;
+	for (auto& shard : shards)
+		res += shard.count.load(std::memory_order_relaxed);
+	return res;
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef UCASEMAP_HPP
+#define UCASEMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "usimd.hpp"
+#include "uunicode_data.hpp"
+#include "uutf.hpp"
+#include "usearch.hpp"
+
+//full unicode case mapping and case folding of utf-16 (SpecialCasing.txt, CaseFolding.txt):
+//a mapping may change the length (U+00DF -> "SS"), surrogate pairs are mapped as one code point
+//and capital sigma lowers to the final form at the end of a word. language specific rules (tr, lt) are not applied.
+//ascii blocks are mapped 8 (SSE2) or 16 (AVX2) units at a time
+namespace ustring_detail
+{
+	enum class CaseMap : uint8_t
+	{
+		Upper,
+		Lower,
+		Fold
+	};
+
+	constexpr const SpecialCase* findSpecialCase(char16_t c) noexcept
+	{
+		const auto end = caseSpecials + std::size(caseSpecials);
+		const auto res = std::lower_bound(caseSpecials, end, c, [](const SpecialCase& special, char16_t c) { return special.unit < c; });
+		return res != end && res->unit == c ? res : nullptr;
+	}
+
+	//Final_Sigma: a cased letter before src[i] and none after it, case-ignorable code points skipped on both sides
+	template <class Unit>
+	constexpr bool isFinalSigma(const Unit* src, size_t count, size_t i) noexcept
+	{
+		auto casedNear = [&](size_t j, bool before)
+			{
+				while (before ? j > 0 : j < count)
+				{
+					size_t length = 1;
+					const auto cp = before ? codePointBefore(src, j, length) : codePointAt(src, count, j, length);
+					const auto flags = unicodePropsOfCodePoint(cp).flags;
+					if ((flags & unicodeFlagCaseIgnorable) == 0)
+						return (flags & unicodeFlagCased) != 0;
+					j = before ? j - length : j + length;
+				}
+				return false;
+			};
+		return casedNear(i, true) && casedNear(i + 1, false) == false;
+	}
+
+	//maps the code point at src[i] into out (up to 3 units), returns the units written.
+	//read is set to the units of src taken: 2 for a surrogate pair, else 1
+	template <class Unit>
+	constexpr size_t mapCaseAt(const Unit* src, size_t count, size_t i, CaseMap mode, char16_t* out, size_t& read) noexcept
+	{
+		const char16_t c = src[i];
+		read = 1;
+		if (isSurrogate(c))
+		{
+			size_t length = 1;
+			const auto cp = codePointAt(src, count, i, length);
+			if (length == 1)
+			{
+				out[0] = c;
+				return 1;
+			}
+			//supplementary mappings stay in the plane and are never special
+			const auto& props = unicodePropsOfCodePoint(cp);
+			const char32_t mapped = (cp & 0xFF0000) | char16_t(cp + (mode == CaseMap::Upper ? props.upperDelta : props.lowerDelta));
+			out[0] = char16_t(0xD800 + ((mapped - 0x10000) >> 10));
+			out[1] = char16_t(0xDC00 + ((mapped - 0x10000) & 0x3FF));
+			read = 2;
+			return 2;
+		}
+
+		const auto& props = unicodePropsOf(c);
+		if (props.flags & unicodeFlagSpecialCase)
+		{
+			const auto special = findSpecialCase(c);
+			const auto units = mode == CaseMap::Upper ? special->upper : mode == CaseMap::Lower ? special->lower : special->fold;
+			size_t length = 0;
+			for (; length < 3 && units[length] != 0; ++length)
+				out[length] = units[length];
+			return length;
+		}
+		if (c == 0x03A3 && mode == CaseMap::Lower && isFinalSigma(src, count, i))
+		{
+			out[0] = 0x03C2;
+			return 1;
+		}
+		out[0] = char16_t(c + (mode == CaseMap::Upper ? props.upperDelta : props.lowerDelta));
+		return 1;
+	}
+
+	constexpr char16_t asciiUpper(char16_t c) noexcept { return (c >= 'a' && c <= 'z') ? c & ~0x20 : c; }
+
+#if defined(USTRING_SSE2)
+	inline __m128i asciiCaseSse2(__m128i v, bool upper) noexcept
+	{
+		//signed compares: units >= 0x8000 are negative and never letters
+		const char16_t first = upper ? 'a' : 'A';
+		const __m128i letters = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(short(first - 1))), _mm_cmpgt_epi16(_mm_set1_epi16(short(first + 26)), v));
+		return _mm_xor_si128(v, _mm_and_si128(letters, _mm_set1_epi16(0x20)));
+	}
+
+	USTRING_TARGET_AVX2 inline size_t mapAsciiCaseAvx2(const char16_t* src, size_t count, char16_t* dst, bool upper) noexcept
+	{
+		const char16_t first = upper ? 'a' : 'A';
+		const __m256i below = _mm256_set1_epi16(short(first - 1)), above = _mm256_set1_epi16(short(first + 26));
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+			if (_mm256_testz_si256(v, _mm256_set1_epi16((short)0xFF80)) == 0)
+				break;
+			const __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi16(v, below), _mm256_cmpgt_epi16(above, v));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(v, _mm256_and_si256(letters, _mm256_set1_epi16(0x20))));
+		}
+		return i;
+	}
+#endif
+
+	//maps the leading ascii units of src into dst (may be src), returns their count
+	inline size_t mapAsciiCase(const char16_t* src, size_t count, char16_t* dst, bool upper) noexcept
+	{
+		size_t i = 0;
+#if defined(USTRING_SSE2)
+		if (count >= 16 && hasAvx2())
+			i = mapAsciiCaseAvx2(src, count, dst, upper);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+			if (isAsciiSse2(v) == false)
+				break;
+			_mm_storeu_si128((__m128i*)(dst + i), asciiCaseSse2(v, upper));
+		}
+#endif
+		for (; i < count && src[i] < 0x80; ++i)
+			dst[i] = upper ? asciiUpper(src[i]) : asciiLower(src[i]);
+		return i;
+	}
+
+	//units of the mapped string from src[first], src before it is the context of a final sigma
+	template <class Unit>
+	constexpr size_t caseMappedLength(const Unit* src, size_t count, size_t first, CaseMap mode) noexcept
+	{
+		//only special mappings change the length
+		size_t res = count - first;
+		size_t i = first;
+#if defined(USTRING_SSE2)
+		if (std::is_constant_evaluated() == false)
+		{
+			for (; i + 8 <= count; i += 8)
+				if (isAsciiSse2(_mm_loadu_si128((const __m128i*)(src + i))) == false)
+					break;
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			const char16_t c = src[i];
+			if (c >= 0x80 && (unicodePropsOf(c).flags & unicodeFlagSpecialCase) != 0)
+			{
+				char16_t units[3];
+				size_t read = 1;
+				res += mapCaseAt(src, count, i, mode, units, read) - 1;
+			}
+		}
+		return res;
+	}
+
+	//maps src[first...] to dst, returns the units of src mapped. without grow it stops at the first mapping
+	//longer than its source (U+00DF -> "SS"): the units before it are mapped one to one, so the string is mapped
+	//in one pass into a buffer of its own size, and caseMappedLength is only needed for the rest of it.
+	//no mapping shortens, so dst may be src: a unit is read before it is written,
+	//and the context of a final sigma stays cased when lowered
+	template <class Unit>
+	constexpr size_t mapCase(const Unit* src, size_t count, size_t first, Unit* dst, CaseMap mode, bool grow = true) noexcept
+	{
+		const bool upper = mode == CaseMap::Upper;
+		size_t i = first, j = 0;
+		while (i < count)
+		{
+			const char16_t c = src[i];
+			if (c < 0x80)
+			{
+				//single ascii units between other letters stay in this loop
+				if (std::is_constant_evaluated() == false && count - i >= 8 && src[i + 1] < 0x80)
+				{
+					const auto ascii = mapAsciiCase((const char16_t*)src + i, count - i, (char16_t*)dst + j, upper);
+					i += ascii;
+					j += ascii;
+				}
+				else
+				{
+					dst[j++] = upper ? asciiUpper(c) : asciiLower(c);
+					++i;
+				}
+				continue;
+			}
+
+			//most units map to one by the simple delta
+			const auto& props = unicodePropsOf(c);
+			if ((props.flags & unicodeFlagSpecialCase) == 0 && isSurrogate(c) == false && c != 0x03A3)
+			{
+				dst[j++] = char16_t(c + (upper ? props.upperDelta : props.lowerDelta));
+				++i;
+				continue;
+			}
+			char16_t units[3];
+			size_t read = 1;
+			const auto length = mapCaseAt(src, count, i, mode, units, read);
+			if (length > read && grow == false)
+				break;
+			for (size_t k = 0; k < length; ++k)
+				dst[j + k] = units[k];
+			i += read;
+			j += length;
+		}
+		return i - first;
+	}
+}
+
+#endif
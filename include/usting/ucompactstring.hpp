@@ -0,0 +1,233 @@
+#ifndef UCOMPACTSTRING_HPP
+#define UCOMPACTSTRING_HPP
+
+#include <string>
+#include <string_view>
+#include <cstring>
+
+#include "ustring.hpp"
+
+//string keeping one byte per code unit while all of them are <= 0xFF (latin-1), like latin-1 QString data
+//or CPython compact strings. the first wider unit widens it to utf-16 for good.
+//UString can not switch its storage because it exposes its UChar buffer, so access here is read-only by value
+class UCompactString
+{
+	std::string latin;
+	UString wide;
+	bool compact = true;
+
+	void widen();
+
+public:
+	UCompactString() noexcept = default;
+	UCompactString(const char* latin) : latin(latin) {}
+	explicit UCompactString(std::string_view latin) : latin(latin) {}
+	explicit UCompactString(std::string&& latin) noexcept : latin(std::move(latin)) {}
+	//compact if every unit of str is <= 0xFF
+	explicit UCompactString(UStringView str);
+
+	bool isCompact() const noexcept { return compact; }
+	size_t size() const noexcept { return compact ? latin.size() : wide.size(); }
+	bool empty() const noexcept { return size() == 0; }
+	//memory taken by the characters
+	size_t byteSize() const noexcept { return compact ? latin.size() : wide.size() * sizeof(UChar); }
+
+	//storage access: latinView is valid while compact, wideView when not
+	std::string_view latinView() const noexcept { return latin; }
+	UStringView wideView() const noexcept { return wide; }
+
+	UChar operator[](size_t ind) const noexcept { return compact ? UChar(char16_t((unsigned char)latin[ind])) : wide[ind]; }
+	UChar at(size_t ind) const { return compact ? UChar(char16_t((unsigned char)latin.at(ind))) : wide.at(ind); }
+	//widens if c is above 0xFF
+	void set(size_t ind, UChar c);
+
+	void reserve(size_t count) { compact ? latin.reserve(count) : wide.reserve(count); }
+	void clear() noexcept;
+
+	UCompactString& operator+=(UChar c);
+	UCompactString& operator+=(std::string_view latin);
+	UCompactString& operator+=(const char* latin) { return operator+=(std::string_view(latin)); }
+	UCompactString& operator+=(UStringView str);
+
+	size_t find(UChar c, size_t off = 0) const noexcept;
+	size_t find(std::string_view latin, size_t off = 0) const;
+	size_t find(UStringView str, size_t off = 0) const;
+
+	bool contains(UChar c) const noexcept { return find(c) != UString::npos; }
+	bool contains(std::string_view latin) const { return find(latin) != UString::npos; }
+	bool contains(UStringView str) const { return find(str) != UString::npos; }
+
+	//a copy when compact, units above 0xFF are skipped otherwise
+	std::string toLatin() const { return compact ? latin : wide.toLatin(); }
+	UString toUString() const { return compact ? UString::fromLatin(latin) : wide; }
+	std::string toUtf8() const;
+
+	friend bool operator==(const UCompactString& str0, const UCompactString& str1) noexcept;
+	friend bool operator==(const UCompactString& str0, std::string_view latin) noexcept;
+	friend bool operator==(const UCompactString& str0, const char* latin) noexcept { return str0 == std::string_view(latin); }
+	friend bool operator==(const UCompactString& str0, UStringView str1) noexcept;
+};
+
+inline UCompactString::UCompactString(UStringView str)
+{
+	latin.resize(str.size());
+	if (ustring_detail::narrowLatin1((const char16_t*)str.data(), str.size(), latin.data()) != str.size())
+	{
+		latin = std::string();
+		wide = UString(str);
+		compact = false;
+	}
+}
+
+inline void UCompactString::widen()
+{
+	wide = UString::fromLatin(latin);
+	latin = std::string();
+	compact = false;
+}
+
+inline void UCompactString::set(size_t ind, UChar c)
+{
+	if (compact && c > 0xFF)
+		widen();
+
+	if (compact)
+		latin[ind] = (char)c.toCode();
+	else
+		wide[ind] = c;
+}
+
+inline void UCompactString::clear() noexcept
+{
+	latin.clear();
+	wide.clear();
+	compact = true;
+}
+
+inline UCompactString& UCompactString::operator+=(UChar c)
+{
+	if (compact && c > 0xFF)
+		widen();
+
+	if (compact)
+		latin.push_back((char)c.toCode());
+	else
+		wide += c;
+	return *this;
+}
+
+inline UCompactString& UCompactString::operator+=(std::string_view str)
+{
+	if (compact)
+		latin += str;
+	else
+		wide += UString::fromLatin(str);
+	return *this;
+}
+
+inline UCompactString& UCompactString::operator+=(UStringView str)
+{
+	if (compact == false)
+	{
+		wide += str;
+		return *this;
+	}
+
+	const auto oldSize = latin.size();
+	latin.resize(oldSize + str.size());
+	const auto count = ustring_detail::narrowLatin1((const char16_t*)str.data(), str.size(), latin.data() + oldSize);
+	if (count != str.size())
+	{
+		latin.resize(oldSize + count);
+		widen();
+		wide += str.substr(count);
+	}
+	return *this;
+}
+
+inline size_t UCompactString::find(UChar c, size_t off) const noexcept
+{
+	if (compact == false)
+		return wide.find(c, off);
+	if (c > 0xFF || off >= latin.size())
+		return UString::npos;
+
+	const auto ptr = (const char*)std::memchr(latin.data() + off, c.toCode(), latin.size() - off);
+	return ptr ? ptr - latin.data() : UString::npos;
+}
+
+inline size_t UCompactString::find(std::string_view str, size_t off) const
+{
+	if (compact)
+		return str.empty() ? UString::npos : latin.find(str, off);
+	return wide.find(UString::fromLatin(str), off);
+}
+
+inline size_t UCompactString::find(UStringView str, size_t off) const
+{
+	if (compact == false)
+		return wide.find(str, off);
+
+	//a needle with units above 0xFF can not be in latin-1 text
+	std::string needle(str.size(), '\0');
+	if (ustring_detail::narrowLatin1((const char16_t*)str.data(), str.size(), needle.data()) != str.size())
+		return UString::npos;
+	return find(std::string_view(needle), off);
+}
+
+inline std::string UCompactString::toUtf8() const
+{
+	if (compact == false)
+		return wide.toStringUtf8();
+
+	//0x80..0xFF take two bytes
+	size_t highCount = 0;
+	for (auto c : latin)
+		highCount += (unsigned char)c >> 7;
+	if (highCount == 0)
+		return latin;
+
+	std::string res;
+	res.reserve(latin.size() + highCount);
+	for (auto c : latin)
+	{
+		const auto unit = (unsigned char)c;
+		if (unit < 0x80)
+		{
+			res.push_back(c);
+		}
+		else
+		{
+			res.push_back(char(0xC0 | (unit >> 6)));
+			res.push_back(char(0x80 | (unit & 0x3F)));
+		}
+	}
+	return res;
+}
+
+inline bool operator==(const UCompactString& str0, const UCompactString& str1) noexcept
+{
+	if (str0.compact && str1.compact)
+		return str0.latin == str1.latin;
+	if (str0.compact)
+		return str1 == std::string_view(str0.latin);
+	if (str1.compact)
+		return str0 == std::string_view(str1.latin);
+	return UStringView(str0.wide) == UStringView(str1.wide);
+}
+
+inline bool operator==(const UCompactString& str0, std::string_view latin) noexcept
+{
+	if (str0.compact)
+		return std::string_view(str0.latin) == latin;
+	return str0.wide.size() == latin.size() && ustring_detail::equalLatin1((const char16_t*)str0.wide.data(), latin.data(), latin.size());
+}
+
+inline bool operator==(const UCompactString& str0, UStringView str1) noexcept
+{
+	if (str0.compact == false)
+		return UStringView(str0.wide) == str1;
+	return str0.latin.size() == str1.size() && ustring_detail::equalLatin1((const char16_t*)str1.data(), str0.latin.data(), str1.size());
+}
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef UFILE_HPP
+#define UFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <filesystem>
+#include <system_error>
+
+#include "ustring.hpp"
+
+//on windows <windows.h> is included as it is: define NOMINMAX before this header to keep out its min and max macros,
+//the code here does not depend on them either way
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+//read-only file mapping and byte order marks, for loading text files without an intermediate copy
+namespace ustring_detail
+{
+	//a whole file mapped for reading, an empty file is not mapped
+	class MappedFile
+	{
+		const char* ptr = nullptr;
+		size_t count = 0;
+
+		[[noreturn]] static void throwMapError(const std::filesystem::path& path, std::error_code code)
+		{
+			throw std::filesystem::filesystem_error("UString: cannot map file", path, code);
+		}
+
+		void unmap() noexcept
+		{
+			if (ptr == nullptr)
+				return;
+#if defined(_WIN32)
+			UnmapViewOfFile(ptr);
+#else
+			munmap((void*)ptr, count);
+#endif
+			ptr = nullptr;
+			count = 0;
+		}
+
+	public:
+		MappedFile() noexcept = default;
+		explicit MappedFile(const std::filesystem::path& path);
+		MappedFile(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept : ptr(std::exchange(other.ptr, nullptr)), count(std::exchange(other.count, 0)) {}
+		~MappedFile() { unmap(); }
+
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile& operator=(MappedFile&& other) noexcept
+		{
+			if (this != &other)
+			{
+				unmap();
+				ptr = std::exchange(other.ptr, nullptr);
+				count = std::exchange(other.count, 0);
+			}
+			return *this;
+		}
+
+		const char* data() const noexcept { return ptr; }
+		size_t size() const noexcept { return count; }
+	};
+
+#if defined(_WIN32)
+	inline MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			throwMapError(path, std::error_code(int(GetLastError()), std::system_category()));
+
+		LARGE_INTEGER fileSize{};
+		if (GetFileSizeEx(file, &fileSize) == FALSE)
+		{
+			const auto error = GetLastError();
+			CloseHandle(file);
+			throwMapError(path, std::error_code(int(error), std::system_category()));
+		}
+		if (uint64_t(fileSize.QuadPart) > (std::numeric_limits<size_t>::max)())
+		{
+			CloseHandle(file);
+			throwMapError(path, std::make_error_code(std::errc::file_too_large));
+		}
+		if (fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return;
+		}
+
+		//the view keeps the file open, the handles are not needed after it is made
+		const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const auto view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		const auto error = GetLastError();
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+		CloseHandle(file);
+		if (view == nullptr)
+			throwMapError(path, std::error_code(int(error), std::system_category()));
+		ptr = (const char*)view;
+		count = size_t(fileSize.QuadPart);
+	}
+#else
+	inline MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			throwMapError(path, std::error_code(errno, std::generic_category()));
+
+		struct stat info{};
+		if (fstat(fd, &info) != 0)
+		{
+			const int error = errno;
+			close(fd);
+			throwMapError(path, std::error_code(error, std::generic_category()));
+		}
+		if (uint64_t(info.st_size) > (std::numeric_limits<size_t>::max)())
+		{
+			close(fd);
+			throwMapError(path, std::make_error_code(std::errc::file_too_large));
+		}
+		if (info.st_size == 0)
+		{
+			close(fd);
+			return;
+		}
+
+		//the mapping keeps the file open
+		const auto view = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		const int error = errno;
+		close(fd);
+		if (view == MAP_FAILED)
+			throwMapError(path, std::error_code(error, std::generic_category()));
+		//text is read front to back, the kernel can read ahead further
+		madvise(view, size_t(info.st_size), MADV_SEQUENTIAL);
+		ptr = (const char*)view;
+		count = size_t(info.st_size);
+	}
+#endif
+
+	//encoding given by the byte order mark at the start of src, Auto if there is none. bom is set to its length
+	constexpr UTextEncoding encodingOfBom(const char* src, size_t count, size_t& bom) noexcept
+	{
+		const auto ptr = (const unsigned char*)src;
+		bom = 0;
+		if (count >= 3 && ptr[0] == 0xEF && ptr[1] == 0xBB && ptr[2] == 0xBF)
+			bom = 3;
+		else if (count >= 2 && ptr[0] == 0xFF && ptr[1] == 0xFE)
+			bom = 2;
+		else if (count >= 2 && ptr[0] == 0xFE && ptr[1] == 0xFF)
+			bom = 2;
+		else
+			return UTextEncoding::Auto;
+		return bom == 3 ? UTextEncoding::Utf8 : ptr[0] == 0xFF ? UTextEncoding::Utf16LE : UTextEncoding::Utf16BE;
+	}
+
+	//resolves Auto, bom is set to the length of a byte order mark of the encoding to skip
+	constexpr UTextEncoding detectEncoding(const char* src, size_t count, UTextEncoding encoding, size_t& bom) noexcept
+	{
+		const auto found = encodingOfBom(src, count, bom);
+		if (encoding == UTextEncoding::Auto)
+			return found == UTextEncoding::Auto ? UTextEncoding::Utf8 : found;
+		if (found != encoding)
+			bom = 0;
+		return encoding;
+	}
+
+	//copies count utf-16 units from bytes in the given order, src needs no alignment
+	inline void loadUtf16(const char* src, size_t count, char16_t* dst, bool bigEndian) noexcept
+	{
+		size_t i = 0;
+		if (bigEndian == (std::endian::native == std::endian::big))
+		{
+			std::copy(src, src + count * 2, (char*)dst);
+			return;
+		}
+#if defined(USTRING_SSE2)
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i * 2));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+		}
+#endif
+		const auto bytes = (const unsigned char*)src;
+		for (; i < count; ++i)
+			dst[i] = bigEndian ? char16_t((bytes[i * 2] << 8) | bytes[i * 2 + 1]) : char16_t(bytes[i * 2] | (bytes[i * 2 + 1] << 8));
+	}
+}
+
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromFile(const std::filesystem::path& path, UTextEncoding encoding, const Alloc& alloc)
+{
+	const ustring_detail::MappedFile file(path);
+	size_t bom = 0;
+	encoding = ustring_detail::detectEncoding(file.data(), file.size(), encoding, bom);
+	const auto src = file.data() + bom;
+	const auto count = file.size() - bom;
+
+	BasicUString res(alloc);
+	switch (encoding)
+	{
+	case UTextEncoding::Utf16LE:
+	case UTextEncoding::Utf16BE:
+		if (count % 2 != 0)
+			ustring_detail::throwInvalidUtf16();
+		res.resize(count / 2);
+		ustring_detail::loadUtf16(src, count / 2, (char16_t*)res.data(), encoding == UTextEncoding::Utf16BE);
+		break;
+	case UTextEncoding::Latin1:
+		res.resize(count);
+		ustring_detail::widenLatin1(src, count, (char16_t*)res.data());
+		break;
+	default:
+		res.resize(ustring_detail::utf16LengthOfUtf8(src, count));
+		ustring_detail::utf8ToUtf16(src, count, (char16_t*)res.data());
+		break;
+	}
+	return res;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef UFORMATTEMPLATE_HPP
+#define UFORMATTEMPLATE_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include "ustring.hpp"
+
+//pattern with Qt-style placeholders parsed once, for messages formatted many times:
+//UFormatTemplate tpl(UString("%1 of %2 files copied")); ... tpl.arg(done, total);
+//placeholders are matched with arguments as in UString::arg
+class UFormatTemplate
+{
+	//a literal run of the pattern, or a placeholder with the index of its argument
+	struct Segment
+	{
+		uint32_t offset;
+		uint32_t size;
+		int8_t rank;
+	};
+
+	UString pattern;
+	std::vector<Segment> segments;
+	size_t placeholders = 0;
+
+public:
+	explicit UFormatTemplate(UStringView pattern);
+
+	//distinct placeholder numbers, the count of arguments used
+	size_t placeholderCount() const noexcept { return placeholders; }
+	UStringView view() const noexcept { return pattern; }
+
+	template <class... Args> requires (std::constructible_from<ustring_detail::FormatArg, const Args&> && ...)
+	UString arg(const Args&... args) const
+	{
+		UString res;
+		appendTo(res, args...);
+		return res;
+	}
+
+	//formats into the end of str, it grows once. an argument viewing str is formatted apart first, then appended
+	template <class Alloc, class... Args> requires (std::constructible_from<ustring_detail::FormatArg, const Args&> && ...)
+	BasicUString<Alloc>& appendTo(BasicUString<Alloc>& str, const Args&... args) const;
+};
+
+inline UFormatTemplate::UFormatTemplate(UStringView pattern) : pattern(pattern)
+{
+	const auto ptr = pattern.data();
+	const auto count = pattern.size();
+
+	bool present[100]{};
+	size_t length = 0;
+	size_t literal = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (const auto number = ustring_detail::placeholderAt(ptr, count, i, length); number != 0)
+		{
+			if (literal != i)
+				segments.push_back({ uint32_t(literal), uint32_t(i - literal), -1 });
+			//the number until ranks are known
+			segments.push_back({ uint32_t(i), uint32_t(length), int8_t(number) });
+			present[number] = true;
+			i += length - 1;
+			literal = i + 1;
+		}
+	}
+	if (literal != count)
+		segments.push_back({ uint32_t(literal), uint32_t(count - literal), -1 });
+
+	int8_t ranks[100];
+	ustring_detail::rankPlaceholders(present, 100, ranks);
+	for (auto& segment : segments)
+		if (segment.rank > 0)
+			segment.rank = ranks[segment.rank];
+	for (bool used : present)
+		placeholders += used;
+}
+
+template <class Alloc, class... Args> requires (std::constructible_from<ustring_detail::FormatArg, const Args&> && ...)
+inline BasicUString<Alloc>& UFormatTemplate::appendTo(BasicUString<Alloc>& str, const Args&... args) const
+{
+	//one unused argument keeps the array valid without arguments
+	const ustring_detail::FormatArg argList[] = { ustring_detail::FormatArg(args)..., ustring_detail::FormatArg(UStringView()) };
+	constexpr size_t argCount = sizeof...(Args);
+
+	//str.resize would free the units a view of str points to before they are copied
+	for (auto& arg : argList)
+	{
+		if (arg.reads(str.data(), str.data() + str.size()))
+		{
+			BasicUString<Alloc> part(str.getAllocator());
+			appendTo(part, args...);
+			return str += part;
+		}
+	}
+
+	size_t resSize = 0;
+	for (auto& segment : segments)
+		resSize += segment.rank >= 0 && size_t(segment.rank) < argCount ? argList[segment.rank].size() : segment.size;
+
+	const auto oldSize = str.size();
+	str.resize(oldSize + resSize);
+	auto out = str.data() + oldSize;
+	const auto ptr = pattern.data();
+	for (auto& segment : segments)
+	{
+		if (segment.rank >= 0 && size_t(segment.rank) < argCount)
+			argList[segment.rank].write(out);
+		else
+			out = std::copy(ptr + segment.offset, ptr + segment.offset + segment.size, out);
+	}
+	return str;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef UGRAPHEME_HPP
+#define UGRAPHEME_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "uunicode_data.hpp"
+#include "uutf.hpp"
+
+//extended grapheme clusters (UAX #29): the user-perceived characters a string is cut at,
+//a letter with its combining marks, a hangul syllable of jamo, an emoji zwj sequence or a flag
+namespace ustring_detail
+{
+	constexpr GraphemeBreak graphemeBreakOf(uint8_t props) noexcept { return GraphemeBreak(props & graphemeBreakMask); }
+
+	//end of the cluster starting at src[pos], pos < count
+	template <class Unit>
+	constexpr size_t graphemeEnd(const Unit* src, size_t count, size_t pos) noexcept
+	{
+		typedef GraphemeBreak B;
+
+		//ascii followed by ascii always breaks but for CR LF
+		if (pos + 1 < count && src[pos] < 0x80 && src[pos + 1] < 0x80)
+			return pos + (src[pos] == '\r' && src[pos + 1] == '\n' ? 2 : 1);
+
+		size_t length = 1;
+		auto props = graphemePropsOf(codePointAt(src, count, pos, length));
+		auto prev = graphemeBreakOf(props);
+		//GB11: the code points so far end with Extended_Pictographic Extend*, or with that and a ZWJ
+		bool pictographic = (props & graphemeFlagExtendedPictographic) != 0;
+		bool pictographicZwj = false;
+		//GB12, GB13: regional indicators pair up from the start of the cluster
+		size_t indicators = prev == B::RegionalIndicator;
+
+		size_t i = pos + length;
+		while (i < count)
+		{
+			if (src[i] < 0x80 && src[i - 1] < 0x80)
+			{
+				if (src[i - 1] == '\r' && src[i] == '\n')
+					++i;
+				return i;
+			}
+
+			props = graphemePropsOf(codePointAt(src, count, i, length));
+			const auto next = graphemeBreakOf(props);
+			const bool nextPictographic = (props & graphemeFlagExtendedPictographic) != 0;
+
+			bool join;
+			if (prev == B::CR || prev == B::LF || prev == B::Control)
+				join = prev == B::CR && next == B::LF;
+			else if (next == B::CR || next == B::LF || next == B::Control)
+				join = false;
+			else if (prev == B::L && (next == B::L || next == B::V || next == B::LV || next == B::LVT))
+				join = true;
+			else if ((prev == B::LV || prev == B::V) && (next == B::V || next == B::T))
+				join = true;
+			else if ((prev == B::LVT || prev == B::T) && next == B::T)
+				join = true;
+			else if (next == B::Extend || next == B::ZWJ || next == B::SpacingMark || prev == B::Prepend)
+				join = true;
+			else if (pictographicZwj && nextPictographic)
+				join = true;
+			else
+				join = prev == B::RegionalIndicator && next == B::RegionalIndicator && indicators % 2 == 1;
+			if (join == false)
+				break;
+
+			pictographicZwj = pictographic && next == B::ZWJ;
+			pictographic = nextPictographic || (pictographic && next == B::Extend);
+			indicators = next == B::RegionalIndicator ? indicators + 1 : 0;
+			prev = next;
+			i += length;
+		}
+		return i;
+	}
+
+	//offset after the first n code points, or count
+	template <class Unit>
+	constexpr size_t codePointsEnd(const Unit* src, size_t count, size_t n) noexcept
+	{
+		size_t i = 0;
+		for (; n != 0 && i < count; --n)
+			i += isHighSurrogate(src[i]) && i + 1 < count && isLowSurrogate(src[i + 1]) ? 2 : 1;
+		return i;
+	}
+
+	//offset after the first n grapheme clusters, or count
+	template <class Unit>
+	constexpr size_t graphemesEnd(const Unit* src, size_t count, size_t n) noexcept
+	{
+		size_t i = 0;
+		for (; n != 0 && i < count; --n)
+			i = graphemeEnd(src, count, i);
+		return i;
+	}
+}
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef UHASH_HPP
+#define UHASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "usimd.hpp"
+#include "usearch.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+//wyhash-style hash of utf-16 code units: 64-bit multiply-xor rounds over 4 units per word,
+//three independent lanes for long strings. sources give the units (raw, case folded or widened latin-1),
+//so equal unit sequences hash equal whatever they are stored as
+namespace ustring_detail
+{
+	constexpr uint64_t hashSecret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+	//a * b as 128 bits, low half in a and high half in b
+	constexpr void multiply128(uint64_t& a, uint64_t& b) noexcept
+	{
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128;
+		const uint128 res = uint128(a) * b;
+		a = uint64_t(res);
+		b = uint64_t(res >> 64);
+#else
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+		if (std::is_constant_evaluated() == false)
+		{
+			a = _umul128(a, b, &b);
+			return;
+		}
+#endif
+		const uint64_t aHi = a >> 32, aLo = uint32_t(a), bHi = b >> 32, bLo = uint32_t(b);
+		const uint64_t hiHi = aHi * bHi, hiLo = aHi * bLo, loHi = aLo * bHi, loLo = aLo * bLo;
+		const uint64_t mid = (loLo >> 32) + uint32_t(hiLo) + uint32_t(loHi);
+		a = (mid << 32) | uint32_t(loLo);
+		b = hiHi + (hiLo >> 32) + (loHi >> 32) + (mid >> 32);
+#endif
+	}
+
+	constexpr uint64_t hashMix(uint64_t a, uint64_t b) noexcept
+	{
+		multiply128(a, b);
+		return a ^ b;
+	}
+
+	//little endian word of units[0..3], the same on every platform
+	constexpr uint64_t hashWord(const char16_t* units) noexcept
+	{
+		return uint64_t(units[0]) | (uint64_t(units[1]) << 16) | (uint64_t(units[2]) << 32) | (uint64_t(units[3]) << 48);
+	}
+
+	//Source::load(off, count, out) writes units off..off+count-1 to out
+	template <class Source>
+	constexpr uint64_t hashUtf16(const Source& source, size_t count) noexcept
+	{
+		constexpr uint64_t initialSeed = hashMix(hashSecret[0], hashSecret[1]);
+		char16_t units[24]{};
+		uint64_t seed = initialSeed;
+		size_t i = 0;
+
+		if (count > 24)
+		{
+			uint64_t seed1 = seed, seed2 = seed;
+			for (; count - i > 24; i += 24)
+			{
+				source.load(i, 24, units);
+				seed = hashMix(hashWord(units) ^ hashSecret[1], hashWord(units + 4) ^ seed);
+				seed1 = hashMix(hashWord(units + 8) ^ hashSecret[2], hashWord(units + 12) ^ seed1);
+				seed2 = hashMix(hashWord(units + 16) ^ hashSecret[3], hashWord(units + 20) ^ seed2);
+			}
+			seed ^= seed1 ^ seed2;
+		}
+		for (; count - i > 8; i += 8)
+		{
+			source.load(i, 8, units);
+			seed = hashMix(hashWord(units) ^ hashSecret[1], hashWord(units + 4) ^ seed);
+		}
+
+		//last units, overlapping reads instead of padding: the length is mixed in at the end
+		uint64_t a = 0, b = 0;
+		if (count >= 8)
+		{
+			source.load(count - 8, 8, units);
+			a = hashWord(units);
+			b = hashWord(units + 4);
+		}
+		else if (count >= 4)
+		{
+			source.load(0, 4, units);
+			source.load(count - 4, 4, units + 4);
+			a = hashWord(units);
+			b = hashWord(units + 4);
+		}
+		else if (count > 0)
+		{
+			source.load(0, 1, units);
+			source.load(count / 2, 1, units + 1);
+			source.load(count - 1, 1, units + 2);
+			a = (uint64_t(units[0]) << 32) | (uint64_t(units[1]) << 16) | units[2];
+		}
+
+		a ^= hashSecret[1];
+		b ^= seed;
+		multiply128(a, b);
+		return hashMix(a ^ hashSecret[0] ^ (count * 2), b ^ hashSecret[1]);
+	}
+
+	//Unit is char16_t or a 16-bit type converting to it (UChar)
+	template <class Unit>
+	struct HashUnits
+	{
+		const Unit* ptr;
+
+		constexpr void load(size_t off, size_t count, char16_t* out) const noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+				out[i] = char16_t(ptr[off + i]);
+		}
+	};
+
+	template <class Unit>
+	struct HashFoldedUnits
+	{
+		const Unit* ptr;
+
+		constexpr void load(size_t off, size_t count, char16_t* out) const noexcept
+		{
+			size_t i = 0;
+#if defined(USTRING_SSE2)
+			if (std::is_constant_evaluated() == false)
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					const __m128i v = _mm_loadu_si128((const __m128i*)(ptr + off + i));
+					if (isAsciiSse2(v) == false)
+						break;
+					_mm_storeu_si128((__m128i*)(out + i), asciiLowerSse2(v));
+				}
+			}
+#endif
+			for (; i < count; ++i)
+				out[i] = foldCase(char16_t(ptr[off + i]));
+		}
+	};
+
+	//latin-1 bytes are the code units of the same value
+	template <bool ignoreCase>
+	struct HashLatin1
+	{
+		const char* ptr;
+
+		constexpr void load(size_t off, size_t count, char16_t* out) const noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const char16_t unit = (unsigned char)ptr[off + i];
+				out[i] = ignoreCase ? foldCase(unit) : unit;
+			}
+		}
+	};
+
+	template <class Unit>
+	constexpr size_t hashUtf16(const Unit* ptr, size_t count, bool ignoreCase) noexcept
+	{
+		return size_t(ignoreCase ? hashUtf16(HashFoldedUnits<Unit>{ ptr }, count) : hashUtf16(HashUnits<Unit>{ ptr }, count));
+	}
+
+	constexpr size_t hashLatin1(const char* ptr, size_t count, bool ignoreCase) noexcept
+	{
+		return size_t(ignoreCase ? hashUtf16(HashLatin1<true>{ ptr }, count) : hashUtf16(HashLatin1<false>{ ptr }, count));
+	}
+}
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef ULATIN1_HPP
+#define ULATIN1_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "usimd.hpp"
+
+//latin-1 (iso-8859-1) kernels: a byte is the code unit of the same value,
+//so widening is a zero extension and narrowing works while units are <= 0xFF
+namespace ustring_detail
+{
+	constexpr void widenLatin1Scalar(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			dst[i] = (unsigned char)src[i];
+	}
+
+	constexpr size_t narrowLatin1Scalar(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		size_t i = 0;
+		for (; i < count && src[i] <= 0xFF; ++i)
+			dst[i] = (char)src[i];
+		return i;
+	}
+
+	constexpr size_t latin1PrefixScalar(const char16_t* src, size_t count) noexcept
+	{
+		size_t i = 0;
+		for (; i < count && src[i] <= 0xFF; ++i);
+		return i;
+	}
+
+	constexpr bool equalLatin1Scalar(const char16_t* str, const char* latin, size_t count) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			if (str[i] != (unsigned char)latin[i])
+				return false;
+		return true;
+	}
+
+#if defined(USTRING_SSE2)
+	//the 16 byte loops are kept out of line: inlined into a call on a short literal, gcc reports
+	//the loads as out of bounds of the literal although the loop never runs for it.
+	//they return the bytes done, a multiple of 16
+	USTRING_NOINLINE inline size_t widenLatin1Blocks(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+		}
+		return i;
+	}
+
+	inline void widenLatin1Sse2(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		const size_t i = count >= 16 ? widenLatin1Blocks(src, count, dst) : 0;
+		widenLatin1Scalar(src + i, count - i, dst + i);
+	}
+
+	USTRING_TARGET_AVX2 inline void widenLatin1Avx2(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+			_mm256_storeu_si256((__m256i*)(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+		}
+		widenLatin1Sse2(src + i, count - i, dst + i);
+	}
+
+	inline size_t narrowLatin1Sse2(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		const __m128i high = _mm_set1_epi16((short)0xFF00);
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+			const __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 8));
+			const __m128i test = _mm_and_si128(_mm_or_si128(lo, hi), high);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(test, zero)) != 0xFFFF)
+				break;
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+		}
+		return i + narrowLatin1Scalar(src + i, count - i, dst + i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t narrowLatin1Avx2(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		const __m256i high = _mm256_set1_epi16((short)0xFF00);
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i lo = _mm256_loadu_si256((const __m256i*)(src + i));
+			const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+			if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), high))
+				break;
+			//packus works per 128-bit lane, permute restores the order
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8));
+		}
+		return i + narrowLatin1Sse2(src + i, count - i, dst + i);
+	}
+
+	inline size_t latin1PrefixSse2(const char16_t* src, size_t count) noexcept
+	{
+		const __m128i high = _mm_set1_epi16((short)0xFF00);
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v = _mm_or_si128(_mm_loadu_si128((const __m128i*)(src + i)), _mm_loadu_si128((const __m128i*)(src + i + 8)));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero)) != 0xFFFF)
+				break;
+		}
+		return i + latin1PrefixScalar(src + i, count - i);
+	}
+
+	//stops at the first block that differs
+	USTRING_NOINLINE inline size_t equalLatin1Blocks(const char16_t* str, const char* latin, size_t count) noexcept
+	{
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(latin + i));
+			const __m128i lo = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(str + i)), _mm_unpacklo_epi8(v, zero));
+			const __m128i hi = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(str + i + 8)), _mm_unpackhi_epi8(v, zero));
+			if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF)
+				break;
+		}
+		return i;
+	}
+
+	inline bool equalLatin1Sse2(const char16_t* str, const char* latin, size_t count) noexcept
+	{
+		const size_t i = count >= 16 ? equalLatin1Blocks(str, latin, count) : 0;
+		return equalLatin1Scalar(str + i, latin + i, count - i);
+	}
+#endif
+
+	inline void widenLatin1(const char* src, size_t count, char16_t* dst) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (count >= 32 && hasAvx2())
+			return widenLatin1Avx2(src, count, dst);
+		widenLatin1Sse2(src, count, dst);
+#else
+		widenLatin1Scalar(src, count, dst);
+#endif
+	}
+
+	//narrows the leading run of units <= 0xFF, returns its length
+	inline size_t narrowLatin1(const char16_t* src, size_t count, char* dst) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (count >= 32 && hasAvx2())
+			return narrowLatin1Avx2(src, count, dst);
+		return narrowLatin1Sse2(src, count, dst);
+#else
+		return narrowLatin1Scalar(src, count, dst);
+#endif
+	}
+
+	//length of the leading run of units <= 0xFF
+	inline size_t latin1Prefix(const char16_t* src, size_t count) noexcept
+	{
+#if defined(USTRING_SSE2)
+		return latin1PrefixSse2(src, count);
+#else
+		return latin1PrefixScalar(src, count);
+#endif
+	}
+
+	inline bool equalLatin1(const char16_t* str, const char* latin, size_t count) noexcept
+	{
+#if defined(USTRING_SSE2)
+		return equalLatin1Sse2(str, latin, count);
+#else
+		return equalLatin1Scalar(str, latin, count);
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef ULINEREADER_HPP
+#define ULINEREADER_HPP
+
+#include <string>
+#include <istream>
+#include <algorithm>
+#include <filesystem>
+
+#include "ustring.hpp"
+#include "uutf8codec.hpp"
+#include "ufile.hpp"
+
+//reads a text line by line from a mapped file or a stream (pipes, sockets), a block at a time:
+//ULineReader reader(path); UStringView line; while (reader.readLine(line)) { ... }
+//blocks are transcoded into one buffer that is reused, so memory stays bounded by a block and the longest line.
+//lines end with \n or \r\n, the last one may have no line break
+class ULineReader
+{
+	static constexpr size_t blockSize = 64 * 1024;
+
+	ustring_detail::MappedFile file;
+	size_t fileOffset = 0;
+	std::istream* in = nullptr;
+	std::string block;
+
+	UTextEncoding textEncoding;
+	UUtfErrorMode mode;
+	UUtf8Decoder decoder;
+	bool started = false;
+	bool ended = false;
+	//utf-16 byte held back at the end of a block
+	bool hasOddByte = false;
+	char oddByte = 0;
+
+	UString buffer;
+	size_t lineStart = 0;
+	//units from lineStart known to have no line break
+	size_t scanned = 0;
+	size_t lines = 0;
+
+	void decodeBlock(const char* src, size_t count);
+	void finishInput();
+	bool fill();
+
+public:
+	//the file is mapped, throws std::filesystem::filesystem_error if it can not be read
+	explicit ULineReader(const std::filesystem::path& path, UTextEncoding encoding = UTextEncoding::Auto, UUtfErrorMode mode = UUtfErrorMode::Replace)
+		: file(path), textEncoding(encoding), mode(mode), decoder(mode) {}
+	//in is read blockSize bytes at a time and must outlive the reader
+	explicit ULineReader(std::istream& in, UTextEncoding encoding = UTextEncoding::Auto, UUtfErrorMode mode = UUtfErrorMode::Replace)
+		: in(&in), textEncoding(encoding), mode(mode), decoder(mode) {}
+
+	ULineReader(const ULineReader&) = delete;
+	ULineReader& operator=(const ULineReader&) = delete;
+
+	//next line without its line break, valid until the next call. false at the end of the input
+	bool readLine(UStringView& line);
+
+	//lines read so far
+	size_t lineCount() const noexcept { return lines; }
+	//Auto until the first block is read
+	UTextEncoding encoding() const noexcept { return textEncoding; }
+};
+
+inline void ULineReader::decodeBlock(const char* src, size_t count)
+{
+	if (started == false)
+	{
+		size_t bom = 0;
+		textEncoding = ustring_detail::detectEncoding(src, count, textEncoding, bom);
+		src += bom;
+		count -= bom;
+		started = true;
+	}
+
+	switch (textEncoding)
+	{
+	case UTextEncoding::Utf16LE:
+	case UTextEncoding::Utf16BE:
+	{
+		const bool bigEndian = textEncoding == UTextEncoding::Utf16BE;
+		if (hasOddByte && count != 0)
+		{
+			const char unit[2] = { oddByte, *src };
+			char16_t c = 0;
+			ustring_detail::loadUtf16(unit, 1, &c, bigEndian);
+			buffer += UChar(c);
+			++src;
+			--count;
+			hasOddByte = false;
+		}
+		const auto oldSize = buffer.size();
+		buffer.resize(oldSize + count / 2);
+		ustring_detail::loadUtf16(src, count / 2, (char16_t*)buffer.data() + oldSize, bigEndian);
+		if (count % 2 != 0)
+		{
+			hasOddByte = true;
+			oddByte = src[count - 1];
+		}
+		break;
+	}
+	case UTextEncoding::Latin1:
+	{
+		const auto oldSize = buffer.size();
+		buffer.resize(oldSize + count);
+		ustring_detail::widenLatin1(src, count, (char16_t*)buffer.data() + oldSize);
+		break;
+	}
+	default:
+		decoder.decode(std::string_view(src, count), buffer);
+		break;
+	}
+}
+
+inline void ULineReader::finishInput()
+{
+	ended = true;
+	decoder.finish(buffer);
+	if (hasOddByte)
+	{
+		hasOddByte = false;
+		if (mode == UUtfErrorMode::Strict)
+			ustring_detail::throwInvalidUtf16();
+		buffer += UChar(char16_t(0xFFFD));
+	}
+}
+
+//drops the lines already read and appends the next block, false at the end of the input
+inline bool ULineReader::fill()
+{
+	if (ended)
+		return false;
+	if (lineStart != 0)
+	{
+		std::copy(buffer.begin() + lineStart, buffer.end(), buffer.begin());
+		buffer.resize(buffer.size() - lineStart);
+		lineStart = 0;
+	}
+
+	if (in != nullptr)
+	{
+		block.resize(blockSize);
+		in->read(block.data(), std::streamsize(blockSize));
+		const auto count = size_t(in->gcount());
+		if (count == 0)
+		{
+			finishInput();
+			return true;
+		}
+		decodeBlock(block.data(), count);
+	}
+	else
+	{
+		const auto count = (std::min)(blockSize, file.size() - fileOffset);
+		if (count == 0)
+		{
+			finishInput();
+			return true;
+		}
+		decodeBlock(file.data() + fileOffset, count);
+		fileOffset += count;
+	}
+	return true;
+}
+
+inline bool ULineReader::readLine(UStringView& line)
+{
+	do
+	{
+		const auto ptr = (const char16_t*)buffer.data();
+		const auto size = buffer.size();
+		if (const auto end = ustring_detail::findUnit(ptr, size, lineStart + scanned, u'\n'); end != ustring_detail::searchNpos)
+		{
+			const auto lineEnd = end > lineStart && ptr[end - 1] == u'\r' ? end - 1 : end;
+			line = UStringView(buffer.data() + lineStart, lineEnd - lineStart);
+			lineStart = end + 1;
+			scanned = 0;
+			++lines;
+			return true;
+		}
+		scanned = size - lineStart;
+	} while (fill());
+
+	//the last line has no line break
+	if (lineStart == buffer.size())
+		return false;
+	line = UStringView(buffer.data() + lineStart, buffer.size() - lineStart);
+	lineStart = buffer.size();
+	scanned = 0;
+	++lines;
+	return true;
+}
+
+#endif
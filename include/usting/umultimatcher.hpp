@@ -0,0 +1,355 @@
+#ifndef UMULTIMATCHER_HPP
+#define UMULTIMATCHER_HPP
+
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <ranges>
+#include <initializer_list>
+#include <algorithm>
+
+#include "ustring.hpp"
+
+//aho-corasick automaton built once from a set of patterns: every search is a single pass over the text
+//whatever the number of patterns. empty patterns never match, equal patterns report the first of them.
+//the automaton works on utf-16 code units, its alphabet is compressed to the units used by the patterns
+//and transitions are a flat table states x alphabet
+class UMultiMatcher
+{
+public:
+	struct Match
+	{
+		size_t pos;		//npos if there is no match
+		size_t size;
+		size_t pattern;	//index in the patterns given to the constructor
+
+		constexpr explicit operator bool() const noexcept { return pos != UString::npos; }
+	};
+
+private:
+	static constexpr uint32_t noState = uint32_t(-1);
+	static constexpr size_t noPattern = size_t(-1);
+	static constexpr unsigned blockShift = 8;
+
+	bool ignoreCase;
+
+	//code unit -> alphabet class (0 for units not in patterns), two-stage table with a shared zero block
+	uint16_t classBlocks[1 << (16 - blockShift)]{};
+	std::vector<uint16_t> classes;
+	uint32_t alphabetSize = 0;
+
+	std::vector<uint32_t> transitions;	//states x alphabetSize
+	std::vector<uint32_t> depth;
+	std::vector<size_t> stateOutput;	//pattern ending in a state or noPattern
+	std::vector<uint32_t> outputLink;	//nearest proper suffix state with an output
+	std::vector<size_t> patternSizes;
+
+	char16_t unitOf(UChar c) const noexcept { return ignoreCase ? ustring_detail::foldCase(c) : char16_t(c); }
+
+	uint32_t classOf(char16_t c) const noexcept
+	{
+		constexpr unsigned mask = (1u << blockShift) - 1;
+		return classes[(size_t(classBlocks[c >> blockShift]) << blockShift) | (c & mask)];
+	}
+
+	uint32_t step(uint32_t state, UChar c) const noexcept
+	{
+		const auto cls = classOf(unitOf(c));
+		return cls == 0 ? 0 : transitions[size_t(state) * alphabetSize + cls - 1];
+	}
+
+	void addPattern(UStringView pattern);
+	void build();
+
+	//calls onMatch(pos, size, pattern) for every match ending after off in order of their ends,
+	//stops when it returns false
+	template <class OnMatch>
+	void scan(UStringView text, size_t off, OnMatch onMatch) const;
+	//calls onMatch(pos, size, pattern) for the non-overlapping matches findFirst would give from the end
+	//of the previous one, in a single pass over the text
+	template <class OnMatch>
+	void scanLeftmostLongest(UStringView text, OnMatch onMatch) const;
+
+public:
+	template <std::ranges::input_range Range>
+		requires std::convertible_to<std::ranges::range_reference_t<Range>, UStringView>
+	explicit UMultiMatcher(const Range& patterns, bool ignoreCase = false);
+	explicit UMultiMatcher(std::initializer_list<UStringView> patterns, bool ignoreCase = false) :
+		UMultiMatcher(std::span<const UStringView>(patterns.begin(), patterns.size()), ignoreCase) {}
+
+	size_t patternCount() const noexcept { return patternSizes.size(); }
+	bool isIgnoreCase() const noexcept { return ignoreCase; }
+
+	//all matches, overlapping ones included, in order of their ends
+	std::vector<Match> findAll(UStringView text, size_t off = 0) const;
+	//leftmost match starting at or after off, the longest one if several start there
+	Match findFirst(UStringView text, size_t off = 0) const;
+	//stops at the first match found
+	bool containsAny(UStringView text) const;
+
+	//non-overlapping matches chosen as findFirst does, same as UString::count for a single pattern
+	size_t count(UStringView text) const;
+
+	//replaces the matches counted by count, replacements[i] is used for pattern i
+	template <class Alloc>
+	size_t replace(BasicUString<Alloc>& str, std::span<const UStringView> replacements) const;
+	template <class Alloc>
+	size_t replace(BasicUString<Alloc>& str, std::initializer_list<UStringView> replacements) const
+	{
+		return replace(str, std::span<const UStringView>(replacements.begin(), replacements.size()));
+	}
+	//same replacement for all patterns
+	template <class Alloc>
+	size_t replace(BasicUString<Alloc>& str, UStringView replacement) const;
+};
+
+template <std::ranges::input_range Range>
+	requires std::convertible_to<std::ranges::range_reference_t<Range>, UStringView>
+inline UMultiMatcher::UMultiMatcher(const Range& patterns, bool ignoreCase) :
+	ignoreCase(ignoreCase), classes(1 << blockShift, 0)
+{
+	//alphabet first, so trie states are allocated with their final width
+	std::vector<char16_t> units;
+	for (const auto& i : patterns)
+	{
+		const UStringView pattern = i;
+		for (auto c : pattern)
+			units.push_back(unitOf(c));
+	}
+	std::sort(units.begin(), units.end());
+	units.erase(std::unique(units.begin(), units.end()), units.end());
+
+	for (auto c : units)
+	{
+		auto& block = classBlocks[c >> blockShift];
+		if (block == 0)
+		{
+			block = uint16_t(classes.size() >> blockShift);
+			classes.resize(classes.size() + (1 << blockShift), 0);
+		}
+		classes[(size_t(block) << blockShift) | (c & ((1u << blockShift) - 1))] = uint16_t(++alphabetSize);
+	}
+
+	transitions.assign(alphabetSize, 0);
+	depth.push_back(0);
+	stateOutput.push_back(noPattern);
+	for (const auto& i : patterns)
+		addPattern(i);
+	build();
+}
+
+inline void UMultiMatcher::addPattern(UStringView pattern)
+{
+	const auto index = patternSizes.size();
+	patternSizes.push_back(pattern.size());
+	if (pattern.empty())
+		return;
+
+	uint32_t state = 0;
+	for (auto c : pattern)
+	{
+		auto& next = transitions[size_t(state) * alphabetSize + classOf(unitOf(c)) - 1];
+		if (next == 0)
+		{
+			//0 is the root, which is never a child, so it marks missing edges while building
+			next = uint32_t(depth.size());
+			transitions.resize(transitions.size() + alphabetSize, 0);
+			depth.push_back(depth[state] + 1);
+			stateOutput.push_back(noPattern);
+		}
+		state = transitions[size_t(state) * alphabetSize + classOf(unitOf(c)) - 1];
+	}
+
+	if (stateOutput[state] == noPattern)
+		stateOutput[state] = index;
+}
+
+inline void UMultiMatcher::build()
+{
+	//breadth first: failure links of shallower states are ready, missing edges become failure transitions
+	const auto states = depth.size();
+	std::vector<uint32_t> fail(states, 0);
+	outputLink.assign(states, noState);
+
+	std::vector<uint32_t> queue;
+	queue.reserve(states);
+	for (uint32_t c = 0; c < alphabetSize; ++c)
+		if (transitions[c] != 0)
+			queue.push_back(transitions[c]);
+
+	for (size_t i = 0; i < queue.size(); ++i)
+	{
+		const auto state = queue[i];
+		const auto failState = fail[state];
+		outputLink[state] = stateOutput[failState] != noPattern ? failState : outputLink[failState];
+
+		for (uint32_t c = 0; c < alphabetSize; ++c)
+		{
+			auto& next = transitions[size_t(state) * alphabetSize + c];
+			const auto failNext = transitions[size_t(failState) * alphabetSize + c];
+			if (next != 0)
+			{
+				fail[next] = failNext;
+				queue.push_back(next);
+			}
+			else
+			{
+				next = failNext;
+			}
+		}
+	}
+}
+
+template <class OnMatch>
+inline void UMultiMatcher::scan(UStringView text, size_t off, OnMatch onMatch) const
+{
+	uint32_t state = 0;
+	for (size_t i = off; i < text.size(); ++i)
+	{
+		state = step(state, text[i]);
+		for (auto out = stateOutput[state] != noPattern ? state : outputLink[state]; out != noState; out = outputLink[out])
+		{
+			const auto pattern = stateOutput[out];
+			if (onMatch(i + 1 - patternSizes[pattern], patternSizes[pattern], pattern) == false)
+				return;
+		}
+	}
+}
+
+template <class OnMatch>
+inline void UMultiMatcher::scanLeftmostLongest(UStringView text, OnMatch onMatch) const
+{
+	//longest match starting at each undecided position, they all fit in a window of the longest pattern size
+	size_t window = 1;
+	for (auto size : patternSizes)
+		window = std::max(window, size);
+	std::vector<size_t> longest(window, noPattern);
+
+	//decides the positions before last, no match can start there any more
+	size_t next = 0;
+	const auto settle = [&](size_t last)
+	{
+		while (next < last)
+		{
+			const auto pattern = longest[next % window];
+			if (pattern == noPattern)
+			{
+				++next;
+				continue;
+			}
+
+			onMatch(next, patternSizes[pattern], pattern);
+			for (const auto end = next + patternSizes[pattern]; next < end; ++next)
+				longest[next % window] = noPattern;
+		}
+	};
+
+	uint32_t state = 0;
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		state = step(state, text[i]);
+		//i + 1 - depth never decreases, later matches start at or after it
+		settle(i + 1 - depth[state]);
+
+		for (auto out = stateOutput[state] != noPattern ? state : outputLink[state]; out != noState; out = outputLink[out])
+		{
+			const auto pattern = stateOutput[out];
+			const auto pos = i + 1 - patternSizes[pattern];
+			auto& slot = longest[pos % window];
+			if (pos >= next && (slot == noPattern || patternSizes[pattern] > patternSizes[slot]))
+				slot = pattern;
+		}
+	}
+	settle(text.size());
+}
+
+inline std::vector<UMultiMatcher::Match> UMultiMatcher::findAll(UStringView text, size_t off) const
+{
+	std::vector<Match> res;
+	scan(text, off, [&res](size_t pos, size_t size, size_t pattern)
+		{
+			res.push_back({ pos, size, pattern });
+			return true;
+		});
+	return res;
+}
+
+inline UMultiMatcher::Match UMultiMatcher::findFirst(UStringView text, size_t off) const
+{
+	Match res{ UString::npos, 0, noPattern };
+	uint32_t state = 0;
+	for (size_t i = off; i < text.size(); ++i)
+	{
+		state = step(state, text[i]);
+		//i + 1 - depth never decreases: once it passes the best start, no better match can follow
+		if (res && i + 1 - depth[state] > res.pos)
+			break;
+
+		for (auto out = stateOutput[state] != noPattern ? state : outputLink[state]; out != noState; out = outputLink[out])
+		{
+			const auto pattern = stateOutput[out];
+			const auto pos = i + 1 - patternSizes[pattern];
+			if (res.pos == UString::npos || pos < res.pos || (pos == res.pos && patternSizes[pattern] > res.size))
+				res = { pos, patternSizes[pattern], pattern };
+		}
+	}
+	return res;
+}
+
+inline bool UMultiMatcher::containsAny(UStringView text) const
+{
+	bool res = false;
+	scan(text, 0, [&res](size_t, size_t, size_t)
+		{
+			res = true;
+			return false;
+		});
+	return res;
+}
+
+inline size_t UMultiMatcher::count(UStringView text) const
+{
+	size_t res = 0;
+	scanLeftmostLongest(text, [&res](size_t, size_t, size_t) { ++res; });
+	return res;
+}
+
+template <class Alloc>
+inline size_t UMultiMatcher::replace(BasicUString<Alloc>& str, std::span<const UStringView> replacements) const
+{
+	assert(replacements.size() >= patternCount());
+
+	//matches first: the result is built with one allocation of the exact size
+	std::vector<Match> matches;
+	size_t newSize = str.size();
+	scanLeftmostLongest(str, [&](size_t pos, size_t size, size_t pattern)
+		{
+			matches.push_back({ pos, size, pattern });
+			newSize = newSize - size + replacements[pattern].size();
+		});
+	if (matches.empty())
+		return 0;
+
+	BasicUString<Alloc> res(str.getAllocator());
+	res.reserve(newSize);
+	size_t readPos = 0;
+	for (const auto& match : matches)
+	{
+		res += str.substrView(readPos, match.pos - readPos);
+		res += replacements[match.pattern];
+		readPos = match.pos + match.size;
+	}
+	res += str.substrView(readPos);
+	str = std::move(res);
+
+	return matches.size();
+}
+
+template <class Alloc>
+inline size_t UMultiMatcher::replace(BasicUString<Alloc>& str, UStringView replacement) const
+{
+	const std::vector<UStringView> replacements(patternCount(), replacement);
+	return replace(str, replacements);
+}
+
+#endif
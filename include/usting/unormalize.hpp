@@ -0,0 +1,374 @@
+#ifndef UNORMALIZE_HPP
+#define UNORMALIZE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "usimd.hpp"
+#include "uunicode_data.hpp"
+#include "uutf.hpp"
+
+//unicode normalization forms (UAX #15)
+enum class UNormalizationForm : uint8_t
+{
+	//canonical decomposition, then canonical composition
+	NFC,
+	//canonical decomposition
+	NFD,
+	//compatibility decomposition, then canonical composition
+	NFKC,
+	//compatibility decomposition
+	NFKD
+};
+
+//text is decomposed, its combining marks are put in canonical order and, for NFC and NFKC, composed again.
+//the quick check (DerivedNormalizationProps.txt) only reads text that is already normalized,
+//the normalizer works on one combining sequence at a time and copies runs of units that never change
+namespace ustring_detail
+{
+	enum class NormCheck : uint8_t
+	{
+		Yes,
+		No,
+		Maybe
+	};
+
+	struct NormForm
+	{
+		//quick check flags of the form
+		uint8_t no;
+		uint8_t maybe;
+		//flag of the code points decomposed
+		uint8_t decompose;
+		bool compat;
+		bool compose;
+		//units below are quick check Yes starters: only the last of a run may change, by the marks after it
+		char16_t stableBelow;
+	};
+
+	constexpr NormForm normFormOf(UNormalizationForm form) noexcept
+	{
+		switch (form)
+		{
+		case UNormalizationForm::NFD:
+			return { normFlagNfdNo, 0, normFlagNfdNo, false, false, 0xC0 };
+		case UNormalizationForm::NFKC:
+			return { normFlagNfkcNo, normFlagNfkcMaybe, normFlagNfkdNo, true, true, 0xA0 };
+		case UNormalizationForm::NFKD:
+			return { normFlagNfkdNo, 0, normFlagNfkdNo, true, false, 0xA0 };
+		default:
+			return { normFlagNfcNo, normFlagNfcMaybe, normFlagNfdNo, false, true, 0x300 };
+		}
+	}
+
+	//hangul syllables are composed of leading, vowel and trailing jamo by arithmetic
+	constexpr char32_t hangulFirst = 0xAC00;
+	constexpr char32_t hangulLeadFirst = 0x1100;
+	constexpr char32_t hangulVowelFirst = 0x1161;
+	constexpr char32_t hangulTrailBase = 0x11A7;
+	constexpr char32_t hangulLeadCount = 19;
+	constexpr char32_t hangulVowelCount = 21;
+	constexpr char32_t hangulTrailCount = 28;
+	constexpr char32_t hangulCount = 11172;
+
+	constexpr const Decomposition* findDecomposition(char32_t cp) noexcept
+	{
+		const auto end = decompositions + std::size(decompositions);
+		const auto res = std::lower_bound(decompositions, end, cp, [](const Decomposition& dec, char32_t cp) { return dec.cp < cp; });
+		return res != end && res->cp == cp ? res : nullptr;
+	}
+
+	//primary composite of the pair, 0 if there is none
+	constexpr char32_t composePair(char32_t first, char32_t second) noexcept
+	{
+		if (first - hangulLeadFirst < hangulLeadCount && second - hangulVowelFirst < hangulVowelCount)
+			return hangulFirst + ((first - hangulLeadFirst) * hangulVowelCount + second - hangulVowelFirst) * hangulTrailCount;
+		if (first - hangulFirst < hangulCount && (first - hangulFirst) % hangulTrailCount == 0 && second - hangulTrailBase - 1 < hangulTrailCount - 1)
+			return first + (second - hangulTrailBase);
+
+		const auto end = compositions + std::size(compositions);
+		const auto res = std::lower_bound(compositions, end, std::pair(first, second), [](const Composition& comp, std::pair<char32_t, char32_t> pair)
+			{
+				return comp.first < pair.first || (comp.first == pair.first && comp.second < pair.second);
+			});
+		return res != end && res->first == first && res->second == second ? res->composite : 0;
+	}
+
+	//index of the first unit from i that is not below limit
+	inline size_t skipBelow(const char16_t* src, size_t count, size_t i, char16_t limit) noexcept
+	{
+#if defined(USTRING_SSE2)
+		//saturating subtraction leaves 0 for units below limit
+		const __m128i bias = _mm_set1_epi16(short(limit - 1));
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v = _mm_subs_epu16(_mm_loadu_si128((const __m128i*)(src + i)), bias);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128())) != 0xFFFF)
+				break;
+		}
+#endif
+		while (i < count && src[i] < limit)
+			++i;
+		return i;
+	}
+
+	//boundary is set to the end of the text known to be normalized, where the rest can be normalized on its own:
+	//count for Yes, before the first code point that is not Yes otherwise
+	inline NormCheck quickCheckNormalized(const char16_t* src, size_t count, UNormalizationForm form, size_t& boundary) noexcept
+	{
+		const auto info = normFormOf(form);
+		auto res = NormCheck::Yes;
+		uint8_t lastCcc = 0;
+		boundary = 0;
+		size_t i = 0;
+		while (i < count)
+		{
+			if (src[i] < info.stableBelow)
+			{
+				i = skipBelow(src, count, i, info.stableBelow);
+				if (res == NormCheck::Yes)
+					boundary = i - 1;
+				lastCcc = 0;
+				continue;
+			}
+
+			size_t length = 1;
+			const auto& props = normPropsOf(codePointAt(src, count, i, length));
+			if ((props.ccc != 0 && lastCcc > props.ccc) || (props.flags & info.no) != 0)
+				return NormCheck::No;
+			if ((props.flags & info.maybe) != 0)
+				res = NormCheck::Maybe;
+			else if (props.ccc == 0 && res == NormCheck::Yes)
+				boundary = i;
+			lastCcc = props.ccc;
+			i += length;
+		}
+		if (res == NormCheck::Yes)
+			boundary = count;
+		return res;
+	}
+
+	//appends normalized text to Out (a string of utf-16 units) as soon as it can not change anymore.
+	//the text may come in parts: a combining sequence or surrogate pair split between them is held back
+	class Normalizer
+	{
+		struct NormChar
+		{
+			char32_t cp;
+			uint8_t ccc;
+		};
+
+		//decomposed code points since the last one nothing before it combines with
+		std::vector<NormChar> pending;
+		NormForm info;
+		//unpaired at the end of the last part
+		char16_t highSurrogate = 0;
+		//normalized units not yet appended, so a string grows once per block instead of once per code point
+		char16_t ready[256];
+		size_t readyCount = 0;
+
+		template <class Out>
+		static void appendUnits(Out& out, const char16_t* src, size_t count)
+		{
+			const auto oldSize = out.size();
+			out.resize(oldSize + count);
+			std::copy(src, src + count, (char16_t*)out.data() + oldSize);
+		}
+
+		template <class Out>
+		void appendReady(Out& out)
+		{
+			appendUnits(out, ready, readyCount);
+			readyCount = 0;
+		}
+
+		template <class Out>
+		void pushDecomposed(char32_t cp, const NormProps& props, Out& out)
+		{
+			if (props.ccc == 0 && (props.flags & info.maybe) == 0)
+				flush(out);
+			pending.push_back({ cp, props.ccc });
+		}
+
+		template <class Out>
+		void pushCodePoint(char32_t cp, Out& out)
+		{
+			const auto& props = normPropsOf(cp);
+			if ((props.flags & info.decompose) == 0)
+			{
+				pushDecomposed(cp, props, out);
+			}
+			else if (cp - hangulFirst < hangulCount)
+			{
+				const auto index = cp - hangulFirst;
+				const char32_t lead = hangulLeadFirst + index / (hangulVowelCount * hangulTrailCount);
+				const char32_t vowel = hangulVowelFirst + index % (hangulVowelCount * hangulTrailCount) / hangulTrailCount;
+				pushDecomposed(lead, normPropsOf(lead), out);
+				pushDecomposed(vowel, normPropsOf(vowel), out);
+				if (const char32_t trail = hangulTrailBase + index % hangulTrailCount; trail != hangulTrailBase)
+					pushDecomposed(trail, normPropsOf(trail), out);
+			}
+			else
+			{
+				const auto dec = findDecomposition(cp);
+				auto first = decompositionCodePoints + dec->offset;
+				size_t length = dec->canonical;
+				if (info.compat && dec->compat != 0)
+				{
+					first += dec->canonical;
+					length = dec->compat;
+				}
+				for (auto ptr = first; ptr != first + length; ++ptr)
+					pushDecomposed(*ptr, normPropsOf(*ptr), out);
+			}
+		}
+
+		//stable sort of every run of combining marks by combining class
+		void reorder() noexcept
+		{
+			for (size_t i = 1; i < pending.size(); ++i)
+			{
+				const auto c = pending[i];
+				if (c.ccc == 0)
+					continue;
+				size_t j = i;
+				for (; j > 0 && pending[j - 1].ccc > c.ccc; --j)
+					pending[j] = pending[j - 1];
+				pending[j] = c;
+			}
+		}
+
+		//canonical composition: a code point combines with the last starter if nothing between them blocks it,
+		//a mark in between blocks it unless its class is lower
+		void compose() noexcept
+		{
+			constexpr size_t noStarter = size_t(-1);
+			size_t starter = pending[0].ccc == 0 ? 0 : noStarter;
+			uint8_t lastCcc = pending[0].ccc;
+			size_t count = 1;
+			for (size_t i = 1; i < pending.size(); ++i)
+			{
+				const auto c = pending[i];
+				if (starter != noStarter && (count == starter + 1 || lastCcc < c.ccc))
+				{
+					if (const auto composite = composePair(pending[starter].cp, c.cp); composite != 0)
+					{
+						pending[starter].cp = composite;
+						continue;
+					}
+				}
+				if (c.ccc == 0)
+					starter = count;
+				lastCcc = c.ccc;
+				pending[count++] = c;
+			}
+			pending.resize(count);
+		}
+
+		template <class Out>
+		void flush(Out& out)
+		{
+			if (pending.empty())
+				return;
+			if (pending.size() > 1)
+			{
+				reorder();
+				if (info.compose)
+					compose();
+			}
+
+			for (auto& c : pending)
+			{
+				if (readyCount + 2 > std::size(ready))
+					appendReady(out);
+				if (c.cp > 0xFFFF)
+				{
+					ready[readyCount++] = char16_t(0xD7C0 + (c.cp >> 10));
+					ready[readyCount++] = char16_t(0xDC00 | (c.cp & 0x3FF));
+				}
+				else
+				{
+					ready[readyCount++] = char16_t(c.cp);
+				}
+			}
+			pending.clear();
+		}
+
+	public:
+		explicit Normalizer(UNormalizationForm form) noexcept : info(normFormOf(form)) {}
+
+		template <class Out>
+		void push(const char16_t* src, size_t count, Out& out)
+		{
+			size_t i = 0;
+			if (highSurrogate != 0 && count != 0)
+			{
+				if (isLowSurrogate(src[0]))
+				{
+					pushCodePoint(0x10000 + ((char32_t(highSurrogate) - 0xD800) << 10) + (src[0] - 0xDC00), out);
+					i = 1;
+				}
+				else
+				{
+					pushCodePoint(highSurrogate, out);
+				}
+				highSurrogate = 0;
+			}
+
+			while (i < count)
+			{
+				if (src[i] < info.stableBelow)
+				{
+					//copied as they are but the last one: marks after it may be reordered into it and compose with it
+					const auto end = skipBelow(src, count, i, info.stableBelow);
+					if (const size_t length = end - 1 - i; length != 0)
+					{
+						flush(out);
+						if (readyCount + length > std::size(ready))
+							appendReady(out);
+						if (length > std::size(ready))
+						{
+							appendUnits(out, src + i, length);
+						}
+						else
+						{
+							std::copy(src + i, src + end - 1, ready + readyCount);
+							readyCount += length;
+						}
+					}
+					pushCodePoint(src[end - 1], out);
+					i = end;
+					continue;
+				}
+				if (isHighSurrogate(src[i]) && i + 1 == count)
+				{
+					highSurrogate = src[i];
+					break;
+				}
+				size_t length = 1;
+				const auto cp = codePointAt(src, count, i, length);
+				pushCodePoint(cp, out);
+				i += length;
+			}
+			appendReady(out);
+		}
+
+		//appends what is held back, the normalizer can take another text afterwards
+		template <class Out>
+		void finish(Out& out)
+		{
+			if (highSurrogate != 0)
+			{
+				pushCodePoint(highSurrogate, out);
+				highSurrogate = 0;
+			}
+			flush(out);
+			appendReady(out);
+		}
+	};
+}
+
+#endif
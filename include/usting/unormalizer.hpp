@@ -0,0 +1,25 @@
+#ifndef UNORMALIZER_HPP
+#define UNORMALIZER_HPP
+
+#include "ustring.hpp"
+
+//normalizes a text given in parts, e.g. a large document read block by block. out only gets what can not change
+//anymore and may be emptied between the parts, so memory stays bounded by a part and the combining sequence
+//held back at its end: UNormalizer nfc(UNormalizationForm::NFC); for (...) { nfc.normalize(block, out); write(out); out.clear(); }
+//nfc.finish(out); the result is the same as normalized() of the whole text
+class UNormalizer
+{
+	ustring_detail::Normalizer normalizer;
+
+public:
+	explicit UNormalizer(UNormalizationForm form) noexcept : normalizer(form) {}
+
+	template <class Alloc>
+	void normalize(UStringView text, BasicUString<Alloc>& out) { normalizer.push((const char16_t*)text.data(), text.size(), out); }
+
+	//appends what is held back, the next text can be normalized afterwards
+	template <class Alloc>
+	void finish(BasicUString<Alloc>& out) { normalizer.finish(out); }
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef UNUMFORMAT_HPP
+#define UNUMFORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//integers are written as utf-16 units straight into the destination: the length is counted first,
+//so a string grows once and nothing is formatted twice. digits are lowercase, as std::to_chars writes them
+namespace ustring_detail
+{
+	constexpr char formatDigitPairs[] =
+		"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+		"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+	constexpr char formatDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+	//digits are made in 64 bits, or in the type itself if it is wider (__int128)
+	template <class T>
+	using FormatMagnitude = std::conditional_t<(sizeof(T) > sizeof(uint64_t)), std::make_unsigned_t<T>, uint64_t>;
+
+	template <class T>
+	constexpr FormatMagnitude<T> formatMagnitude(T num) noexcept
+	{
+		typedef std::make_unsigned_t<T> U;
+		if constexpr (std::is_signed_v<T>)
+			return num < 0 ? U(U(0) - U(num)) : U(num);
+		else
+			return num;
+	}
+
+	//units written by formatIntegral, sign included
+	template <class T>
+	constexpr size_t formatIntegralLength(T num, unsigned base) noexcept
+	{
+		static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "T must be an integral type");
+
+		typedef FormatMagnitude<T> Magnitude;
+		Magnitude value = formatMagnitude(num);
+		size_t res = std::is_signed_v<T> && num < 0 ? 2 : 1;
+		if (base == 10)
+		{
+			//compares instead of divisions
+			for (Magnitude power = 10; value >= power; power *= 10)
+			{
+				++res;
+				if (power > Magnitude(~Magnitude(0)) / 10)
+					break;
+			}
+		}
+		else
+		{
+			for (; value >= base; value /= base)
+				++res;
+		}
+		return res;
+	}
+
+	//out must hold formatIntegralLength(num, base) units, base is 2..36
+	template <class T, class Unit>
+	constexpr void formatIntegral(T num, unsigned base, Unit* out, size_t length) noexcept
+	{
+		FormatMagnitude<T> value = formatMagnitude(num);
+		auto ptr = out + length;
+		if (base == 10)
+		{
+			//two digits per division
+			for (; value >= 100; value /= 100)
+			{
+				const auto pair = formatDigitPairs + (value % 100) * 2;
+				*--ptr = Unit(char16_t(pair[1]));
+				*--ptr = Unit(char16_t(pair[0]));
+			}
+			if (value >= 10)
+			{
+				*--ptr = Unit(char16_t(formatDigitPairs[value * 2 + 1]));
+				*--ptr = Unit(char16_t(formatDigitPairs[value * 2]));
+			}
+			else
+			{
+				*--ptr = Unit(char16_t('0' + value));
+			}
+		}
+		else
+		{
+			do
+			{
+				*--ptr = Unit(char16_t(formatDigits[value % base]));
+				value /= base;
+			} while (value != 0);
+		}
+
+		if (ptr != out)
+			*--ptr = Unit(u'-');
+	}
+}
+
+#endif
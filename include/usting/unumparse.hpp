@@ -0,0 +1,347 @@
+#ifndef UNUMPARSE_HPP
+#define UNUMPARSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <charconv>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <algorithm>
+
+#include "usimd.hpp"
+#include "uunicode_data.hpp"
+
+enum class UParseMode : uint8_t
+{
+	//the whole string is the number: an optional '-' and digits, nothing around them
+	Strict,
+	//white space around the number, a '+' and a "0x" prefix (base 16) are skipped,
+	//parsing stops at the first unit that can not continue the number
+	Lenient
+};
+
+template <class T>
+struct UParseResult
+{
+	T value{};
+	//units read: up to the first one not taken, trailing white space included in lenient mode
+	size_t consumed = 0;
+	//invalid_argument if there is no number (or, in strict mode, something follows it), result_out_of_range if it does not fit
+	std::errc ec = std::errc::invalid_argument;
+
+	constexpr explicit operator bool() const noexcept { return ec == std::errc(); }
+};
+
+//numbers are parsed from utf-16 units directly. Unit is char16_t or UChar
+namespace ustring_detail
+{
+	constexpr bool isParseSpace(char16_t c) noexcept
+	{
+		return c == ' ' || (c >= 9 && c <= 13) || (c >= 0x80 && (unicodePropsOf(c).flags & unicodeFlagWhiteSpace) != 0);
+	}
+
+	//value of a digit of any base up to 36, 99 for other units
+	constexpr unsigned parseDigit(char16_t c) noexcept
+	{
+		if (unsigned(c) - '0' < 10u)
+			return unsigned(c) - '0';
+		const unsigned letter = unsigned(c | 0x20) - 'a';
+		return letter < 26u ? letter + 10 : 99;
+	}
+
+#if defined(USTRING_SSE2)
+	//8 decimal digits validated and converted at once, false if one of the units is not a digit
+	inline bool parse8DigitsSse2(const char16_t* ptr, uint32_t& value) noexcept
+	{
+		const __m128i digits = _mm_sub_epi16(_mm_loadu_si128((const __m128i*)ptr), _mm_set1_epi16('0'));
+		//units below '0' wrap around and stay above 9
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(digits, _mm_set1_epi16(9)), _mm_setzero_si128())) != 0xFFFF)
+			return false;
+
+		const __m128i pairs = _mm_madd_epi16(digits, _mm_setr_epi16(10, 1, 10, 1, 10, 1, 10, 1));
+		const __m128i quads = _mm_madd_epi16(_mm_packs_epi32(pairs, pairs), _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+		value = uint32_t(_mm_cvtsi128_si32(quads)) * 10000 + uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(quads, 4)));
+		return true;
+	}
+#endif
+
+	template <class Unit>
+	constexpr size_t skipParseSpace(const Unit* ptr, size_t count, size_t i) noexcept
+	{
+		while (i < count && isParseSpace(char16_t(ptr[i])))
+			++i;
+		return i;
+	}
+
+	//prefix: anything may follow the number, as in lenient mode (for numbers inside a larger buffer)
+	template <class T, class Unit>
+	constexpr UParseResult<T> parseIntegral(const Unit* ptr, size_t count, unsigned base, UParseMode mode, bool prefix = false) noexcept
+	{
+		static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "T must be an integral type");
+
+		UParseResult<T> res;
+		if (base < 2 || base > 36)
+			return res;
+
+		const bool lenient = mode == UParseMode::Lenient;
+		size_t i = lenient ? skipParseSpace(ptr, count, 0) : 0;
+
+		bool negative = false;
+		if (i < count && ptr[i] == '-' && std::is_signed_v<T>)
+		{
+			negative = true;
+			++i;
+		}
+		else if (lenient && i < count && ptr[i] == '+')
+		{
+			++i;
+		}
+		if (lenient && base == 16 && count - i > 2 && ptr[i] == '0' && (ptr[i + 1] | 0x20) == 'x' && parseDigit(ptr[i + 2]) < 16)
+			i += 2;
+
+		//digits are added up in 64 bits, or in the type itself if it is wider (__int128)
+		typedef std::conditional_t<(sizeof(T) > sizeof(uint64_t)), std::make_unsigned_t<T>, uint64_t> Magnitude;
+		const Magnitude limit = Magnitude(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+		const size_t first = i;
+		Magnitude value = 0;
+		bool overflow = false;
+
+		//19 decimal digits always fit in 64 bits: no overflow check until the end of them
+		if (base == 10)
+		{
+			const size_t uncheckedEnd = first + std::min<size_t>(count - first, 19);
+#if defined(USTRING_SSE2)
+			if (std::is_constant_evaluated() == false)
+			{
+				uint32_t chunk = 0;
+				for (; uncheckedEnd - i >= 8 && parse8DigitsSse2((const char16_t*)ptr + i, chunk); i += 8)
+					value = value * 100000000 + chunk;
+			}
+#endif
+			for (unsigned digit; i < uncheckedEnd && (digit = unsigned(ptr[i]) - '0') < 10u; ++i)
+				value = value * 10 + digit;
+			overflow = value > limit;
+		}
+
+		//no division per digit, base 10 divides by a constant
+		const Magnitude cutoff = base == 10 ? limit / 10 : limit / base;
+		const unsigned cutoffDigit = unsigned(limit - cutoff * base);
+		for (; i < count; ++i)
+		{
+			const auto digit = parseDigit(ptr[i]);
+			if (digit >= base)
+				break;
+			//like std::from_chars, all digits are consumed even when the value is out of range
+			if (overflow || value > cutoff || (value == cutoff && digit > cutoffDigit))
+				overflow = true;
+			else
+				value = value * base + digit;
+		}
+
+		if (i == first)
+			return res;
+
+		if (lenient)
+			i = skipParseSpace(ptr, count, i);
+		res.consumed = i;
+		if (lenient == false && prefix == false && i != count)
+			return res;
+		if (overflow)
+		{
+			res.ec = std::errc::result_out_of_range;
+			return res;
+		}
+
+		typedef std::make_unsigned_t<T> U;
+		res.value = T(negative ? U(U(0) - U(value)) : U(value));
+		res.ec = std::errc();
+		return res;
+	}
+
+	//decimal mantissa up to 19 digits and exponent, exact in T (one rounding) when small enough
+	template <class T>
+	inline bool parseFloatFast(uint64_t mantissa, int64_t exp10, bool negative, T& value) noexcept
+	{
+		constexpr double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+		if constexpr (std::is_same_v<T, double>)
+		{
+			if (mantissa > (uint64_t(1) << 53) || exp10 < -22 || exp10 > 22)
+				return false;
+			value = exp10 < 0 ? double(mantissa) / powers[-exp10] : double(mantissa) * powers[exp10];
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			if (mantissa > (uint64_t(1) << 24) || exp10 < -10 || exp10 > 10)
+				return false;
+			value = exp10 < 0 ? float(mantissa) / float(powers[-exp10]) : float(mantissa) * float(powers[exp10]);
+		}
+		else
+		{
+			return false;
+		}
+
+		if (negative)
+			value = -value;
+		return true;
+	}
+
+	template <class Unit>
+	constexpr size_t matchNoCase(const Unit* ptr, size_t count, size_t i, const char* word) noexcept
+	{
+		size_t n = 0;
+		for (; word[n] != 0; ++n)
+			if (i + n >= count || (ptr[i + n] | 0x20) != word[n])
+				return 0;
+		return n;
+	}
+
+	//syntax of std::from_chars is checked on the units, then values that are not exact in the fast path
+	//are converted by std::from_chars from the ascii units of the number
+	template <class T, class Unit>
+	inline UParseResult<T> parseFloatingPoint(const Unit* ptr, size_t count, std::chars_format format, UParseMode mode, bool prefix = false)
+	{
+		static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+
+		UParseResult<T> res;
+		const bool lenient = mode == UParseMode::Lenient;
+		size_t i = lenient ? skipParseSpace(ptr, count, 0) : 0;
+
+		bool negative = false;
+		if (i < count && ptr[i] == '-')
+		{
+			negative = true;
+			++i;
+		}
+		else if (lenient && i < count && ptr[i] == '+')
+		{
+			++i;
+		}
+
+		const size_t numberStart = i;
+		const bool hex = format == std::chars_format::hex;
+		const unsigned base = hex ? 16 : 10;
+		uint64_t mantissa = 0;
+		int64_t exp10 = 0;
+		unsigned digitCount = 0;
+		bool exact = hex == false;
+		bool sawDigit = false;
+
+		if (size_t n = matchNoCase(ptr, count, i, "infinity"); n != 0 || (n = matchNoCase(ptr, count, i, "inf")) != 0)
+		{
+			i += n;
+			exact = false;
+		}
+		else if ((n = matchNoCase(ptr, count, i, "nan")) != 0)
+		{
+			i += n;
+			exact = false;
+			//nan(n-char-sequence)
+			if (i < count && ptr[i] == '(')
+			{
+				auto j = i + 1;
+				while (j < count && (parseDigit(ptr[j]) < 36 || ptr[j] == '_'))
+					++j;
+				if (j < count && ptr[j] == ')')
+					i = j + 1;
+			}
+		}
+		else
+		{
+			auto digits = [&](bool fraction)
+				{
+					for (unsigned digit; i < count && (digit = parseDigit(ptr[i])) < base; ++i)
+					{
+						sawDigit = true;
+						if (mantissa == 0 && digit == 0)
+						{
+							exp10 -= fraction;
+						}
+						else if (digitCount < 19)
+						{
+							mantissa = mantissa * base + digit;
+							++digitCount;
+							exp10 -= fraction;
+						}
+						else
+						{
+							//dropped digits: the value needs the exact conversion
+							exact = false;
+							exp10 += fraction == false;
+						}
+					}
+				};
+
+			digits(false);
+			if (i < count && ptr[i] == '.')
+			{
+				++i;
+				digits(true);
+			}
+			if (sawDigit == false)
+				return res;
+
+			//exponent: required for scientific, not taken for fixed
+			const char16_t expChar = hex ? 'p' : 'e';
+			bool sawExponent = false;
+			if (format != std::chars_format::fixed && i < count && (ptr[i] | 0x20) == expChar)
+			{
+				auto j = i + 1;
+				bool expNegative = false;
+				if (j < count && (ptr[j] == '-' || ptr[j] == '+'))
+					expNegative = ptr[j++] == '-';
+				if (j < count && unsigned(ptr[j]) - '0' < 10u)
+				{
+					int64_t exp = 0;
+					for (; j < count && unsigned(ptr[j]) - '0' < 10u; ++j)
+						exp = std::min<int64_t>(exp * 10 + (ptr[j] - '0'), 100000);
+					exp10 += expNegative ? -exp : exp;
+					sawExponent = true;
+					i = j;
+				}
+			}
+			if (format == std::chars_format::scientific && sawExponent == false)
+				return res;
+		}
+
+		const size_t numberEnd = i;
+		if (lenient)
+			i = skipParseSpace(ptr, count, i);
+		res.consumed = i;
+		if (lenient == false && prefix == false && i != count)
+			return res;
+
+		if (exact && parseFloatFast(mantissa, exp10, negative, res.value))
+		{
+			res.ec = std::errc();
+			return res;
+		}
+
+		//all units of the number are ascii here
+		char buf[64];
+		std::string longBuf;
+		char* text = buf;
+		const size_t length = numberEnd - numberStart + negative;
+		if (length > sizeof(buf))
+		{
+			longBuf.resize(length);
+			text = longBuf.data();
+		}
+		if (negative)
+			text[0] = '-';
+		for (size_t j = numberStart; j < numberEnd; ++j)
+			text[j - numberStart + negative] = char(ptr[j]);
+
+		T value{};
+		const auto converted = std::from_chars(text, text + length, value, format);
+		res.ec = converted.ec;
+		if (converted.ec == std::errc())
+			res.value = value;
+		return res;
+	}
+}
+
+#endif
@@ -0,0 +1,696 @@
+#ifndef USEARCH_HPP
+#define USEARCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <algorithm>
+
+#include "usimd.hpp"
+#include "uunicode_data.hpp"
+
+//case-insensitive search engine shared by all ignoreCase operations of UString.
+//two code units are equal ignoring case when their folded (lowered) values are equal
+namespace ustring_detail
+{
+	constexpr size_t searchNpos = size_t(-1);
+
+	constexpr char16_t asciiLower(char16_t c) noexcept { return (c >= 'A' && c <= 'Z') ? c | 0x20 : c; }
+
+	constexpr char16_t foldCase(char16_t c) noexcept
+	{
+		return c < 0x80 ? asciiLower(c) : char16_t(c + unicodePropsOf(c).lowerDelta);
+	}
+
+	//writes code units equal to c ignoring case (its case class) into out,
+	//returns their count or 0 if there are more than maxCount
+	constexpr size_t caseVariants(char16_t c, char16_t* out, size_t maxCount) noexcept
+	{
+		const auto f = foldCase(c);
+		const auto keysEnd = caseClassKeys + std::size(caseClassKeys);
+		const auto key = std::lower_bound(caseClassKeys, keysEnd, f);
+		if (key == keysEnd || *key != f)
+		{
+			out[0] = f;
+			return 1;
+		}
+
+		const auto index = key - caseClassKeys;
+		const size_t count = caseClassBegin[index + 1] - caseClassBegin[index];
+		if (count > maxCount)
+			return 0;
+		for (size_t i = 0; i < count; ++i)
+			out[i] = caseClassMembers[caseClassBegin[index] + i];
+		return count;
+	}
+
+#if defined(USTRING_SSE2)
+	inline __m128i asciiLowerSse2(__m128i v) noexcept
+	{
+		//signed compares: units >= 0x8000 are negative and never in 'A'..'Z'
+		const __m128i upper = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16('A' - 1)), _mm_cmpgt_epi16(_mm_set1_epi16('Z' + 1), v));
+		return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi16(0x20)));
+	}
+
+	inline bool isAsciiSse2(__m128i v) noexcept
+	{
+		return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128())) == 0xFFFF;
+	}
+#endif
+
+	//str is compared against already folded units
+	inline bool equalFolded(const char16_t* str, const char16_t* folded, size_t count) noexcept
+	{
+		size_t i = 0;
+#if defined(USTRING_SSE2)
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+			if (isAsciiSse2(v))
+			{
+				const __m128i f = _mm_loadu_si128((const __m128i*)(folded + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(asciiLowerSse2(v), f)) != 0xFFFF)
+					return false;
+			}
+			else
+			{
+				for (size_t j = i; j < i + 8; ++j)
+					if (foldCase(str[j]) != folded[j])
+						return false;
+			}
+		}
+#endif
+		for (; i < count; ++i)
+			if (foldCase(str[i]) != folded[i])
+				return false;
+		return true;
+	}
+
+	inline bool equalIgnoreCase(const char16_t* str0, const char16_t* str1, size_t count) noexcept
+	{
+		size_t i = 0;
+#if defined(USTRING_SSE2)
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v0 = _mm_loadu_si128((const __m128i*)(str0 + i));
+			const __m128i v1 = _mm_loadu_si128((const __m128i*)(str1 + i));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(v0, v1)) == 0xFFFF)
+				continue;
+			if (isAsciiSse2(_mm_or_si128(v0, v1)))
+			{
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(asciiLowerSse2(v0), asciiLowerSse2(v1))) != 0xFFFF)
+					return false;
+			}
+			else
+			{
+				for (size_t j = i; j < i + 8; ++j)
+					if (str0[j] != str1[j] && foldCase(str0[j]) != foldCase(str1[j]))
+						return false;
+			}
+		}
+#endif
+		for (; i < count; ++i)
+			if (str0[i] != str1[i] && foldCase(str0[i]) != foldCase(str1[i]))
+				return false;
+		return true;
+	}
+
+	//needle folded once and reused for any number of searches.
+	//candidates are filtered by the case variants of the first and last units
+	//(compared 8/16 at a time) and verified with equalFolded
+	class IgnoreCaseNeedle
+	{
+		static constexpr size_t maxVariants = 4;
+
+		std::u16string folded;
+		char16_t firstVariants[maxVariants]{};
+		char16_t lastVariants[maxVariants]{};
+		size_t firstCount = 0;
+		size_t lastCount = 0;
+
+		bool isFirst(char16_t c) const noexcept
+		{
+			if (firstCount == 0)
+				return foldCase(c) == folded.front();
+			for (size_t i = 0; i < firstCount; ++i)
+				if (firstVariants[i] == c)
+					return true;
+			return false;
+		}
+
+#if defined(USTRING_SSE2)
+		static __m128i variantsMaskSse2(__m128i v, const char16_t* variants, size_t count) noexcept
+		{
+			if (count == 0)
+				return _mm_set1_epi16(-1);
+			__m128i res = _mm_cmpeq_epi16(v, _mm_set1_epi16((short)variants[0]));
+			for (size_t i = 1; i < count; ++i)
+				res = _mm_or_si128(res, _mm_cmpeq_epi16(v, _mm_set1_epi16((short)variants[i])));
+			return res;
+		}
+
+		//candidate bitmask of starts pos..pos+7, two bits per position
+		unsigned candidatesSse2(const char16_t* hay, size_t pos) const noexcept
+		{
+			const __m128i first = variantsMaskSse2(_mm_loadu_si128((const __m128i*)(hay + pos)), firstVariants, firstCount);
+			const __m128i last = variantsMaskSse2(_mm_loadu_si128((const __m128i*)(hay + pos + folded.size() - 1)), lastVariants, lastCount);
+			return (unsigned)_mm_movemask_epi8(_mm_and_si128(first, last)) & 0x5555u;
+		}
+
+		USTRING_TARGET_AVX2 static __m256i variantsMaskAvx2(__m256i v, const char16_t* variants, size_t count) noexcept
+		{
+			if (count == 0)
+				return _mm256_set1_epi16(-1);
+			__m256i res = _mm256_cmpeq_epi16(v, _mm256_set1_epi16((short)variants[0]));
+			for (size_t i = 1; i < count; ++i)
+				res = _mm256_or_si256(res, _mm256_cmpeq_epi16(v, _mm256_set1_epi16((short)variants[i])));
+			return res;
+		}
+
+		//candidate bitmask of starts pos..pos+15, two bits per position
+		USTRING_TARGET_AVX2 unsigned candidatesAvx2(const char16_t* hay, size_t pos) const noexcept
+		{
+			const __m256i first = variantsMaskAvx2(_mm256_loadu_si256((const __m256i*)(hay + pos)), firstVariants, firstCount);
+			const __m256i last = variantsMaskAvx2(_mm256_loadu_si256((const __m256i*)(hay + pos + folded.size() - 1)), lastVariants, lastCount);
+			return (unsigned)_mm256_movemask_epi8(_mm256_and_si256(first, last)) & 0x55555555u;
+		}
+
+		size_t findBlocks(const char16_t* hay, size_t& pos, size_t lastStart) const noexcept
+		{
+			if (hasAvx2())
+			{
+				for (; pos + 15 <= lastStart; pos += 16)
+				{
+					for (unsigned mask = candidatesAvx2(hay, pos); mask != 0; mask &= mask - 1)
+					{
+						const size_t candidate = pos + std::countr_zero(mask) / 2;
+						if (equalFolded(hay + candidate, folded.data(), folded.size()))
+							return candidate;
+					}
+				}
+			}
+			for (; pos + 7 <= lastStart; pos += 8)
+			{
+				for (unsigned mask = candidatesSse2(hay, pos); mask != 0; mask &= mask - 1)
+				{
+					const size_t candidate = pos + std::countr_zero(mask) / 2;
+					if (equalFolded(hay + candidate, folded.data(), folded.size()))
+						return candidate;
+				}
+			}
+			return searchNpos;
+		}
+
+		//pos is the highest start still to check, blocks end at pos
+		size_t rfindBlocks(const char16_t* hay, size_t& pos, size_t firstStart) const noexcept
+		{
+			if (hasAvx2())
+			{
+				for (; pos >= firstStart + 15 && pos != searchNpos; pos -= 16)
+				{
+					const size_t blockStart = pos - 15;
+					for (unsigned mask = candidatesAvx2(hay, blockStart); mask != 0;)
+					{
+						const int bit = 31 - std::countl_zero(mask);
+						const size_t candidate = blockStart + bit / 2;
+						if (equalFolded(hay + candidate, folded.data(), folded.size()))
+							return candidate;
+						mask &= ~(1u << bit);
+					}
+				}
+			}
+			for (; pos >= firstStart + 7 && pos != searchNpos; pos -= 8)
+			{
+				const size_t blockStart = pos - 7;
+				for (unsigned mask = candidatesSse2(hay, blockStart); mask != 0;)
+				{
+					const int bit = 31 - std::countl_zero(mask);
+					const size_t candidate = blockStart + bit / 2;
+					if (equalFolded(hay + candidate, folded.data(), folded.size()))
+						return candidate;
+					mask &= ~(1u << bit);
+				}
+			}
+			return searchNpos;
+		}
+#endif
+
+	public:
+		//Char is char16_t or any type converting to it (UChar)
+		template <class Char>
+		constexpr IgnoreCaseNeedle(const Char* ptr, size_t count) : folded(count, u'\0')
+		{
+			for (size_t i = 0; i < count; ++i)
+				folded[i] = foldCase(char16_t(ptr[i]));
+			if (count != 0)
+			{
+				firstCount = caseVariants(folded.front(), firstVariants, maxVariants);
+				lastCount = caseVariants(folded.back(), lastVariants, maxVariants);
+			}
+		}
+
+		size_t size() const noexcept { return folded.size(); }
+
+		bool matchesAt(const char16_t* ptr) const noexcept { return equalFolded(ptr, folded.data(), folded.size()); }
+
+		//first match starting at or after off
+		size_t find(const char16_t* hay, size_t hayLen, size_t off = 0) const noexcept
+		{
+			const size_t m = folded.size();
+			if (m == 0 || off > hayLen || hayLen - off < m)
+				return searchNpos;
+
+			const size_t lastStart = hayLen - m;
+			size_t pos = off;
+#if defined(USTRING_SSE2)
+			if (firstCount != 0 || lastCount != 0)
+			{
+				const auto res = findBlocks(hay, pos, lastStart);
+				if (res != searchNpos)
+					return res;
+			}
+#endif
+			for (; pos <= lastStart; ++pos)
+				if (isFirst(hay[pos]) && equalFolded(hay + pos, folded.data(), m))
+					return pos;
+
+			return searchNpos;
+		}
+
+		//last match starting at or after off
+		size_t rfind(const char16_t* hay, size_t hayLen, size_t off = 0) const noexcept
+		{
+			const size_t m = folded.size();
+			if (m == 0 || off > hayLen || hayLen - off < m)
+				return searchNpos;
+
+			size_t pos = hayLen - m;
+#if defined(USTRING_SSE2)
+			if (firstCount != 0 || lastCount != 0)
+			{
+				const auto res = rfindBlocks(hay, pos, off);
+				if (res != searchNpos)
+					return res;
+			}
+#endif
+			for (; pos >= off && pos != searchNpos; --pos)
+				if (isFirst(hay[pos]) && equalFolded(hay + pos, folded.data(), m))
+					return pos;
+
+			return searchNpos;
+		}
+	};
+
+	//exact (case-sensitive) search: memchr-like scan for one unit, first/last unit filter for longer needles.
+	//needles longer than shortNeedleMax fall back to two-way with a shift table (linear in the worst case)
+	//when the filter gives too many false candidates
+
+	constexpr size_t shortNeedleMax = 32;
+
+#if defined(USTRING_SSE2)
+	USTRING_TARGET_AVX2 inline size_t findUnitAvx2(const char16_t* hay, size_t len, size_t& pos, char16_t c) noexcept
+	{
+		const __m256i v = _mm256_set1_epi16((short)c);
+		for (; pos + 16 <= len; pos += 16)
+		{
+			const unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + pos)), v));
+			if (mask != 0)
+				return pos + std::countr_zero(mask) / 2;
+		}
+		return searchNpos;
+	}
+
+	//pos is the end of the part still to check
+	USTRING_TARGET_AVX2 inline size_t rfindUnitAvx2(const char16_t* hay, size_t off, size_t& pos, char16_t c) noexcept
+	{
+		const __m256i v = _mm256_set1_epi16((short)c);
+		for (; pos >= off + 16; pos -= 16)
+		{
+			const unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + pos - 16)), v));
+			if (mask != 0)
+				return pos - 16 + (31 - std::countl_zero(mask)) / 2;
+		}
+		return searchNpos;
+	}
+#endif
+
+	inline size_t findUnit(const char16_t* hay, size_t len, size_t off, char16_t c) noexcept
+	{
+		size_t pos = off;
+#if defined(USTRING_SSE2)
+		if (hasAvx2())
+		{
+			const auto res = findUnitAvx2(hay, len, pos, c);
+			if (res != searchNpos)
+				return res;
+		}
+		const __m128i v = _mm_set1_epi16((short)c);
+		for (; pos + 8 <= len; pos += 8)
+		{
+			const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + pos)), v));
+			if (mask != 0)
+				return pos + std::countr_zero(mask) / 2;
+		}
+#endif
+		for (; pos < len; ++pos)
+			if (hay[pos] == c)
+				return pos;
+		return searchNpos;
+	}
+
+	//last position at or after off
+	inline size_t rfindUnit(const char16_t* hay, size_t len, size_t off, char16_t c) noexcept
+	{
+		size_t pos = len;
+#if defined(USTRING_SSE2)
+		if (hasAvx2())
+		{
+			const auto res = rfindUnitAvx2(hay, off, pos, c);
+			if (res != searchNpos)
+				return res;
+		}
+		const __m128i v = _mm_set1_epi16((short)c);
+		for (; pos >= off + 8; pos -= 8)
+		{
+			const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + pos - 8)), v));
+			if (mask != 0)
+				return pos - 8 + (31 - std::countl_zero(mask)) / 2;
+		}
+#endif
+		while (pos > off)
+			if (hay[--pos] == c)
+				return pos;
+		return searchNpos;
+	}
+
+	inline bool equalUnits(const char16_t* str0, const char16_t* str1, size_t count) noexcept
+	{
+		return std::char_traits<char16_t>::compare(str0, str1, count) == 0;
+	}
+
+	//false candidates of the filter allowed for a long needle before falling back to two-way:
+	//the filter is faster on usual text, two-way keeps the worst case linear
+	struct FilterBudget
+	{
+		bool bounded;
+		size_t start;
+		size_t failures = 0;
+		bool exhausted = false;
+
+		bool fail(size_t pos) noexcept
+		{
+			++failures;
+			exhausted = bounded && failures > 16 + (pos > start ? pos - start : start - pos) / 8;
+			return exhausted;
+		}
+	};
+
+#if defined(USTRING_SSE2)
+	USTRING_TARGET_AVX2 inline size_t findFilteredAvx2(const char16_t* hay, size_t lastStart, size_t& pos, const char16_t* needle, size_t m, FilterBudget& budget) noexcept
+	{
+		const __m256i first = _mm256_set1_epi16((short)needle[0]);
+		const __m256i last = _mm256_set1_epi16((short)needle[m - 1]);
+		for (; pos + 15 <= lastStart; pos += 16)
+		{
+			const __m256i f = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + pos)), first);
+			const __m256i l = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + pos + m - 1)), last);
+			for (unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(f, l)) & 0x55555555u; mask != 0; mask &= mask - 1)
+			{
+				const size_t candidate = pos + std::countr_zero(mask) / 2;
+				if (equalUnits(hay + candidate + 1, needle + 1, m - 2))
+					return candidate;
+				if (budget.fail(pos))
+					return searchNpos;
+			}
+		}
+		return searchNpos;
+	}
+
+	//pos is the highest start still to check
+	USTRING_TARGET_AVX2 inline size_t rfindFilteredAvx2(const char16_t* hay, size_t firstStart, size_t& pos, const char16_t* needle, size_t m, FilterBudget& budget) noexcept
+	{
+		const __m256i first = _mm256_set1_epi16((short)needle[0]);
+		const __m256i last = _mm256_set1_epi16((short)needle[m - 1]);
+		for (; pos >= firstStart + 15 && pos != searchNpos; pos -= 16)
+		{
+			const size_t blockStart = pos - 15;
+			const __m256i f = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + blockStart)), first);
+			const __m256i l = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(hay + blockStart + m - 1)), last);
+			for (unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(f, l)) & 0x55555555u; mask != 0;)
+			{
+				const int bit = 31 - std::countl_zero(mask);
+				const size_t candidate = blockStart + bit / 2;
+				if (equalUnits(hay + candidate + 1, needle + 1, m - 2))
+					return candidate;
+				if (budget.fail(pos))
+					return searchNpos;
+				mask &= ~(1u << bit);
+			}
+		}
+		return searchNpos;
+	}
+#endif
+
+	//first/last unit filter for m >= 2: first match with a start in pos..lastStart.
+	//when the budget is exhausted, returns npos and pos is where the search must continue
+	inline size_t findFiltered(const char16_t* hay, size_t lastStart, size_t& pos, const char16_t* needle, size_t m, FilterBudget& budget) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (hasAvx2())
+		{
+			const auto res = findFilteredAvx2(hay, lastStart, pos, needle, m, budget);
+			if (res != searchNpos || budget.exhausted)
+				return res;
+		}
+		const __m128i first = _mm_set1_epi16((short)needle[0]);
+		const __m128i last = _mm_set1_epi16((short)needle[m - 1]);
+		for (; pos + 7 <= lastStart; pos += 8)
+		{
+			const __m128i f = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + pos)), first);
+			const __m128i l = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + pos + m - 1)), last);
+			for (unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(f, l)) & 0x5555u; mask != 0; mask &= mask - 1)
+			{
+				const size_t candidate = pos + std::countr_zero(mask) / 2;
+				if (equalUnits(hay + candidate + 1, needle + 1, m - 2))
+					return candidate;
+				if (budget.fail(pos))
+					return searchNpos;
+			}
+		}
+#endif
+		for (; pos <= lastStart; ++pos)
+		{
+			if (hay[pos] == needle[0] && hay[pos + m - 1] == needle[m - 1])
+			{
+				if (equalUnits(hay + pos + 1, needle + 1, m - 2))
+					return pos;
+				if (budget.fail(pos))
+					return searchNpos;
+			}
+		}
+		return searchNpos;
+	}
+
+	//same as findFiltered backwards: last match with a start in firstStart..pos
+	inline size_t rfindFiltered(const char16_t* hay, size_t firstStart, size_t& pos, const char16_t* needle, size_t m, FilterBudget& budget) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (hasAvx2())
+		{
+			const auto res = rfindFilteredAvx2(hay, firstStart, pos, needle, m, budget);
+			if (res != searchNpos || budget.exhausted)
+				return res;
+		}
+		const __m128i first = _mm_set1_epi16((short)needle[0]);
+		const __m128i last = _mm_set1_epi16((short)needle[m - 1]);
+		for (; pos >= firstStart + 7 && pos != searchNpos; pos -= 8)
+		{
+			const size_t blockStart = pos - 7;
+			const __m128i f = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + blockStart)), first);
+			const __m128i l = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(hay + blockStart + m - 1)), last);
+			for (unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(f, l)) & 0x5555u; mask != 0;)
+			{
+				const int bit = 31 - std::countl_zero(mask);
+				const size_t candidate = blockStart + bit / 2;
+				if (equalUnits(hay + candidate + 1, needle + 1, m - 2))
+					return candidate;
+				if (budget.fail(pos))
+					return searchNpos;
+				mask &= ~(1u << bit);
+			}
+		}
+#endif
+		for (; pos >= firstStart && pos != searchNpos; --pos)
+		{
+			if (hay[pos] == needle[0] && hay[pos + m - 1] == needle[m - 1])
+			{
+				if (equalUnits(hay + pos + 1, needle + 1, m - 2))
+					return pos;
+				if (budget.fail(pos))
+					return searchNpos;
+			}
+		}
+		return searchNpos;
+	}
+
+	//two-way string matching (Crochemore-Perrin) with a Horspool-like skip on the last unit,
+	//units are hashed by their low byte for the skip table.
+	//reverse == true searches the reversed needle in the reversed text, giving the last match.
+	//the needle is not stored, the same one must be passed to find
+	template <bool reverse>
+	class TwoWay
+	{
+		size_t m = 0;
+		size_t ms = 0;		//critical position - 1 (may be npos)
+		size_t period = 0;
+		size_t mem0 = 0;	//for periodic needles: the prefix known to match after a shift by period
+		uint64_t unitSet[4]{};
+		size_t shift[256]{};	//1 + last position of a low byte in the needle
+
+		static constexpr char16_t at(const char16_t* str, size_t len, size_t i) noexcept { return reverse ? str[len - 1 - i] : str[i]; }
+
+		//maximal suffix for the unit order (or the opposite one), returns its start - 1
+		static constexpr size_t maximalSuffix(const char16_t* needle, size_t m, bool opposite, size_t& period) noexcept
+		{
+			size_t ip = searchNpos;
+			size_t jp = 0;
+			size_t k = 1;
+			period = 1;
+			while (jp + k < m)
+			{
+				const auto a = at(needle, m, ip + k);
+				const auto b = at(needle, m, jp + k);
+				if (a == b)
+				{
+					if (k == period)
+					{
+						jp += period;
+						k = 1;
+					}
+					else
+						++k;
+				}
+				else if (opposite ? a < b : a > b)
+				{
+					jp += k;
+					k = 1;
+					period = jp - ip;
+				}
+				else
+				{
+					ip = jp++;
+					k = period = 1;
+				}
+			}
+			return ip;
+		}
+
+	public:
+		constexpr TwoWay() noexcept = default;
+		constexpr TwoWay(const char16_t* needle, size_t m) noexcept : m(m)
+		{
+			for (size_t i = 0; i < m; ++i)
+			{
+				const unsigned b = at(needle, m, i) & 0xFF;
+				unitSet[b >> 6] |= uint64_t(1) << (b & 63);
+				shift[b] = i + 1;
+			}
+
+			size_t p0 = 0;
+			ms = maximalSuffix(needle, m, false, p0);
+			const size_t ms1 = maximalSuffix(needle, m, true, period);
+			if (ms1 + 1 > ms + 1)
+				ms = ms1;
+			else
+				period = p0;
+
+			bool periodic = true;
+			for (size_t i = 0; i < ms + 1 && periodic; ++i)
+				periodic = at(needle, m, i) == at(needle, m, i + period);
+
+			if (periodic)
+				mem0 = m - period;
+			else
+				period = std::max(ms + 1, m - ms - 1) + 1;
+		}
+
+		//first match in the search direction, as a position from the start of hay
+		size_t find(const char16_t* needle, const char16_t* hay, size_t len) const noexcept
+		{
+			size_t pos = 0;
+			size_t mem = 0;
+			while (len - pos >= m)
+			{
+				const unsigned b = at(hay, len, pos + m - 1) & 0xFF;
+				if ((unitSet[b >> 6] >> (b & 63) & 1) == 0)
+				{
+					pos += m;
+					mem = 0;
+					continue;
+				}
+				size_t k = m - shift[b];
+				if (k != 0)
+				{
+					pos += std::max(k, mem);
+					mem = 0;
+					continue;
+				}
+
+				//right part, then left part
+				for (k = std::max(ms + 1, mem); k < m && at(needle, m, k) == at(hay, len, pos + k); ++k);
+				if (k < m)
+				{
+					pos += k - ms;
+					mem = 0;
+					continue;
+				}
+				for (k = ms + 1; k > mem && at(needle, m, k - 1) == at(hay, len, pos + k - 1); --k);
+				if (k <= mem)
+					return reverse ? len - pos - m : pos;
+
+				pos += period;
+				mem = mem0;
+			}
+			return searchNpos;
+		}
+	};
+
+	//first match at or after off. twoWay may point to the tables prepared for this needle,
+	//otherwise they are built only if the search falls back to two-way
+	inline size_t findExact(const char16_t* hay, size_t len, size_t off, const char16_t* needle, size_t m, const TwoWay<false>* twoWay = nullptr) noexcept
+	{
+		if (m == 0 || off > len || len - off < m)
+			return searchNpos;
+		if (m == 1)
+			return findUnit(hay, len, off, needle[0]);
+
+		size_t pos = off;
+		FilterBudget budget{ m > shortNeedleMax, off };
+		const auto res = findFiltered(hay, len - m, pos, needle, m, budget);
+		if (budget.exhausted == false)
+			return res;
+
+		const auto twoWayRes = twoWay ? twoWay->find(needle, hay + pos, len - pos) : TwoWay<false>(needle, m).find(needle, hay + pos, len - pos);
+		return twoWayRes == searchNpos ? searchNpos : twoWayRes + pos;
+	}
+
+	//last match at or after off, twoWay as for findExact
+	inline size_t rfindExact(const char16_t* hay, size_t len, size_t off, const char16_t* needle, size_t m, const TwoWay<true>* twoWay = nullptr) noexcept
+	{
+		if (m == 0 || off > len || len - off < m)
+			return searchNpos;
+		if (m == 1)
+			return rfindUnit(hay, len, off, needle[0]);
+
+		size_t pos = len - m;
+		FilterBudget budget{ m > shortNeedleMax, pos };
+		const auto res = rfindFiltered(hay, off, pos, needle, m, budget);
+		if (budget.exhausted == false)
+			return res;
+
+		const auto twoWayRes = twoWay ? twoWay->find(needle, hay + off, pos + m - off) : TwoWay<true>(needle, m).find(needle, hay + off, pos + m - off);
+		return twoWayRes == searchNpos ? searchNpos : twoWayRes + off;
+	}
+}
+
+#endif
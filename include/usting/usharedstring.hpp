@@ -0,0 +1,161 @@
+#ifndef USHAREDSTRING_HPP
+#define USHAREDSTRING_HPP
+
+#include <atomic>
+#include <new>
+#include <compare>
+
+#include "ustring.hpp"
+
+//implicitly shared (copy-on-write) string: copies share one buffer with an atomic reference count,
+//so copying is O(1) and never allocates. a write detaches (copies the buffer) only if it is shared.
+//like QString, any number of threads may read and copy strings sharing a buffer,
+//but one USharedString object must not be written while another thread uses that same object
+class USharedString
+{
+	//header and characters in one allocation
+	struct Data
+	{
+		std::atomic<size_t> refs;
+		size_t size;
+		size_t capacity;
+
+		UChar* chars() noexcept { return reinterpret_cast<UChar*>(this + 1); }
+		const UChar* chars() const noexcept { return reinterpret_cast<const UChar*>(this + 1); }
+
+		static Data* create(size_t capacity)
+		{
+			auto res = new (::operator new(sizeof(Data) + (capacity + 1) * sizeof(UChar))) Data{ {1}, 0, capacity };
+			res->chars()[0] = UChar();
+			return res;
+		}
+		static Data* create(UStringView str, size_t capacity)
+		{
+			auto res = create(capacity);
+			if (str.empty() == false)
+				std::char_traits<UChar>::copy(res->chars(), str.data(), str.size());
+			res->size = str.size();
+			res->chars()[res->size] = UChar();
+			return res;
+		}
+	};
+
+	Data* d = nullptr;
+
+	static void release(Data* data) noexcept
+	{
+		if (data && data->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			data->~Data();
+			::operator delete(data);
+		}
+	}
+
+	//makes the buffer owned by this object only and able to hold capacity characters
+	void detach(size_t capacity);
+
+public:
+	USharedString() noexcept = default;
+	explicit USharedString(UStringView str) : d(str.empty() ? nullptr : Data::create(str, str.size())) {}
+	explicit USharedString(const UString& str) : USharedString(UStringView(str)) {}
+
+	USharedString(const USharedString& other) noexcept : d(other.d)
+	{
+		if (d)
+			d->refs.fetch_add(1, std::memory_order_relaxed);
+	}
+	USharedString(USharedString&& other) noexcept : d(other.d) { other.d = nullptr; }
+	~USharedString() { release(d); }
+
+	USharedString& operator=(const USharedString& other) noexcept
+	{
+		USharedString(other).swap(*this);
+		return *this;
+	}
+	USharedString& operator=(USharedString&& other) noexcept
+	{
+		USharedString(std::move(other)).swap(*this);
+		return *this;
+	}
+
+	void swap(USharedString& other) noexcept { std::swap(d, other.d); }
+
+	size_t size() const noexcept { return d ? d->size : 0; }
+	bool empty() const noexcept { return size() == 0; }
+	size_t capacity() const noexcept { return d ? d->capacity : 0; }
+
+	//true if the buffer is used by other strings too
+	bool isShared() const noexcept { return d && d->refs.load(std::memory_order_acquire) != 1; }
+	//true if both strings use the same buffer
+	bool isSharedWith(const USharedString& other) const noexcept { return d == other.d; }
+
+	//read access never detaches
+	const UChar* data() const noexcept { return d ? d->chars() : nullptr; }
+	const UChar* begin() const noexcept { return data(); }
+	const UChar* end() const noexcept { return data() + size(); }
+	const UChar& operator[](size_t ind) const noexcept { assert(ind < size()); return d->chars()[ind]; }
+	UStringView view() const noexcept { return UStringView(data(), size()); }
+	operator UStringView() const noexcept { return view(); }
+	UString toUString() const { return UString(view()); }
+
+	//write access detaches a shared buffer
+	UChar* mutableData();
+	void set(size_t ind, UChar c) { assert(ind < size()); mutableData()[ind] = c; }
+	void reserve(size_t count) { if (count > capacity()) detach(count); }
+	void clear() noexcept { release(d); d = nullptr; }
+
+	USharedString& operator+=(UStringView str);
+	USharedString& operator+=(UChar c) { return operator+=(UStringView(&c, 1)); }
+
+	friend bool operator==(const USharedString& str0, const USharedString& str1) noexcept
+	{
+		return str0.d == str1.d || str0.view() == str1.view();
+	}
+	friend bool operator==(const USharedString& str0, UStringView str1) noexcept { return str0.view() == str1; }
+	friend std::strong_ordering operator<=>(const USharedString& str0, const USharedString& str1) noexcept { return str0.view() <=> str1.view(); }
+	friend std::strong_ordering operator<=>(const USharedString& str0, UStringView str1) noexcept { return str0.view() <=> str1; }
+};
+
+inline void USharedString::detach(size_t capacity)
+{
+	if (d && d->capacity >= capacity && d->refs.load(std::memory_order_acquire) == 1)
+		return;
+
+	auto data = Data::create(view(), std::max(capacity, size()));
+	release(d);
+	d = data;
+}
+
+inline UChar* USharedString::mutableData()
+{
+	if (d == nullptr)
+		return nullptr;
+	detach(size());
+	return d->chars();
+}
+
+inline USharedString& USharedString::operator+=(UStringView str)
+{
+	if (str.empty())
+		return *this;
+
+	const auto newSize = size() + str.size();
+	if (newSize > capacity() || isShared())
+	{
+		//a view into this string stays valid: the old buffer is released after copying
+		auto data = Data::create(view(), newSize > capacity() ? std::max(newSize, capacity() * 2) : capacity());
+		std::char_traits<UChar>::copy(data->chars() + data->size, str.data(), str.size());
+		data->size = newSize;
+		data->chars()[newSize] = UChar();
+		release(d);
+		d = data;
+		return *this;
+	}
+
+	std::char_traits<UChar>::move(d->chars() + d->size, str.data(), str.size());
+	d->size = newSize;
+	d->chars()[newSize] = UChar();
+	return *this;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef USIMD_HPP
+#define USIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+
+//define USTRING_NO_SIMD to force the scalar code paths
+#if !defined(USTRING_NO_SIMD) && (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define USTRING_SSE2 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define USTRING_TARGET_AVX2
+#define USTRING_NOINLINE __declspec(noinline)
+#else
+#define USTRING_TARGET_AVX2 __attribute__((target("avx2")))
+#define USTRING_NOINLINE __attribute__((noinline))
+#endif
+#endif
+
+namespace ustring_detail
+{
+	struct CpuFeatures
+	{
+		bool avx2 = false;
+	};
+
+	//detected once, on first use
+	inline const CpuFeatures& cpuFeatures() noexcept
+	{
+		static const CpuFeatures features = []() noexcept
+			{
+				CpuFeatures res;
+#if defined(USTRING_SSE2)
+#if defined(_MSC_VER) && !defined(__clang__)
+				int info[4]{};
+				__cpuid(info, 0);
+				if (info[0] >= 7)
+				{
+					__cpuid(info, 1);
+					const bool osxsave = (info[2] & (1 << 27)) != 0;
+					const bool avx = (info[2] & (1 << 28)) != 0;
+					if (osxsave && avx && (_xgetbv(0) & 6) == 6)
+					{
+						__cpuidex(info, 7, 0);
+						res.avx2 = (info[1] & (1 << 5)) != 0;
+					}
+				}
+#else
+				__builtin_cpu_init();
+				res.avx2 = __builtin_cpu_supports("avx2");
+#endif
+#endif
+				return res;
+			}();
+		return features;
+	}
+
+	inline bool hasAvx2() noexcept { return cpuFeatures().avx2; }
+}
+
+#endif
@@ -6,7 +6,32 @@
 #include <locale>
 #include <charconv>
 #include <filesystem>
-#include <codecvt>
+#include <string_view>
+#include <vector>
+#include <compare>
+#include <ranges>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <memory>
+#include <functional>
+#include <memory_resource>
+#include <system_error>
+#include <version>
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+#include "uutf.hpp"
+#include "ulatin1.hpp"
+#include "uunicode_data.hpp"
+#include "usearch.hpp"
+#include "uhash.hpp"
+#include "unumparse.hpp"
+#include "unumformat.hpp"
+#include "ucasemap.hpp"
+#include "unormalize.hpp"
+#include "ugrapheme.hpp"
 
 #ifdef QT_CORE_LIB
 #include <QString>
@@ -16,7 +41,29 @@ class UChar
 {
 	char16_t c;
 
-	inline static const std::ctype<wchar_t>& ctype = std::use_facet<std::ctype<wchar_t>>(std::locale::classic());
+public:
+	//unicode general category, same order as the ucd abbreviations Lu, Ll, Lt ... Co, Cn
+	enum class Category : uint8_t
+	{
+		LetterUppercase, LetterLowercase, LetterTitlecase, LetterModifier, LetterOther,
+		MarkNonSpacing, MarkSpacingCombining, MarkEnclosing,
+		NumberDecimalDigit, NumberLetter, NumberOther,
+		PunctuationConnector, PunctuationDash, PunctuationOpen, PunctuationClose,
+		PunctuationInitialQuote, PunctuationFinalQuote, PunctuationOther,
+		SymbolMath, SymbolCurrency, SymbolModifier, SymbolOther,
+		SeparatorSpace, SeparatorLine, SeparatorParagraph,
+		OtherControl, OtherFormat, OtherSurrogate, OtherPrivateUse, OtherNotAssigned
+	};
+
+private:
+	constexpr const ustring_detail::UnicodeProps& props() const noexcept { return ustring_detail::unicodePropsOf(c); }
+
+	//mask of the categories first..last
+	static constexpr uint32_t categories(Category first, Category last) noexcept
+	{
+		return (2u << uint8_t(last)) - (1u << uint8_t(first));
+	}
+	constexpr bool isCategory(uint32_t mask) const noexcept { return ((1u << props().category) & mask) != 0; }
 
 public:
 	constexpr UChar() noexcept = default;
@@ -25,75 +72,921 @@ public:
 	constexpr UChar(char8_t c) noexcept :c(c) {}
 	constexpr UChar(wchar_t c) noexcept :c(c) {}
 
-	constexpr UChar(const UChar&) noexcept = default;
-	constexpr UChar(UChar&&)noexcept = default;
-	constexpr ~UChar()noexcept = default;
+	constexpr UChar(const UChar&) noexcept = default;
+	constexpr UChar(UChar&&)noexcept = default;
+	constexpr ~UChar()noexcept = default;
+
+	//simple (one to one) unicode case mapping
+	constexpr UChar toUpper() const noexcept { return fromCode(char16_t(c + props().upperDelta)); }
+	constexpr UChar toLower() const noexcept { return fromCode(char16_t(c + props().lowerDelta)); }
+
+	constexpr Category category() const noexcept { return Category(props().category); }
+
+	//decimal digit of any script
+	constexpr bool isDigit() const noexcept { return category() == Category::NumberDecimalDigit; }
+	//is this symbol alphabet or number
+	constexpr bool isAlnum() const noexcept
+	{
+		return isCategory(categories(Category::LetterUppercase, Category::LetterOther) | categories(Category::NumberDecimalDigit, Category::NumberDecimalDigit));
+	}
+	//is hex digit
+	constexpr bool isXDigit() const noexcept { return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f'); }
+	//is alphabet symbol
+	constexpr bool isAlpha() const noexcept { return isCategory(categories(Category::LetterUppercase, Category::LetterOther)); }
+	//unicode white space: space, tabs, line breaks and others
+	constexpr bool isSpace() const noexcept { return (props().flags & ustring_detail::unicodeFlagWhiteSpace) != 0; }
+	constexpr bool isUpper() const noexcept { return category() == Category::LetterUppercase; }
+	constexpr bool isLower() const noexcept { return category() == Category::LetterLowercase; }
+	//, . ' and other punctuation or symbols
+	constexpr bool isPunct() const noexcept { return isCategory(categories(Category::PunctuationConnector, Category::SymbolOther)); }
+	//this non control symbols: no separators, controls, format, surrogates or unassigned
+	constexpr bool isPrint() const noexcept
+	{
+		return !isCategory(categories(Category::SeparatorSpace, Category::OtherSurrogate) | categories(Category::OtherNotAssigned, Category::OtherNotAssigned));
+	}
+	//is control symbols
+	constexpr bool isCntrl() const noexcept { return category() == Category::OtherControl; }
+	constexpr bool isNull() const noexcept { return c == 0; }
+
+	constexpr int toCode() const noexcept { return c; }
+	constexpr char toChar() const noexcept { return c; }
+	constexpr wchar_t toWChar() const noexcept { return c; }
+	constexpr char16_t toChar16() const noexcept { return c; }
+	constexpr char8_t toChar8() const noexcept { return c; }
+	constexpr char32_t toChar32() const noexcept { return c; }
+#ifdef QT_CORE_LIB
+	constexpr QChar toQChar() const noexcept { return QChar(c); }
+#endif
+
+	static constexpr UChar fromCode(int code)noexcept { UChar res; res.c = code; return res; }
+
+	constexpr operator char16_t() const noexcept { return c; }
+
+	constexpr UChar& operator=(const UChar&)noexcept = default;
+	constexpr UChar& operator=(UChar&&)noexcept = default;
+};
+
+template <class Alloc = std::allocator<UChar>>
+class BasicUString;
+typedef BasicUString<> UString;
+//allocates from a std::pmr::memory_resource, e.g. a monotonic_buffer_resource arena
+typedef BasicUString<std::pmr::polymorphic_allocator<UChar>> UPmrString;
+
+class UStringView;
+
+template <class Separator>
+class USplitRange;
+
+class USearcher;
+
+class UCodePointRange;
+class UGraphemeRange;
+
+namespace ustring_detail
+{
+	template <class Pred>
+	class PredicateSeparator;
+
+	class FormatArg;
+}
+
+//non-owning read-only view of UChar sequence (pointer + length).
+//UString converts to it implicitly, so it can be passed anywhere a slice is enough
+class UStringView :
+	protected std::basic_string_view<UChar, std::char_traits<UChar>>
+{
+	typedef std::basic_string_view<UChar, std::char_traits<UChar>> src_view;
+
+	template <class Alloc>
+	friend class BasicUString;
+
+public:
+	constexpr UStringView()noexcept = default;
+	constexpr UStringView(const UChar* str, size_t count) noexcept : src_view(str, count) {}
+	constexpr UStringView(const UChar* startStr, const UChar* endStr) noexcept : src_view(startStr, endStr - startStr) {}
+	explicit constexpr UStringView(const UChar* str) noexcept : src_view(str) {}
+	UStringView(std::u16string_view str) noexcept : src_view((const UChar*)str.data(), str.size()) {}
+
+	constexpr UStringView(const UStringView&)noexcept = default;
+	constexpr UStringView& operator=(const UStringView&)noexcept = default;
+
+	using src_view::at;
+	using src_view::size;
+
+	using src_view::operator[];
+
+	using src_view::back;
+	using src_view::front;
+
+	using src_view::begin;
+	using src_view::end;
+
+	using src_view::data;
+	using src_view::empty;
+
+	using src_view::npos;
+
+	constexpr void removePrefix(size_t count) { src_view::remove_prefix(count); }
+	constexpr void removeSuffix(size_t count) { src_view::remove_suffix(count); }
+
+	constexpr size_t find(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept;
+	constexpr size_t find(UStringView str, size_t off = 0, bool ignoreCase = false)const noexcept;
+	constexpr size_t rfind(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept;
+	constexpr size_t rfind(UStringView str, size_t off = 0, bool ignoreCase = false)const noexcept;
+
+	//count is clamped to the end of the view
+	constexpr UStringView substr(size_t off, size_t count = npos)const noexcept;
+	constexpr std::vector<UStringView> split(UStringView separator, bool ignoreCase = false, bool saveEmpty = true)const;
+
+	//lazy split: pieces are found one at a time while iterating, nothing is allocated
+	constexpr USplitRange<USearcher> lazySplit(UStringView separator, bool ignoreCase = false, bool saveEmpty = true)const;
+	constexpr USplitRange<USearcher> lazySplit(UChar separator, bool ignoreCase = false, bool saveEmpty = true)const;
+	//every symbol for which pred returns true is a separator
+	template <class Pred> requires std::predicate<const Pred&, UChar>
+	constexpr USplitRange<ustring_detail::PredicateSeparator<Pred>> lazySplit(Pred pred, bool saveEmpty = true)const;
+
+	constexpr bool startsWith(UStringView val, bool ignoreCase = false)const noexcept;
+	constexpr bool endsWith(UStringView val, bool ignoreCase = false)const noexcept;
+
+	constexpr bool contains(UStringView str, bool ignoreCase = false)const noexcept { return find(str, 0, ignoreCase) != npos; }
+	constexpr bool contains(UChar c, bool ignoreCase = false)const noexcept { return find(c, 0, ignoreCase) != npos; }
+
+	constexpr size_t count(UStringView subStr, bool ignoreCase = false)const noexcept;
+	constexpr size_t count(UChar c, bool ignoreCase = false)const noexcept;
+
+	//code points and extended grapheme clusters (user-perceived characters), found while iterating
+	constexpr UCodePointRange codePoints()const noexcept;
+	constexpr UGraphemeRange graphemes()const noexcept;
+	//surrogate pairs count once, the units are counted in SIMD blocks
+	constexpr size_t codePointCount()const noexcept { return ustring_detail::codePointCount(data(), size()); }
+	constexpr size_t graphemeCount()const noexcept;
+	//the first n code points or grapheme clusters: a cut for a display limit never splits a surrogate pair or a character
+	constexpr UStringView leftCodePoints(size_t n)const noexcept { return UStringView(data(), ustring_detail::codePointsEnd(data(), size(), n)); }
+	constexpr UStringView leftGraphemes(size_t n)const noexcept { return UStringView(data(), ustring_detail::graphemesEnd(data(), size(), n)); }
+
+	//offset of the first unpaired surrogate (a cut may split a pair), npos if the text is valid utf-16
+	constexpr size_t validateUtf16()const noexcept
+	{
+		const auto res = ustring_detail::utf16ValidLength(data(), size());
+		return res == size() ? npos : res;
+	}
+	constexpr bool isValidUtf16()const noexcept { return ustring_detail::utf16ValidLength(data(), size()) == size(); }
+
+	//the units are parsed in place, nothing is copied or allocated for integers
+	template <class T> requires std::integral<T>
+	constexpr UParseResult<T> parseIntegral(uint8_t base = 10, UParseMode mode = UParseMode::Strict) const noexcept
+	{
+		return ustring_detail::parseIntegral<T>(data(), size(), base, mode);
+	}
+	//same syntax as std::from_chars, exactly rounded
+	template <class T> requires std::floating_point<T>
+	UParseResult<T> parseFloatingPoint(UParseMode mode = UParseMode::Strict, std::chars_format format = std::chars_format::general) const
+	{
+		return ustring_detail::parseFloatingPoint<T>(data(), size(), format, mode);
+	}
+
+	//lenient parse of the whole view: done is false if anything but white space surrounds the number
+	template <class T>
+	std::enable_if_t<std::is_integral<T>::value, T>
+		toIntegral(uint8_t base = 10, bool* done = nullptr) const;
+
+	template <class T>
+	std::enable_if_t<std::is_floating_point<T>::value, T>
+		toFloatingPoint(bool* done = nullptr) const;
+
+	//every field parsed as T (integers in base 10, floating point in general format) into one vector.
+	//invalid fields are T() and counted in invalid
+	template <class T, std::ranges::input_range Range>
+		requires (std::integral<T> || std::floating_point<T>) && std::convertible_to<std::ranges::range_reference_t<Range>, UStringView>
+	static std::vector<T> parseColumn(const Range& fields, UParseMode mode = UParseMode::Strict, size_t* invalid = nullptr);
+	//fields of buffer separated by delimiter, a delimiter at the very end does not start another field
+	template <class T> requires std::integral<T> || std::floating_point<T>
+	static std::vector<T> parseColumn(UStringView buffer, UChar delimiter, UParseMode mode = UParseMode::Strict, size_t* invalid = nullptr);
+
+	std::u16string_view toUtf16View()const noexcept { return std::u16string_view((const char16_t*)data(), size()); }
+
+	static bool compare(UStringView str0, UStringView str1, bool ignoreCase) noexcept;
+
+	friend constexpr bool operator==(UStringView str0, UStringView str1) noexcept
+	{
+		return src_view(str0) == src_view(str1);
+	}
+	friend constexpr std::strong_ordering operator<=>(UStringView str0, UStringView str1) noexcept
+	{
+		const auto res = src_view(str0).compare(src_view(str1));
+		return res < 0 ? std::strong_ordering::less : (res > 0 ? std::strong_ordering::greater : std::strong_ordering::equal);
+	}
+};
+
+//needle prepared once for searching any number of strings: the ignoreCase needle is folded
+//and the two-way tables of long needles are built in the constructor
+class USearcher
+{
+	std::basic_string<UChar> needle;
+	ustring_detail::TwoWay<false> forward;
+	ustring_detail::TwoWay<true> backward;
+	ustring_detail::IgnoreCaseNeedle folded;
+	bool ignoreCase;
+
+	const char16_t* needlePtr() const noexcept { return (const char16_t*)needle.data(); }
+
+public:
+	//the needle is copied, so a temporary can be passed
+	constexpr explicit USearcher(UStringView needle, bool ignoreCase = false);
+
+	constexpr size_t size() const noexcept { return needle.size(); }
+	constexpr bool isIgnoreCase() const noexcept { return ignoreCase; }
+	constexpr UStringView view() const noexcept { return UStringView(needle.data(), needle.size()); }
+
+	//same as UStringView::find and rfind: off is the lowest start position
+	constexpr size_t find(UStringView str, size_t off = 0) const noexcept;
+	constexpr size_t rfind(UStringView str, size_t off = 0) const noexcept;
+
+	//non-overlapping matches
+	constexpr size_t count(UStringView str) const noexcept;
+	constexpr bool contains(UStringView str) const noexcept { return find(str) != UStringView::npos; }
+};
+
+constexpr USearcher::USearcher(UStringView needle, bool ignoreCase) :
+	needle(needle.begin(), needle.end()), folded(needle.data(), ignoreCase ? needle.size() : 0), ignoreCase(ignoreCase)
+{
+	if (ignoreCase == false && needle.size() > ustring_detail::shortNeedleMax && std::is_constant_evaluated() == false)
+	{
+		forward = ustring_detail::TwoWay<false>(needlePtr(), size());
+		backward = ustring_detail::TwoWay<true>(needlePtr(), size());
+	}
+}
+
+constexpr size_t USearcher::find(UStringView str, size_t off) const noexcept
+{
+	if (ignoreCase)
+		return folded.find((const char16_t*)str.data(), str.size(), off);
+	if (std::is_constant_evaluated())
+		return str.find(view(), off);
+	return ustring_detail::findExact((const char16_t*)str.data(), str.size(), off, needlePtr(), size(), &forward);
+}
+
+constexpr size_t USearcher::rfind(UStringView str, size_t off) const noexcept
+{
+	if (ignoreCase)
+		return folded.rfind((const char16_t*)str.data(), str.size(), off);
+	if (std::is_constant_evaluated())
+		return str.rfind(view(), off);
+	return ustring_detail::rfindExact((const char16_t*)str.data(), str.size(), off, needlePtr(), size(), &backward);
+}
+
+constexpr size_t USearcher::count(UStringView str) const noexcept
+{
+	size_t res = 0;
+	if (size() == 0)
+		return res;
+
+	for (size_t off = find(str); off != UStringView::npos; off = find(str, off + size()))
+		++res;
+	return res;
+}
+
+namespace ustring_detail
+{
+	//separators of USplitRange (USearcher or PredicateSeparator): find returns the start of the next separator
+	//at or after off (npos if none), size is the separator size
+
+	template <class Pred>
+	class PredicateSeparator
+	{
+		Pred pred;
+
+	public:
+		constexpr PredicateSeparator(Pred pred) : pred(std::move(pred)) {}
+
+		constexpr size_t size() const noexcept { return 1; }
+
+		constexpr size_t find(UStringView str, size_t off) const
+		{
+			for (auto ptr = str.data() + off, end = str.data() + str.size(); ptr < end; ++ptr)
+				if (pred(*ptr))
+					return ptr - str.data();
+			return UStringView::npos;
+		}
+	};
+
+	struct ReplaceMatch
+	{
+		size_t pos;
+		size_t length;
+		UStringView after;
+	};
+
+	//replacers of UString::replace: next returns the first match at or after off (pos npos if none).
+	//the replacements are copied, so they may point into the string being changed
+
+	class SingleReplacer
+	{
+		USearcher before;
+		std::basic_string<UChar> after;
+
+	public:
+		constexpr SingleReplacer(UStringView before, UStringView after, bool ignoreCase) :
+			before(before, ignoreCase), after(after.begin(), after.end()) {}
+
+		constexpr bool shrinks() const noexcept { return after.size() <= before.size(); }
+		constexpr void reset() noexcept {}
+
+		constexpr ReplaceMatch next(UStringView str, size_t off) const noexcept
+		{
+			return { before.find(str, off), before.size(), UStringView(after.data(), after.size()) };
+		}
+	};
+
+	//the earliest match of any pair wins, on equal positions the pair listed first.
+	//the next match of every pair is kept, so each pair scans the string once
+	class MultiReplacer
+	{
+		static constexpr size_t unknown = UStringView::npos - 1;
+
+		std::vector<USearcher> befores;
+		std::vector<std::basic_string<UChar>> afters;
+		std::vector<size_t> nextPos;
+
+	public:
+		constexpr MultiReplacer(std::span<const std::pair<UStringView, UStringView>> pairs, bool ignoreCase)
+		{
+			befores.reserve(pairs.size());
+			afters.reserve(pairs.size());
+			for (const auto& [before, after] : pairs)
+			{
+				befores.emplace_back(before, ignoreCase);
+				afters.emplace_back(after.begin(), after.end());
+			}
+			reset();
+		}
+
+		constexpr bool shrinks() const noexcept
+		{
+			for (size_t i = 0; i < befores.size(); ++i)
+				if (afters[i].size() > befores[i].size())
+					return false;
+			return true;
+		}
+
+		constexpr void reset() { nextPos.assign(befores.size(), unknown); }
+
+		constexpr ReplaceMatch next(UStringView str, size_t off)
+		{
+			ReplaceMatch res{ UStringView::npos, 0, UStringView() };
+			for (size_t i = 0; i < befores.size(); ++i)
+			{
+				auto& pos = nextPos[i];
+				if (pos == unknown || (pos != UStringView::npos && pos < off))
+					pos = befores[i].find(str, off);
+				if (pos < res.pos)
+					res = { pos, befores[i].size(), UStringView(afters[i].data(), afters[i].size()) };
+			}
+			return res;
+		}
+	};
+}
+
+//forward range of the pieces of a string, yields views into it, so the string must outlive the range.
+//iteration can stop at any time: only the part of the string up to the current piece is scanned
+template <class Separator>
+class USplitRange : public std::ranges::view_interface<USplitRange<Separator>>
+{
+	UStringView str;
+	Separator separator;
+	bool saveEmpty;
+
+public:
+	class iterator
+	{
+		const USplitRange* range = nullptr;
+		size_t pos = UStringView::npos;
+		size_t pieceEnd = 0;
+
+		//from pos, skips empty pieces if they are not saved, npos at the end
+		constexpr void findPiece()
+		{
+			const auto size = range->str.size();
+			while (pos <= size)
+			{
+				pieceEnd = std::min(range->separator.find(range->str, pos), size);
+				if (pieceEnd != pos || range->saveEmpty)
+					return;
+				pos = nextPos();
+			}
+			pos = UStringView::npos;
+		}
+
+		constexpr size_t nextPos() const noexcept
+		{
+			//the last piece ends at the end of string, not at a separator
+			return pieceEnd == range->str.size() ? pieceEnd + 1 : pieceEnd + range->separator.size();
+		}
+
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = UStringView;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr iterator()noexcept = default;
+		constexpr explicit iterator(const USplitRange* range) : range(range), pos(0) { findPiece(); }
+
+		constexpr UStringView operator*() const noexcept { return UStringView(range->str.data() + pos, pieceEnd - pos); }
+
+		constexpr iterator& operator++()
+		{
+			pos = nextPos();
+			findPiece();
+			return *this;
+		}
+		constexpr iterator operator++(int)
+		{
+			auto res = *this;
+			++*this;
+			return res;
+		}
+
+		friend constexpr bool operator==(const iterator& it0, const iterator& it1) noexcept { return it0.pos == it1.pos; }
+		friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept { return it.pos == UStringView::npos; }
+	};
+
+	constexpr USplitRange(UStringView str, Separator separator, bool saveEmpty) :
+		str(str), separator(std::move(separator)), saveEmpty(saveEmpty) {}
+
+	constexpr iterator begin() const { return iterator(this); }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+//forward range of the code points of a string, surrogate pairs are combined and an unpaired surrogate
+//is yielded as it is. like USplitRange it refers to the string, which must outlive it
+class UCodePointRange : public std::ranges::view_interface<UCodePointRange>
+{
+	UStringView str;
+
+public:
+	class iterator
+	{
+		const UChar* ptr = nullptr;
+		const UChar* end = nullptr;
+
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = char32_t;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr iterator()noexcept = default;
+		constexpr iterator(const UChar* ptr, const UChar* end) noexcept : ptr(ptr), end(end) {}
+
+		constexpr char32_t operator*() const noexcept
+		{
+			size_t length = 1;
+			return ustring_detail::codePointAt(ptr, end - ptr, 0, length);
+		}
+		//the units of the current code point start here
+		constexpr const UChar* position() const noexcept { return ptr; }
+
+		constexpr iterator& operator++() noexcept
+		{
+			ptr += ustring_detail::codePointsEnd(ptr, end - ptr, 1);
+			return *this;
+		}
+		constexpr iterator operator++(int) noexcept
+		{
+			auto res = *this;
+			++*this;
+			return res;
+		}
+
+		friend constexpr bool operator==(const iterator& it0, const iterator& it1) noexcept { return it0.ptr == it1.ptr; }
+		friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept { return it.ptr == it.end; }
+	};
+
+	constexpr explicit UCodePointRange(UStringView str) noexcept : str(str) {}
+
+	constexpr iterator begin() const noexcept { return iterator(str.data(), str.data() + str.size()); }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+//forward range of the extended grapheme clusters of a string (UAX #29), yields views into it
+class UGraphemeRange : public std::ranges::view_interface<UGraphemeRange>
+{
+	UStringView str;
+
+public:
+	class iterator
+	{
+		const UChar* ptr = nullptr;
+		const UChar* next = nullptr;
+		const UChar* end = nullptr;
+
+		constexpr void findNext() noexcept { next = ptr == end ? end : ptr + ustring_detail::graphemeEnd(ptr, end - ptr, 0); }
+
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = UStringView;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr iterator()noexcept = default;
+		constexpr iterator(const UChar* ptr, const UChar* end) noexcept : ptr(ptr), end(end) { findNext(); }
+
+		constexpr UStringView operator*() const noexcept { return UStringView(ptr, next); }
+
+		constexpr iterator& operator++() noexcept
+		{
+			ptr = next;
+			findNext();
+			return *this;
+		}
+		constexpr iterator operator++(int) noexcept
+		{
+			auto res = *this;
+			++*this;
+			return res;
+		}
+
+		friend constexpr bool operator==(const iterator& it0, const iterator& it1) noexcept { return it0.ptr == it1.ptr; }
+		friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept { return it.ptr == it.end; }
+	};
+
+	constexpr explicit UGraphemeRange(UStringView str) noexcept : str(str) {}
+
+	constexpr iterator begin() const noexcept { return iterator(str.data(), str.data() + str.size()); }
+	constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+};
+
+constexpr UCodePointRange UStringView::codePoints()const noexcept
+{
+	return UCodePointRange(*this);
+}
+
+constexpr UGraphemeRange UStringView::graphemes()const noexcept
+{
+	return UGraphemeRange(*this);
+}
+
+constexpr size_t UStringView::graphemeCount()const noexcept
+{
+	size_t res = 0;
+	for (size_t i = 0; i < size(); i = ustring_detail::graphemeEnd(data(), size(), i))
+		++res;
+	return res;
+}
+
+template<class T>
+inline std::enable_if_t<std::is_integral<T>::value, T>
+UStringView::toIntegral(uint8_t base, bool* done) const
+{
+	const auto res = parseIntegral<T>(base, UParseMode::Lenient);
+	if (done)
+		*done = res && res.consumed == size();
+	return res.value;
+}
+
+template<class T>
+inline std::enable_if_t<std::is_floating_point<T>::value, T>
+UStringView::toFloatingPoint(bool* done) const
+{
+	const auto res = parseFloatingPoint<T>(UParseMode::Lenient);
+	if (done)
+		*done = res && res.consumed == size();
+	return res.value;
+}
+
+namespace ustring_detail
+{
+	template <class T>
+	inline UParseResult<T> parseField(const UChar* ptr, size_t count, UParseMode mode, bool prefix = false)
+	{
+		if constexpr (std::is_integral_v<T>)
+			return parseIntegral<T>(ptr, count, 10, mode, prefix);
+		else
+			return parseFloatingPoint<T>(ptr, count, std::chars_format::general, mode, prefix);
+	}
+}
+
+template <class T, std::ranges::input_range Range>
+	requires (std::integral<T> || std::floating_point<T>) && std::convertible_to<std::ranges::range_reference_t<Range>, UStringView>
+inline std::vector<T> UStringView::parseColumn(const Range& fields, UParseMode mode, size_t* invalid)
+{
+	std::vector<T> res;
+	if constexpr (std::ranges::sized_range<Range>)
+		res.reserve(std::ranges::size(fields));
+
+	size_t invalidCount = 0;
+	for (auto&& field : fields)
+	{
+		const UStringView str(field);
+		const auto parsed = ustring_detail::parseField<T>(str.data(), str.size(), mode);
+		invalidCount += !parsed;
+		res.push_back(parsed.value);
+	}
+	if (invalid)
+		*invalid = invalidCount;
+	return res;
+}
+
+template <class T> requires std::integral<T> || std::floating_point<T>
+inline std::vector<T> UStringView::parseColumn(UStringView buffer, UChar delimiter, UParseMode mode, size_t* invalid)
+{
+	std::vector<T> res;
+	size_t invalidCount = 0;
+	const auto ptr = buffer.data();
+	const auto size = buffer.size();
+
+	//strict fields are parsed as prefixes of the rest of the buffer and must end at a delimiter,
+	//so the buffer is read once. white space skipped by lenient parsing could cross a delimiter
+	const bool bounded = mode == UParseMode::Lenient;
+	for (size_t off = 0; off < size;)
+	{
+		size_t end = bounded ? buffer.find(delimiter, off) : npos;
+		auto parsed = ustring_detail::parseField<T>(ptr + off, (end == npos ? size : end) - off, mode, bounded == false);
+		if (bounded == false)
+		{
+			end = off + parsed.consumed;
+			if (end != size && ptr[end] != delimiter)
+			{
+				parsed = UParseResult<T>();
+				end = buffer.find(delimiter, end);
+			}
+		}
+		if (end == npos)
+			end = size;
+
+		invalidCount += !parsed;
+		res.push_back(parsed.value);
+		off = end + 1;
+	}
+	if (invalid)
+		*invalid = invalidCount;
+	return res;
+}
+
+constexpr size_t UStringView::find(UChar c, size_t off, bool ignoreCase)const noexcept
+{
+	assert(size() >= off);
+
+	if (ignoreCase==false)
+	{
+		if (std::is_constant_evaluated())
+			return src_view::find(c, off);
+		return ustring_detail::findUnit((const char16_t*)data(), size(), off, c);
+	}
+	else
+	{
+		const char16_t ch = c;
+		return ustring_detail::IgnoreCaseNeedle(&ch, 1).find((const char16_t*)data(), size(), off);
+	}
+}
+
+constexpr size_t UStringView::find(UStringView str, size_t off, bool ignoreCase)const noexcept
+{
+	auto otherStrSize = str.size();
+	if (otherStrSize == 0)
+		return npos;
+
+	assert(size() >= off);
+
+	if (ignoreCase == false)
+	{
+		if (std::is_constant_evaluated())
+			return src_view::find(str, off);
+		return ustring_detail::findExact((const char16_t*)data(), size(), off, (const char16_t*)str.data(), otherStrSize);
+	}
+	else
+	{
+		return ustring_detail::IgnoreCaseNeedle(str.data(), otherStrSize).find((const char16_t*)data(), size(), off);
+	}
+}
+
+constexpr size_t UStringView::rfind(UChar c, size_t off, bool ignoreCase)const noexcept
+{
+	assert(size() >= off);
+
+	if (ignoreCase == false)
+	{
+		if (std::is_constant_evaluated() == false)
+			return ustring_detail::rfindUnit((const char16_t*)data(), size(), off, c);
+
+		for (auto srcPtr = data() + size(), srcEnd = data() + off; srcPtr > srcEnd;)
+		{
+			--srcPtr;
+			if (*srcPtr == c)
+				return srcPtr - data();
+		}
+	}
+	else
+	{
+		const char16_t ch = c;
+		return ustring_detail::IgnoreCaseNeedle(&ch, 1).rfind((const char16_t*)data(), size(), off);
+	}
+	
+	return npos;
+}
+
+constexpr size_t UStringView::rfind(UStringView str, size_t off, bool ignoreCase)const noexcept
+{
+	if (str.size() == 0)
+		return npos;
+
+	assert(size() >= off);
+
+	if (str.size() > size() - off)
+		return npos;
+
+	if (ignoreCase == false)
+	{
+		if (std::is_constant_evaluated() == false)
+			return ustring_detail::rfindExact((const char16_t*)data(), size(), off, (const char16_t*)str.data(), str.size());
+
+		const auto otherPtr = str.data();
+		const auto otherEnd = otherPtr + str.size();
+		const auto c = str.front();
+
+		for (auto srcPtr = data() + size() - str.size() + 1, srcEnd = data() + off; srcPtr > srcEnd;)
+		{
+			--srcPtr;
+			if (*srcPtr == c)
+			{
+				auto tmpPtr0 = otherPtr + 1;
+				auto tmpPtr1 = srcPtr + 1;
+				while (tmpPtr0 < otherEnd)
+				{
+					if (*tmpPtr0 != *tmpPtr1)
+						break;
+					++tmpPtr0; ++tmpPtr1;
+				}
+
+				if (tmpPtr0 == otherEnd)
+					return srcPtr - data();
+			}
+		}
+	}
+	else
+	{
+		return ustring_detail::IgnoreCaseNeedle(str.data(), str.size()).rfind((const char16_t*)data(), size(), off);
+	}
+
+	return npos;
+}
+
+constexpr UStringView UStringView::substr(size_t off, size_t count)const noexcept
+{
+	assert(size() >= off);
+
+	return UStringView(data() + off, std::min(count, size() - off));
+}
+
+constexpr std::vector<UStringView> UStringView::split(UStringView separator, bool ignoreCase, bool saveEmpty)const
+{
+	std::vector<UStringView> res;
+	for (auto piece : lazySplit(separator, ignoreCase, saveEmpty))
+		res.push_back(piece);
+	return res;
+}
+
+constexpr USplitRange<USearcher> UStringView::lazySplit(UStringView separator, bool ignoreCase, bool saveEmpty)const
+{
+	return USplitRange<USearcher>(*this, USearcher(separator, ignoreCase), saveEmpty);
+}
+
+constexpr USplitRange<USearcher> UStringView::lazySplit(UChar separator, bool ignoreCase, bool saveEmpty)const
+{
+	return lazySplit(UStringView(&separator, 1), ignoreCase, saveEmpty);
+}
+
+template <class Pred> requires std::predicate<const Pred&, UChar>
+constexpr USplitRange<ustring_detail::PredicateSeparator<Pred>> UStringView::lazySplit(Pred pred, bool saveEmpty)const
+{
+	return USplitRange<ustring_detail::PredicateSeparator<Pred>>(*this, ustring_detail::PredicateSeparator<Pred>(std::move(pred)), saveEmpty);
+}
+
+constexpr bool UStringView::startsWith(UStringView val, bool ignoreCase)const noexcept
+{
+	if (ignoreCase == false)
+	{
+		return src_view::starts_with(val);
+	}
+	else if(size()>=val.size())
+	{
+		return ustring_detail::equalIgnoreCase((const char16_t*)data(), (const char16_t*)val.data(), val.size());
+	}
+
+	return false;
+}
+
+constexpr bool UStringView::endsWith(UStringView val, bool ignoreCase)const noexcept
+{
+	if (ignoreCase==false)
+	{
+		return src_view::ends_with(val);
+	}
+	else if (size() >= val.size())
+	{
+		auto sizeVal = val.size();
+
+		return ustring_detail::equalIgnoreCase((const char16_t*)data() + size() - sizeVal, (const char16_t*)val.data(), sizeVal);
+	}
+
+	return false;
+}
+
+constexpr size_t UStringView::count(UStringView subStr, bool ignoreCase)const noexcept
+{
+	return USearcher(subStr, ignoreCase).count(*this);
+}
+
+constexpr size_t UStringView::count(UChar c, bool ignoreCase)const noexcept
+{
+	size_t res = 0;
+
+	if (ignoreCase == false)
+	{
+		for (auto ptr = data(), end = ptr + size(); ptr < end; ++ptr)
+			res += *ptr == c;
+	}
+	else
+	{
+		const char16_t ch = c;
+		const ustring_detail::IgnoreCaseNeedle needle(&ch, 1);
+		const auto ptr = (const char16_t*)data();
+
+		for (size_t off = needle.find(ptr, size()); off != npos; off = needle.find(ptr, size(), off + 1))
+			++res;
+	}
 
-	UChar toUpper() const noexcept { return fromCode(ctype.toupper(c)); }
-	UChar toLower() const noexcept { return fromCode(ctype.tolower(c)); }
+	return res;
+}
 
-	bool isDigit() const noexcept { return ctype.is(ctype.digit, c); }
-	//is this symbol alphabet or number
-	bool isAlnum() const noexcept { return ctype.is(ctype.alnum, c); }
-	//is hex digit
-	bool isXDigit() const noexcept { return ctype.is(ctype.xdigit, c); }
-	//is alphabet symbol
-	bool isAlpha() const noexcept { return ctype.is(ctype.alpha, c); }
-	//is space or hor tab
-	bool isSpace() const noexcept { return ctype.is(ctype.space, c); }
-	bool isUpper() const noexcept { return ctype.is(ctype.upper, c); }
-	bool isLower() const noexcept { return ctype.is(ctype.lower, c); }
-	//, . ' and other
-	bool isPunct() const noexcept { return ctype.is(ctype.punct, c); }
-	//this non control symbols
-	bool isPrint() const noexcept { return ctype.is(ctype.graph, c); }
-	//is control symbols
-	bool isCntrl() const noexcept { return ctype.is(ctype.cntrl, c); }
-	constexpr bool isNull() const noexcept { return c == 0; }
+inline bool UStringView::compare(UStringView str0, UStringView str1, bool ignoreCase) noexcept
+{
+	if (ignoreCase)
+	{
+		if (str0.size() != str1.size())
+			return false;
+		else
+			return ustring_detail::equalIgnoreCase((const char16_t*)str0.data(), (const char16_t*)str1.data(), str0.size());
+	}
+	else
+	{
+		return str0 == str1;
+	}
+}
 
-	constexpr int toCode() const noexcept { return c; }
-	constexpr char toChar() const noexcept { return c; }
-	constexpr wchar_t toWChar() const noexcept { return c; }
-	constexpr char16_t toChar16() const noexcept { return c; }
-	constexpr char8_t toChar8() const noexcept { return c; }
-	constexpr char32_t toChar32() const noexcept { return c; }
-#ifdef QT_CORE_LIB
-	constexpr QChar toQChar() const noexcept { return QChar(c); }
-#endif
+//utf-16 string, Alloc allocates its UChar buffer. strings made by its functions
+//(substr, split, toUpper ...) use the allocator of the source string
+template <class Alloc>
+class BasicUString :
+	protected std::basic_string<UChar, std::char_traits<UChar>, Alloc>
+{
+	typedef std::basic_string<UChar, std::char_traits<UChar>, Alloc> src_str;
+	typedef typename std::allocator_traits<Alloc>::template rebind_alloc<BasicUString> vector_alloc;
 
-	static constexpr UChar fromCode(int code)noexcept { UChar res; res.c = code; return res; }
+	constexpr static size_t srtLen(const char* ptr) noexcept;
 
-	constexpr operator char16_t() const noexcept { return c; }
+	//const char* strings are latin-1: every byte is the code unit of the same value
+	constexpr void appendLatin(const char* str, size_t count);
 
-	constexpr UChar& operator=(const UChar&)noexcept = default;
-	constexpr UChar& operator=(UChar&&)noexcept = default;
-};
+	constexpr UStringView view() const noexcept { return UStringView(data(), size()); }
 
-class UString :
-	protected std::basic_string<UChar, std::char_traits<UChar>, std::allocator<UChar>>
-{
-	typedef std::basic_string<UChar, std::char_traits<UChar>, std::allocator<UChar>> src_str;
+	template <class Replacer>
+	constexpr size_t replaceWith(Replacer& replacer);
 
-	constexpr static bool isValidSymbolForNum(int c) noexcept;
-	constexpr static size_t srtLen(const char* ptr) noexcept;
+	//one pass into a string of the same size, the length is only counted after a mapping that grows
+	BasicUString mappedCase(ustring_detail::CaseMap mode)const;
+	void convertCase(ustring_detail::CaseMap mode);
 
 #if !NDEBUG
-	std::u16string& dbgView= *(std::u16string*)this;
+	typedef std::basic_string<char16_t, std::char_traits<char16_t>, typename std::allocator_traits<Alloc>::template rebind_alloc<char16_t>> dbg_str;
+	dbg_str& dbgView= *(dbg_str*)this;
 #endif
 
 public:
-	UString()noexcept = default;
-	explicit constexpr UString(uint32_t size, UChar ch = ' ') :src_str(size, ch) {}
-	explicit constexpr UString(const UChar* str) : src_str(str) {}
-	constexpr UString(const UChar* str, uint32_t count) : src_str(str, count) {}
-	constexpr UString(const UChar* startStr, const UChar* endStr) : src_str(startStr, endStr) {}
-	constexpr UString(const char* str, uint32_t count);
-	constexpr UString(const char* startPtr, const char* endPtr) :
-		UString(startPtr, srtLen(startPtr)) {}
-	constexpr UString(const char* str) : UString(str, srtLen(str)) {}
-
-	constexpr UString(const UString& other) : src_str(other) {}
-	constexpr UString(UString&& other)noexcept : src_str(std::move(other)) {}
+	typedef Alloc allocator_type;
+
+	BasicUString()noexcept(noexcept(Alloc())) = default;
+	explicit constexpr BasicUString(const Alloc& alloc)noexcept : src_str(alloc) {}
+	explicit constexpr BasicUString(uint32_t size, UChar ch = ' ', const Alloc& alloc = Alloc()) :src_str(size, ch, alloc) {}
+	explicit constexpr BasicUString(const UChar* str, const Alloc& alloc = Alloc()) : src_str(str, alloc) {}
+	constexpr BasicUString(const UChar* str, uint32_t count, const Alloc& alloc = Alloc()) : src_str(str, count, alloc) {}
+	constexpr BasicUString(const UChar* startStr, const UChar* endStr, const Alloc& alloc = Alloc()) : src_str(startStr, endStr, alloc) {}
+	constexpr BasicUString(const char* str, uint32_t count, const Alloc& alloc = Alloc());
+	constexpr BasicUString(const char* startPtr, const char* endPtr, const Alloc& alloc = Alloc()) :
+		BasicUString(startPtr, srtLen(startPtr), alloc) {}
+	constexpr BasicUString(const char* str, const Alloc& alloc = Alloc()) : BasicUString(str, srtLen(str), alloc) {}
+
+	constexpr BasicUString(const BasicUString& other) : src_str(other) {}
+	constexpr BasicUString(BasicUString&& other)noexcept : src_str(std::move(other)) {}
+	explicit constexpr BasicUString(UStringView str, const Alloc& alloc = Alloc()) : src_str(str.data(), str.size(), alloc) {}
+	//allocator-extended copy and move, used by allocator-aware containers (std::pmr::vector<UPmrString>)
+	constexpr BasicUString(const BasicUString& other, const Alloc& alloc) : src_str(other, alloc) {}
+	constexpr BasicUString(BasicUString&& other, const Alloc& alloc) : src_str(std::move(other), alloc) {}
+
+	constexpr Alloc getAllocator() const noexcept { return src_str::get_allocator(); }
+
+	constexpr operator UStringView() const noexcept { return view(); }
 
 	using src_str::at;
 	using src_str::size;
@@ -123,35 +1016,35 @@ public:
 	void popBack() { src_str::pop_back(); }
 	void shrinkToFit() { src_str::shrink_to_fit(); }
 
-	constexpr UString& operator=(UString&& val)noexcept { 
+	constexpr BasicUString& operator=(BasicUString&& val)noexcept { 
 		src_str::operator=(std::move(val));
 		return *this;
 	}
-	constexpr UString& operator=(const UString& val) { src_str::operator=(val); return *this; }
-	constexpr UString& operator=(const UChar* val) { src_str::operator=(val); return *this; }
-	constexpr UString& operator=(const char* val) { src_str::operator=(UString(val)); return *this; }
-	constexpr UString& operator=(UChar val) { src_str::operator=(val); return *this; }
-
-	constexpr UString& operator+=(UString&& val) { src_str::operator+=(std::move(val)); return *this; }
-	constexpr UString& operator+=(const UString& val) { src_str::operator+=(val); return *this; }
-	constexpr UString& operator+=(const char* val);
-	constexpr UString& operator+=(const UChar* val) { src_str::operator+=(val); return *this; }
-	constexpr UString& operator+=(UChar val) { src_str::operator+=(val); return *this; }
-
-	constexpr UString operator+(UString&& val) const {
-		UString str; str.reserve(size() + val.size()); str = *this; str += val; return str;
+	constexpr BasicUString& operator=(const BasicUString& val) { src_str::operator=(val); return *this; }
+	constexpr BasicUString& operator=(const UChar* val) { src_str::operator=(val); return *this; }
+	constexpr BasicUString& operator=(const char* val) { src_str::clear(); appendLatin(val, srtLen(val)); return *this; }
+	constexpr BasicUString& operator=(UChar val) { src_str::operator=(val); return *this; }
+
+	constexpr BasicUString& operator+=(BasicUString&& val) { src_str::operator+=(std::move(val)); return *this; }
+	constexpr BasicUString& operator+=(const BasicUString& val) { src_str::operator+=(val); return *this; }
+	constexpr BasicUString& operator+=(const char* val);
+	constexpr BasicUString& operator+=(const UChar* val) { src_str::operator+=(val); return *this; }
+	constexpr BasicUString& operator+=(UStringView val) { src_str::append(val.data(), val.size()); return *this; }
+	constexpr BasicUString& operator+=(UChar val) { src_str::operator+=(val); return *this; }
+
+#if !defined(USTRING_USE_STRINGBUILDER)
+	constexpr BasicUString operator+(BasicUString&& val) const {
+		BasicUString str(getAllocator()); str.reserve(size() + val.size()); str += *this; str += val; return str;
 	}
-	constexpr UString operator+(const UString& val) const {
-		UString str; str.reserve(size() + val.size()); str = *this; str += val; return str;
+	constexpr BasicUString operator+(const BasicUString& val) const {
+		BasicUString str(getAllocator()); str.reserve(size() + val.size()); str += *this; str += val; return str;
 	}
-	constexpr UString operator+(const char* val) const { UString str(*this); str += val; return str; }
-	constexpr UString operator+(const UChar* val) const { UString str(*this); str += val; return str; }
-
-	constexpr bool operator==(UString&& val) const noexcept;
-	constexpr bool operator!=(UString&& val) const noexcept { return !operator==(std::move(val)); }
+	constexpr BasicUString operator+(const char* val) const { BasicUString str(*this, getAllocator()); str += val; return str; }
+	constexpr BasicUString operator+(const UChar* val) const { BasicUString str(*this, getAllocator()); str += val; return str; }
+#endif
 
-	constexpr bool operator==(const UString& val) const noexcept { return *((src_str*)this) == *((src_str*)&val); }
-	constexpr bool operator!=(const UString& val)const noexcept { return !operator==(val); }
+	constexpr bool operator==(const BasicUString& val) const noexcept { return *((src_str*)this) == *((src_str*)&val); }
+	constexpr bool operator!=(const BasicUString& val)const noexcept { return !operator==(val); }
 
 	constexpr bool operator==(const UChar* val) const noexcept { return *((src_str*)this) == val; }
 	constexpr bool operator!=(const UChar* val)const noexcept { return !operator==(val); }
@@ -159,41 +1052,123 @@ public:
 	constexpr bool operator==(const char* val) const noexcept;
 	constexpr bool operator!=(const char* val)const noexcept { return !operator==(val); }
 
-	constexpr void popFront() { src_str::erase(0, 1); }
+	//numbers are formatted into the end of this string, it grows once per number
+	template <class T>
+	constexpr std::enable_if_t<std::is_integral<T>::value, BasicUString&> appendIntegral(T num, int base = 10);
+	//format and precision as in fromFloatingPoint
+	template <class T>
+	std::enable_if_t<std::is_floating_point<T>::value, BasicUString&> appendFloatingPoint(T num, uint8_t format = 'g', int8_t precision = -1);
+
+#if defined(__cpp_lib_format)
+	//std::format syntax, the utf-8 output is transcoded into the end of this string while it is produced
+	template <class... Args>
+	BasicUString& appendFormat(std::format_string<Args...> fmt, Args&&... args);
+	template <class... Args>
+	static BasicUString format(std::format_string<Args...> fmt, Args&&... args)
+	{
+		return format(Alloc(), fmt, std::forward<Args>(args)...);
+	}
+	//the allocator comes first, the arguments are a pack
+	template <class... Args>
+	static BasicUString format(const Alloc& alloc, std::format_string<Args...> fmt, Args&&... args)
+	{
+		BasicUString res(alloc);
+		res.appendFormat(fmt, std::forward<Args>(args)...);
+		return res;
+	}
+#endif
 
-	constexpr size_t find(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept;
-	constexpr size_t find(const UString& str, size_t off = 0, bool ignoreCase = false)const noexcept;
-	constexpr size_t rfind(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept;
-	constexpr size_t rfind(const UString& str, size_t off = 0, bool ignoreCase = false)const noexcept;
+	//Qt-style arg(): the lowest numbered placeholder (%1 ... %99) gets the first argument, the next lowest the second...
+	//a number used several times gets the same argument everywhere, placeholders without an argument stay as they are.
+	//arguments are strings, UChar, latin-1 const char*, integers (decimal) and floating point (shortest round trip).
+	//the result is sized exactly and written in one pass
+	template <class... Args> requires (sizeof...(Args) > 0) && (std::constructible_from<ustring_detail::FormatArg, const Args&> && ...)
+	BasicUString arg(const Args&... args) const;
+
+	constexpr void popFront() { src_str::erase(0, 1); }
 
-	constexpr UString substr(size_t off, size_t count)const;
-	constexpr std::vector<UString> split(const UString& separator, bool ignoreCase = false, bool saveEmpty = true)const;
+	constexpr size_t find(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept { return view().find(c, off, ignoreCase); }
+	constexpr size_t find(const BasicUString& str, size_t off = 0, bool ignoreCase = false)const noexcept { return view().find(str, off, ignoreCase); }
+	constexpr size_t find(UStringView str, size_t off = 0, bool ignoreCase = false)const noexcept { return view().find(str, off, ignoreCase); }
+	constexpr size_t rfind(UChar c, size_t off = 0, bool ignoreCase = false)const noexcept { return view().rfind(c, off, ignoreCase); }
+	constexpr size_t rfind(const BasicUString& str, size_t off = 0, bool ignoreCase = false)const noexcept { return view().rfind(str, off, ignoreCase); }
+	constexpr size_t rfind(UStringView str, size_t off = 0, bool ignoreCase = false)const noexcept { return view().rfind(str, off, ignoreCase); }
+
+	constexpr BasicUString substr(size_t off, size_t count)const;
+	//same as substr, but without copying: the view is valid while this string is not modified
+	constexpr UStringView substrView(size_t off, size_t count = npos)const noexcept { return view().substr(off, count); }
+	constexpr std::vector<BasicUString, vector_alloc> split(const BasicUString& separator, bool ignoreCase = false, bool saveEmpty = true)const;
+	//same as split, but pieces are views into this string
+	constexpr std::vector<UStringView> splitView(UStringView separator, bool ignoreCase = false, bool saveEmpty = true)const { return view().split(separator, ignoreCase, saveEmpty); }
+	//lazy split range over this string, it must not be a temporary
+	constexpr auto lazySplit(const BasicUString& separator, bool ignoreCase = false, bool saveEmpty = true)const& { return view().lazySplit(separator, ignoreCase, saveEmpty); }
+	constexpr auto lazySplit(UStringView separator, bool ignoreCase = false, bool saveEmpty = true)const& { return view().lazySplit(separator, ignoreCase, saveEmpty); }
+	constexpr auto lazySplit(UChar separator, bool ignoreCase = false, bool saveEmpty = true)const& { return view().lazySplit(separator, ignoreCase, saveEmpty); }
+	template <class Pred> requires std::predicate<const Pred&, UChar>
+	constexpr auto lazySplit(Pred pred, bool saveEmpty = true)const& { return view().lazySplit(std::move(pred), saveEmpty); }
+	template <class... Args>
+	void lazySplit(Args&&...)const&& = delete;
 	constexpr void insert(size_t offset, const char* str);
 	constexpr void insert(size_t offset, const UChar* str);
-	constexpr void insert(size_t offset, const UString& str);
-	constexpr void insert(size_t offset, UString&& str);
+	constexpr void insert(size_t offset, const BasicUString& str);
+	constexpr void insert(size_t offset, BasicUString&& str);
+	constexpr void insert(size_t offset, UStringView str);
 	constexpr void insert(size_t offset, UChar c);
 
-	constexpr bool startsWith(const UString& val, bool ignoreCase = false)const noexcept;
-	constexpr bool startsWith(const UChar* valPtr, bool ignoreCase = false)const noexcept;
+	constexpr bool startsWith(const BasicUString& val, bool ignoreCase = false)const noexcept { return view().startsWith(val, ignoreCase); }
+	constexpr bool startsWith(UStringView val, bool ignoreCase = false)const noexcept { return view().startsWith(val, ignoreCase); }
+	constexpr bool startsWith(const UChar* valPtr, bool ignoreCase = false)const noexcept { return view().startsWith(UStringView(valPtr), ignoreCase); }
 	constexpr bool startsWith(const char* valPtr, bool ignoreCase = false)const noexcept;
-	constexpr bool endsWith(const UString& val, bool ignoreCase = false)const noexcept;
-	constexpr bool endsWith(const UChar* valPtr, bool ignoreCase = false)const noexcept;
+	constexpr bool endsWith(const BasicUString& val, bool ignoreCase = false)const noexcept { return view().endsWith(val, ignoreCase); }
+	constexpr bool endsWith(UStringView val, bool ignoreCase = false)const noexcept { return view().endsWith(val, ignoreCase); }
+	constexpr bool endsWith(const UChar* valPtr, bool ignoreCase = false)const noexcept { return view().endsWith(UStringView(valPtr), ignoreCase); }
 	constexpr bool endsWith(const char* valPtr, bool ignoreCase = false)const noexcept;
 
-	constexpr bool contains(const UString& str, bool ignoreCase = false)const noexcept { return find(str,0, ignoreCase) != npos; }
-
-	constexpr size_t count(const UString& subStr, bool ignoreCase = false)const noexcept;
-	constexpr size_t count(const UChar c, bool ignoreCase = false)const noexcept;
-	constexpr size_t count(const char c, bool ignoreCase = false)const noexcept;
+	constexpr bool contains(const BasicUString& str, bool ignoreCase = false)const noexcept { return find(str,0, ignoreCase) != npos; }
+	constexpr bool contains(UStringView str, bool ignoreCase = false)const noexcept { return find(str, 0, ignoreCase) != npos; }
 
-	constexpr size_t replace(const UString& before, const UString& after, bool ignoreCase = false);
+	constexpr size_t count(const BasicUString& subStr, bool ignoreCase = false)const noexcept { return view().count(subStr, ignoreCase); }
+	constexpr size_t count(UStringView subStr, bool ignoreCase = false)const noexcept { return view().count(subStr, ignoreCase); }
+	constexpr size_t count(const UChar c, bool ignoreCase = false)const noexcept { return view().count(c, ignoreCase); }
+	constexpr size_t count(const char c, bool ignoreCase = false)const noexcept { return view().count(UChar(c), ignoreCase); }
 
-	void convertToUpper();
-	void convertToLower();
+	//replaces all non-overlapping matches from left to right, returns their count
+	constexpr size_t replace(const BasicUString& before, const BasicUString& after, bool ignoreCase = false) { return replace(UStringView(before), UStringView(after), ignoreCase); }
+	constexpr size_t replace(UStringView before, UStringView after, bool ignoreCase = false);
+	//all pairs are replaced in one scan, a replacement is never searched again
+	constexpr size_t replace(std::span<const std::pair<UStringView, UStringView>> pairs, bool ignoreCase = false);
+	constexpr size_t replace(std::initializer_list<std::pair<UStringView, UStringView>> pairs, bool ignoreCase = false)
+	{
+		return replace(std::span<const std::pair<UStringView, UStringView>>(pairs.begin(), pairs.size()), ignoreCase);
+	}
 
-	UString toUpper()const;
-	UString toLower()const;
+	//full unicode case mapping: the length may change (U+00DF -> "SS"), surrogate pairs and final sigma are handled.
+	//UChar::toUpper/toLower map single code units only
+	void convertToUpper() { convertCase(ustring_detail::CaseMap::Upper); }
+	void convertToLower() { convertCase(ustring_detail::CaseMap::Lower); }
+
+	BasicUString toUpper()const { return mappedCase(ustring_detail::CaseMap::Upper); }
+	BasicUString toLower()const { return mappedCase(ustring_detail::CaseMap::Lower); }
+	//full case folding, for caseless comparison: caseFold() of "Straße" and "STRASSE" are equal
+	BasicUString caseFold()const { return mappedCase(ustring_detail::CaseMap::Fold); }
+
+	//unicode normalization. a string that is already normalized is only scanned (quick check),
+	//otherwise the part of it before the first code point that may change is copied and the rest normalized
+	BasicUString normalized(UNormalizationForm form)const;
+	bool isNormalized(UNormalizationForm form)const;
+
+	constexpr UCodePointRange codePoints()const noexcept { return view().codePoints(); }
+	constexpr UGraphemeRange graphemes()const noexcept { return view().graphemes(); }
+	constexpr size_t codePointCount()const noexcept { return view().codePointCount(); }
+	constexpr size_t graphemeCount()const noexcept { return view().graphemeCount(); }
+	//keeps the first n code points or grapheme clusters, a cut for a display limit never splits a surrogate pair or a character
+	constexpr void truncateToCodePoints(size_t n) { resize(ustring_detail::codePointsEnd(data(), size(), n)); }
+	constexpr void truncateToGraphemes(size_t n) { resize(ustring_detail::graphemesEnd(data(), size(), n)); }
+
+	constexpr size_t validateUtf16()const noexcept { return view().validateUtf16(); }
+	constexpr bool isValidUtf16()const noexcept { return view().isValidUtf16(); }
+	//replaces each unpaired surrogate with U+FFFD, the length is kept
+	BasicUString& repairUtf16() noexcept;
 
 	bool isLower()const;
 	bool isUpper()const;
@@ -213,56 +1188,85 @@ public:
 	std::enable_if_t<std::is_floating_point<T>::value, T>
 		toFloatingPoint(size_t startOff, size_t count, bool* done = nullptr) const;
 
+	template <class T> requires std::integral<T>
+	constexpr UParseResult<T> parseIntegral(uint8_t base = 10, UParseMode mode = UParseMode::Strict) const noexcept
+	{
+		return ustring_detail::parseIntegral<T>(data(), size(), base, mode);
+	}
+	template <class T> requires std::floating_point<T>
+	UParseResult<T> parseFloatingPoint(UParseMode mode = UParseMode::Strict, std::chars_format format = std::chars_format::general) const
+	{
+		return ustring_detail::parseFloatingPoint<T>(data(), size(), format, mode);
+	}
+
 	constexpr std::string toLatin()const;
 	std::string toString(const std::locale& locale = std::locale(), UChar _default='-')const;
 	std::string toStringUtf8()const;
 	std::u8string toUtf8()const;
+	//UUtfErrorMode::Replace writes U+FFFD for an unpaired surrogate instead of throwing
+	std::u8string toUtf8(UUtfErrorMode mode)const;
 	constexpr std::u16string toUtf16()const;
 	std::u32string toUtf32()const;
 	std::wstring toWString()const;
 	std::filesystem::path toPath()const;
 #ifdef QT_CORE_LIB
-	QString toQString()const { return QString::fromStdU16String(*(std::u16string*)this); }
+	QString toQString()const { return QString((const QChar*)data(), int(size())); }
 #endif
 
 	template <class T>
-	static std::enable_if_t<std::is_integral<T>::value, UString> fromIntegral(T num, int base = 10);
+	static std::enable_if_t<std::is_integral<T>::value, BasicUString> fromIntegral(T num, int base = 10, const Alloc& alloc = Alloc());
 	//format: 'g'- general; 'f' - fixed; 's' - scientific; 'h' - hex
 	//if precision < 0: auto precision
 	template <class T>
-	static std::enable_if_t<std::is_floating_point<T>::value, UString> 
-		fromFloatingPoint(T num, uint8_t format = 'g', int8_t precision = -1);
-	static UString fromString(std::string_view str, const std::locale& locale = std::locale());
-	static constexpr UString fromLatin(std::string_view str);
-	static UString fromUtf8(std::string_view str);
-	static UString fromUtf8(std::u8string_view str);
-	static constexpr UString fromUtf16(std::u16string_view str);
-	static UString fromUtf32(std::u32string_view str);
-	static UString fromWString(std::wstring_view str);
-	static UString fromPath(const std::filesystem::path& path);
+	static std::enable_if_t<std::is_floating_point<T>::value, BasicUString> 
+		fromFloatingPoint(T num, uint8_t format = 'g', int8_t precision = -1, const Alloc& alloc = Alloc());
+	static BasicUString fromString(std::string_view str, const std::locale& locale = std::locale(), const Alloc& alloc = Alloc());
+	static constexpr BasicUString fromLatin(std::string_view str, const Alloc& alloc = Alloc());
+	static BasicUString fromUtf8(std::string_view str, const Alloc& alloc = Alloc());
+	static BasicUString fromUtf8(std::u8string_view str, const Alloc& alloc = Alloc());
+	//UUtfErrorMode::Replace writes U+FFFD for each maximal subpart of an invalid sequence instead of throwing
+	static BasicUString fromUtf8(std::string_view str, UUtfErrorMode mode, const Alloc& alloc = Alloc());
+	static BasicUString fromUtf8(std::u8string_view str, UUtfErrorMode mode, const Alloc& alloc = Alloc());
+	static constexpr BasicUString fromUtf16(std::u16string_view str, const Alloc& alloc = Alloc());
+	static BasicUString fromUtf32(std::u32string_view str, const Alloc& alloc = Alloc());
+	static BasicUString fromWString(std::wstring_view str, const Alloc& alloc = Alloc());
+	static BasicUString fromPath(const std::filesystem::path& path, const Alloc& alloc = Alloc());
+	//loads a text file: it is mapped and transcoded into the result, a byte order mark is skipped.
+	//throws std::filesystem::filesystem_error if it can not be read, std::range_error on malformed text.
+	//defined in ufile.hpp, which keeps the platform file headers out of this one
+	static BasicUString fromFile(const std::filesystem::path& path, UTextEncoding encoding = UTextEncoding::Auto, const Alloc& alloc = Alloc());
 #ifdef QT_CORE_LIB
-	static UString fromQString(const QString& str) { return UString::fromUtf16(str.toStdU16String()); }
+	static BasicUString fromQString(const QString& str, const Alloc& alloc = Alloc()) { return fromUtf16(str.toStdU16String(), alloc); }
 #endif
 
-	static bool compare(const UString& str0, const UString& str1, bool ignoreCase) noexcept;
+	static bool compare(const BasicUString& str0, const BasicUString& str1, bool ignoreCase) noexcept { return UStringView::compare(str0, str1, ignoreCase); }
 };
 
-constexpr UString::UString(const char* str,uint32_t count)
+template <class Alloc>
+constexpr BasicUString<Alloc>::BasicUString(const char* str, uint32_t count, const Alloc& alloc) : src_str(alloc)
 {
-	resize(count);
-
-	for (auto currentPtr = data(), end = currentPtr + count; currentPtr < end; ++str, ++currentPtr)
-	{
-		*currentPtr = *str;
-	}
+	appendLatin(str, count);
 }
 
-constexpr bool UString::isValidSymbolForNum(int c)noexcept
+template <class Alloc>
+constexpr void BasicUString<Alloc>::appendLatin(const char* str, size_t count)
 {
-	return (c > 41 && c < 58) || (c > 64 && c < 71)|| (c > 96 && c < 103);
+	const auto oldSize = size();
+	resize(oldSize + count);
+
+	if (std::is_constant_evaluated())
+	{
+		for (auto currentPtr = data() + oldSize, end = currentPtr + count; currentPtr < end; ++str, ++currentPtr)
+			*currentPtr = char16_t((unsigned char)*str);
+	}
+	else
+	{
+		ustring_detail::widenLatin1(str, count, (char16_t*)data() + oldSize);
+	}
 }
 
-constexpr size_t UString::srtLen(const char* ptr) noexcept
+template <class Alloc>
+constexpr size_t BasicUString<Alloc>::srtLen(const char* ptr) noexcept
 {
 	auto auxilPtr = ptr;
 	while (*auxilPtr != 0)
@@ -270,114 +1274,56 @@ constexpr size_t UString::srtLen(const char* ptr) noexcept
 	return auxilPtr - ptr;
 }
 
+template <class Alloc>
 template<class T>
 inline std::enable_if_t<std::is_integral<T>::value, T>
-UString::toIntegral(size_t startOff, size_t count,uint8_t base, bool* done) const
+BasicUString<Alloc>::toIntegral(size_t startOff, size_t count,uint8_t base, bool* done) const
 {
 	if (startOff > size())
 	{
 		if (done)
-			done = false;
+			*done = false;
 		return T(0);
 	}
 
-	if (count > size() - startOff)
-		count = size() - startOff;
-
-
-	constexpr const int sizeBuf = 30;
-	T resNum = 0;
-	char tmpStr[sizeBuf]{};
-
-	uint8_t countSymb = 0;
-	for (auto ptr = data() + startOff, end = ptr + count; ptr < end; ptr++)
-	{
-		if (isValidSymbolForNum(ptr->toCode()))
-		{
-			tmpStr[countSymb] = *ptr;
-			++countSymb;
-			if (countSymb >= sizeBuf)
-			{
-				if (done)
-				{
-					done = false;
-					return resNum;
-				}
-			}
-		}
-	}
-
-	auto res = std::from_chars(tmpStr, tmpStr + countSymb, resNum, base);
-
-	if (done)
-	{
-		*done = res.ec == std::errc(0);
-	}
-
-	return resNum;
+	const UStringView str = view().substr(startOff, count);
+	return str.toIntegral<T>(base, done);
 }
 
+template <class Alloc>
 template<class T>
 inline std::enable_if_t<std::is_floating_point<T>::value, T>
-UString::toFloatingPoint(size_t startOff, size_t count, bool* done) const
+BasicUString<Alloc>::toFloatingPoint(size_t startOff, size_t count, bool* done) const
 {
 	if (startOff > size())
 	{
 		if (done)
-			done = false;
+			*done = false;
 		return T(0);
 	}
 
-	if (count > size() - startOff)
-		count = size() - startOff;
-
-
-	constexpr const int sizeBuf = 30;
-	T resNum = 0;
-	char tmpStr[sizeBuf]{};
-
-	uint8_t countSymb = 0;
-	for (auto ptr = data() + startOff, end = ptr + count; ptr < end; ptr++)
-	{
-		if (isValidSymbolForNum(*ptr))
-		{
-			tmpStr[countSymb] = *ptr;
-			++countSymb;
-			if (countSymb >= sizeBuf)
-			{
-				if (done)
-				{
-					done = false;
-					return resNum;
-				}
-			}
-		}
-	}
-
-	auto res = std::from_chars(tmpStr, tmpStr + countSymb, resNum);
-
-	if (done)
-	{
-		*done = res.ec == std::errc(0);
-	}
-
-	return resNum;
+	const UStringView str = view().substr(startOff, count);
+	return str.toFloatingPoint<T>(done);
 }
 
+template <class Alloc>
 template <class T>
-inline std::enable_if_t<std::is_integral<T>::value, UString> UString::fromIntegral(T num, int base)
+constexpr std::enable_if_t<std::is_integral<T>::value, BasicUString<Alloc>&> BasicUString<Alloc>::appendIntegral(T num, int base)
 {
-	char buf[25]{};
-	std::to_chars(buf, buf + 25, num, base);
+	assert(base >= 2 && base <= 36);
 
-	return UString(buf);
+	const auto oldSize = size();
+	const auto length = ustring_detail::formatIntegralLength(num, base);
+	resize(oldSize + length);
+	ustring_detail::formatIntegral(num, base, data() + oldSize, length);
+	return *this;
 }
 
+template <class Alloc>
 template <class T>
-inline std::enable_if_t<std::is_floating_point<T>::value, UString> 
-UString::fromFloatingPoint(T num, uint8_t format,int8_t precision)
+inline std::enable_if_t<std::is_floating_point<T>::value, BasicUString<Alloc>&>
+BasicUString<Alloc>::appendFloatingPoint(T num, uint8_t format, int8_t precision)
 {
-	char buf[40]{};
 	std::chars_format f;
 	switch (format)
 	{
@@ -395,310 +1341,180 @@ UString::fromFloatingPoint(T num, uint8_t format,int8_t precision)
 		break;
 	}
 
-	if(precision>=0)
-		std::to_chars(buf, buf + sizeof(buf), num, f, precision);
-	else
-		std::to_chars(buf, buf + sizeof(buf), num, f);
-
-	return UString(buf);
-}
-
-constexpr size_t UString::find(UChar c, size_t off, bool ignoreCase)const noexcept
-{
-	assert(size() >= off);
+	auto toChars = [&](char* first, char* last)
+		{
+			return precision >= 0 ? std::to_chars(first, last, num, f, precision) : std::to_chars(first, last, num, f);
+		};
 
-	if (ignoreCase==false)
+	char buf[128];
+	auto res = toChars(buf, buf + sizeof(buf));
+	if (res.ec == std::errc())
 	{
-		return src_str::find(c, off);
+		appendLatin(buf, res.ptr - buf);
+		return *this;
 	}
-	else if (1 <= size() - off)
-	{
-		auto srcPtr = data() + off;
-		const auto srcEnd = srcPtr + size();
-
-		if (c.isAlpha())
-		{
-			auto forCompare = c.toLower();
-
-			while (srcPtr < srcEnd)
-			{
-				if (srcPtr->toLower() == forCompare)
-					return srcPtr - data();
 
-				srcPtr++;
-			}
-		}
-		else
-		{
-			while (srcPtr < srcEnd)
-			{
-				if (*srcPtr == c)
-					return srcPtr - data();
-
-				srcPtr++;
-			}
-		}
-	}
-	return npos;
+	//fixed notation of large values
+	std::string longBuf(sizeof(buf), 0);
+	do
+	{
+		longBuf.resize(longBuf.size() * 4);
+		res = toChars(longBuf.data(), longBuf.data() + longBuf.size());
+	} while (res.ec != std::errc());
+	appendLatin(longBuf.data(), res.ptr - longBuf.data());
+	return *this;
 }
 
-constexpr size_t UString::find(const UString& str, size_t off, bool ignoreCase)const noexcept
+template <class Alloc>
+template <class T>
+inline std::enable_if_t<std::is_integral<T>::value, BasicUString<Alloc>> BasicUString<Alloc>::fromIntegral(T num, int base, const Alloc& alloc)
 {
-	auto otherStrSize = str.size();
-	if (otherStrSize == 0)
-		return npos;
-
-	assert(size() >= off);
-
-	if (ignoreCase == false)
-	{
-		return src_str::find(str,off);
-	}
-	else if (otherStrSize <=size() - off)
-	{
-		auto srcPtr = data() + off;
-		const auto srcEnd = srcPtr + size() - off - str.size() + 1;
-		const auto otherPtr = str.data();
-		const auto otherEnd = otherPtr + str.size();
-
-		auto c = otherPtr->toLower();
-
-		while (srcPtr< srcEnd)
-		{
-			if (srcPtr->toLower() == c)
-			{
-				auto tmpPtr0 = otherPtr + 1;
-				auto tmpPtr1 = srcPtr + 1;
-				while (tmpPtr0 < otherEnd)
-				{
-					if (tmpPtr0->toLower() != tmpPtr1->toLower())
-						break;
-					++tmpPtr0; ++tmpPtr1;
-				}
-
-				if(tmpPtr0== otherEnd)
-					return srcPtr - data();
-			}
-
-			srcPtr++;
-		}
-	}
-	return npos;
+	BasicUString res(alloc);
+	res.appendIntegral(num, base);
+	return res;
 }
 
-constexpr size_t UString::rfind(UChar c, size_t off, bool ignoreCase)const noexcept
+template <class Alloc>
+template <class T>
+inline std::enable_if_t<std::is_floating_point<T>::value, BasicUString<Alloc>> 
+BasicUString<Alloc>::fromFloatingPoint(T num, uint8_t format,int8_t precision, const Alloc& alloc)
 {
-	assert(size() >= off);
-	
-	auto srcPtr = data() + size() - 1;
-	const auto srcEnd = data() + off - 1;
-
-	if (ignoreCase == false)
-	{
-		while (srcPtr > srcEnd)
-		{
-			if (*srcPtr == c)
-				return srcPtr - data();
-
-			--srcPtr;
-		}
-	}
-	else
-	{
-		if (c.isAlpha())
-		{
-			auto forCompare = c.toLower();
-			while (srcPtr > srcEnd)
-			{
-				if (srcPtr->toLower() == forCompare)
-					return srcPtr - data();
-
-				--srcPtr;
-			}
-		}
-		else
-		{
-			while (srcPtr > srcEnd)
-			{
-				if (*srcPtr == c)
-					return srcPtr - data();
-
-				--srcPtr;
-			}
-		}
-	}
-	
-	return npos;
+	BasicUString res(alloc);
+	res.appendFloatingPoint(num, format, precision);
+	return res;
 }
 
-constexpr size_t UString::rfind(const UString& str, size_t off, bool ignoreCase)const noexcept
+#if defined(__cpp_lib_format)
+namespace ustring_detail
 {
-	if (str.size() == 0)
-		return npos;
-
-	assert(size() >= off);
-
-	auto srcPtr = data() + size() - str.size();
-	const auto srcEnd = data() + off - 1;
-
-	const auto otherPtr = str.data();
-	const auto otherEnd = otherPtr + str.size();
-
-	if (ignoreCase == false)
-	{
-		while (srcPtr > srcEnd)
-		{
-			auto c = str.front();
-
-			if (*srcPtr == c)
-			{
-				auto tmpPtr0 = otherPtr + 1;
-				auto tmpPtr1 = srcPtr + 1;
-				while (tmpPtr0 < otherEnd)
-				{
-					if (*tmpPtr0 != *tmpPtr1)
-						break;
-					++tmpPtr0; ++tmpPtr1;
-				}
-
-				if (tmpPtr0 == otherEnd)
-					return srcPtr - data();
-			}
-
-			srcPtr++;
-		}
-	}
-	else
+	//output of std::format_to: utf-8 bytes are collected in a block and transcoded to the end of str
+	//when it is full, a sequence cut by the end of the block waits for the next one
+	template <class Str>
+	class Utf8FormatSink
 	{
-		auto c = otherPtr->toLower();
+		Str& str;
+		char buf[256];
+		size_t count = 0;
 
-		while (srcPtr > srcEnd)
+	public:
+		class iterator
 		{
-			if (srcPtr->toLower() == c)
-			{
-				auto tmpPtr0 = otherPtr + 1;
-				auto tmpPtr1 = srcPtr + 1;
-				while (tmpPtr0 < otherEnd)
-				{
-					if (tmpPtr0->toLower() != tmpPtr1->toLower())
-						break;
-					++tmpPtr0;
-					++tmpPtr1;
-				}
-
-				if (tmpPtr0 == otherEnd)
-					return srcPtr - data();
-			}
-
-			srcPtr++;
-		}
-	}
+			Utf8FormatSink* sink = nullptr;
 
-	return npos;
-}
+		public:
+			typedef std::ptrdiff_t difference_type;
 
-constexpr UString UString::substr(size_t off, size_t count)const
-{
-	return UString(data()+off, count);
-}
+			iterator() noexcept = default;
+			explicit iterator(Utf8FormatSink* sink) noexcept : sink(sink) {}
 
-constexpr std::vector<UString> UString::split(const UString& separator, bool ignoreCase,bool saveEmpty)const
-{
-	std::vector<UString> res;
-	size_t pos = 0;
-	size_t oldPos = 0;
-	const auto sizeSep = separator.size();
-	const auto currentSize = size();
+			iterator& operator*() noexcept { return *this; }
+			iterator& operator=(char c) { sink->put(c); return *this; }
+			iterator& operator++() noexcept { return *this; }
+			iterator operator++(int) noexcept { return *this; }
+		};
 
-	if (ignoreCase == false)
-	{
-		while (pos<= currentSize)
-		{
-			oldPos = pos;
-			pos = std::min(find(separator, pos), currentSize);
+		explicit Utf8FormatSink(Str& str) noexcept : str(str) {}
 
-			auto s = pos - oldPos;
-			if (s|| saveEmpty)
-				res.emplace_back(UString(data() + oldPos, s));
+		iterator out() noexcept { return iterator(this); }
 
-			if (npos - pos >= sizeSep)
-				pos += sizeSep;
-			else
-				break;
+		void put(char c)
+		{
+			if (count == sizeof(buf))
+				flush(false);
+			buf[count++] = c;
 		}
-	}
-	else
-	{
-		const auto auxilSep = separator.toLower();
-		const auto otherPtr = auxilSep.data();
-		const auto endOtherPtr = otherPtr+ sizeSep;
-		const auto currentEndPtr = data() + currentSize;
 
-		while (pos <= currentSize)
+		//throws std::range_error if the output is not valid utf-8
+		void flush(bool last)
 		{
-			oldPos = pos;
-			for (size_t end = size(); pos < end; pos++)
+			size_t complete = count;
+			if (last == false && count != 0)
 			{
-				auto currentPtr = data() + pos;
-
-				bool isFind = true;
-				for (auto j = otherPtr; isFind && j < endOtherPtr && currentPtr < currentEndPtr; ++j, ++currentPtr)
-					isFind = currentPtr->toLower() == *j;
-
-				if (isFind)
-					break;
+				auto lead = count - 1;
+				while (lead > 0 && count - lead < 4 && (buf[lead] & 0xC0) == 0x80)
+					--lead;
+				const auto byte = (unsigned char)buf[lead];
+				const size_t length = byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+				if (lead + length > count)
+					complete = lead;
 			}
-			
-			auto s = pos - oldPos;
-			if (s || saveEmpty)
-				res.emplace_back(UString(data() + oldPos, s));
-
-			if (npos - pos >= sizeSep)
-				pos += sizeSep;
-			else
-				break;
+
+			const auto oldSize = str.size();
+			str.resize(oldSize + utf16LengthOfUtf8(buf, complete));
+			utf8ToUtf16(buf, complete, (char16_t*)str.data() + oldSize);
+			std::char_traits<char>::move(buf, buf + complete, count - complete);
+			count -= complete;
 		}
-	}
+	};
+}
+
+template <class Alloc>
+template <class... Args>
+inline BasicUString<Alloc>& BasicUString<Alloc>::appendFormat(std::format_string<Args...> fmt, Args&&... args)
+{
+	ustring_detail::Utf8FormatSink<BasicUString> sink(*this);
+	std::format_to(sink.out(), fmt, std::forward<Args>(args)...);
+	sink.flush(true);
+	return *this;
+}
+#endif
 
+template <class Alloc>
+constexpr BasicUString<Alloc> BasicUString<Alloc>::substr(size_t off, size_t count)const
+{
+	return BasicUString(data()+off, count, getAllocator());
+}
+
+template <class Alloc>
+constexpr std::vector<BasicUString<Alloc>, typename BasicUString<Alloc>::vector_alloc>
+BasicUString<Alloc>::split(const BasicUString& separator, bool ignoreCase,bool saveEmpty)const
+{
+	//pieces and the vector use the allocator of this string
+	const vector_alloc alloc(getAllocator());
+	std::vector<BasicUString, vector_alloc> res(alloc);
+	for (auto piece : view().lazySplit(separator, ignoreCase, saveEmpty))
+		res.push_back(BasicUString(piece, getAllocator()));
 	return res;
 }
 
-constexpr void UString::insert(size_t ind, const char* str)
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, const char* str)
 {
-	src_str::insert(ind, UString(str));
+	src_str::insert(ind, BasicUString(str, getAllocator()));
 }
 
-constexpr void UString::insert(size_t ind, const UString& str)
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, const BasicUString& str)
 {
 	src_str::insert(ind, str);
 }
 
-constexpr void UString::insert(size_t ind, UString&& str)
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, BasicUString&& str)
 {
 	src_str::insert(ind, str);
 }
 
-constexpr bool UString::startsWith(const UString& val, bool ignoreCase)const noexcept
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, const UChar* str)
 {
-	if (ignoreCase == false)
-	{
-		return src_str::starts_with(val);
-	}
-	else if(size()>=val.size())
-	{
-		for (auto currentPtr = data(), otherPtr = val.data(), end = otherPtr + val.size();
-			otherPtr < end; ++otherPtr, ++currentPtr)
-		{
-			if (currentPtr->toLower() != otherPtr->toLower())
-				return false;
-		}
-		return true;
-	}
+	src_str::insert(ind, str);
+}
 
-	return false;
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, UStringView str)
+{
+	src_str::insert(ind, str.data(), str.size());
+}
+
+template <class Alloc>
+constexpr void BasicUString<Alloc>::insert(size_t ind, UChar c)
+{
+	src_str::insert(ind, 1, c);
 }
 
-constexpr bool UString::startsWith(const char* valPtr, bool ignoreCase)const noexcept
+template <class Alloc>
+constexpr bool BasicUString<Alloc>::startsWith(const char* valPtr, bool ignoreCase)const noexcept
 {
 	std::string_view val(valPtr);
 	if (size() < val.size())
@@ -710,9 +1526,12 @@ constexpr bool UString::startsWith(const char* valPtr, bool ignoreCase)const noe
 
 	if (ignoreCase==false)
 	{
+		if (std::is_constant_evaluated() == false)
+			return ustring_detail::equalLatin1((const char16_t*)currentPtr, otherPtr, val.size());
+
 		for (; otherPtr < end; ++otherPtr, ++currentPtr)
 		{
-			if (*currentPtr != *otherPtr)
+			if (*currentPtr != (unsigned char)*otherPtr)
 				return false;
 		}
 	}
@@ -720,36 +1539,15 @@ constexpr bool UString::startsWith(const char* valPtr, bool ignoreCase)const noe
 	{
 		for (;otherPtr < end; ++otherPtr, ++currentPtr)
 		{
-			if (currentPtr->toLower().toCode() != tolower(*otherPtr))
+			if (ustring_detail::foldCase(*currentPtr) != ustring_detail::foldCase(char16_t((unsigned char)*otherPtr)))
 				return false;
 		}
 	}
 	return true;
 }
 
-constexpr bool UString::endsWith(const UString& val, bool ignoreCase)const noexcept
-{
-	if (ignoreCase==false)
-	{
-		return src_str::ends_with(val);
-	}
-	else if (size() >= val.size())
-	{
-		auto sizeVal = val.size();
-
-		for (auto currentPtr = data() + size() - sizeVal, otherPtr = val.data(), end = otherPtr + sizeVal;
-			otherPtr < end; ++otherPtr, ++currentPtr)
-		{
-			if (currentPtr->toLower() != otherPtr->toLower())
-				return false;
-		}
-		return true;
-	}
-
-	return false;
-}
-
-constexpr bool UString::endsWith(const char* valPtr, bool ignoreCase)const noexcept
+template <class Alloc>
+constexpr bool BasicUString<Alloc>::endsWith(const char* valPtr, bool ignoreCase)const noexcept
 {
 	std::string_view val(valPtr);
 	auto otherSize = val.size();
@@ -762,9 +1560,12 @@ constexpr bool UString::endsWith(const char* valPtr, bool ignoreCase)const noexc
 
 	if (ignoreCase == false)
 	{
+		if (std::is_constant_evaluated() == false)
+			return ustring_detail::equalLatin1((const char16_t*)currentPtr, otherPtr, otherSize);
+
 		for (; otherPtr < end; ++otherPtr, ++currentPtr)
 		{
-			if (*currentPtr != *otherPtr)
+			if (*currentPtr != (unsigned char)*otherPtr)
 				return false;
 		}
 	}
@@ -772,138 +1573,169 @@ constexpr bool UString::endsWith(const char* valPtr, bool ignoreCase)const noexc
 	{
 		for (; otherPtr < end; ++otherPtr, ++currentPtr)
 		{
-			if (currentPtr->toLower().toCode() != tolower(*otherPtr))
+			if (ustring_detail::foldCase(*currentPtr) != ustring_detail::foldCase(char16_t((unsigned char)*otherPtr)))
 				return false;
 		}
 	}
 	return true;
 }
 
-constexpr size_t UString::count(const UString& subStr, bool ignoreCase)const noexcept
+template <class Alloc>
+template <class Replacer>
+constexpr size_t BasicUString<Alloc>::replaceWith(Replacer& replacer)
 {
+	const auto src = view();
 	size_t res = 0;
-	size_t off = 0;
-	size_t s1 = subStr.size();
-	auto end = size();
 
-	while (off < end)
+	if (replacer.shrinks())
 	{
-		off = find(subStr, off, ignoreCase);
-		if (off==npos)
-		{
-			break;
-		}
-		else
+		//in place with two pointers: the written part never outgrows the read part
+		const auto ptr = data();
+		size_t readPos = 0;
+		size_t writePos = 0;
+		for (auto match = replacer.next(src, 0); match.pos != npos; match = replacer.next(src, readPos))
 		{
+			if (writePos != readPos)
+				std::copy(ptr + readPos, ptr + match.pos, ptr + writePos);
+			writePos += match.pos - readPos;
+			std::copy(match.after.begin(), match.after.end(), ptr + writePos);
+			writePos += match.after.size();
+			readPos = match.pos + match.length;
 			++res;
-			off += s1;
 		}
-	}
-
-	return res;
-}
-
-constexpr size_t UString::count(const char c, bool ignoreCase)const noexcept
-{
-	size_t res = 0;
-	size_t off = 0;
 
-	auto end = size();
-
-	while (off < end)
-	{
-		off = find(c, off, ignoreCase);
-		if (off == npos)
-		{
-			break;
-		}
-		else
+		if (res != 0)
 		{
-			++res;
-			off += 1;
+			std::copy(ptr + readPos, ptr + size(), ptr + writePos);
+			src_str::resize(writePos + size() - readPos);
 		}
+		return res;
 	}
 
-	return res;
-}
-
-constexpr size_t UString::replace(const UString& before, const UString& after, bool ignoreCase)
-{
-	size_t res = 0;
-	size_t off = 0;
-	size_t sizeBefore = before.size();
-	size_t sizeAfter = after.size();
-	int64_t delta = sizeBefore - sizeAfter;
-	auto end = size();
-
-	while (off < end)
+	//count then build: one allocation of the exact size
+	size_t newSize = size();
+	for (auto match = replacer.next(src, 0); match.pos != npos; match = replacer.next(src, match.pos + match.length))
 	{
-		off = find(before, off, ignoreCase);
-		if (off == npos)
-		{
-			break;
-		}
-		else
-		{
-			if (delta>0)
-			{
-				erase(off + sizeAfter, delta);
-			}
-			else if (delta < 0)
-			{
-				src_str::insert(begin() + off + sizeBefore, -delta, L' ');
-			}
-
-			for (size_t i = 0; i < sizeAfter; i++)
-				operator[](i + off) = after[i];
-
-			++res;
-			off += sizeAfter;
-		}
+		newSize = newSize - match.length + match.after.size();
+		++res;
 	}
+	if (res == 0)
+		return 0;
+
+	replacer.reset();
+	src_str buf(getAllocator());
+	buf.reserve(newSize);
+	size_t readPos = 0;
+	for (auto match = replacer.next(src, 0); match.pos != npos; match = replacer.next(src, readPos))
+	{
+		buf.append(data() + readPos, match.pos - readPos);
+		buf.append(match.after.data(), match.after.size());
+		readPos = match.pos + match.length;
+	}
+	buf.append(data() + readPos, size() - readPos);
+	src_str::swap(buf);
 
 	return res;
 }
 
-constexpr UString& UString::operator+=(const char* val)
+template <class Alloc>
+constexpr size_t BasicUString<Alloc>::replace(UStringView before, UStringView after, bool ignoreCase)
 {
-	std::string_view strView(val);
-	auto oldSize = size();
-	resize(oldSize + strView.size());
+	ustring_detail::SingleReplacer replacer(before, after, ignoreCase);
+	return replaceWith(replacer);
+}
 
-	for (auto i = data() + oldSize, end = i + strView.size(); i < end; ++i, ++val)
-		*i = *val;
+template <class Alloc>
+constexpr size_t BasicUString<Alloc>::replace(std::span<const std::pair<UStringView, UStringView>> pairs, bool ignoreCase)
+{
+	ustring_detail::MultiReplacer replacer(pairs, ignoreCase);
+	return replaceWith(replacer);
+}
 
+template <class Alloc>
+constexpr BasicUString<Alloc>& BasicUString<Alloc>::operator+=(const char* val)
+{
+	appendLatin(val, srtLen(val));
 	return *this;
 }
 
-inline void UString::convertToUpper()
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::mappedCase(ustring_detail::CaseMap mode) const
 {
-	for (auto& i : *this)
-		i = i.toUpper();
+	BasicUString res(getAllocator());
+	res.resize(size());
+	const auto mapped = ustring_detail::mapCase(data(), size(), 0, res.data(), mode, false);
+	if (mapped != size())
+	{
+		res.resize(mapped + ustring_detail::caseMappedLength(data(), size(), mapped, mode));
+		ustring_detail::mapCase(data(), size(), mapped, res.data() + mapped, mode);
+	}
+	return res;
 }
 
-inline void UString::convertToLower()
+template <class Alloc>
+inline void BasicUString<Alloc>::convertCase(ustring_detail::CaseMap mode)
 {
-	for (auto& i : *this)
-		i = i.toLower();
+	const auto mapped = ustring_detail::mapCase(data(), size(), 0, data(), mode, false);
+	if (mapped == size())
+		return;
+
+	//the rest grows: it is mapped after the part already mapped in place
+	BasicUString res(getAllocator());
+	res.resize(mapped + ustring_detail::caseMappedLength(data(), size(), mapped, mode));
+	std::copy(data(), data() + mapped, res.data());
+	ustring_detail::mapCase(data(), size(), mapped, res.data() + mapped, mode);
+	*this = std::move(res);
 }
 
-inline UString UString::toUpper() const
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::normalized(UNormalizationForm form) const
 {
-	UString res(*this);
-	res.convertToUpper();
+	const auto ptr = (const char16_t*)data();
+	size_t boundary = 0;
+	if (ustring_detail::quickCheckNormalized(ptr, size(), form, boundary) == ustring_detail::NormCheck::Yes)
+		return BasicUString(*this, getAllocator());
+
+	BasicUString res(getAllocator());
+	res.reserve(size());
+	res += UStringView(data(), boundary);
+	ustring_detail::Normalizer normalizer(form);
+	normalizer.push(ptr + boundary, size() - boundary, res);
+	normalizer.finish(res);
 	return res;
 }
 
-inline UString UString::toLower() const
+template <class Alloc>
+inline BasicUString<Alloc>& BasicUString<Alloc>::repairUtf16() noexcept
 {
-	UString res(*this);
-	res.convertToLower();
-	return res;
+	const auto ptr = (char16_t*)data();
+	const auto count = size();
+	//the unit after an unpaired surrogate never completes a pair with it
+	for (size_t i = ustring_detail::utf16ValidLength(ptr, count); i < count; i += 1 + ustring_detail::utf16ValidLength(ptr + i + 1, count - i - 1))
+		ptr[i] = 0xFFFD;
+	return *this;
+}
+
+template <class Alloc>
+inline bool BasicUString<Alloc>::isNormalized(UNormalizationForm form) const
+{
+	const auto ptr = (const char16_t*)data();
+	size_t boundary = 0;
+	const auto check = ustring_detail::quickCheckNormalized(ptr, size(), form, boundary);
+	if (check != ustring_detail::NormCheck::Maybe)
+		return check == ustring_detail::NormCheck::Yes;
+
+	//code points that may compose with the ones before them: the rest is normalized to compare
+	BasicUString rest(getAllocator());
+	rest.reserve(size() - boundary);
+	ustring_detail::Normalizer normalizer(form);
+	normalizer.push(ptr + boundary, size() - boundary, rest);
+	normalizer.finish(rest);
+	return std::equal(rest.begin(), rest.end(), begin() + boundary, end());
 }
 
-inline bool UString::isLower()const
+template <class Alloc>
+inline bool BasicUString<Alloc>::isLower()const
 {
 	for (auto& i : *this)
 		if (i.isAlpha() &&i.isUpper())
@@ -911,7 +1743,8 @@ inline bool UString::isLower()const
 	return true;
 }
 
-inline bool UString::isUpper()const
+template <class Alloc>
+inline bool BasicUString<Alloc>::isUpper()const
 {
 	for (auto& i : *this)
 		if (i.isAlpha() && i.isLower())
@@ -919,20 +1752,37 @@ inline bool UString::isUpper()const
 	return true;
 }
 
-constexpr std::string UString::toLatin() const
+template <class Alloc>
+constexpr std::string BasicUString<Alloc>::toLatin() const
 {
 	std::string res;
-	res.reserve(size());
 
-	for (auto i = data(), end = i + size(); i < end; i++)
+	if (std::is_constant_evaluated())
+	{
+		for (auto i = data(), end = i + size(); i < end; i++)
+		{
+			if (*i <= 0xFF)
+				res.push_back(i->toChar());
+		}
+		return res;
+	}
+
+	//units above 0xFF are skipped
+	res.resize(size());
+	const auto src = (const char16_t*)data();
+	size_t written = 0;
+	for (size_t i = 0; i < size(); ++i)
 	{
-		if (*i >= std::numeric_limits<char>::min() && *i <= std::numeric_limits<char>::max())
-			res.push_back(i->toChar());
+		const auto count = ustring_detail::narrowLatin1(src + i, size() - i, res.data() + written);
+		written += count;
+		i += count;
 	}
+	res.resize(written);
 	return res;
 }
 
-inline std::string UString::toString(const std::locale& locale, UChar _default) const
+template <class Alloc>
+inline std::string BasicUString<Alloc>::toString(const std::locale& locale, UChar _default) const
 {
 	//https://www.codeproject.com/Tips/196097/Converting-ANSI-to-Unicode-and-back
 
@@ -958,34 +1808,62 @@ inline std::string UString::toString(const std::locale& locale, UChar _default)
 	return res;
 }
 
-inline std::string UString::toStringUtf8() const
+template <class Alloc>
+inline std::string BasicUString<Alloc>::toStringUtf8() const
 {
-	std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> converter;
-	auto ptr = (char16_t*)data();
-	return converter.to_bytes(ptr, ptr + size());
+	auto ptr = (const char16_t*)data();
+	std::string res(ustring_detail::utf8LengthOfUtf16(ptr, size()), 0);
+	ustring_detail::utf16ToUtf8(ptr, size(), res.data());
+	return res;
 }
 
-inline std::u8string UString::toUtf8() const
+template <class Alloc>
+inline std::u8string BasicUString<Alloc>::toUtf8() const
 {
-	// Convert the u16string to u8string
-	auto str = toStringUtf8();
+	auto ptr = (const char16_t*)data();
+	std::u8string res(ustring_detail::utf8LengthOfUtf16(ptr, size()), 0);
+	ustring_detail::utf16ToUtf8(ptr, size(), (char*)res.data());
+	return res;
+}
 
-	return *(std::u8string*)&str;
+template <class Alloc>
+inline std::u8string BasicUString<Alloc>::toUtf8(UUtfErrorMode mode) const
+{
+	if (mode == UUtfErrorMode::Strict)
+		return toUtf8();
+
+	auto ptr = (const char16_t*)data();
+	std::u8string res(ustring_detail::utf8LengthOfUtf16(ptr, size()), 0);
+	size_t read = 0;
+	auto written = ustring_detail::utf16ToUtf8Prefix(ptr, size(), (char*)res.data(), read);
+	if (read != size())
+	{
+		//an unpaired surrogate was counted as 2 bytes, U+FFFD takes 3
+		res.resize(written + (size() - read) * 3);
+		written += ustring_detail::utf16ToUtf8Replacing(ptr + read, size() - read, (char*)res.data() + written);
+	}
+	res.resize(written);
+	return res;
 }
 
-constexpr std::u16string UString::toUtf16() const
+template <class Alloc>
+constexpr std::u16string BasicUString<Alloc>::toUtf16() const
 {
 	const char16_t* startPtr = (const char16_t*)data();
 	return std::u16string(startPtr, startPtr + size());
 }
 
-inline std::u32string UString::toUtf32() const
+template <class Alloc>
+inline std::u32string BasicUString<Alloc>::toUtf32() const
 {
-	std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-	return conv.from_bytes(toStringUtf8());
+	auto ptr = (const char16_t*)data();
+	std::u32string res(ustring_detail::utf32LengthOfUtf16(ptr, size()), 0);
+	ustring_detail::utf16ToUtf32(ptr, size(), res.data());
+	return res;
 }
 
-inline std::wstring UString::toWString() const
+template <class Alloc>
+inline std::wstring BasicUString<Alloc>::toWString() const
 {
 	if constexpr (sizeof(wchar_t)==sizeof(char16_t))
 	{
@@ -994,45 +1872,23 @@ inline std::wstring UString::toWString() const
 	}
 	else
 	{
-		std::wstring_convert<std::codecvt_utf16<wchar_t>> converter;
+		static_assert(sizeof(wchar_t) == sizeof(char32_t), "Invalid size wchar_t");
 
-		// Convert the u16string to wstring
-		return converter.from_bytes(
-			reinterpret_cast<const char*>(this->c_str()),
-			reinterpret_cast<const char*>(this->c_str() + this->size())
-		);
+		auto ptr = (const char16_t*)data();
+		std::wstring res(ustring_detail::utf32LengthOfUtf16(ptr, size()), 0);
+		ustring_detail::utf16ToUtf32(ptr, size(), (char32_t*)res.data());
+		return res;
 	}
 }
 
-inline std::filesystem::path UString::toPath()const
+template <class Alloc>
+inline std::filesystem::path BasicUString<Alloc>::toPath()const
 {
-	return std::filesystem::path(*(std::u16string*)this);
-}
-
-inline bool UString::compare(const UString& str0, const UString& str1, bool ignoreCase) noexcept
-{
-	if (ignoreCase)
-	{
-		if (str0.size() != str1.size())
-			return false;
-		else
-		{
-			for (auto ptr0 = str0.data(), ptr1 = str1.data(), end = ptr0 + str0.size();
-				ptr0 < end; ++ptr0, ++ptr1)
-				if (ptr0->toLower() != ptr1->toLower())
-					return false;
-
-			return true;
-		}
-	}
-	else
-	{
-		return str0 == str1;
-	}
-
+	return std::filesystem::path(std::u16string_view((const char16_t*)data(), size()));
 }
 
-inline UString UString::fromString(std::string_view str, const std::locale& locale)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromString(std::string_view str, const std::locale& locale, const Alloc& alloc)
 {
 	//https://www.codeproject.com/Tips/196097/Converting-ANSI-to-Unicode-and-back
 
@@ -1052,24 +1908,24 @@ inline UString UString::fromString(std::string_view str, const std::locale& loca
 		const auto _Result = _Facet.in(_State, _From_begin, _From_end, _From_next, _To_begin, _To_end, _To_next);
 
 		if (_From_next < _From_begin || _From_next > _From_end || _To_next < _To_begin || _To_next > _To_end) {
-			std::_Throw_system_error(std::errc::invalid_argument);
+			throw std::system_error(std::make_error_code(std::errc::invalid_argument));
 		}
 
 		switch (_Result) {
 		case std::codecvt_base::ok:
 			_Output.resize(static_cast<size_t>(_To_next - _To_begin));
-			return fromWString(_Output);
+			return fromWString(_Output, alloc);
 
 		case std::codecvt_base::partial:
 			if (count>2)
-				std::_Throw_system_error(std::errc::invalid_argument);
+				throw std::system_error(std::make_error_code(std::errc::invalid_argument));
 
 			// N4810 28.4.1.4.2 [locale.codecvt.virtuals]/5:
 			// "A return value of partial, if (from_next == from_end), indicates that either the
 			// destination sequence has not absorbed all the available destination elements,
 			// or that additional source elements are needed before another destination element can be produced."
 			if ((_From_next == _From_end && _To_next != _To_end) || _Output.size() > _Output.max_size() / 2) {
-				std::_Throw_system_error(std::errc::invalid_argument);
+				throw std::system_error(std::make_error_code(std::errc::invalid_argument));
 			}
 
 			_Output.resize(_Output.size() * 2);
@@ -1078,114 +1934,416 @@ inline UString UString::fromString(std::string_view str, const std::locale& loca
 		//case codecvt_base::error:
 		//case codecvt_base::noconv:
 		default:
-			std::_Throw_system_error(std::errc::invalid_argument);
+			throw std::system_error(std::make_error_code(std::errc::invalid_argument));
 		}
 	}
 }
 
-constexpr UString UString::fromLatin(std::string_view str)
+template <class Alloc>
+constexpr BasicUString<Alloc> BasicUString<Alloc>::fromLatin(std::string_view str, const Alloc& alloc)
 {
-	UString res(str.size());
-	auto currentPtr = res.data();
-	
-	for (auto otherPtr = str.data(),end= otherPtr+str.size(); otherPtr < end; ++otherPtr)
-	{
-		/*if (*currentPtr < '\a' )
-		{
-			res.pop_back();
-		}
-		else*/
-		{
-			*currentPtr = *otherPtr;
-			++currentPtr;
-		}
-	}
+	BasicUString res(alloc);
+	res.appendLatin(str.data(), str.size());
+	return res;
+}
 
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromUtf8(std::string_view str, const Alloc& alloc)
+{
+	BasicUString res(alloc);
+	res.resize(ustring_detail::utf16LengthOfUtf8(str.data(), str.size()));
+	ustring_detail::utf8ToUtf16(str.data(), str.size(), (char16_t*)res.data());
 	return res;
 }
 
-inline UString UString::fromUtf8(std::string_view str)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromUtf8(std::u8string_view str, const Alloc& alloc)
 {
-	std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> converter;
+	return fromUtf8(std::string_view{ reinterpret_cast<const char*>(str.data()), str.size() }, alloc);
+}
 
-	return fromUtf16(converter.from_bytes(str.data(), str.data() + str.size()));
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromUtf8(std::string_view str, UUtfErrorMode mode, const Alloc& alloc)
+{
+	if (mode == UUtfErrorMode::Strict)
+		return fromUtf8(str, alloc);
+
+	BasicUString res(alloc);
+	res.resize(ustring_detail::utf16LengthOfUtf8(str.data(), str.size()));
+	size_t read = 0;
+	auto written = ustring_detail::utf8ToUtf16Prefix(str.data(), str.size(), (char16_t*)res.data(), read);
+	if (read != str.size())
+	{
+		//a byte becomes at most one unit, U+FFFD included
+		res.resize(written + str.size() - read);
+		written += ustring_detail::utf8ToUtf16Replacing(str.data() + read, str.size() - read, (char16_t*)res.data() + written);
+	}
+	res.resize(written);
+	return res;
 }
 
-inline UString UString::fromUtf8(std::u8string_view str)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromUtf8(std::u8string_view str, UUtfErrorMode mode, const Alloc& alloc)
 {
-	return fromUtf8(std::string_view{ reinterpret_cast<const char*>(str.data()), str.size() });
+	return fromUtf8(std::string_view{ reinterpret_cast<const char*>(str.data()), str.size() }, mode, alloc);
 }
 
-constexpr UString UString::fromUtf16(std::u16string_view str)
+template <class Alloc>
+constexpr BasicUString<Alloc> BasicUString<Alloc>::fromUtf16(std::u16string_view str, const Alloc& alloc)
 {
-	return UString((UChar*)str.data(), str.size());
+	return BasicUString((UChar*)str.data(), str.size(), alloc);
 }
 
-inline UString UString::fromUtf32(std::u32string_view str)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromUtf32(std::u32string_view str, const Alloc& alloc)
 {
-	std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-	return fromUtf8(converter.to_bytes(str.data(), str.data() + str.size()));
+	BasicUString res(alloc);
+	res.resize(ustring_detail::utf16LengthOfUtf32(str.data(), str.size()));
+	ustring_detail::utf32ToUtf16(str.data(), str.size(), (char16_t*)res.data());
+	return res;
 }
 
-inline UString UString::fromWString(std::wstring_view str)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromWString(std::wstring_view str, const Alloc& alloc)
 {
 	if constexpr (sizeof(wchar_t) == sizeof(char16_t))
 	{
-		return UString((UChar*)str.data(), str.size());
-	}
-	else if constexpr (sizeof(wchar_t) == sizeof(char32_t))
-	{
-		return fromUtf16(std::filesystem::_Convert_wide_to<std::char_traits<char16_t>,
-			std::allocator<char16_t>, char16_t>(str, std::allocator<char16_t>()));
+		return BasicUString((UChar*)str.data(), str.size(), alloc);
 	}
 	else
 	{
-		throw std::exception("Invalid size wchar_t");
+		static_assert(sizeof(wchar_t) == sizeof(char32_t), "Invalid size wchar_t");
+
+		return fromUtf32(std::u32string_view((const char32_t*)str.data(), str.size()), alloc);
 	}
 }
 
-inline UString UString::fromPath(const std::filesystem::path& path)
+template <class Alloc>
+inline BasicUString<Alloc> BasicUString<Alloc>::fromPath(const std::filesystem::path& path, const Alloc& alloc)
 {
-	return UString::fromUtf16(path.u16string());
+	return fromUtf16(path.u16string(), alloc);
 }
 
-constexpr bool UString::operator==(const char* val) const noexcept
+template <class Alloc>
+constexpr bool BasicUString<Alloc>::operator==(const char* val) const noexcept
 {
+	if (std::is_constant_evaluated() == false)
+	{
+		const auto count = srtLen(val);
+		return size() == count && ustring_detail::equalLatin1((const char16_t*)data(), val, count);
+	}
+
 	std::string_view view(val);
 	if (size() != view.size())
 		return false;
 	auto wptr = data();
 
 	for (auto end = val + size(); val < end; ++wptr, ++val)
-		if (*wptr != *val)
+		if (*wptr != (unsigned char)*val)
 			return false;
 	return true;
 }
 
 
-constexpr UString operator+(const char* str0,const UString& str1) {
-	std::string_view strV(str0);
+#if !defined(USTRING_USE_STRINGBUILDER)
+template <class Alloc>
+constexpr BasicUString<Alloc> operator+(const char* str0, const BasicUString<Alloc>& str1) {
+	BasicUString<Alloc> res(str1.getAllocator());
+	res.reserve(std::string_view(str0).size() + str1.size());
+	res += str0;
+	res += str1;
+	return res;
+}
+#endif
+
+template <class Alloc>
+constexpr bool operator==(const char* str0, const BasicUString<Alloc>& str1)noexcept {return str1==str0;}
+template <class Alloc>
+constexpr bool operator!=(const char* str0, const BasicUString<Alloc>& str1)noexcept { return str1 != str0; }
+template <class Alloc>
+constexpr bool operator==(const char* str0, BasicUString<Alloc>&& str1)noexcept { return str1 == str0; }
+template <class Alloc>
+constexpr bool operator!=(const char* str0, BasicUString<Alloc>&& str1)noexcept { return str1 != str0; }
+
+namespace ustring_detail
+{
+	//lookup keys of the hash and equal functors: utf-16 views or latin-1 const char*
+	struct Latin1Key
+	{
+		std::string_view str;
+	};
+
+	constexpr UStringView lookupKey(UStringView str) noexcept { return str; }
+	inline UStringView lookupKey(std::u16string_view str) noexcept { return str; }
+	template <class Alloc>
+	constexpr UStringView lookupKey(const BasicUString<Alloc>& str) noexcept { return str; }
+	constexpr Latin1Key lookupKey(const char* str) noexcept { return { str }; }
+
+	template <bool ignoreCase>
+	struct KeyHash
+	{
+		using is_transparent = void;
+
+		template <class T>
+		constexpr size_t operator()(const T& str) const noexcept { return hashOf(lookupKey(str)); }
+
+	private:
+		static constexpr size_t hashOf(UStringView str) noexcept { return hashUtf16(str.data(), str.size(), ignoreCase); }
+		static constexpr size_t hashOf(Latin1Key key) noexcept { return hashLatin1(key.str.data(), key.str.size(), ignoreCase); }
+	};
+
+	template <bool ignoreCase>
+	struct KeyEqual
+	{
+		using is_transparent = void;
+
+		template <class T0, class T1>
+		constexpr bool operator()(const T0& str0, const T1& str1) const noexcept { return equal(lookupKey(str0), lookupKey(str1)); }
+
+	private:
+		static constexpr bool equal(UStringView str0, UStringView str1) noexcept
+		{
+			return str0.size() == str1.size() && str0.startsWith(str1, ignoreCase);
+		}
+		static constexpr bool equal(UStringView str0, Latin1Key key) noexcept
+		{
+			if (str0.size() != key.str.size())
+				return false;
+			if (ignoreCase == false && std::is_constant_evaluated() == false)
+				return equalLatin1((const char16_t*)str0.data(), key.str.data(), key.str.size());
+			for (size_t i = 0; i < key.str.size(); ++i)
+			{
+				const char16_t unit = (unsigned char)key.str[i];
+				if (str0[i] != unit && (ignoreCase == false || foldCase(str0[i]) != foldCase(unit)))
+					return false;
+			}
+			return true;
+		}
+		static constexpr bool equal(Latin1Key key, UStringView str1) noexcept { return equal(str1, key); }
+		static constexpr bool equal(Latin1Key key0, Latin1Key key1) noexcept
+		{
+			if (key0.str.size() != key1.str.size())
+				return false;
+			for (size_t i = 0; i < key0.str.size(); ++i)
+			{
+				const char16_t unit0 = (unsigned char)key0.str[i], unit1 = (unsigned char)key1.str[i];
+				if (unit0 != unit1 && (ignoreCase == false || foldCase(unit0) != foldCase(unit1)))
+					return false;
+			}
+			return true;
+		}
+	};
+}
+
+//transparent hash and equal functors for unordered containers of UString:
+//std::unordered_map<UString, T, UStringHash, UStringEqual> is searched by UStringView,
+//std::u16string_view or latin-1 const char* without making a UString
+typedef ustring_detail::KeyHash<false> UStringHash;
+typedef ustring_detail::KeyEqual<false> UStringEqual;
+//same, keys equal ignoring case hash equal: case is folded on the fly, no lowered copy is made
+typedef ustring_detail::KeyHash<true> UStringHashIgnoreCase;
+typedef ustring_detail::KeyEqual<true> UStringEqualIgnoreCase;
+
+template <class Alloc>
+struct std::hash<BasicUString<Alloc>>
+{
+	constexpr size_t operator()(const BasicUString<Alloc>& str) const noexcept { return UStringHash()(str); }
+};
+
+template <>
+struct std::hash<UStringView>
+{
+	constexpr size_t operator()(UStringView str) const noexcept { return UStringHash()(str); }
+};
+
+namespace ustring_detail
+{
+	//one argument of arg(): strings are referenced, numbers are formatted into the argument itself
+	class FormatArg
+	{
+		enum class Kind : uint8_t { Units, Latin, Local };
+
+		Kind kind;
+		size_t count;
+		const void* ptr = nullptr;
+		//the longest is a 128-bit integer with its sign
+		UChar local[40];
+
+	public:
+		FormatArg(UStringView str) noexcept : kind(Kind::Units), count(str.size()), ptr(str.data()) {}
+		FormatArg(std::u16string_view str) noexcept : FormatArg(UStringView(str)) {}
+		FormatArg(const char* str) noexcept : kind(Kind::Latin), count(std::char_traits<char>::length(str)), ptr(str) {}
+		FormatArg(UChar c) noexcept : kind(Kind::Local), count(1) { local[0] = c; }
+
+		//character types are UChar
+		template <class T> requires std::integral<T> && (!std::same_as<T, bool>) && (!std::same_as<T, char>) &&
+			(!std::same_as<T, char8_t>) && (!std::same_as<T, char16_t>) && (!std::same_as<T, wchar_t>)
+		FormatArg(T num) noexcept : kind(Kind::Local), count(formatIntegralLength(num, 10))
+		{
+			formatIntegral(num, 10, local, count);
+		}
+
+		template <class T> requires std::floating_point<T>
+		FormatArg(T num) noexcept : kind(Kind::Local)
+		{
+			char buf[sizeof(local) / sizeof(UChar)];
+			count = std::to_chars(buf, buf + sizeof(buf), num).ptr - buf;
+			widenLatin1(buf, count, (char16_t*)local);
+		}
+
+		//the argument must not be copied: a number points to its own buffer
+		FormatArg(const FormatArg&) = delete;
+		FormatArg& operator=(const FormatArg&) = delete;
+
+		size_t size() const noexcept { return count; }
+
+		//true if the argument is a view of units in [first, last)
+		bool reads(const UChar* first, const UChar* last) const noexcept
+		{
+			return kind == Kind::Units && count != 0 && std::less_equal<const void*>()(first, ptr) && std::less<const void*>()(ptr, last);
+		}
+
+		void write(UChar*& out) const noexcept
+		{
+			switch (kind)
+			{
+			case Kind::Units:
+				std::char_traits<UChar>::copy(out, (const UChar*)ptr, count);
+				break;
+			case Kind::Latin:
+				widenLatin1((const char*)ptr, count, (char16_t*)out);
+				break;
+			case Kind::Local:
+				std::char_traits<UChar>::copy(out, local, count);
+				break;
+			}
+			out += count;
+		}
+	};
+
+	//number of the placeholder %1 ... %99 starting at ptr[i] and its length, 0 if there is none.
+	//two digits are always taken, as Qt does: %10 is placeholder 10 even with one argument
+	constexpr unsigned placeholderAt(const UChar* ptr, size_t count, size_t i, size_t& length) noexcept
+	{
+		if (ptr[i] != '%' || count - i < 2 || unsigned(ptr[i + 1]) - '0' >= 10u)
+			return 0;
+		unsigned number = unsigned(ptr[i + 1]) - '0';
+		length = 2;
+		if (count - i > 2 && unsigned(ptr[i + 2]) - '0' < 10u)
+		{
+			number = number * 10 + unsigned(ptr[i + 2]) - '0';
+			length = 3;
+		}
+		return number;
+	}
 
-	UString res(strV.size() + str1.size());
-	auto currentPtr = res.data();
-	auto otherPtr = str1.data();
+	//argument index of every placeholder number (-1: none), given the numbers present in a pattern
+	inline void rankPlaceholders(const bool (&present)[100], size_t argCount, int8_t (&ranks)[100]) noexcept
+	{
+		int8_t rank = 0;
+		for (size_t number = 0; number < 100; ++number)
+			ranks[number] = present[number] && size_t(rank) < argCount ? rank++ : int8_t(-1);
+	}
+}
 
-	for (auto end = currentPtr + strV.size(); currentPtr < end; ++currentPtr, ++str0)
+template <class Alloc>
+template <class... Args> requires (sizeof...(Args) > 0) && (std::constructible_from<ustring_detail::FormatArg, const Args&> && ...)
+inline BasicUString<Alloc> BasicUString<Alloc>::arg(const Args&... args) const
+{
+	//constructed in place, never moved
+	const ustring_detail::FormatArg argList[] = { ustring_detail::FormatArg(args)... };
+	const auto ptr = data();
+	const auto count = size();
+
+	bool present[100]{};
+	size_t length = 0;
+	for (size_t i = 0; i < count; ++i)
 	{
-		*currentPtr = *str0;
+		if (const auto number = ustring_detail::placeholderAt(ptr, count, i, length); number != 0)
+		{
+			present[number] = true;
+			i += length - 1;
+		}
 	}
+	int8_t ranks[100];
+	ustring_detail::rankPlaceholders(present, sizeof...(Args), ranks);
 
-	for (auto end = currentPtr + str1.size(); currentPtr < end; ++currentPtr,++otherPtr)
+	size_t resSize = count;
+	for (size_t i = 0; i < count; ++i)
 	{
-		*currentPtr = *otherPtr;
+		if (const auto number = ustring_detail::placeholderAt(ptr, count, i, length); number != 0)
+		{
+			if (ranks[number] >= 0)
+				resSize += argList[ranks[number]].size() - length;
+			i += length - 1;
+		}
 	}
 
+	BasicUString res(getAllocator());
+	res.resize(resSize);
+	auto out = res.data();
+	size_t literal = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (const auto number = ustring_detail::placeholderAt(ptr, count, i, length); number != 0)
+		{
+			if (ranks[number] >= 0)
+			{
+				out = std::copy(ptr + literal, ptr + i, out);
+				argList[ranks[number]].write(out);
+				literal = i + length;
+			}
+			i += length - 1;
+		}
+	}
+	std::copy(ptr + literal, ptr + count, out);
 	return res;
 }
 
-constexpr bool operator==(const char* str0, const UString& str1)noexcept {return str1==str0;}
-constexpr bool operator!=(const char* str0, const UString& str1)noexcept { return str1 != str0; }
-constexpr bool operator==(const char* str0, UString&& str1)noexcept { return str1 == str0; }
-constexpr bool operator!=(const char* str0, UString&& str1)noexcept { return str1 != str0; }
+//offset of the first invalid or truncated sequence, npos if str is valid utf-8. nothing is thrown or allocated
+inline size_t validateUtf8(std::string_view str) noexcept
+{
+	const auto res = ustring_detail::utf8ValidLength(str.data(), str.size());
+	return res == str.size() ? UStringView::npos : res;
+}
+
+inline size_t validateUtf8(std::u8string_view str) noexcept { return validateUtf8(std::string_view((const char*)str.data(), str.size())); }
+
+#if defined(__cpp_lib_format)
+namespace ustring_detail
+{
+	//strings are written as utf-8, fill, alignment, width and precision work as for std::string_view
+	struct UStringFormatter : std::formatter<std::string_view, char>
+	{
+		template <class FormatContext>
+		auto format(UStringView str, FormatContext& ctx) const
+		{
+			const auto src = (const char16_t*)str.data();
+			const auto length = utf8LengthOfUtf16(src, str.size());
+			char buf[256];
+			std::string longBuf;
+			char* dst = buf;
+			if (length > sizeof(buf))
+			{
+				longBuf.resize(length);
+				dst = longBuf.data();
+			}
+			utf16ToUtf8(src, str.size(), dst);
+			return std::formatter<std::string_view, char>::format(std::string_view(dst, length), ctx);
+		}
+	};
+}
+
+template <class Alloc>
+struct std::formatter<BasicUString<Alloc>, char> : ustring_detail::UStringFormatter {};
+
+template <>
+struct std::formatter<UStringView, char> : ustring_detail::UStringFormatter {};
+#endif
+
+//operator+ builds the whole expression lazily, see ustringbuilder.hpp
+#if defined(USTRING_USE_STRINGBUILDER)
+#include "ustringbuilder.hpp"
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,286 @@
+#ifndef USTRINGBUILDER_HPP
+#define USTRINGBUILDER_HPP
+
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <concepts>
+#include <algorithm>
+
+#include "ustring.hpp"
+
+template <class A, class B>
+class UConcat;
+
+//parts of a lazy concatenation: size() is known before writing, so the result is allocated once
+namespace ustring_detail
+{
+	template <class T>
+	struct ConcatPart;
+
+	//true if ptr is in [first, last). a constant evaluation cannot compare unrelated pointers, so it assumes the worst
+	constexpr bool pointsInto(const void* ptr, const UChar* first, const UChar* last) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return true;
+		return std::less_equal<const void*>()(first, ptr) && std::less<const void*>()(ptr, last);
+	}
+
+	template <class Alloc>
+	struct ConcatPart<BasicUString<Alloc>>
+	{
+		static constexpr bool isString = true;
+		static constexpr size_t size(const BasicUString<Alloc>& str) noexcept { return str.size(); }
+		static constexpr void write(const BasicUString<Alloc>& str, UChar*& out) noexcept { out = std::copy(str.begin(), str.end(), out); }
+		//two strings never share a buffer, so only the target itself starts at first
+		static constexpr bool aliases(const BasicUString<Alloc>& str, const UChar* first, const UChar*) noexcept { return std::is_constant_evaluated() || str.data() == first; }
+	};
+
+	template <>
+	struct ConcatPart<UStringView>
+	{
+		static constexpr bool isString = true;
+		static constexpr size_t size(UStringView str) noexcept { return str.size(); }
+		static constexpr void write(UStringView str, UChar*& out) noexcept { out = std::copy(str.begin(), str.end(), out); }
+		static constexpr bool aliases(UStringView str, const UChar* first, const UChar* last) noexcept { return !str.empty() && pointsInto(str.data(), first, last); }
+	};
+
+	template <>
+	struct ConcatPart<std::u16string_view>
+	{
+		static constexpr bool isString = true;
+		static constexpr size_t size(std::u16string_view str) noexcept { return str.size(); }
+		static constexpr void write(std::u16string_view str, UChar*& out) noexcept { out = std::copy(str.begin(), str.end(), out); }
+		static constexpr bool aliases(std::u16string_view str, const UChar* first, const UChar* last) noexcept { return !str.empty() && pointsInto(str.data(), first, last); }
+	};
+
+	template <>
+	struct ConcatPart<UChar>
+	{
+		static constexpr bool isString = false;
+		static constexpr size_t size(UChar) noexcept { return 1; }
+		static constexpr void write(UChar c, UChar*& out) noexcept { *out++ = c; }
+		static constexpr bool aliases(UChar, const UChar*, const UChar*) noexcept { return false; }
+	};
+
+	template <>
+	struct ConcatPart<const UChar*>
+	{
+		static constexpr bool isString = false;
+		static constexpr size_t size(const UChar* str) noexcept { return std::char_traits<UChar>::length(str); }
+		static constexpr void write(const UChar* str, UChar*& out) noexcept { out = std::copy(str, str + size(str), out); }
+		//the terminator of the target counts too, the units before it are read up to there
+		static constexpr bool aliases(const UChar* str, const UChar* first, const UChar* last) noexcept { return pointsInto(str, first, last + 1); }
+	};
+
+	//latin-1, as everywhere in UString
+	template <>
+	struct ConcatPart<const char*>
+	{
+		static constexpr bool isString = false;
+		static constexpr size_t size(const char* str) noexcept { return std::char_traits<char>::length(str); }
+		static constexpr void write(const char* str, UChar*& out) noexcept
+		{
+			const auto count = size(str);
+			if (std::is_constant_evaluated())
+			{
+				for (size_t i = 0; i < count; ++i)
+					out[i] = char16_t((unsigned char)str[i]);
+			}
+			else
+			{
+				widenLatin1(str, count, (char16_t*)out);
+			}
+			out += count;
+		}
+		static constexpr bool aliases(const char*, const UChar*, const UChar*) noexcept { return false; }
+	};
+
+	//string literals and char buffers, the length is still up to the terminator
+	template <size_t N>
+	struct ConcatPart<char[N]> : ConcatPart<const char*> {};
+
+	template <class A, class B>
+	struct ConcatPart<UConcat<A, B>>
+	{
+		static constexpr bool isString = true;
+		static constexpr size_t size(const UConcat<A, B>& concat) noexcept { return concat.size(); }
+		static constexpr void write(const UConcat<A, B>& concat, UChar*& out) noexcept { concat.write(out); }
+		static constexpr bool aliases(const UConcat<A, B>& concat, const UChar* first, const UChar* last) noexcept { return concat.aliases(first, last); }
+	};
+
+	//the first string with the allocator type Alloc in an expression, nullptr if there is none
+	template <class Alloc, class T>
+	constexpr const BasicUString<Alloc>* firstConcatString(const T&) noexcept { return nullptr; }
+	template <class Alloc>
+	constexpr const BasicUString<Alloc>* firstConcatString(const BasicUString<Alloc>& str) noexcept { return &str; }
+	template <class Alloc, class A, class B>
+	constexpr const BasicUString<Alloc>* firstConcatString(const UConcat<A, B>& concat) noexcept { return concat.template firstString<Alloc>(); }
+
+	template <class T>
+	concept ConcatOperand = requires(const T& part, UChar*& out)
+	{
+		ConcatPart<T>::size(part);
+		ConcatPart<T>::write(part, out);
+	};
+
+	//one side must be a string, so UChar + UChar and pointer arithmetic keep their meaning
+	template <class A, class B>
+	concept ConcatOperands = ConcatOperand<A> && ConcatOperand<B> && (ConcatPart<A>::isString || ConcatPart<B>::isString);
+}
+
+//lazy concatenation made by operator% (and operator+ with USTRING_USE_STRINGBUILDER defined).
+//it keeps references to its operands, so it must be converted to a string in the same expression:
+//UString url = host % "/" % path % "?" % query; allocates and copies once.
+//auto url = host % "/" % path; would keep references to temporaries
+template <class A, class B>
+class UConcat
+{
+	const A& a;
+	const B& b;
+
+public:
+	constexpr UConcat(const A& a, const B& b) noexcept : a(a), b(b) {}
+
+	constexpr size_t size() const noexcept { return ustring_detail::ConcatPart<A>::size(a) + ustring_detail::ConcatPart<B>::size(b); }
+
+	//out must hold size() units, it is moved past them
+	constexpr void write(UChar*& out) const noexcept
+	{
+		ustring_detail::ConcatPart<A>::write(a, out);
+		ustring_detail::ConcatPart<B>::write(b, out);
+	}
+
+	//true if an operand reads units of the string [first, last) or the string itself
+	constexpr bool aliases(const UChar* first, const UChar* last) const noexcept
+	{
+		return ustring_detail::ConcatPart<A>::aliases(a, first, last) || ustring_detail::ConcatPart<B>::aliases(b, first, last);
+	}
+
+	template <class Alloc = std::allocator<UChar>>
+	constexpr BasicUString<Alloc> toUString(const Alloc& alloc = Alloc()) const
+	{
+		BasicUString<Alloc> res(alloc);
+		res.resize(size());
+		auto out = res.data();
+		write(out);
+		return res;
+	}
+
+	template <class Alloc>
+	constexpr const BasicUString<Alloc>* firstString() const noexcept
+	{
+		if (const auto str = ustring_detail::firstConcatString<Alloc>(a))
+			return str;
+		return ustring_detail::firstConcatString<Alloc>(b);
+	}
+
+	//the result takes the allocator of the first string of the same type, as the eager operator+ keeps the left one's
+	template <class Alloc>
+	constexpr operator BasicUString<Alloc>() const
+	{
+		const auto str = firstString<Alloc>();
+		return toUString<Alloc>(str != nullptr ? str->getAllocator() : Alloc());
+	}
+};
+
+template <class A, class B> requires ustring_detail::ConcatOperands<A, B>
+constexpr UConcat<A, B> operator%(const A& a, const B& b) noexcept { return UConcat<A, B>(a, b); }
+
+#if defined(USTRING_USE_STRINGBUILDER)
+template <class A, class B> requires ustring_detail::ConcatOperands<A, B>
+constexpr UConcat<A, B> operator+(const A& a, const B& b) noexcept { return UConcat<A, B>(a, b); }
+#endif
+
+//grows str once for the whole expression
+template <class Alloc, class A, class B>
+constexpr BasicUString<Alloc>& operator+=(BasicUString<Alloc>& str, const UConcat<A, B>& concat)
+{
+	//str += str % x and str += UStringView(str) % x read str while it is written, so the parts are joined first
+	if (concat.aliases(str.data(), str.data() + str.size()))
+		return str += concat.template toUString<Alloc>(str.getAllocator());
+
+	const auto oldSize = str.size();
+	str.resize(oldSize + concat.size());
+	auto out = str.data() + oldSize;
+	concat.write(out);
+	return str;
+}
+
+//explicit builder: appends grow one buffer, take() moves it out as the result without copying
+template <class Alloc = std::allocator<UChar>>
+class BasicUStringBuilder
+{
+	BasicUString<Alloc> str;
+
+	template <class T>
+	static constexpr bool isNumber = (std::integral<T> || std::floating_point<T>) && !std::same_as<T, bool> &&
+		!std::same_as<T, char> && !std::same_as<T, char8_t> && !std::same_as<T, char16_t> && !std::same_as<T, char32_t> && !std::same_as<T, wchar_t>;
+
+public:
+	BasicUStringBuilder() = default;
+	explicit BasicUStringBuilder(const Alloc& alloc) : str(alloc) {}
+	//capacity is a hint of the final size in code units
+	explicit BasicUStringBuilder(size_t capacity, const Alloc& alloc = Alloc()) : str(alloc) { str.reserve(capacity); }
+
+	size_t size() const noexcept { return str.size(); }
+	bool empty() const noexcept { return str.empty(); }
+	size_t capacity() const noexcept { return str.capacity(); }
+	void reserve(size_t capacity) { str.reserve(capacity); }
+	void clear() noexcept { str.clear(); }
+
+	//valid until the next append
+	UStringView view() const noexcept { return str; }
+
+	BasicUStringBuilder& append(UStringView val) { str += val; return *this; }
+	BasicUStringBuilder& append(UChar val) { str += val; return *this; }
+	//latin-1
+	BasicUStringBuilder& append(const char* val) { str += val; return *this; }
+	BasicUStringBuilder& append(std::u8string_view utf8) { return appendUtf8(std::string_view((const char*)utf8.data(), utf8.size())); }
+	BasicUStringBuilder& appendUtf8(std::string_view utf8);
+	template <class A, class B>
+	BasicUStringBuilder& append(const UConcat<A, B>& concat) { str += concat; return *this; }
+
+	//decimal integers, shortest round-trip floating point
+	template <class T> requires isNumber<T>
+	BasicUStringBuilder& append(T num)
+	{
+		if constexpr (std::integral<T>)
+		{
+			str.appendIntegral(num);
+		}
+		else
+		{
+			char buf[64];
+			*std::to_chars(buf, buf + sizeof(buf) - 1, num).ptr = 0;
+			str += (const char*)buf;
+		}
+		return *this;
+	}
+
+	template <class T>
+	BasicUStringBuilder& operator<<(const T& val) { return append(val); }
+
+	//moves the result out, the builder is empty afterwards
+	BasicUString<Alloc> take() noexcept
+	{
+		auto res = std::move(str);
+		str.clear();
+		return res;
+	}
+	BasicUString<Alloc> toUString() const& { return BasicUString<Alloc>(str, str.getAllocator()); }
+	BasicUString<Alloc> toUString() && noexcept { return take(); }
+};
+
+typedef BasicUStringBuilder<> UStringBuilder;
+
+template <class Alloc>
+inline BasicUStringBuilder<Alloc>& BasicUStringBuilder<Alloc>::appendUtf8(std::string_view utf8)
+{
+	const auto oldSize = str.size();
+	str.resize(oldSize + ustring_detail::utf16LengthOfUtf8(utf8.data(), utf8.size()));
+	ustring_detail::utf8ToUtf16(utf8.data(), utf8.size(), (char16_t*)str.data() + oldSize);
+	return *this;
+}
+
+#endif
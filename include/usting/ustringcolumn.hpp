@@ -0,0 +1,188 @@
+#ifndef USTRINGCOLUMN_HPP
+#define USTRINGCOLUMN_HPP
+
+#include <vector>
+#include <thread>
+#include <memory>
+#include <ranges>
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <exception>
+#include <algorithm>
+#include <string_view>
+
+#include "ustring.hpp"
+
+namespace ustring_detail
+{
+	//values a thread gets at least, below that a batch is converted on the calling thread
+	constexpr size_t columnValuesPerThread = 16384;
+
+	//calls body(first, last) for contiguous parts of [0, count) on up to threadCount threads (0: one per core).
+	//the first exception thrown by a part is rethrown after all of them are done
+	template <class Body>
+	void parallelParts(size_t count, size_t threadCount, const Body& body)
+	{
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		threadCount = std::min(threadCount, count / columnValuesPerThread);
+		if (threadCount <= 1)
+		{
+			body(size_t(0), count);
+			return;
+		}
+
+		const size_t part = (count + threadCount - 1) / threadCount;
+		std::vector<std::exception_ptr> errors(threadCount);
+		auto run = [&](size_t index)
+			{
+				try
+				{
+					body(index * part, std::min(count, (index + 1) * part));
+				}
+				catch (...)
+				{
+					errors[index] = std::current_exception();
+				}
+			};
+		{
+			//joined when they go out of scope, also if starting one of them throws
+			std::vector<std::jthread> workers;
+			workers.reserve(threadCount - 1);
+			for (size_t index = 1; index < threadCount; ++index)
+				workers.emplace_back(run, index);
+			run(0);
+		}
+		for (auto& error : errors)
+			if (error)
+				std::rethrow_exception(error);
+	}
+}
+
+//a batch of strings in one buffer: the values are stored one after another and found by their offsets,
+//so a column of any size takes two allocations. UStringColumn names = UStringColumn::fromUtf8(rows);
+//for (UStringView name : names) ...
+template <class Alloc = std::allocator<UChar>>
+class BasicUStringColumn
+{
+	typedef std::vector<size_t, typename std::allocator_traits<Alloc>::template rebind_alloc<size_t>> Offsets;
+
+	BasicUString<Alloc> units;
+	//size() + 1 entries, value i is units[offsets[i], offsets[i + 1])
+	Offsets offsets;
+
+public:
+	class iterator
+	{
+		const UChar* units = nullptr;
+		const size_t* offset = nullptr;
+
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = UStringView;
+		using difference_type = std::ptrdiff_t;
+
+		iterator() noexcept = default;
+		iterator(const UChar* units, const size_t* offset) noexcept : units(units), offset(offset) {}
+
+		UStringView operator*() const noexcept { return UStringView(units + offset[0], offset[1] - offset[0]); }
+		UStringView operator[](difference_type n) const noexcept { return *(*this + n); }
+
+		iterator& operator++() noexcept { ++offset; return *this; }
+		iterator operator++(int) noexcept { auto res = *this; ++offset; return res; }
+		iterator& operator--() noexcept { --offset; return *this; }
+		iterator operator--(int) noexcept { auto res = *this; --offset; return res; }
+		iterator& operator+=(difference_type n) noexcept { offset += n; return *this; }
+		iterator& operator-=(difference_type n) noexcept { offset -= n; return *this; }
+
+		friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+		friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+		friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+		friend difference_type operator-(const iterator& it0, const iterator& it1) noexcept { return it0.offset - it1.offset; }
+		friend bool operator==(const iterator& it0, const iterator& it1) noexcept { return it0.offset == it1.offset; }
+		friend std::strong_ordering operator<=>(const iterator& it0, const iterator& it1) noexcept { return it0.offset <=> it1.offset; }
+	};
+
+	explicit BasicUStringColumn(const Alloc& alloc = Alloc()) : units(alloc), offsets(1, 0, alloc) {}
+
+	//converts a batch of utf-8 values (std::string, std::string_view...): the lengths are found first, then the buffer
+	//is allocated once and every value transcoded into its place. threadCount > 1 (0: one per core) splits a large batch
+	//between threads. UUtfErrorMode::Strict throws std::range_error if a value is not valid utf-8
+	template <std::ranges::random_access_range Range>
+		requires std::ranges::sized_range<Range> && std::convertible_to<std::ranges::range_reference_t<const Range&>, std::string_view>
+	static BasicUStringColumn fromUtf8(const Range& values, UUtfErrorMode mode = UUtfErrorMode::Strict, size_t threadCount = 1, const Alloc& alloc = Alloc());
+
+	size_t size() const noexcept { return offsets.size() - 1; }
+	bool empty() const noexcept { return size() == 0; }
+
+	UStringView operator[](size_t i) const noexcept { return UStringView(units.data() + offsets[i], offsets[i + 1] - offsets[i]); }
+	iterator begin() const noexcept { return iterator(units.data(), offsets.data()); }
+	iterator end() const noexcept { return iterator(units.data(), offsets.data() + size()); }
+
+	//the values one after another
+	UStringView buffer() const noexcept { return units; }
+	//views of the values, valid while the column is
+	std::vector<UStringView> views() const { return std::vector<UStringView>(begin(), end()); }
+
+	void reserve(size_t valueCount, size_t unitCount)
+	{
+		offsets.reserve(valueCount + 1);
+		units.reserve(unitCount);
+	}
+	void push_back(UStringView value)
+	{
+		units += value;
+		offsets.push_back(units.size());
+	}
+	void clear() noexcept
+	{
+		units.clear();
+		offsets.resize(1);
+	}
+};
+
+typedef BasicUStringColumn<> UStringColumn;
+
+template <class Alloc>
+template <std::ranges::random_access_range Range>
+	requires std::ranges::sized_range<Range> && std::convertible_to<std::ranges::range_reference_t<const Range&>, std::string_view>
+inline BasicUStringColumn<Alloc> BasicUStringColumn<Alloc>::fromUtf8(const Range& values, UUtfErrorMode mode, size_t threadCount, const Alloc& alloc)
+{
+	BasicUStringColumn res(alloc);
+	const size_t count = std::ranges::size(values);
+	const auto first = std::ranges::begin(values);
+	res.offsets.resize(count + 1);
+	const auto offsets = res.offsets.data();
+
+	//lengths are stored one entry ahead and summed into offsets
+	ustring_detail::parallelParts(count, threadCount, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const std::string_view value = first[i];
+				offsets[i + 1] = mode == UUtfErrorMode::Strict ? ustring_detail::utf16LengthOfUtf8(value.data(), value.size())
+					: ustring_detail::utf16LengthOfUtf8Replacing(value.data(), value.size());
+			}
+		});
+	for (size_t i = 0; i < count; ++i)
+		offsets[i + 1] += offsets[i];
+
+	res.units.resize(offsets[count]);
+	const auto dst = (char16_t*)res.units.data();
+	ustring_detail::parallelParts(count, threadCount, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const std::string_view value = first[i];
+				if (mode == UUtfErrorMode::Strict)
+					ustring_detail::utf8ToUtf16(value.data(), value.size(), dst + offsets[i]);
+				else
+					ustring_detail::utf8ToUtf16Replacing(value.data(), value.size(), dst + offsets[i]);
+			}
+		});
+	return res;
+}
+
+#endif
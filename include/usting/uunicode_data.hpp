@@ -0,0 +1,14370 @@
+#ifndef UUNICODE_DATA_HPP
+#define UUNICODE_DATA_HPP
+
+//generated by tools/gen_unicode_data.py from the Unicode Character Database
+//version 14.0.0, do not edit
+
+#include <cstdint>
+
+namespace ustring_detail
+{
+	struct UnicodeProps
+	{
+		uint8_t category;
+		uint8_t flags;
+		uint16_t upperDelta;
+		uint16_t lowerDelta;
+	};
+
+	inline constexpr uint8_t unicodeFlagWhiteSpace = 1;
+	inline constexpr uint8_t unicodeFlagSpecialCase = 2;
+	inline constexpr uint8_t unicodeFlagCased = 4;
+	inline constexpr uint8_t unicodeFlagCaseIgnorable = 8;
+	inline constexpr unsigned unicodeBlockShift = 7;
+
+	inline constexpr UnicodeProps unicodeProps[220] = {
+		{ 25, 0, 0, 0 },
+		{ 25, 1, 0, 0 },
+		{ 22, 1, 0, 0 },
+		{ 17, 0, 0, 0 },
+		{ 19, 0, 0, 0 },
+		{ 17, 8, 0, 0 },
+		{ 13, 0, 0, 0 },
+		{ 14, 0, 0, 0 },
+		{ 18, 0, 0, 0 },
+		{ 12, 0, 0, 0 },
+		{ 8, 0, 0, 0 },
+		{ 0, 4, 0, 32 },
+		{ 20, 8, 0, 0 },
+		{ 11, 0, 0, 0 },
+		{ 1, 4, 65504, 0 },
+		{ 21, 0, 0, 0 },
+		{ 4, 4, 0, 0 },
+		{ 15, 0, 0, 0 },
+		{ 26, 8, 0, 0 },
+		{ 10, 0, 0, 0 },
+		{ 1, 6, 743, 0 },
+		{ 16, 0, 0, 0 },
+		{ 1, 6, 0, 0 },
+		{ 1, 4, 121, 0 },
+		{ 0, 4, 0, 1 },
+		{ 1, 4, 65535, 0 },
+		{ 0, 6, 0, 65337 },
+		{ 1, 4, 65304, 0 },
+		{ 1, 4, 0, 0 },
+		{ 0, 4, 0, 65415 },
+		{ 1, 6, 65236, 0 },
+		{ 1, 4, 195, 0 },
+		{ 0, 4, 0, 210 },
+		{ 0, 4, 0, 206 },
+		{ 0, 4, 0, 205 },
+		{ 0, 4, 0, 79 },
+		{ 0, 4, 0, 202 },
+		{ 0, 4, 0, 203 },
+		{ 0, 4, 0, 207 },
+		{ 1, 4, 97, 0 },
+		{ 0, 4, 0, 211 },
+		{ 0, 4, 0, 209 },
+		{ 1, 4, 163, 0 },
+		{ 0, 4, 0, 213 },
+		{ 1, 4, 130, 0 },
+		{ 0, 4, 0, 214 },
+		{ 0, 4, 0, 218 },
+		{ 0, 4, 0, 217 },
+		{ 0, 4, 0, 219 },
+		{ 4, 0, 0, 0 },
+		{ 1, 4, 56, 0 },
+		{ 0, 4, 0, 2 },
+		{ 2, 4, 65535, 1 },
+		{ 1, 4, 65534, 0 },
+		{ 1, 4, 65457, 0 },
+		{ 0, 4, 0, 65439 },
+		{ 0, 4, 0, 65480 },
+		{ 0, 4, 0, 65406 },
+		{ 0, 4, 0, 10795 },
+		{ 0, 4, 0, 65373 },
+		{ 0, 4, 0, 10792 },
+		{ 1, 4, 10815, 0 },
+		{ 0, 4, 0, 65341 },
+		{ 0, 4, 0, 69 },
+		{ 0, 4, 0, 71 },
+		{ 1, 4, 10783, 0 },
+		{ 1, 4, 10780, 0 },
+		{ 1, 4, 10782, 0 },
+		{ 1, 4, 65326, 0 },
+		{ 1, 4, 65330, 0 },
+		{ 1, 4, 65331, 0 },
+		{ 1, 4, 65334, 0 },
+		{ 1, 4, 65333, 0 },
+		{ 1, 4, 42319, 0 },
+		{ 1, 4, 42315, 0 },
+		{ 1, 4, 65329, 0 },
+		{ 1, 4, 42280, 0 },
+		{ 1, 4, 42308, 0 },
+		{ 1, 4, 65327, 0 },
+		{ 1, 4, 65325, 0 },
+		{ 1, 4, 10743, 0 },
+		{ 1, 4, 42305, 0 },
+		{ 1, 4, 10749, 0 },
+		{ 1, 4, 65323, 0 },
+		{ 1, 4, 65322, 0 },
+		{ 1, 4, 10727, 0 },
+		{ 1, 4, 65318, 0 },
+		{ 1, 4, 42307, 0 },
+		{ 1, 4, 42282, 0 },
+		{ 1, 4, 65467, 0 },
+		{ 1, 4, 65319, 0 },
+		{ 1, 4, 65465, 0 },
+		{ 1, 4, 65317, 0 },
+		{ 1, 4, 42261, 0 },
+		{ 1, 4, 42258, 0 },
+		{ 3, 12, 0, 0 },
+		{ 3, 8, 0, 0 },
+		{ 5, 8, 0, 0 },
+		{ 5, 14, 84, 0 },
+		{ 29, 0, 0, 0 },
+		{ 0, 4, 0, 116 },
+		{ 0, 4, 0, 38 },
+		{ 0, 4, 0, 37 },
+		{ 0, 4, 0, 64 },
+		{ 0, 4, 0, 63 },
+		{ 1, 4, 65498, 0 },
+		{ 1, 4, 65499, 0 },
+		{ 1, 6, 65505, 0 },
+		{ 1, 4, 65472, 0 },
+		{ 1, 4, 65473, 0 },
+		{ 0, 4, 0, 8 },
+		{ 1, 6, 65474, 0 },
+		{ 1, 6, 65479, 0 },
+		{ 0, 4, 0, 0 },
+		{ 1, 6, 65489, 0 },
+		{ 1, 6, 65482, 0 },
+		{ 1, 4, 65528, 0 },
+		{ 1, 6, 65450, 0 },
+		{ 1, 6, 65456, 0 },
+		{ 1, 4, 7, 0 },
+		{ 1, 4, 65420, 0 },
+		{ 0, 4, 0, 65476 },
+		{ 1, 6, 65440, 0 },
+		{ 0, 4, 0, 65529 },
+		{ 0, 4, 0, 80 },
+		{ 1, 4, 65456, 0 },
+		{ 7, 8, 0, 0 },
+		{ 0, 4, 0, 15 },
+		{ 1, 4, 65521, 0 },
+		{ 0, 4, 0, 48 },
+		{ 1, 4, 65488, 0 },
+		{ 6, 0, 0, 0 },
+		{ 0, 4, 0, 7264 },
+		{ 1, 4, 3008, 0 },
+		{ 0, 6, 0, 38864 },
+		{ 0, 6, 0, 8 },
+		{ 1, 6, 65528, 0 },
+		{ 9, 0, 0, 0 },
+		{ 1, 6, 59282, 0 },
+		{ 1, 6, 59283, 0 },
+		{ 1, 6, 59292, 0 },
+		{ 1, 6, 59294, 0 },
+		{ 1, 6, 59293, 0 },
+		{ 1, 6, 59300, 0 },
+		{ 1, 6, 59355, 0 },
+		{ 1, 6, 35266, 0 },
+		{ 0, 4, 0, 62528 },
+		{ 1, 4, 35332, 0 },
+		{ 1, 4, 3814, 0 },
+		{ 1, 4, 35384, 0 },
+		{ 1, 6, 65477, 0 },
+		{ 0, 6, 0, 57921 },
+		{ 1, 4, 8, 0 },
+		{ 0, 4, 0, 65528 },
+		{ 1, 4, 74, 0 },
+		{ 1, 4, 86, 0 },
+		{ 1, 4, 100, 0 },
+		{ 1, 4, 128, 0 },
+		{ 1, 4, 112, 0 },
+		{ 1, 4, 126, 0 },
+		{ 1, 6, 8, 0 },
+		{ 2, 6, 0, 65528 },
+		{ 1, 6, 9, 0 },
+		{ 0, 4, 0, 65462 },
+		{ 2, 6, 0, 65527 },
+		{ 1, 6, 58331, 0 },
+		{ 0, 4, 0, 65450 },
+		{ 0, 4, 0, 65436 },
+		{ 0, 4, 0, 65424 },
+		{ 0, 4, 0, 65408 },
+		{ 0, 4, 0, 65410 },
+		{ 15, 8, 0, 0 },
+		{ 16, 8, 0, 0 },
+		{ 23, 1, 0, 0 },
+		{ 24, 1, 0, 0 },
+		{ 0, 4, 0, 58019 },
+		{ 0, 4, 0, 57153 },
+		{ 0, 4, 0, 57274 },
+		{ 0, 4, 0, 28 },
+		{ 1, 4, 65508, 0 },
+		{ 9, 4, 0, 16 },
+		{ 9, 4, 65520, 0 },
+		{ 21, 4, 0, 26 },
+		{ 21, 4, 65510, 0 },
+		{ 0, 4, 0, 54793 },
+		{ 0, 4, 0, 61722 },
+		{ 0, 4, 0, 54809 },
+		{ 1, 4, 54741, 0 },
+		{ 1, 4, 54744, 0 },
+		{ 0, 4, 0, 54756 },
+		{ 0, 4, 0, 54787 },
+		{ 0, 4, 0, 54753 },
+		{ 0, 4, 0, 54754 },
+		{ 0, 4, 0, 54721 },
+		{ 1, 4, 58272, 0 },
+		{ 0, 4, 0, 30204 },
+		{ 0, 4, 0, 23256 },
+		{ 1, 4, 48, 0 },
+		{ 0, 4, 0, 23228 },
+		{ 0, 4, 0, 23217 },
+		{ 0, 4, 0, 23221 },
+		{ 0, 4, 0, 23231 },
+		{ 0, 4, 0, 23278 },
+		{ 0, 4, 0, 23254 },
+		{ 0, 4, 0, 23275 },
+		{ 0, 4, 0, 928 },
+		{ 0, 4, 0, 65488 },
+		{ 0, 4, 0, 23229 },
+		{ 0, 4, 0, 30152 },
+		{ 1, 4, 64608, 0 },
+		{ 1, 6, 26672, 0 },
+		{ 27, 0, 0, 0 },
+		{ 28, 0, 0, 0 },
+		{ 0, 4, 0, 40 },
+		{ 1, 4, 65496, 0 },
+		{ 0, 4, 0, 39 },
+		{ 1, 4, 65497, 0 },
+		{ 0, 4, 0, 34 },
+		{ 1, 4, 65502, 0 },
+		{ 21, 4, 0, 0 },
+	};
+
+	inline constexpr uint8_t unicodePropsStage1[8704] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+		32, 33, 34, 34, 35, 36, 37, 38, 39, 34, 34, 34, 40, 41, 42, 43,
+		44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+		60, 61, 62, 63, 64, 64, 65, 66, 67, 68, 69, 70, 71, 69, 72, 73,
+		69, 69, 64, 74, 64, 64, 75, 76, 77, 78, 79, 80, 81, 82, 69, 83,
+		84, 85, 86, 87, 88, 89, 69, 69, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 90, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		91, 34, 34, 34, 34, 34, 34, 34, 34, 92, 34, 34, 93, 94, 95, 96,
+		97, 98, 99, 100, 101, 102, 103, 104, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 105,
+		106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 34, 34, 108, 109, 110, 111, 34, 34, 112, 113, 114, 115, 116, 117,
+		118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 34, 34, 130, 131,
+		132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 122, 143, 144, 145, 146,
+		147, 148, 149, 150, 151, 152, 153, 122, 154, 155, 122, 156, 157, 158, 159, 122,
+		160, 161, 162, 163, 164, 165, 122, 122, 166, 167, 168, 169, 122, 170, 122, 171,
+		34, 34, 34, 34, 34, 34, 34, 172, 173, 34, 174, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 175,
+		34, 34, 34, 34, 34, 34, 34, 34, 176, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 34, 34, 34, 34, 177, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		34, 34, 34, 34, 178, 179, 180, 181, 122, 122, 122, 122, 182, 183, 184, 185,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 186,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 187, 188, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 189,
+		34, 34, 190, 34, 34, 191, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 192, 193, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 194, 195,
+		69, 196, 197, 198, 199, 200, 201, 122, 202, 203, 204, 205, 206, 207, 208, 209,
+		69, 69, 69, 69, 210, 211, 122, 122, 122, 122, 122, 122, 122, 122, 212, 122,
+		213, 122, 214, 122, 122, 215, 122, 122, 122, 122, 122, 122, 122, 122, 122, 216,
+		34, 217, 218, 122, 122, 122, 122, 122, 219, 220, 221, 122, 222, 223, 122, 122,
+		224, 225, 226, 227, 228, 122, 69, 229, 69, 69, 69, 69, 69, 230, 231, 232,
+		233, 234, 69, 69, 235, 236, 69, 237, 122, 122, 122, 122, 122, 122, 122, 122,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 238, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 239, 34,
+		240, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 241, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 242, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		34, 34, 34, 34, 243, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 244, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		245, 122, 246, 247, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 248,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+		107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 248,
+	};
+
+	inline constexpr uint8_t unicodePropsStage2[31872] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 3, 3, 3, 4, 3, 3, 5, 6, 7, 3, 8, 3, 9, 5, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 3, 8, 8, 8, 3,
+		3, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 3, 7, 12, 13,
+		12, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 8, 7, 8, 0,
+		0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 3, 4, 4, 4, 4, 15, 3, 12, 15, 16, 17, 8, 18, 15, 12,
+		15, 8, 19, 19, 12, 20, 3, 5, 12, 19, 16, 21, 19, 19, 19, 3,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 8, 11, 11, 11, 11, 11, 11, 11, 22,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 8, 14, 14, 14, 14, 14, 14, 14, 23,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		26, 27, 24, 25, 24, 25, 24, 25, 28, 24, 25, 24, 25, 24, 25, 24,
+		25, 24, 25, 24, 25, 24, 25, 24, 25, 22, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 29, 24, 25, 24, 25, 24, 25, 30,
+		31, 32, 24, 25, 24, 25, 33, 24, 25, 34, 34, 24, 25, 28, 35, 36,
+		37, 24, 25, 34, 38, 39, 40, 41, 24, 25, 42, 28, 40, 43, 44, 45,
+		24, 25, 24, 25, 24, 25, 46, 24, 25, 46, 28, 28, 24, 25, 46, 24,
+		25, 47, 47, 24, 25, 24, 25, 48, 24, 25, 28, 49, 24, 25, 28, 50,
+		49, 49, 49, 49, 51, 52, 53, 51, 52, 53, 51, 52, 53, 24, 25, 24,
+		25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 54, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		22, 51, 52, 53, 24, 25, 55, 56, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		57, 28, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 28, 28, 28, 28, 28, 28, 58, 24, 25, 59, 60, 61,
+		61, 24, 25, 62, 63, 64, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		65, 66, 67, 68, 69, 28, 70, 70, 28, 71, 28, 72, 73, 28, 28, 28,
+		70, 74, 28, 75, 28, 76, 77, 28, 78, 79, 77, 80, 81, 28, 28, 79,
+		28, 82, 83, 28, 28, 84, 28, 28, 28, 28, 28, 28, 28, 85, 28, 28,
+		86, 28, 87, 86, 28, 28, 28, 88, 86, 89, 90, 90, 91, 28, 28, 28,
+		28, 28, 92, 28, 49, 28, 28, 28, 28, 28, 28, 28, 28, 93, 94, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 96, 96, 96, 96, 96, 96, 96,
+		95, 95, 12, 12, 12, 12, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+		96, 96, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		95, 95, 95, 95, 95, 12, 12, 12, 12, 12, 12, 12, 96, 12, 96, 12,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		24, 25, 24, 25, 96, 12, 24, 25, 99, 99, 95, 44, 44, 44, 3, 100,
+		99, 99, 99, 99, 12, 12, 101, 5, 102, 102, 102, 99, 103, 99, 104, 104,
+		22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 99, 11, 11, 11, 11, 11, 11, 11, 11, 11, 105, 106, 106, 106,
+		22, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 107, 14, 14, 14, 14, 14, 14, 14, 14, 14, 108, 109, 109, 110,
+		111, 112, 113, 113, 113, 114, 115, 116, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		117, 118, 119, 120, 121, 122, 8, 24, 25, 123, 24, 25, 28, 57, 57, 57,
+		124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 15, 97, 97, 97, 97, 97, 126, 126, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		127, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 128,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		99, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		129, 129, 129, 129, 129, 129, 129, 99, 99, 96, 3, 3, 3, 3, 3, 5,
+		28, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 22, 28, 3, 9, 99, 99, 15, 15, 4,
+		99, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 9, 97,
+		3, 97, 97, 3, 97, 97, 3, 97, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 49,
+		49, 49, 49, 3, 5, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		18, 18, 18, 18, 18, 18, 8, 8, 8, 3, 3, 4, 3, 3, 15, 15,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 3, 18, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		96, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 3, 3, 49, 49,
+		97, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 3, 49, 97, 97, 97, 97, 97, 97, 97, 18, 15, 97,
+		97, 97, 97, 97, 97, 96, 96, 97, 97, 15, 97, 97, 97, 97, 49, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 15, 15, 49,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 99, 18,
+		49, 97, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 99, 99, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 96, 96, 15, 3, 3, 3, 96, 99, 99, 97, 4, 4,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 96, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 96, 97, 97, 97, 96, 97, 97, 97, 97, 97, 99, 99,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 99, 99, 3, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 12, 49, 49, 49, 49, 49, 49, 99,
+		18, 18, 99, 99, 99, 99, 99, 99, 97, 97, 97, 97, 97, 97, 97, 97,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 96, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 18, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 131, 97, 49, 131, 131,
+		131, 97, 97, 97, 97, 97, 97, 97, 97, 131, 131, 131, 131, 97, 131, 131,
+		49, 97, 97, 97, 97, 97, 97, 97, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 97, 3, 3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		3, 96, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 97, 131, 131, 99, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 49,
+		49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 99, 99, 99, 49, 49, 49, 49, 99, 99, 97, 49, 131, 131,
+		131, 97, 97, 97, 97, 99, 99, 131, 131, 99, 99, 131, 131, 97, 49, 99,
+		99, 99, 99, 99, 99, 99, 99, 131, 99, 99, 99, 99, 49, 49, 99, 49,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		49, 49, 4, 4, 19, 19, 19, 19, 19, 19, 15, 4, 49, 3, 97, 99,
+		99, 97, 97, 131, 99, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 49,
+		49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 99, 49, 49, 99, 49, 49, 99, 99, 97, 99, 131, 131,
+		131, 97, 97, 99, 99, 99, 99, 97, 97, 99, 99, 97, 97, 97, 99, 99,
+		99, 97, 99, 99, 99, 99, 99, 99, 99, 49, 49, 49, 49, 99, 49, 99,
+		99, 99, 99, 99, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		97, 97, 49, 49, 49, 97, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 97, 97, 131, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49,
+		49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 99, 99, 97, 49, 131, 131,
+		131, 97, 97, 97, 97, 97, 99, 97, 97, 131, 99, 131, 131, 97, 99, 99,
+		49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		3, 4, 99, 99, 99, 99, 99, 99, 99, 49, 97, 97, 97, 97, 97, 97,
+		99, 97, 131, 131, 99, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 49,
+		49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 99, 99, 97, 49, 131, 97,
+		131, 97, 97, 97, 97, 99, 99, 131, 131, 99, 99, 131, 131, 97, 99, 99,
+		99, 99, 99, 99, 99, 97, 97, 131, 99, 99, 99, 99, 49, 49, 99, 49,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		15, 49, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 97, 49, 99, 49, 49, 49, 49, 49, 49, 99, 99, 99, 49, 49,
+		49, 99, 49, 49, 49, 49, 99, 99, 99, 49, 49, 99, 49, 99, 49, 49,
+		99, 99, 99, 49, 49, 99, 99, 99, 49, 49, 49, 99, 99, 99, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 131, 131,
+		97, 131, 131, 99, 99, 99, 131, 131, 131, 99, 131, 131, 131, 97, 99, 99,
+		49, 99, 99, 99, 99, 99, 99, 131, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		19, 19, 19, 15, 15, 15, 15, 15, 15, 4, 15, 99, 99, 99, 99, 99,
+		97, 131, 131, 131, 97, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49,
+		49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 97, 49, 97, 97,
+		97, 131, 131, 131, 131, 99, 97, 97, 97, 99, 97, 97, 97, 97, 99, 99,
+		99, 99, 99, 99, 99, 97, 97, 99, 49, 49, 49, 99, 99, 49, 99, 99,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		99, 99, 99, 99, 99, 99, 99, 3, 19, 19, 19, 19, 19, 19, 19, 15,
+		49, 97, 131, 131, 3, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49,
+		49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 99, 99, 97, 49, 131, 97,
+		131, 131, 131, 131, 131, 99, 97, 131, 131, 99, 131, 131, 97, 97, 99, 99,
+		99, 99, 99, 99, 99, 131, 131, 99, 99, 99, 99, 99, 99, 49, 49, 99,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		99, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 131, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49,
+		49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 49, 131, 131,
+		131, 97, 97, 97, 97, 99, 131, 131, 131, 99, 131, 131, 131, 97, 49, 15,
+		99, 99, 99, 99, 49, 49, 49, 131, 19, 19, 19, 19, 19, 19, 19, 49,
+		49, 49, 97, 97, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 49, 49, 49, 49, 49, 49,
+		99, 97, 131, 131, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 97, 99, 99, 99, 99, 131,
+		131, 131, 97, 97, 97, 99, 97, 99, 131, 131, 131, 131, 131, 131, 131, 131,
+		99, 99, 99, 99, 99, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		99, 99, 131, 131, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 97, 49, 49, 97, 97, 97, 97, 97, 97, 97, 99, 99, 99, 99, 4,
+		49, 49, 49, 49, 49, 49, 96, 97, 97, 97, 97, 97, 97, 97, 97, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 49, 49, 99, 49, 99, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 97, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97, 97, 49, 99, 99,
+		49, 49, 49, 49, 49, 99, 96, 99, 97, 97, 97, 97, 97, 97, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 49, 49, 49, 49,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 15, 15, 15, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 15, 3, 15, 15, 15, 97, 97, 15, 15, 15, 15, 15, 15,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 15, 97, 15, 97, 15, 97, 6, 7, 6, 7, 131, 131,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		99, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 131,
+		97, 97, 97, 97, 97, 3, 97, 97, 49, 49, 49, 49, 49, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 99, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 99, 15, 15,
+		15, 15, 15, 15, 15, 15, 97, 15, 15, 15, 15, 15, 15, 99, 15, 15,
+		3, 3, 3, 3, 3, 15, 15, 15, 15, 3, 3, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131, 131, 97, 97, 97,
+		97, 131, 97, 97, 97, 97, 97, 97, 131, 97, 97, 131, 131, 97, 97, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 3, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 131, 131, 97, 97, 49, 49, 49, 49, 97, 97,
+		97, 49, 131, 131, 131, 49, 49, 131, 131, 131, 131, 131, 131, 131, 49, 49,
+		49, 97, 97, 97, 97, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 131, 131, 97, 97, 131, 131, 131, 131, 131, 131, 97, 49, 131,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 131, 131, 131, 97, 15, 15,
+		132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+		132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+		132, 132, 132, 132, 132, 132, 99, 132, 99, 99, 99, 99, 99, 132, 99, 99,
+		133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+		133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+		133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 3, 96, 133, 133, 133,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 99, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		49, 99, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 97, 97, 97,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99,
+		134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+		135, 135, 135, 135, 135, 135, 99, 99, 136, 136, 136, 136, 136, 136, 99, 99,
+		9, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 15, 3, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		2, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 6, 7, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 3, 3, 3, 137, 137,
+		137, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 97, 97, 131, 99, 99, 99, 99, 99, 99, 99, 99, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 97, 131, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49,
+		49, 99, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 97, 97, 131, 97, 97, 97, 97, 97, 97, 97, 131, 131,
+		131, 131, 131, 131, 131, 131, 97, 131, 131, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 3, 3, 3, 96, 3, 3, 3, 4, 49, 97, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99,
+		3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 97, 97, 97, 18, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 96, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 97, 97, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 49, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		97, 97, 97, 131, 131, 131, 131, 97, 97, 131, 131, 131, 99, 99, 99, 99,
+		131, 131, 97, 131, 131, 131, 131, 131, 131, 97, 97, 97, 99, 99, 99, 99,
+		15, 99, 99, 99, 3, 3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 19, 99, 99, 99, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 97, 97, 131, 131, 97, 99, 99, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 131, 97, 131, 97, 97, 97, 97, 97, 97, 97, 99,
+		97, 131, 97, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97, 131, 131, 131,
+		131, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 99, 99, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		3, 3, 3, 3, 3, 3, 3, 96, 3, 3, 3, 3, 3, 3, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 126, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 97, 131, 97, 97, 97, 97, 97, 131, 97, 131, 131, 131,
+		131, 131, 97, 131, 131, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 3, 3, 3, 3,
+		3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 3, 99,
+		97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 131, 97, 97, 97, 97, 131, 131, 97, 97, 131, 97, 97, 97, 49, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 131, 97, 97, 131, 131, 131, 97, 131, 97,
+		97, 97, 131, 131, 99, 99, 99, 99, 99, 99, 99, 99, 3, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 131, 131, 131, 131, 131, 131, 131, 131, 97, 97, 97, 97,
+		97, 97, 97, 97, 131, 131, 97, 97, 99, 99, 99, 3, 3, 3, 3, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 49, 49, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 96, 96, 96, 96, 96, 96, 3, 3,
+		138, 139, 140, 141, 141, 142, 143, 144, 145, 99, 99, 99, 99, 99, 99, 99,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 99, 99, 146, 146, 146,
+		3, 3, 3, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 3, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 131, 97, 97, 97, 97, 97, 97, 97, 49, 49, 49, 49, 97, 49, 49,
+		49, 49, 49, 49, 97, 49, 49, 131, 97, 97, 49, 99, 99, 99, 99, 99,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 95, 147, 28, 28, 28, 148, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 149, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 22, 22, 22, 22, 22, 150, 28, 28, 151, 28,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		152, 152, 152, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153,
+		152, 152, 152, 152, 152, 152, 99, 99, 153, 153, 153, 153, 153, 153, 99, 99,
+		152, 152, 152, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153,
+		152, 152, 152, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153,
+		152, 152, 152, 152, 152, 152, 99, 99, 153, 153, 153, 153, 153, 153, 99, 99,
+		22, 152, 22, 152, 22, 152, 22, 152, 99, 153, 99, 153, 99, 153, 99, 153,
+		152, 152, 152, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153,
+		154, 154, 155, 155, 155, 155, 156, 156, 157, 157, 158, 158, 159, 159, 99, 99,
+		160, 160, 160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161,
+		160, 160, 160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161,
+		160, 160, 160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161,
+		152, 152, 22, 162, 22, 99, 22, 22, 153, 153, 163, 163, 164, 12, 165, 12,
+		12, 12, 22, 162, 22, 99, 22, 22, 166, 166, 166, 166, 164, 12, 12, 12,
+		152, 152, 22, 22, 99, 99, 22, 22, 153, 153, 167, 167, 99, 12, 12, 12,
+		152, 152, 22, 22, 22, 119, 22, 22, 153, 153, 168, 168, 123, 12, 12, 12,
+		99, 99, 22, 162, 22, 99, 22, 22, 169, 169, 170, 170, 164, 12, 12, 99,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18, 18, 18, 18, 18,
+		9, 9, 9, 9, 9, 9, 3, 3, 171, 172, 6, 17, 17, 21, 6, 17,
+		3, 3, 3, 3, 5, 3, 3, 5, 173, 174, 18, 18, 18, 18, 18, 2,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 17, 21, 3, 3, 3, 3, 13,
+		13, 3, 3, 3, 8, 6, 7, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 8, 3, 13, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+		18, 18, 18, 18, 18, 99, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		19, 95, 99, 99, 19, 19, 19, 19, 19, 19, 8, 8, 8, 6, 7, 95,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 8, 8, 8, 6, 7, 99,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 99, 99, 99,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 126, 126, 126,
+		126, 97, 126, 126, 126, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 113, 15, 15, 15, 15, 113, 15, 15, 28, 113, 113, 113, 28, 28,
+		113, 113, 113, 28, 15, 113, 15, 15, 8, 113, 113, 113, 113, 113, 15, 15,
+		15, 15, 15, 15, 113, 15, 175, 15, 113, 15, 176, 177, 113, 113, 15, 28,
+		113, 113, 178, 113, 28, 49, 49, 49, 49, 28, 15, 15, 28, 28, 113, 113,
+		8, 8, 8, 8, 8, 113, 28, 28, 28, 28, 15, 8, 15, 15, 179, 15,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+		181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+		137, 137, 137, 24, 25, 137, 137, 137, 137, 19, 15, 15, 99, 99, 99, 99,
+		8, 8, 8, 8, 8, 15, 15, 15, 15, 15, 8, 8, 15, 15, 15, 15,
+		8, 15, 15, 8, 15, 15, 8, 15, 15, 15, 15, 15, 15, 15, 8, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 8,
+		15, 15, 8, 15, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		15, 15, 15, 15, 15, 15, 15, 15, 6, 7, 6, 7, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		8, 8, 15, 15, 15, 15, 15, 15, 15, 6, 7, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 8, 8, 8,
+		8, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+		182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+		183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+		183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 8, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 8, 8, 8, 8, 8, 8, 8, 8,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		8, 8, 8, 8, 8, 6, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+		7, 6, 7, 6, 7, 6, 7, 6, 7, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 6, 7, 6, 7, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6, 7, 8, 8,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 15, 15, 8, 8, 8, 8, 8, 8, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 99, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+		130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+		24, 25, 184, 185, 186, 187, 188, 24, 25, 24, 25, 24, 25, 189, 190, 191,
+		192, 28, 24, 25, 28, 24, 25, 28, 28, 28, 28, 28, 95, 95, 193, 193,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 28, 15, 15, 15, 15, 15, 15, 24, 25, 24, 25, 97,
+		97, 97, 24, 25, 99, 99, 99, 99, 99, 3, 3, 3, 3, 19, 3, 3,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+		194, 194, 194, 194, 194, 194, 99, 194, 99, 99, 99, 99, 99, 194, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 96,
+		3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 97,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		3, 3, 17, 21, 17, 21, 3, 3, 3, 17, 21, 3, 17, 21, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 9, 3, 3, 9, 3, 17, 21, 3, 3,
+		17, 21, 6, 7, 6, 7, 6, 7, 6, 7, 3, 3, 3, 3, 3, 96,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 3, 3, 3, 3,
+		9, 3, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		15, 15, 3, 3, 3, 6, 7, 6, 7, 6, 7, 6, 7, 9, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99,
+		2, 3, 3, 3, 15, 96, 49, 137, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 15, 15, 6, 7, 6, 7, 6, 7, 6, 7, 9, 6, 7, 7,
+		15, 137, 137, 137, 137, 137, 137, 137, 137, 137, 97, 97, 97, 97, 131, 131,
+		9, 96, 96, 96, 96, 96, 15, 15, 137, 137, 137, 96, 49, 3, 15, 15,
+		99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 97, 97, 12, 12, 96, 96, 49,
+		9, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 3, 96, 96, 96, 49,
+		99, 99, 99, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		15, 15, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 19, 19, 19, 19, 19, 19, 19, 19,
+		15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 96, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 96, 96, 96, 96, 96, 96, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 96, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 49, 97,
+		126, 126, 126, 3, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 3, 96,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 95, 95, 97, 97,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		97, 97, 3, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99,
+		12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+		12, 12, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		28, 28, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		95, 28, 28, 28, 28, 28, 28, 28, 28, 24, 25, 24, 25, 195, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 96, 12, 12, 24, 25, 196, 28, 49,
+		24, 25, 24, 25, 197, 28, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 198, 199, 200, 201, 198, 28,
+		202, 203, 204, 205, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25, 24, 25,
+		24, 25, 24, 25, 206, 207, 208, 24, 25, 24, 25, 99, 99, 99, 99, 99,
+		24, 25, 99, 28, 99, 28, 24, 25, 24, 25, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 96, 96, 96, 24, 25, 49, 95, 95, 28, 49, 49, 49, 49, 49,
+		49, 49, 97, 49, 49, 49, 97, 49, 49, 49, 49, 97, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 131, 131, 97, 97, 131, 15, 15, 15, 15, 97, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 15, 15, 4, 15, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99,
+		131, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+		131, 131, 131, 131, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 3, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 49, 49, 49, 49, 49, 49, 3, 3, 3, 49, 3, 49, 49, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 131, 131, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		97, 97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 97, 131, 131, 97, 97, 97, 97, 131, 131, 97, 97, 131, 131,
+		131, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 99, 96,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 3, 3,
+		49, 49, 49, 49, 49, 97, 96, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 49, 49, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 131,
+		131, 97, 97, 131, 131, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 97, 49, 49, 49, 49, 49, 49, 49, 49, 97, 131, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 3, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		96, 49, 49, 49, 49, 49, 49, 15, 15, 15, 49, 131, 97, 131, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		97, 49, 97, 97, 97, 49, 49, 97, 97, 49, 49, 49, 49, 49, 97, 97,
+		49, 97, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 49, 49, 96, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131, 97, 97, 131, 131,
+		3, 3, 49, 96, 96, 131, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 49, 49, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49, 99,
+		99, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 99,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 209, 28, 28, 28, 28, 28, 28, 28, 12, 95, 95, 95, 95,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 96, 12, 12, 99, 99, 99, 99,
+		210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+		210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+		210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+		210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+		210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 131, 131, 97, 131, 131, 97, 131, 131, 3, 131, 97, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		22, 22, 22, 22, 22, 22, 22, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 22, 22, 22, 22, 22, 99, 99, 99, 99, 99, 49, 97, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 8, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 99, 49, 99,
+		49, 49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 7, 6,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 15,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 4, 15, 15, 15,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		3, 3, 3, 5, 3, 3, 3, 6, 7, 3, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		3, 9, 9, 13, 13, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+		7, 6, 7, 6, 7, 3, 3, 6, 7, 3, 3, 3, 3, 13, 13, 13,
+		3, 3, 5, 99, 3, 5, 3, 3, 9, 6, 7, 6, 7, 6, 7, 3,
+		3, 3, 8, 9, 8, 8, 8, 99, 3, 4, 3, 3, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 18,
+		99, 3, 3, 3, 4, 3, 3, 5, 6, 7, 3, 8, 3, 9, 5, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 3, 8, 8, 8, 3,
+		3, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 3, 7, 12, 13,
+		12, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 8, 7, 8, 6,
+		7, 3, 6, 7, 3, 3, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		96, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 96, 96,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		99, 99, 49, 49, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49,
+		99, 99, 49, 49, 49, 49, 49, 49, 99, 99, 49, 49, 49, 99, 99, 99,
+		4, 4, 8, 12, 15, 4, 4, 99, 15, 8, 8, 8, 8, 15, 15, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 18, 18, 18, 15, 15, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99,
+		3, 3, 3, 99, 99, 99, 99, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 99, 99, 99, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 19, 19, 15, 15, 15, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99,
+		15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 97, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99, 99, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 137, 49, 49, 49, 49, 49, 49, 49, 49, 137, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 99, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		3, 137, 137, 137, 137, 137, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		213, 213, 213, 213, 213, 213, 213, 213, 214, 214, 214, 214, 214, 214, 214, 214,
+		214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+		214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		213, 213, 213, 213, 99, 99, 99, 99, 214, 214, 214, 214, 214, 214, 214, 214,
+		214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+		214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 3,
+		215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 99, 215, 215, 215, 215,
+		215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 99, 215, 215, 215, 215,
+		215, 215, 215, 99, 215, 215, 99, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+		216, 216, 99, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+		216, 216, 99, 216, 216, 216, 216, 216, 216, 216, 99, 216, 216, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		95, 96, 96, 95, 95, 95, 99, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+		95, 99, 95, 95, 95, 95, 95, 95, 95, 95, 95, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 99, 99, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 49, 49, 99, 99, 99, 49, 99, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 3, 19, 19, 19, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 15, 15, 19, 19, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		99, 99, 99, 99, 99, 99, 99, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 99, 49, 49, 99, 99, 99, 99, 99, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 19, 19, 19, 19, 19, 19, 99, 99, 99, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 3,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 19, 19, 49, 49,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		99, 99, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		49, 97, 97, 97, 99, 97, 97, 99, 99, 99, 99, 99, 97, 97, 97, 97,
+		49, 49, 49, 49, 99, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 97, 97, 97, 99, 99, 99, 99, 97,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 19, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 19, 19,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 15, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 97, 97, 99, 99, 99, 99, 19, 19, 19, 19, 19,
+		3, 3, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 99, 3, 3, 3, 3, 3, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 19, 19, 19, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 99, 99, 99, 99, 99, 19, 19, 19, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 99, 99, 99, 99, 99, 99, 99, 3, 3, 3, 3, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 19, 19, 19, 19, 19, 19, 19,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+		103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+		103, 103, 103, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		108, 108, 108, 99, 99, 99, 99, 99, 99, 99, 19, 19, 19, 19, 19, 19,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 97, 97, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 97, 97, 9, 99, 99,
+		49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 19, 19, 19, 19, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 97, 97, 97, 97, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		131, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 3, 3, 3, 3, 3, 3, 3, 99, 99,
+		99, 99, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		97, 49, 49, 97, 97, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 97,
+		97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		131, 131, 131, 97, 97, 97, 97, 131, 131, 97, 97, 3, 3, 18, 3, 3,
+		3, 3, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 18, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 131, 97, 97, 97,
+		97, 97, 97, 97, 97, 99, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		3, 3, 3, 3, 49, 131, 131, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 97, 3, 3, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 131, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 131, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97, 97, 131,
+		131, 49, 49, 49, 49, 3, 3, 3, 3, 97, 97, 97, 97, 3, 131, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 49, 3, 49, 3, 3, 3,
+		99, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131, 131, 131, 97,
+		97, 97, 131, 131, 97, 131, 97, 97, 3, 3, 3, 3, 3, 3, 97, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 99, 49, 49, 49, 49, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 3, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97,
+		131, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		97, 97, 131, 131, 99, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 49,
+		49, 99, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 99, 97, 97, 49, 131, 131,
+		97, 131, 131, 131, 131, 99, 99, 131, 131, 99, 99, 131, 131, 131, 99, 99,
+		49, 99, 99, 99, 99, 99, 99, 131, 99, 99, 99, 99, 99, 49, 49, 49,
+		49, 49, 131, 131, 99, 99, 97, 97, 97, 97, 97, 97, 97, 99, 99, 99,
+		97, 97, 97, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 131, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97,
+		131, 131, 97, 97, 97, 131, 97, 49, 49, 49, 49, 3, 3, 3, 3, 3,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 99, 3, 97, 49,
+		49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		131, 131, 131, 97, 97, 97, 97, 97, 97, 131, 97, 131, 131, 131, 131, 97,
+		97, 131, 97, 97, 49, 49, 3, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131,
+		131, 131, 97, 97, 97, 97, 99, 99, 131, 131, 131, 131, 97, 97, 131, 97,
+		97, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 49, 49, 49, 49, 97, 97, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		131, 131, 131, 97, 97, 97, 97, 97, 97, 97, 97, 131, 131, 97, 131, 97,
+		97, 3, 3, 3, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 131, 97, 131, 131,
+		97, 97, 97, 97, 97, 97, 131, 97, 49, 3, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 97, 97, 97,
+		131, 131, 97, 97, 97, 97, 131, 97, 97, 97, 97, 97, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 19, 19, 3, 3, 3, 15,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131, 131, 131, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 131, 97, 97, 3, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 49, 99, 99, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		131, 131, 131, 131, 131, 131, 99, 131, 131, 99, 99, 97, 97, 131, 97, 49,
+		131, 49, 131, 97, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 131, 131, 131, 97, 97, 97, 97, 99, 99, 97, 97, 131, 131, 131, 131,
+		97, 49, 3, 49, 131, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 97, 97, 97, 97, 97, 97, 131, 49, 97, 97, 97, 97, 3,
+		3, 3, 3, 3, 3, 3, 3, 97, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 97, 97, 97, 97, 97, 97, 131, 131, 97, 97, 97, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 131, 97, 97, 3, 3, 3, 49, 3, 3,
+		3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131,
+		97, 97, 97, 97, 97, 97, 97, 99, 97, 97, 97, 97, 97, 97, 131, 97,
+		49, 3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99,
+		3, 3, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 99, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 99, 131, 97, 97, 97, 97, 97, 97,
+		97, 131, 97, 97, 131, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 99, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 97, 97, 97, 97, 97, 97, 99, 99, 99, 97, 99, 97, 97, 99, 97,
+		97, 97, 97, 97, 97, 97, 49, 97, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 99, 49, 49, 99, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 131, 131, 131, 131, 131, 99,
+		97, 97, 99, 131, 131, 97, 131, 97, 49, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 97, 97, 131, 131, 3, 3, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 15, 15, 4, 4, 4,
+		4, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+		137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 99,
+		3, 3, 3, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 3, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 3, 3,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		97, 97, 97, 97, 97, 3, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		97, 97, 97, 97, 97, 97, 97, 3, 3, 3, 3, 3, 15, 15, 15, 15,
+		96, 96, 96, 96, 3, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 19, 19, 19, 19, 19,
+		19, 19, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 3, 3, 3, 3, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 97,
+		49, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+		131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+		131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+		131, 131, 131, 131, 131, 131, 131, 131, 99, 99, 99, 99, 99, 99, 99, 97,
+		97, 97, 97, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		96, 96, 3, 96, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		131, 131, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		96, 96, 96, 96, 99, 96, 96, 96, 96, 96, 96, 96, 99, 96, 96, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 15, 97, 97, 3,
+		18, 18, 18, 18, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 131, 131, 97, 97, 97, 15, 15, 15, 131, 131, 131,
+		131, 131, 131, 18, 18, 18, 18, 18, 18, 18, 18, 97, 97, 97, 97, 97,
+		97, 97, 97, 15, 15, 97, 97, 97, 97, 97, 97, 97, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 97, 97, 97, 97, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 97, 97, 97, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28,
+		28, 28, 28, 28, 28, 99, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 113, 99, 113, 113,
+		99, 99, 113, 99, 99, 113, 113, 99, 99, 113, 113, 113, 113, 99, 113, 113,
+		113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 99, 28, 99, 28, 28, 28,
+		28, 28, 28, 28, 99, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 113, 113, 99, 113, 113, 113, 113, 99, 99, 113, 113, 113,
+		113, 113, 113, 113, 113, 99, 113, 113, 113, 113, 113, 113, 113, 99, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 113, 113, 99, 113, 113, 113, 113, 99,
+		113, 113, 113, 113, 113, 99, 113, 99, 99, 99, 113, 113, 113, 113, 113, 113,
+		113, 99, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 99, 99, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 8, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 8, 28, 28, 28, 28,
+		28, 28, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 8, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 8, 28, 28, 28, 28, 28, 28, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 8, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 8,
+		28, 28, 28, 28, 28, 28, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 8,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 8, 28, 28, 28, 28, 28, 28,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 8, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+		28, 28, 28, 8, 28, 28, 28, 28, 28, 28, 113, 28, 99, 99, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 15, 15, 15, 15, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 15, 15, 15,
+		15, 15, 15, 15, 15, 97, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 97, 15, 15, 3, 3, 3, 3, 3, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 97, 97, 97, 97, 97,
+		99, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 49, 28, 28, 28, 28, 28,
+		28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 99, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 99, 99, 97, 97, 97, 97, 97,
+		97, 97, 99, 97, 97, 99, 97, 97, 97, 97, 97, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99,
+		97, 97, 97, 97, 97, 97, 97, 96, 96, 96, 96, 96, 96, 96, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 49, 15,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 97, 97, 97, 97,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 4,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 99, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 99, 99, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		97, 97, 97, 97, 97, 97, 97, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+		217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+		217, 217, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+		218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+		218, 218, 218, 218, 97, 97, 97, 97, 97, 97, 97, 96, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 3, 3,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 19, 19, 19,
+		4, 19, 19, 19, 19, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 99, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 49, 49, 99, 49, 99, 99, 49, 99, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 99, 49, 49, 49, 49, 99, 49, 99, 49, 99, 99, 99, 99,
+		99, 99, 49, 99, 99, 99, 99, 49, 99, 49, 99, 49, 99, 49, 49, 49,
+		99, 49, 49, 99, 49, 99, 99, 49, 99, 49, 99, 49, 99, 49, 99, 49,
+		99, 49, 49, 99, 49, 99, 99, 49, 49, 49, 49, 99, 49, 49, 49, 49,
+		49, 49, 49, 99, 49, 49, 49, 49, 99, 49, 49, 49, 49, 99, 49, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99,
+		99, 49, 49, 49, 99, 49, 49, 49, 49, 49, 99, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		8, 8, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99,
+		99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 15, 15, 15, 15, 15, 15,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 15, 15, 15, 15, 15, 15,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+		219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 12, 12, 12, 12, 12,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99,
+		15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99,
+		15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99,
+		15, 15, 15, 15, 15, 99, 99, 99, 15, 15, 15, 15, 15, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 99, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+		49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 18, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212,
+		212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 99, 99,
+	};
+
+	constexpr const UnicodeProps& unicodePropsOf(char16_t c) noexcept
+	{
+		constexpr unsigned mask = (1u << unicodeBlockShift) - 1;
+		return unicodeProps[unicodePropsStage2[(unsigned(unicodePropsStage1[c >> unicodeBlockShift]) << unicodeBlockShift) | (c & mask)]];
+	}
+
+	//cp must be below 0x110000, case deltas apply to its low 16 bits
+	constexpr const UnicodeProps& unicodePropsOfCodePoint(char32_t cp) noexcept
+	{
+		constexpr unsigned mask = (1u << unicodeBlockShift) - 1;
+		return unicodeProps[unicodePropsStage2[(unsigned(unicodePropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)]];
+	}
+
+	//full mappings of the code units flagged unicodeFlagSpecialCase, sorted. unused units are 0
+	struct SpecialCase
+	{
+		char16_t unit;
+		char16_t upper[3];
+		char16_t lower[3];
+		char16_t fold[3];
+	};
+
+	inline constexpr SpecialCase caseSpecials[298] = {
+		{ 181, { 924, 0, 0 }, { 181, 0, 0 }, { 956, 0, 0 } },
+		{ 223, { 83, 83, 0 }, { 223, 0, 0 }, { 115, 115, 0 } },
+		{ 304, { 304, 0, 0 }, { 105, 775, 0 }, { 105, 775, 0 } },
+		{ 329, { 700, 78, 0 }, { 329, 0, 0 }, { 700, 110, 0 } },
+		{ 383, { 83, 0, 0 }, { 383, 0, 0 }, { 115, 0, 0 } },
+		{ 496, { 74, 780, 0 }, { 496, 0, 0 }, { 106, 780, 0 } },
+		{ 837, { 921, 0, 0 }, { 837, 0, 0 }, { 953, 0, 0 } },
+		{ 912, { 921, 776, 769 }, { 912, 0, 0 }, { 953, 776, 769 } },
+		{ 944, { 933, 776, 769 }, { 944, 0, 0 }, { 965, 776, 769 } },
+		{ 962, { 931, 0, 0 }, { 962, 0, 0 }, { 963, 0, 0 } },
+		{ 976, { 914, 0, 0 }, { 976, 0, 0 }, { 946, 0, 0 } },
+		{ 977, { 920, 0, 0 }, { 977, 0, 0 }, { 952, 0, 0 } },
+		{ 981, { 934, 0, 0 }, { 981, 0, 0 }, { 966, 0, 0 } },
+		{ 982, { 928, 0, 0 }, { 982, 0, 0 }, { 960, 0, 0 } },
+		{ 1008, { 922, 0, 0 }, { 1008, 0, 0 }, { 954, 0, 0 } },
+		{ 1009, { 929, 0, 0 }, { 1009, 0, 0 }, { 961, 0, 0 } },
+		{ 1013, { 917, 0, 0 }, { 1013, 0, 0 }, { 949, 0, 0 } },
+		{ 1415, { 1333, 1362, 0 }, { 1415, 0, 0 }, { 1381, 1410, 0 } },
+		{ 5024, { 5024, 0, 0 }, { 43888, 0, 0 }, { 5024, 0, 0 } },
+		{ 5025, { 5025, 0, 0 }, { 43889, 0, 0 }, { 5025, 0, 0 } },
+		{ 5026, { 5026, 0, 0 }, { 43890, 0, 0 }, { 5026, 0, 0 } },
+		{ 5027, { 5027, 0, 0 }, { 43891, 0, 0 }, { 5027, 0, 0 } },
+		{ 5028, { 5028, 0, 0 }, { 43892, 0, 0 }, { 5028, 0, 0 } },
+		{ 5029, { 5029, 0, 0 }, { 43893, 0, 0 }, { 5029, 0, 0 } },
+		{ 5030, { 5030, 0, 0 }, { 43894, 0, 0 }, { 5030, 0, 0 } },
+		{ 5031, { 5031, 0, 0 }, { 43895, 0, 0 }, { 5031, 0, 0 } },
+		{ 5032, { 5032, 0, 0 }, { 43896, 0, 0 }, { 5032, 0, 0 } },
+		{ 5033, { 5033, 0, 0 }, { 43897, 0, 0 }, { 5033, 0, 0 } },
+		{ 5034, { 5034, 0, 0 }, { 43898, 0, 0 }, { 5034, 0, 0 } },
+		{ 5035, { 5035, 0, 0 }, { 43899, 0, 0 }, { 5035, 0, 0 } },
+		{ 5036, { 5036, 0, 0 }, { 43900, 0, 0 }, { 5036, 0, 0 } },
+		{ 5037, { 5037, 0, 0 }, { 43901, 0, 0 }, { 5037, 0, 0 } },
+		{ 5038, { 5038, 0, 0 }, { 43902, 0, 0 }, { 5038, 0, 0 } },
+		{ 5039, { 5039, 0, 0 }, { 43903, 0, 0 }, { 5039, 0, 0 } },
+		{ 5040, { 5040, 0, 0 }, { 43904, 0, 0 }, { 5040, 0, 0 } },
+		{ 5041, { 5041, 0, 0 }, { 43905, 0, 0 }, { 5041, 0, 0 } },
+		{ 5042, { 5042, 0, 0 }, { 43906, 0, 0 }, { 5042, 0, 0 } },
+		{ 5043, { 5043, 0, 0 }, { 43907, 0, 0 }, { 5043, 0, 0 } },
+		{ 5044, { 5044, 0, 0 }, { 43908, 0, 0 }, { 5044, 0, 0 } },
+		{ 5045, { 5045, 0, 0 }, { 43909, 0, 0 }, { 5045, 0, 0 } },
+		{ 5046, { 5046, 0, 0 }, { 43910, 0, 0 }, { 5046, 0, 0 } },
+		{ 5047, { 5047, 0, 0 }, { 43911, 0, 0 }, { 5047, 0, 0 } },
+		{ 5048, { 5048, 0, 0 }, { 43912, 0, 0 }, { 5048, 0, 0 } },
+		{ 5049, { 5049, 0, 0 }, { 43913, 0, 0 }, { 5049, 0, 0 } },
+		{ 5050, { 5050, 0, 0 }, { 43914, 0, 0 }, { 5050, 0, 0 } },
+		{ 5051, { 5051, 0, 0 }, { 43915, 0, 0 }, { 5051, 0, 0 } },
+		{ 5052, { 5052, 0, 0 }, { 43916, 0, 0 }, { 5052, 0, 0 } },
+		{ 5053, { 5053, 0, 0 }, { 43917, 0, 0 }, { 5053, 0, 0 } },
+		{ 5054, { 5054, 0, 0 }, { 43918, 0, 0 }, { 5054, 0, 0 } },
+		{ 5055, { 5055, 0, 0 }, { 43919, 0, 0 }, { 5055, 0, 0 } },
+		{ 5056, { 5056, 0, 0 }, { 43920, 0, 0 }, { 5056, 0, 0 } },
+		{ 5057, { 5057, 0, 0 }, { 43921, 0, 0 }, { 5057, 0, 0 } },
+		{ 5058, { 5058, 0, 0 }, { 43922, 0, 0 }, { 5058, 0, 0 } },
+		{ 5059, { 5059, 0, 0 }, { 43923, 0, 0 }, { 5059, 0, 0 } },
+		{ 5060, { 5060, 0, 0 }, { 43924, 0, 0 }, { 5060, 0, 0 } },
+		{ 5061, { 5061, 0, 0 }, { 43925, 0, 0 }, { 5061, 0, 0 } },
+		{ 5062, { 5062, 0, 0 }, { 43926, 0, 0 }, { 5062, 0, 0 } },
+		{ 5063, { 5063, 0, 0 }, { 43927, 0, 0 }, { 5063, 0, 0 } },
+		{ 5064, { 5064, 0, 0 }, { 43928, 0, 0 }, { 5064, 0, 0 } },
+		{ 5065, { 5065, 0, 0 }, { 43929, 0, 0 }, { 5065, 0, 0 } },
+		{ 5066, { 5066, 0, 0 }, { 43930, 0, 0 }, { 5066, 0, 0 } },
+		{ 5067, { 5067, 0, 0 }, { 43931, 0, 0 }, { 5067, 0, 0 } },
+		{ 5068, { 5068, 0, 0 }, { 43932, 0, 0 }, { 5068, 0, 0 } },
+		{ 5069, { 5069, 0, 0 }, { 43933, 0, 0 }, { 5069, 0, 0 } },
+		{ 5070, { 5070, 0, 0 }, { 43934, 0, 0 }, { 5070, 0, 0 } },
+		{ 5071, { 5071, 0, 0 }, { 43935, 0, 0 }, { 5071, 0, 0 } },
+		{ 5072, { 5072, 0, 0 }, { 43936, 0, 0 }, { 5072, 0, 0 } },
+		{ 5073, { 5073, 0, 0 }, { 43937, 0, 0 }, { 5073, 0, 0 } },
+		{ 5074, { 5074, 0, 0 }, { 43938, 0, 0 }, { 5074, 0, 0 } },
+		{ 5075, { 5075, 0, 0 }, { 43939, 0, 0 }, { 5075, 0, 0 } },
+		{ 5076, { 5076, 0, 0 }, { 43940, 0, 0 }, { 5076, 0, 0 } },
+		{ 5077, { 5077, 0, 0 }, { 43941, 0, 0 }, { 5077, 0, 0 } },
+		{ 5078, { 5078, 0, 0 }, { 43942, 0, 0 }, { 5078, 0, 0 } },
+		{ 5079, { 5079, 0, 0 }, { 43943, 0, 0 }, { 5079, 0, 0 } },
+		{ 5080, { 5080, 0, 0 }, { 43944, 0, 0 }, { 5080, 0, 0 } },
+		{ 5081, { 5081, 0, 0 }, { 43945, 0, 0 }, { 5081, 0, 0 } },
+		{ 5082, { 5082, 0, 0 }, { 43946, 0, 0 }, { 5082, 0, 0 } },
+		{ 5083, { 5083, 0, 0 }, { 43947, 0, 0 }, { 5083, 0, 0 } },
+		{ 5084, { 5084, 0, 0 }, { 43948, 0, 0 }, { 5084, 0, 0 } },
+		{ 5085, { 5085, 0, 0 }, { 43949, 0, 0 }, { 5085, 0, 0 } },
+		{ 5086, { 5086, 0, 0 }, { 43950, 0, 0 }, { 5086, 0, 0 } },
+		{ 5087, { 5087, 0, 0 }, { 43951, 0, 0 }, { 5087, 0, 0 } },
+		{ 5088, { 5088, 0, 0 }, { 43952, 0, 0 }, { 5088, 0, 0 } },
+		{ 5089, { 5089, 0, 0 }, { 43953, 0, 0 }, { 5089, 0, 0 } },
+		{ 5090, { 5090, 0, 0 }, { 43954, 0, 0 }, { 5090, 0, 0 } },
+		{ 5091, { 5091, 0, 0 }, { 43955, 0, 0 }, { 5091, 0, 0 } },
+		{ 5092, { 5092, 0, 0 }, { 43956, 0, 0 }, { 5092, 0, 0 } },
+		{ 5093, { 5093, 0, 0 }, { 43957, 0, 0 }, { 5093, 0, 0 } },
+		{ 5094, { 5094, 0, 0 }, { 43958, 0, 0 }, { 5094, 0, 0 } },
+		{ 5095, { 5095, 0, 0 }, { 43959, 0, 0 }, { 5095, 0, 0 } },
+		{ 5096, { 5096, 0, 0 }, { 43960, 0, 0 }, { 5096, 0, 0 } },
+		{ 5097, { 5097, 0, 0 }, { 43961, 0, 0 }, { 5097, 0, 0 } },
+		{ 5098, { 5098, 0, 0 }, { 43962, 0, 0 }, { 5098, 0, 0 } },
+		{ 5099, { 5099, 0, 0 }, { 43963, 0, 0 }, { 5099, 0, 0 } },
+		{ 5100, { 5100, 0, 0 }, { 43964, 0, 0 }, { 5100, 0, 0 } },
+		{ 5101, { 5101, 0, 0 }, { 43965, 0, 0 }, { 5101, 0, 0 } },
+		{ 5102, { 5102, 0, 0 }, { 43966, 0, 0 }, { 5102, 0, 0 } },
+		{ 5103, { 5103, 0, 0 }, { 43967, 0, 0 }, { 5103, 0, 0 } },
+		{ 5104, { 5104, 0, 0 }, { 5112, 0, 0 }, { 5104, 0, 0 } },
+		{ 5105, { 5105, 0, 0 }, { 5113, 0, 0 }, { 5105, 0, 0 } },
+		{ 5106, { 5106, 0, 0 }, { 5114, 0, 0 }, { 5106, 0, 0 } },
+		{ 5107, { 5107, 0, 0 }, { 5115, 0, 0 }, { 5107, 0, 0 } },
+		{ 5108, { 5108, 0, 0 }, { 5116, 0, 0 }, { 5108, 0, 0 } },
+		{ 5109, { 5109, 0, 0 }, { 5117, 0, 0 }, { 5109, 0, 0 } },
+		{ 5112, { 5104, 0, 0 }, { 5112, 0, 0 }, { 5104, 0, 0 } },
+		{ 5113, { 5105, 0, 0 }, { 5113, 0, 0 }, { 5105, 0, 0 } },
+		{ 5114, { 5106, 0, 0 }, { 5114, 0, 0 }, { 5106, 0, 0 } },
+		{ 5115, { 5107, 0, 0 }, { 5115, 0, 0 }, { 5107, 0, 0 } },
+		{ 5116, { 5108, 0, 0 }, { 5116, 0, 0 }, { 5108, 0, 0 } },
+		{ 5117, { 5109, 0, 0 }, { 5117, 0, 0 }, { 5109, 0, 0 } },
+		{ 7296, { 1042, 0, 0 }, { 7296, 0, 0 }, { 1074, 0, 0 } },
+		{ 7297, { 1044, 0, 0 }, { 7297, 0, 0 }, { 1076, 0, 0 } },
+		{ 7298, { 1054, 0, 0 }, { 7298, 0, 0 }, { 1086, 0, 0 } },
+		{ 7299, { 1057, 0, 0 }, { 7299, 0, 0 }, { 1089, 0, 0 } },
+		{ 7300, { 1058, 0, 0 }, { 7300, 0, 0 }, { 1090, 0, 0 } },
+		{ 7301, { 1058, 0, 0 }, { 7301, 0, 0 }, { 1090, 0, 0 } },
+		{ 7302, { 1066, 0, 0 }, { 7302, 0, 0 }, { 1098, 0, 0 } },
+		{ 7303, { 1122, 0, 0 }, { 7303, 0, 0 }, { 1123, 0, 0 } },
+		{ 7304, { 42570, 0, 0 }, { 7304, 0, 0 }, { 42571, 0, 0 } },
+		{ 7830, { 72, 817, 0 }, { 7830, 0, 0 }, { 104, 817, 0 } },
+		{ 7831, { 84, 776, 0 }, { 7831, 0, 0 }, { 116, 776, 0 } },
+		{ 7832, { 87, 778, 0 }, { 7832, 0, 0 }, { 119, 778, 0 } },
+		{ 7833, { 89, 778, 0 }, { 7833, 0, 0 }, { 121, 778, 0 } },
+		{ 7834, { 65, 702, 0 }, { 7834, 0, 0 }, { 97, 702, 0 } },
+		{ 7835, { 7776, 0, 0 }, { 7835, 0, 0 }, { 7777, 0, 0 } },
+		{ 7838, { 7838, 0, 0 }, { 223, 0, 0 }, { 115, 115, 0 } },
+		{ 8016, { 933, 787, 0 }, { 8016, 0, 0 }, { 965, 787, 0 } },
+		{ 8018, { 933, 787, 768 }, { 8018, 0, 0 }, { 965, 787, 768 } },
+		{ 8020, { 933, 787, 769 }, { 8020, 0, 0 }, { 965, 787, 769 } },
+		{ 8022, { 933, 787, 834 }, { 8022, 0, 0 }, { 965, 787, 834 } },
+		{ 8064, { 7944, 921, 0 }, { 8064, 0, 0 }, { 7936, 953, 0 } },
+		{ 8065, { 7945, 921, 0 }, { 8065, 0, 0 }, { 7937, 953, 0 } },
+		{ 8066, { 7946, 921, 0 }, { 8066, 0, 0 }, { 7938, 953, 0 } },
+		{ 8067, { 7947, 921, 0 }, { 8067, 0, 0 }, { 7939, 953, 0 } },
+		{ 8068, { 7948, 921, 0 }, { 8068, 0, 0 }, { 7940, 953, 0 } },
+		{ 8069, { 7949, 921, 0 }, { 8069, 0, 0 }, { 7941, 953, 0 } },
+		{ 8070, { 7950, 921, 0 }, { 8070, 0, 0 }, { 7942, 953, 0 } },
+		{ 8071, { 7951, 921, 0 }, { 8071, 0, 0 }, { 7943, 953, 0 } },
+		{ 8072, { 7944, 921, 0 }, { 8064, 0, 0 }, { 7936, 953, 0 } },
+		{ 8073, { 7945, 921, 0 }, { 8065, 0, 0 }, { 7937, 953, 0 } },
+		{ 8074, { 7946, 921, 0 }, { 8066, 0, 0 }, { 7938, 953, 0 } },
+		{ 8075, { 7947, 921, 0 }, { 8067, 0, 0 }, { 7939, 953, 0 } },
+		{ 8076, { 7948, 921, 0 }, { 8068, 0, 0 }, { 7940, 953, 0 } },
+		{ 8077, { 7949, 921, 0 }, { 8069, 0, 0 }, { 7941, 953, 0 } },
+		{ 8078, { 7950, 921, 0 }, { 8070, 0, 0 }, { 7942, 953, 0 } },
+		{ 8079, { 7951, 921, 0 }, { 8071, 0, 0 }, { 7943, 953, 0 } },
+		{ 8080, { 7976, 921, 0 }, { 8080, 0, 0 }, { 7968, 953, 0 } },
+		{ 8081, { 7977, 921, 0 }, { 8081, 0, 0 }, { 7969, 953, 0 } },
+		{ 8082, { 7978, 921, 0 }, { 8082, 0, 0 }, { 7970, 953, 0 } },
+		{ 8083, { 7979, 921, 0 }, { 8083, 0, 0 }, { 7971, 953, 0 } },
+		{ 8084, { 7980, 921, 0 }, { 8084, 0, 0 }, { 7972, 953, 0 } },
+		{ 8085, { 7981, 921, 0 }, { 8085, 0, 0 }, { 7973, 953, 0 } },
+		{ 8086, { 7982, 921, 0 }, { 8086, 0, 0 }, { 7974, 953, 0 } },
+		{ 8087, { 7983, 921, 0 }, { 8087, 0, 0 }, { 7975, 953, 0 } },
+		{ 8088, { 7976, 921, 0 }, { 8080, 0, 0 }, { 7968, 953, 0 } },
+		{ 8089, { 7977, 921, 0 }, { 8081, 0, 0 }, { 7969, 953, 0 } },
+		{ 8090, { 7978, 921, 0 }, { 8082, 0, 0 }, { 7970, 953, 0 } },
+		{ 8091, { 7979, 921, 0 }, { 8083, 0, 0 }, { 7971, 953, 0 } },
+		{ 8092, { 7980, 921, 0 }, { 8084, 0, 0 }, { 7972, 953, 0 } },
+		{ 8093, { 7981, 921, 0 }, { 8085, 0, 0 }, { 7973, 953, 0 } },
+		{ 8094, { 7982, 921, 0 }, { 8086, 0, 0 }, { 7974, 953, 0 } },
+		{ 8095, { 7983, 921, 0 }, { 8087, 0, 0 }, { 7975, 953, 0 } },
+		{ 8096, { 8040, 921, 0 }, { 8096, 0, 0 }, { 8032, 953, 0 } },
+		{ 8097, { 8041, 921, 0 }, { 8097, 0, 0 }, { 8033, 953, 0 } },
+		{ 8098, { 8042, 921, 0 }, { 8098, 0, 0 }, { 8034, 953, 0 } },
+		{ 8099, { 8043, 921, 0 }, { 8099, 0, 0 }, { 8035, 953, 0 } },
+		{ 8100, { 8044, 921, 0 }, { 8100, 0, 0 }, { 8036, 953, 0 } },
+		{ 8101, { 8045, 921, 0 }, { 8101, 0, 0 }, { 8037, 953, 0 } },
+		{ 8102, { 8046, 921, 0 }, { 8102, 0, 0 }, { 8038, 953, 0 } },
+		{ 8103, { 8047, 921, 0 }, { 8103, 0, 0 }, { 8039, 953, 0 } },
+		{ 8104, { 8040, 921, 0 }, { 8096, 0, 0 }, { 8032, 953, 0 } },
+		{ 8105, { 8041, 921, 0 }, { 8097, 0, 0 }, { 8033, 953, 0 } },
+		{ 8106, { 8042, 921, 0 }, { 8098, 0, 0 }, { 8034, 953, 0 } },
+		{ 8107, { 8043, 921, 0 }, { 8099, 0, 0 }, { 8035, 953, 0 } },
+		{ 8108, { 8044, 921, 0 }, { 8100, 0, 0 }, { 8036, 953, 0 } },
+		{ 8109, { 8045, 921, 0 }, { 8101, 0, 0 }, { 8037, 953, 0 } },
+		{ 8110, { 8046, 921, 0 }, { 8102, 0, 0 }, { 8038, 953, 0 } },
+		{ 8111, { 8047, 921, 0 }, { 8103, 0, 0 }, { 8039, 953, 0 } },
+		{ 8114, { 8122, 921, 0 }, { 8114, 0, 0 }, { 8048, 953, 0 } },
+		{ 8115, { 913, 921, 0 }, { 8115, 0, 0 }, { 945, 953, 0 } },
+		{ 8116, { 902, 921, 0 }, { 8116, 0, 0 }, { 940, 953, 0 } },
+		{ 8118, { 913, 834, 0 }, { 8118, 0, 0 }, { 945, 834, 0 } },
+		{ 8119, { 913, 834, 921 }, { 8119, 0, 0 }, { 945, 834, 953 } },
+		{ 8124, { 913, 921, 0 }, { 8115, 0, 0 }, { 945, 953, 0 } },
+		{ 8126, { 921, 0, 0 }, { 8126, 0, 0 }, { 953, 0, 0 } },
+		{ 8130, { 8138, 921, 0 }, { 8130, 0, 0 }, { 8052, 953, 0 } },
+		{ 8131, { 919, 921, 0 }, { 8131, 0, 0 }, { 951, 953, 0 } },
+		{ 8132, { 905, 921, 0 }, { 8132, 0, 0 }, { 942, 953, 0 } },
+		{ 8134, { 919, 834, 0 }, { 8134, 0, 0 }, { 951, 834, 0 } },
+		{ 8135, { 919, 834, 921 }, { 8135, 0, 0 }, { 951, 834, 953 } },
+		{ 8140, { 919, 921, 0 }, { 8131, 0, 0 }, { 951, 953, 0 } },
+		{ 8146, { 921, 776, 768 }, { 8146, 0, 0 }, { 953, 776, 768 } },
+		{ 8147, { 921, 776, 769 }, { 8147, 0, 0 }, { 953, 776, 769 } },
+		{ 8150, { 921, 834, 0 }, { 8150, 0, 0 }, { 953, 834, 0 } },
+		{ 8151, { 921, 776, 834 }, { 8151, 0, 0 }, { 953, 776, 834 } },
+		{ 8162, { 933, 776, 768 }, { 8162, 0, 0 }, { 965, 776, 768 } },
+		{ 8163, { 933, 776, 769 }, { 8163, 0, 0 }, { 965, 776, 769 } },
+		{ 8164, { 929, 787, 0 }, { 8164, 0, 0 }, { 961, 787, 0 } },
+		{ 8166, { 933, 834, 0 }, { 8166, 0, 0 }, { 965, 834, 0 } },
+		{ 8167, { 933, 776, 834 }, { 8167, 0, 0 }, { 965, 776, 834 } },
+		{ 8178, { 8186, 921, 0 }, { 8178, 0, 0 }, { 8060, 953, 0 } },
+		{ 8179, { 937, 921, 0 }, { 8179, 0, 0 }, { 969, 953, 0 } },
+		{ 8180, { 911, 921, 0 }, { 8180, 0, 0 }, { 974, 953, 0 } },
+		{ 8182, { 937, 834, 0 }, { 8182, 0, 0 }, { 969, 834, 0 } },
+		{ 8183, { 937, 834, 921 }, { 8183, 0, 0 }, { 969, 834, 953 } },
+		{ 8188, { 937, 921, 0 }, { 8179, 0, 0 }, { 969, 953, 0 } },
+		{ 43888, { 5024, 0, 0 }, { 43888, 0, 0 }, { 5024, 0, 0 } },
+		{ 43889, { 5025, 0, 0 }, { 43889, 0, 0 }, { 5025, 0, 0 } },
+		{ 43890, { 5026, 0, 0 }, { 43890, 0, 0 }, { 5026, 0, 0 } },
+		{ 43891, { 5027, 0, 0 }, { 43891, 0, 0 }, { 5027, 0, 0 } },
+		{ 43892, { 5028, 0, 0 }, { 43892, 0, 0 }, { 5028, 0, 0 } },
+		{ 43893, { 5029, 0, 0 }, { 43893, 0, 0 }, { 5029, 0, 0 } },
+		{ 43894, { 5030, 0, 0 }, { 43894, 0, 0 }, { 5030, 0, 0 } },
+		{ 43895, { 5031, 0, 0 }, { 43895, 0, 0 }, { 5031, 0, 0 } },
+		{ 43896, { 5032, 0, 0 }, { 43896, 0, 0 }, { 5032, 0, 0 } },
+		{ 43897, { 5033, 0, 0 }, { 43897, 0, 0 }, { 5033, 0, 0 } },
+		{ 43898, { 5034, 0, 0 }, { 43898, 0, 0 }, { 5034, 0, 0 } },
+		{ 43899, { 5035, 0, 0 }, { 43899, 0, 0 }, { 5035, 0, 0 } },
+		{ 43900, { 5036, 0, 0 }, { 43900, 0, 0 }, { 5036, 0, 0 } },
+		{ 43901, { 5037, 0, 0 }, { 43901, 0, 0 }, { 5037, 0, 0 } },
+		{ 43902, { 5038, 0, 0 }, { 43902, 0, 0 }, { 5038, 0, 0 } },
+		{ 43903, { 5039, 0, 0 }, { 43903, 0, 0 }, { 5039, 0, 0 } },
+		{ 43904, { 5040, 0, 0 }, { 43904, 0, 0 }, { 5040, 0, 0 } },
+		{ 43905, { 5041, 0, 0 }, { 43905, 0, 0 }, { 5041, 0, 0 } },
+		{ 43906, { 5042, 0, 0 }, { 43906, 0, 0 }, { 5042, 0, 0 } },
+		{ 43907, { 5043, 0, 0 }, { 43907, 0, 0 }, { 5043, 0, 0 } },
+		{ 43908, { 5044, 0, 0 }, { 43908, 0, 0 }, { 5044, 0, 0 } },
+		{ 43909, { 5045, 0, 0 }, { 43909, 0, 0 }, { 5045, 0, 0 } },
+		{ 43910, { 5046, 0, 0 }, { 43910, 0, 0 }, { 5046, 0, 0 } },
+		{ 43911, { 5047, 0, 0 }, { 43911, 0, 0 }, { 5047, 0, 0 } },
+		{ 43912, { 5048, 0, 0 }, { 43912, 0, 0 }, { 5048, 0, 0 } },
+		{ 43913, { 5049, 0, 0 }, { 43913, 0, 0 }, { 5049, 0, 0 } },
+		{ 43914, { 5050, 0, 0 }, { 43914, 0, 0 }, { 5050, 0, 0 } },
+		{ 43915, { 5051, 0, 0 }, { 43915, 0, 0 }, { 5051, 0, 0 } },
+		{ 43916, { 5052, 0, 0 }, { 43916, 0, 0 }, { 5052, 0, 0 } },
+		{ 43917, { 5053, 0, 0 }, { 43917, 0, 0 }, { 5053, 0, 0 } },
+		{ 43918, { 5054, 0, 0 }, { 43918, 0, 0 }, { 5054, 0, 0 } },
+		{ 43919, { 5055, 0, 0 }, { 43919, 0, 0 }, { 5055, 0, 0 } },
+		{ 43920, { 5056, 0, 0 }, { 43920, 0, 0 }, { 5056, 0, 0 } },
+		{ 43921, { 5057, 0, 0 }, { 43921, 0, 0 }, { 5057, 0, 0 } },
+		{ 43922, { 5058, 0, 0 }, { 43922, 0, 0 }, { 5058, 0, 0 } },
+		{ 43923, { 5059, 0, 0 }, { 43923, 0, 0 }, { 5059, 0, 0 } },
+		{ 43924, { 5060, 0, 0 }, { 43924, 0, 0 }, { 5060, 0, 0 } },
+		{ 43925, { 5061, 0, 0 }, { 43925, 0, 0 }, { 5061, 0, 0 } },
+		{ 43926, { 5062, 0, 0 }, { 43926, 0, 0 }, { 5062, 0, 0 } },
+		{ 43927, { 5063, 0, 0 }, { 43927, 0, 0 }, { 5063, 0, 0 } },
+		{ 43928, { 5064, 0, 0 }, { 43928, 0, 0 }, { 5064, 0, 0 } },
+		{ 43929, { 5065, 0, 0 }, { 43929, 0, 0 }, { 5065, 0, 0 } },
+		{ 43930, { 5066, 0, 0 }, { 43930, 0, 0 }, { 5066, 0, 0 } },
+		{ 43931, { 5067, 0, 0 }, { 43931, 0, 0 }, { 5067, 0, 0 } },
+		{ 43932, { 5068, 0, 0 }, { 43932, 0, 0 }, { 5068, 0, 0 } },
+		{ 43933, { 5069, 0, 0 }, { 43933, 0, 0 }, { 5069, 0, 0 } },
+		{ 43934, { 5070, 0, 0 }, { 43934, 0, 0 }, { 5070, 0, 0 } },
+		{ 43935, { 5071, 0, 0 }, { 43935, 0, 0 }, { 5071, 0, 0 } },
+		{ 43936, { 5072, 0, 0 }, { 43936, 0, 0 }, { 5072, 0, 0 } },
+		{ 43937, { 5073, 0, 0 }, { 43937, 0, 0 }, { 5073, 0, 0 } },
+		{ 43938, { 5074, 0, 0 }, { 43938, 0, 0 }, { 5074, 0, 0 } },
+		{ 43939, { 5075, 0, 0 }, { 43939, 0, 0 }, { 5075, 0, 0 } },
+		{ 43940, { 5076, 0, 0 }, { 43940, 0, 0 }, { 5076, 0, 0 } },
+		{ 43941, { 5077, 0, 0 }, { 43941, 0, 0 }, { 5077, 0, 0 } },
+		{ 43942, { 5078, 0, 0 }, { 43942, 0, 0 }, { 5078, 0, 0 } },
+		{ 43943, { 5079, 0, 0 }, { 43943, 0, 0 }, { 5079, 0, 0 } },
+		{ 43944, { 5080, 0, 0 }, { 43944, 0, 0 }, { 5080, 0, 0 } },
+		{ 43945, { 5081, 0, 0 }, { 43945, 0, 0 }, { 5081, 0, 0 } },
+		{ 43946, { 5082, 0, 0 }, { 43946, 0, 0 }, { 5082, 0, 0 } },
+		{ 43947, { 5083, 0, 0 }, { 43947, 0, 0 }, { 5083, 0, 0 } },
+		{ 43948, { 5084, 0, 0 }, { 43948, 0, 0 }, { 5084, 0, 0 } },
+		{ 43949, { 5085, 0, 0 }, { 43949, 0, 0 }, { 5085, 0, 0 } },
+		{ 43950, { 5086, 0, 0 }, { 43950, 0, 0 }, { 5086, 0, 0 } },
+		{ 43951, { 5087, 0, 0 }, { 43951, 0, 0 }, { 5087, 0, 0 } },
+		{ 43952, { 5088, 0, 0 }, { 43952, 0, 0 }, { 5088, 0, 0 } },
+		{ 43953, { 5089, 0, 0 }, { 43953, 0, 0 }, { 5089, 0, 0 } },
+		{ 43954, { 5090, 0, 0 }, { 43954, 0, 0 }, { 5090, 0, 0 } },
+		{ 43955, { 5091, 0, 0 }, { 43955, 0, 0 }, { 5091, 0, 0 } },
+		{ 43956, { 5092, 0, 0 }, { 43956, 0, 0 }, { 5092, 0, 0 } },
+		{ 43957, { 5093, 0, 0 }, { 43957, 0, 0 }, { 5093, 0, 0 } },
+		{ 43958, { 5094, 0, 0 }, { 43958, 0, 0 }, { 5094, 0, 0 } },
+		{ 43959, { 5095, 0, 0 }, { 43959, 0, 0 }, { 5095, 0, 0 } },
+		{ 43960, { 5096, 0, 0 }, { 43960, 0, 0 }, { 5096, 0, 0 } },
+		{ 43961, { 5097, 0, 0 }, { 43961, 0, 0 }, { 5097, 0, 0 } },
+		{ 43962, { 5098, 0, 0 }, { 43962, 0, 0 }, { 5098, 0, 0 } },
+		{ 43963, { 5099, 0, 0 }, { 43963, 0, 0 }, { 5099, 0, 0 } },
+		{ 43964, { 5100, 0, 0 }, { 43964, 0, 0 }, { 5100, 0, 0 } },
+		{ 43965, { 5101, 0, 0 }, { 43965, 0, 0 }, { 5101, 0, 0 } },
+		{ 43966, { 5102, 0, 0 }, { 43966, 0, 0 }, { 5102, 0, 0 } },
+		{ 43967, { 5103, 0, 0 }, { 43967, 0, 0 }, { 5103, 0, 0 } },
+		{ 64256, { 70, 70, 0 }, { 64256, 0, 0 }, { 102, 102, 0 } },
+		{ 64257, { 70, 73, 0 }, { 64257, 0, 0 }, { 102, 105, 0 } },
+		{ 64258, { 70, 76, 0 }, { 64258, 0, 0 }, { 102, 108, 0 } },
+		{ 64259, { 70, 70, 73 }, { 64259, 0, 0 }, { 102, 102, 105 } },
+		{ 64260, { 70, 70, 76 }, { 64260, 0, 0 }, { 102, 102, 108 } },
+		{ 64261, { 83, 84, 0 }, { 64261, 0, 0 }, { 115, 116, 0 } },
+		{ 64262, { 83, 84, 0 }, { 64262, 0, 0 }, { 115, 116, 0 } },
+		{ 64275, { 1348, 1350, 0 }, { 64275, 0, 0 }, { 1396, 1398, 0 } },
+		{ 64276, { 1348, 1333, 0 }, { 64276, 0, 0 }, { 1396, 1381, 0 } },
+		{ 64277, { 1348, 1339, 0 }, { 64277, 0, 0 }, { 1396, 1387, 0 } },
+		{ 64278, { 1358, 1350, 0 }, { 64278, 0, 0 }, { 1406, 1398, 0 } },
+		{ 64279, { 1348, 1341, 0 }, { 64279, 0, 0 }, { 1396, 1389, 0 } },
+	};
+
+	//folded values having more than one code unit lowering to them, sorted
+	inline constexpr char16_t caseClassKeys[1164] = {
+		97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+		113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 223, 224, 225, 226, 227, 228,
+		229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+		245, 246, 248, 249, 250, 251, 252, 253, 254, 255, 257, 259, 261, 263, 265, 267,
+		269, 271, 273, 275, 277, 279, 281, 283, 285, 287, 289, 291, 293, 295, 297, 299,
+		301, 303, 307, 309, 311, 314, 316, 318, 320, 322, 324, 326, 328, 331, 333, 335,
+		337, 339, 341, 343, 345, 347, 349, 351, 353, 355, 357, 359, 361, 363, 365, 367,
+		369, 371, 373, 375, 378, 380, 382, 384, 387, 389, 392, 396, 402, 405, 409, 410,
+		414, 417, 419, 421, 424, 429, 432, 436, 438, 441, 445, 447, 454, 457, 460, 462,
+		464, 466, 468, 470, 472, 474, 476, 477, 479, 481, 483, 485, 487, 489, 491, 493,
+		495, 499, 501, 505, 507, 509, 511, 513, 515, 517, 519, 521, 523, 525, 527, 529,
+		531, 533, 535, 537, 539, 541, 543, 547, 549, 551, 553, 555, 557, 559, 561, 563,
+		572, 575, 576, 578, 583, 585, 587, 589, 591, 592, 593, 594, 595, 596, 598, 599,
+		601, 603, 604, 608, 609, 611, 613, 614, 616, 617, 618, 619, 620, 623, 625, 626,
+		629, 637, 640, 642, 643, 647, 648, 649, 650, 651, 652, 658, 669, 670, 881, 883,
+		887, 891, 892, 893, 940, 941, 942, 943, 945, 946, 947, 948, 949, 950, 951, 952,
+		953, 954, 955, 956, 957, 958, 959, 960, 961, 963, 964, 965, 966, 967, 968, 969,
+		970, 971, 972, 973, 974, 983, 985, 987, 989, 991, 993, 995, 997, 999, 1001, 1003,
+		1005, 1007, 1010, 1011, 1016, 1019, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
+		1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+		1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+		1114, 1115, 1116, 1117, 1118, 1119, 1121, 1123, 1125, 1127, 1129, 1131, 1133, 1135, 1137, 1139,
+		1141, 1143, 1145, 1147, 1149, 1151, 1153, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179,
+		1181, 1183, 1185, 1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207, 1209, 1211,
+		1213, 1215, 1218, 1220, 1222, 1224, 1226, 1228, 1230, 1231, 1233, 1235, 1237, 1239, 1241, 1243,
+		1245, 1247, 1249, 1251, 1253, 1255, 1257, 1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273, 1275,
+		1277, 1279, 1281, 1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303, 1305, 1307,
+		1309, 1311, 1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327, 1377, 1378, 1379, 1380, 1381, 1382,
+		1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398,
+		1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+		4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319,
+		4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335,
+		4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4349, 4350, 4351, 5112, 5113,
+		5114, 5115, 5116, 5117, 7545, 7549, 7566, 7681, 7683, 7685, 7687, 7689, 7691, 7693, 7695, 7697,
+		7699, 7701, 7703, 7705, 7707, 7709, 7711, 7713, 7715, 7717, 7719, 7721, 7723, 7725, 7727, 7729,
+		7731, 7733, 7735, 7737, 7739, 7741, 7743, 7745, 7747, 7749, 7751, 7753, 7755, 7757, 7759, 7761,
+		7763, 7765, 7767, 7769, 7771, 7773, 7775, 7777, 7779, 7781, 7783, 7785, 7787, 7789, 7791, 7793,
+		7795, 7797, 7799, 7801, 7803, 7805, 7807, 7809, 7811, 7813, 7815, 7817, 7819, 7821, 7823, 7825,
+		7827, 7829, 7841, 7843, 7845, 7847, 7849, 7851, 7853, 7855, 7857, 7859, 7861, 7863, 7865, 7867,
+		7869, 7871, 7873, 7875, 7877, 7879, 7881, 7883, 7885, 7887, 7889, 7891, 7893, 7895, 7897, 7899,
+		7901, 7903, 7905, 7907, 7909, 7911, 7913, 7915, 7917, 7919, 7921, 7923, 7925, 7927, 7929, 7931,
+		7933, 7935, 7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 7952, 7953, 7954, 7955, 7956, 7957,
+		7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7984, 7985, 7986, 7987, 7988, 7989, 7990, 7991,
+		8000, 8001, 8002, 8003, 8004, 8005, 8017, 8019, 8021, 8023, 8032, 8033, 8034, 8035, 8036, 8037,
+		8038, 8039, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8055, 8056, 8057, 8058, 8059, 8060, 8061,
+		8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8080, 8081, 8082, 8083, 8084, 8085, 8086, 8087,
+		8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8112, 8113, 8115, 8131, 8144, 8145, 8160, 8161,
+		8165, 8179, 8526, 8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567, 8568, 8569, 8570, 8571, 8572,
+		8573, 8574, 8575, 8580, 9424, 9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432, 9433, 9434, 9435,
+		9436, 9437, 9438, 9439, 9440, 9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 11312, 11313,
+		11314, 11315, 11316, 11317, 11318, 11319, 11320, 11321, 11322, 11323, 11324, 11325, 11326, 11327, 11328, 11329,
+		11330, 11331, 11332, 11333, 11334, 11335, 11336, 11337, 11338, 11339, 11340, 11341, 11342, 11343, 11344, 11345,
+		11346, 11347, 11348, 11349, 11350, 11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358, 11359, 11361, 11365,
+		11366, 11368, 11370, 11372, 11379, 11382, 11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407, 11409, 11411,
+		11413, 11415, 11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433, 11435, 11437, 11439, 11441, 11443,
+		11445, 11447, 11449, 11451, 11453, 11455, 11457, 11459, 11461, 11463, 11465, 11467, 11469, 11471, 11473, 11475,
+		11477, 11479, 11481, 11483, 11485, 11487, 11489, 11491, 11500, 11502, 11507, 11520, 11521, 11522, 11523, 11524,
+		11525, 11526, 11527, 11528, 11529, 11530, 11531, 11532, 11533, 11534, 11535, 11536, 11537, 11538, 11539, 11540,
+		11541, 11542, 11543, 11544, 11545, 11546, 11547, 11548, 11549, 11550, 11551, 11552, 11553, 11554, 11555, 11556,
+		11557, 11559, 11565, 42561, 42563, 42565, 42567, 42569, 42571, 42573, 42575, 42577, 42579, 42581, 42583, 42585,
+		42587, 42589, 42591, 42593, 42595, 42597, 42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631, 42633, 42635,
+		42637, 42639, 42641, 42643, 42645, 42647, 42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797, 42799, 42803,
+		42805, 42807, 42809, 42811, 42813, 42815, 42817, 42819, 42821, 42823, 42825, 42827, 42829, 42831, 42833, 42835,
+		42837, 42839, 42841, 42843, 42845, 42847, 42849, 42851, 42853, 42855, 42857, 42859, 42861, 42863, 42874, 42876,
+		42879, 42881, 42883, 42885, 42887, 42892, 42897, 42899, 42900, 42903, 42905, 42907, 42909, 42911, 42913, 42915,
+		42917, 42919, 42921, 42933, 42935, 42937, 42939, 42941, 42943, 42945, 42947, 42952, 42954, 42961, 42967, 42969,
+		42998, 43859, 43888, 43889, 43890, 43891, 43892, 43893, 43894, 43895, 43896, 43897, 43898, 43899, 43900, 43901,
+		43902, 43903, 43904, 43905, 43906, 43907, 43908, 43909, 43910, 43911, 43912, 43913, 43914, 43915, 43916, 43917,
+		43918, 43919, 43920, 43921, 43922, 43923, 43924, 43925, 43926, 43927, 43928, 43929, 43930, 43931, 43932, 43933,
+		43934, 43935, 43936, 43937, 43938, 43939, 43940, 43941, 43942, 43943, 43944, 43945, 43946, 43947, 43948, 43949,
+		43950, 43951, 43952, 43953, 43954, 43955, 43956, 43957, 43958, 43959, 43960, 43961, 43962, 43963, 43964, 43965,
+		43966, 43967, 65345, 65346, 65347, 65348, 65349, 65350, 65351, 65352, 65353, 65354, 65355, 65356, 65357, 65358,
+		65359, 65360, 65361, 65362, 65363, 65364, 65365, 65366, 65367, 65368, 65369, 65370,
+	};
+
+	inline constexpr uint16_t caseClassBegin[1165] = {
+		0, 2, 4, 6, 8, 10, 12, 14, 16, 19, 21, 24, 26, 28, 30, 32,
+		34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64,
+		66, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93, 95, 97,
+		99, 101, 103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127, 129,
+		131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159, 161,
+		163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189, 191, 193,
+		195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221, 223, 225,
+		227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253, 255, 257,
+		259, 261, 263, 265, 267, 269, 271, 273, 275, 277, 279, 281, 283, 286, 289, 292,
+		294, 296, 298, 300, 302, 304, 306, 308, 310, 312, 314, 316, 318, 320, 322, 324,
+		326, 328, 331, 333, 335, 337, 339, 341, 343, 345, 347, 349, 351, 353, 355, 357,
+		359, 361, 363, 365, 367, 369, 371, 373, 375, 377, 379, 381, 383, 385, 387, 389,
+		391, 393, 395, 397, 399, 401, 403, 405, 407, 409, 411, 413, 415, 417, 419, 421,
+		423, 425, 427, 429, 431, 433, 435, 437, 439, 441, 443, 445, 447, 449, 451, 453,
+		455, 457, 459, 461, 463, 465, 467, 469, 471, 473, 475, 477, 479, 481, 483, 485,
+		487, 489, 491, 493, 495, 497, 499, 501, 503, 505, 507, 509, 511, 513, 515, 517,
+		520, 522, 524, 526, 528, 530, 532, 534, 536, 538, 540, 542, 544, 546, 548, 550,
+		553, 555, 557, 559, 561, 563, 565, 567, 569, 571, 573, 575, 577, 579, 581, 583,
+		585, 587, 589, 591, 593, 595, 597, 599, 601, 603, 605, 607, 609, 611, 613, 615,
+		617, 619, 621, 623, 625, 627, 629, 631, 633, 635, 637, 639, 641, 643, 645, 647,
+		649, 651, 653, 655, 657, 659, 661, 663, 665, 667, 669, 671, 673, 675, 677, 679,
+		681, 683, 685, 687, 689, 691, 693, 695, 697, 699, 701, 703, 705, 707, 709, 711,
+		713, 715, 717, 719, 721, 723, 725, 727, 729, 731, 733, 735, 737, 739, 741, 743,
+		745, 747, 749, 751, 753, 755, 757, 759, 761, 763, 765, 767, 769, 771, 773, 775,
+		777, 779, 781, 783, 785, 787, 789, 791, 793, 795, 797, 799, 801, 803, 805, 807,
+		809, 811, 813, 815, 817, 819, 821, 823, 825, 827, 829, 831, 833, 835, 837, 839,
+		841, 843, 845, 847, 849, 851, 853, 855, 857, 859, 861, 863, 865, 867, 869, 871,
+		873, 875, 877, 879, 881, 883, 885, 887, 889, 891, 893, 895, 897, 899, 901, 903,
+		905, 907, 909, 911, 913, 915, 917, 919, 921, 923, 925, 927, 929, 931, 933, 935,
+		937, 939, 941, 943, 945, 947, 949, 951, 953, 955, 957, 959, 961, 963, 965, 967,
+		969, 971, 973, 975, 977, 979, 981, 983, 985, 987, 989, 991, 993, 995, 997, 999,
+		1001, 1003, 1005, 1007, 1009, 1011, 1013, 1015, 1017, 1019, 1021, 1023, 1025, 1027, 1029, 1031,
+		1033, 1035, 1037, 1039, 1041, 1043, 1045, 1047, 1049, 1051, 1053, 1055, 1057, 1059, 1061, 1063,
+		1065, 1067, 1069, 1071, 1073, 1075, 1077, 1079, 1081, 1083, 1085, 1087, 1089, 1091, 1093, 1095,
+		1097, 1099, 1101, 1103, 1105, 1107, 1109, 1111, 1113, 1115, 1117, 1119, 1121, 1123, 1125, 1127,
+		1129, 1131, 1133, 1135, 1137, 1139, 1141, 1143, 1145, 1147, 1149, 1151, 1153, 1155, 1157, 1159,
+		1161, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183, 1185, 1187, 1189, 1191,
+		1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207, 1209, 1211, 1213, 1215, 1217, 1219, 1221, 1223,
+		1225, 1227, 1229, 1231, 1233, 1235, 1237, 1239, 1241, 1243, 1245, 1247, 1249, 1251, 1253, 1255,
+		1257, 1259, 1261, 1263, 1265, 1267, 1269, 1271, 1273, 1275, 1277, 1279, 1281, 1283, 1285, 1287,
+		1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319,
+		1321, 1323, 1325, 1327, 1329, 1331, 1333, 1335, 1337, 1339, 1341, 1343, 1345, 1347, 1349, 1351,
+		1353, 1355, 1357, 1359, 1361, 1363, 1365, 1367, 1369, 1371, 1373, 1375, 1377, 1379, 1381, 1383,
+		1385, 1387, 1389, 1391, 1393, 1395, 1397, 1399, 1401, 1403, 1405, 1407, 1409, 1411, 1413, 1415,
+		1417, 1419, 1421, 1423, 1425, 1427, 1429, 1431, 1433, 1435, 1437, 1439, 1441, 1443, 1445, 1447,
+		1449, 1451, 1453, 1455, 1457, 1459, 1461, 1463, 1465, 1467, 1469, 1471, 1473, 1475, 1477, 1479,
+		1481, 1483, 1485, 1487, 1489, 1491, 1493, 1495, 1497, 1499, 1501, 1503, 1505, 1507, 1509, 1511,
+		1513, 1515, 1517, 1519, 1521, 1523, 1525, 1527, 1529, 1531, 1533, 1535, 1537, 1539, 1541, 1543,
+		1545, 1547, 1549, 1551, 1553, 1555, 1557, 1559, 1561, 1563, 1565, 1567, 1569, 1571, 1573, 1575,
+		1577, 1579, 1581, 1583, 1585, 1587, 1589, 1591, 1593, 1595, 1597, 1599, 1601, 1603, 1605, 1607,
+		1609, 1611, 1613, 1615, 1617, 1619, 1621, 1623, 1625, 1627, 1629, 1631, 1633, 1635, 1637, 1639,
+		1641, 1643, 1645, 1647, 1649, 1651, 1653, 1655, 1657, 1659, 1661, 1663, 1665, 1667, 1669, 1671,
+		1673, 1675, 1677, 1679, 1681, 1683, 1685, 1687, 1689, 1691, 1693, 1695, 1697, 1699, 1701, 1703,
+		1705, 1707, 1709, 1711, 1713, 1715, 1717, 1719, 1721, 1723, 1725, 1727, 1729, 1731, 1733, 1735,
+		1737, 1739, 1741, 1743, 1745, 1747, 1749, 1751, 1753, 1755, 1757, 1759, 1761, 1763, 1765, 1767,
+		1769, 1771, 1773, 1775, 1777, 1779, 1781, 1783, 1785, 1787, 1789, 1791, 1793, 1795, 1797, 1799,
+		1801, 1803, 1805, 1807, 1809, 1811, 1813, 1815, 1817, 1819, 1821, 1823, 1825, 1827, 1829, 1831,
+		1833, 1835, 1837, 1839, 1841, 1843, 1845, 1847, 1849, 1851, 1853, 1855, 1857, 1859, 1861, 1863,
+		1865, 1867, 1869, 1871, 1873, 1875, 1877, 1879, 1881, 1883, 1885, 1887, 1889, 1891, 1893, 1895,
+		1897, 1899, 1901, 1903, 1905, 1907, 1909, 1911, 1913, 1915, 1917, 1919, 1921, 1923, 1925, 1927,
+		1929, 1931, 1933, 1935, 1937, 1939, 1941, 1943, 1945, 1947, 1949, 1951, 1953, 1955, 1957, 1959,
+		1961, 1963, 1965, 1967, 1969, 1971, 1973, 1975, 1977, 1979, 1981, 1983, 1985, 1987, 1989, 1991,
+		1993, 1995, 1997, 1999, 2001, 2003, 2005, 2007, 2009, 2011, 2013, 2015, 2017, 2019, 2021, 2023,
+		2025, 2027, 2029, 2031, 2033, 2035, 2037, 2039, 2041, 2043, 2045, 2047, 2049, 2051, 2053, 2055,
+		2057, 2059, 2061, 2063, 2065, 2067, 2069, 2071, 2073, 2075, 2077, 2079, 2081, 2083, 2085, 2087,
+		2089, 2091, 2093, 2095, 2097, 2099, 2101, 2103, 2105, 2107, 2109, 2111, 2113, 2115, 2117, 2119,
+		2121, 2123, 2125, 2127, 2129, 2131, 2133, 2135, 2137, 2139, 2141, 2143, 2145, 2147, 2149, 2151,
+		2153, 2155, 2157, 2159, 2161, 2163, 2165, 2167, 2169, 2171, 2173, 2175, 2177, 2179, 2181, 2183,
+		2185, 2187, 2189, 2191, 2193, 2195, 2197, 2199, 2201, 2203, 2205, 2207, 2209, 2211, 2213, 2215,
+		2217, 2219, 2221, 2223, 2225, 2227, 2229, 2231, 2233, 2235, 2237, 2239, 2241, 2243, 2245, 2247,
+		2249, 2251, 2253, 2255, 2257, 2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273, 2275, 2277, 2279,
+		2281, 2283, 2285, 2287, 2289, 2291, 2293, 2295, 2297, 2299, 2301, 2303, 2305, 2307, 2309, 2311,
+		2313, 2315, 2317, 2319, 2321, 2323, 2325, 2327, 2329, 2331, 2333, 2335, 2337,
+	};
+
+	inline constexpr char16_t caseClassMembers[2337] = {
+		65, 97, 66, 98, 67, 99, 68, 100, 69, 101, 70, 102, 71, 103, 72, 104,
+		73, 105, 304, 74, 106, 75, 107, 8490, 76, 108, 77, 109, 78, 110, 79, 111,
+		80, 112, 81, 113, 82, 114, 83, 115, 84, 116, 85, 117, 86, 118, 87, 119,
+		88, 120, 89, 121, 90, 122, 223, 7838, 192, 224, 193, 225, 194, 226, 195, 227,
+		196, 228, 197, 229, 8491, 198, 230, 199, 231, 200, 232, 201, 233, 202, 234, 203,
+		235, 204, 236, 205, 237, 206, 238, 207, 239, 208, 240, 209, 241, 210, 242, 211,
+		243, 212, 244, 213, 245, 214, 246, 216, 248, 217, 249, 218, 250, 219, 251, 220,
+		252, 221, 253, 222, 254, 255, 376, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+		265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+		281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296,
+		297, 298, 299, 300, 301, 302, 303, 306, 307, 308, 309, 310, 311, 313, 314, 315,
+		316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 330, 331, 332,
+		333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348,
+		349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+		365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 377, 378, 379, 380, 381,
+		382, 384, 579, 386, 387, 388, 389, 391, 392, 395, 396, 401, 402, 405, 502, 408,
+		409, 410, 573, 414, 544, 416, 417, 418, 419, 420, 421, 423, 424, 428, 429, 431,
+		432, 435, 436, 437, 438, 440, 441, 444, 445, 447, 503, 452, 453, 454, 455, 456,
+		457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472,
+		473, 474, 475, 476, 398, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487,
+		488, 489, 490, 491, 492, 493, 494, 495, 497, 498, 499, 500, 501, 504, 505, 506,
+		507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
+		523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538,
+		539, 540, 541, 542, 543, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556,
+		557, 558, 559, 560, 561, 562, 563, 571, 572, 575, 11390, 576, 11391, 577, 578, 582,
+		583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 11375, 593, 11373, 594, 11376, 385,
+		595, 390, 596, 393, 598, 394, 599, 399, 601, 400, 603, 604, 42923, 403, 608, 609,
+		42924, 404, 611, 613, 42893, 614, 42922, 407, 616, 406, 617, 618, 42926, 619, 11362, 620,
+		42925, 412, 623, 625, 11374, 413, 626, 415, 629, 637, 11364, 422, 640, 642, 42949, 425,
+		643, 647, 42929, 430, 648, 580, 649, 433, 650, 434, 651, 581, 652, 439, 658, 669,
+		42930, 670, 42928, 880, 881, 882, 883, 886, 887, 891, 1021, 892, 1022, 893, 1023, 902,
+		940, 904, 941, 905, 942, 906, 943, 913, 945, 914, 946, 915, 947, 916, 948, 917,
+		949, 918, 950, 919, 951, 920, 952, 1012, 921, 953, 922, 954, 923, 955, 924, 956,
+		925, 957, 926, 958, 927, 959, 928, 960, 929, 961, 931, 963, 932, 964, 933, 965,
+		934, 966, 935, 967, 936, 968, 937, 969, 8486, 938, 970, 939, 971, 908, 972, 910,
+		973, 911, 974, 975, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994,
+		995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1010, 1017, 895,
+		1011, 1015, 1016, 1018, 1019, 1040, 1072, 1041, 1073, 1042, 1074, 1043, 1075, 1044, 1076, 1045,
+		1077, 1046, 1078, 1047, 1079, 1048, 1080, 1049, 1081, 1050, 1082, 1051, 1083, 1052, 1084, 1053,
+		1085, 1054, 1086, 1055, 1087, 1056, 1088, 1057, 1089, 1058, 1090, 1059, 1091, 1060, 1092, 1061,
+		1093, 1062, 1094, 1063, 1095, 1064, 1096, 1065, 1097, 1066, 1098, 1067, 1099, 1068, 1100, 1069,
+		1101, 1070, 1102, 1071, 1103, 1024, 1104, 1025, 1105, 1026, 1106, 1027, 1107, 1028, 1108, 1029,
+		1109, 1030, 1110, 1031, 1111, 1032, 1112, 1033, 1113, 1034, 1114, 1035, 1115, 1036, 1116, 1037,
+		1117, 1038, 1118, 1039, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+		1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146,
+		1147, 1148, 1149, 1150, 1151, 1152, 1153, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+		1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+		1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+		1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1217, 1218, 1219,
+		1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1216, 1231, 1232, 1233, 1234,
+		1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
+		1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
+		1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
+		1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+		1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314,
+		1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1329, 1377, 1330,
+		1378, 1331, 1379, 1332, 1380, 1333, 1381, 1334, 1382, 1335, 1383, 1336, 1384, 1337, 1385, 1338,
+		1386, 1339, 1387, 1340, 1388, 1341, 1389, 1342, 1390, 1343, 1391, 1344, 1392, 1345, 1393, 1346,
+		1394, 1347, 1395, 1348, 1396, 1349, 1397, 1350, 1398, 1351, 1399, 1352, 1400, 1353, 1401, 1354,
+		1402, 1355, 1403, 1356, 1404, 1357, 1405, 1358, 1406, 1359, 1407, 1360, 1408, 1361, 1409, 1362,
+		1410, 1363, 1411, 1364, 1412, 1365, 1413, 1366, 1414, 4304, 7312, 4305, 7313, 4306, 7314, 4307,
+		7315, 4308, 7316, 4309, 7317, 4310, 7318, 4311, 7319, 4312, 7320, 4313, 7321, 4314, 7322, 4315,
+		7323, 4316, 7324, 4317, 7325, 4318, 7326, 4319, 7327, 4320, 7328, 4321, 7329, 4322, 7330, 4323,
+		7331, 4324, 7332, 4325, 7333, 4326, 7334, 4327, 7335, 4328, 7336, 4329, 7337, 4330, 7338, 4331,
+		7339, 4332, 7340, 4333, 7341, 4334, 7342, 4335, 7343, 4336, 7344, 4337, 7345, 4338, 7346, 4339,
+		7347, 4340, 7348, 4341, 7349, 4342, 7350, 4343, 7351, 4344, 7352, 4345, 7353, 4346, 7354, 4349,
+		7357, 4350, 7358, 4351, 7359, 5104, 5112, 5105, 5113, 5106, 5114, 5107, 5115, 5108, 5116, 5109,
+		5117, 7545, 42877, 7549, 11363, 7566, 42950, 7680, 7681, 7682, 7683, 7684, 7685, 7686, 7687, 7688,
+		7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701, 7702, 7703, 7704,
+		7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717, 7718, 7719, 7720,
+		7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732, 7733, 7734, 7735, 7736,
+		7737, 7738, 7739, 7740, 7741, 7742, 7743, 7744, 7745, 7746, 7747, 7748, 7749, 7750, 7751, 7752,
+		7753, 7754, 7755, 7756, 7757, 7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765, 7766, 7767, 7768,
+		7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780, 7781, 7782, 7783, 7784,
+		7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792, 7793, 7794, 7795, 7796, 7797, 7798, 7799, 7800,
+		7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813, 7814, 7815, 7816,
+		7817, 7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828, 7829, 7840, 7841, 7842,
+		7843, 7844, 7845, 7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857, 7858,
+		7859, 7860, 7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7874,
+		7875, 7876, 7877, 7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890,
+		7891, 7892, 7893, 7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906,
+		7907, 7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921, 7922,
+		7923, 7924, 7925, 7926, 7927, 7928, 7929, 7930, 7931, 7932, 7933, 7934, 7935, 7936, 7944, 7937,
+		7945, 7938, 7946, 7939, 7947, 7940, 7948, 7941, 7949, 7942, 7950, 7943, 7951, 7952, 7960, 7953,
+		7961, 7954, 7962, 7955, 7963, 7956, 7964, 7957, 7965, 7968, 7976, 7969, 7977, 7970, 7978, 7971,
+		7979, 7972, 7980, 7973, 7981, 7974, 7982, 7975, 7983, 7984, 7992, 7985, 7993, 7986, 7994, 7987,
+		7995, 7988, 7996, 7989, 7997, 7990, 7998, 7991, 7999, 8000, 8008, 8001, 8009, 8002, 8010, 8003,
+		8011, 8004, 8012, 8005, 8013, 8017, 8025, 8019, 8027, 8021, 8029, 8023, 8031, 8032, 8040, 8033,
+		8041, 8034, 8042, 8035, 8043, 8036, 8044, 8037, 8045, 8038, 8046, 8039, 8047, 8048, 8122, 8049,
+		8123, 8050, 8136, 8051, 8137, 8052, 8138, 8053, 8139, 8054, 8154, 8055, 8155, 8056, 8184, 8057,
+		8185, 8058, 8170, 8059, 8171, 8060, 8186, 8061, 8187, 8064, 8072, 8065, 8073, 8066, 8074, 8067,
+		8075, 8068, 8076, 8069, 8077, 8070, 8078, 8071, 8079, 8080, 8088, 8081, 8089, 8082, 8090, 8083,
+		8091, 8084, 8092, 8085, 8093, 8086, 8094, 8087, 8095, 8096, 8104, 8097, 8105, 8098, 8106, 8099,
+		8107, 8100, 8108, 8101, 8109, 8102, 8110, 8103, 8111, 8112, 8120, 8113, 8121, 8115, 8124, 8131,
+		8140, 8144, 8152, 8145, 8153, 8160, 8168, 8161, 8169, 8165, 8172, 8179, 8188, 8498, 8526, 8544,
+		8560, 8545, 8561, 8546, 8562, 8547, 8563, 8548, 8564, 8549, 8565, 8550, 8566, 8551, 8567, 8552,
+		8568, 8553, 8569, 8554, 8570, 8555, 8571, 8556, 8572, 8557, 8573, 8558, 8574, 8559, 8575, 8579,
+		8580, 9398, 9424, 9399, 9425, 9400, 9426, 9401, 9427, 9402, 9428, 9403, 9429, 9404, 9430, 9405,
+		9431, 9406, 9432, 9407, 9433, 9408, 9434, 9409, 9435, 9410, 9436, 9411, 9437, 9412, 9438, 9413,
+		9439, 9414, 9440, 9415, 9441, 9416, 9442, 9417, 9443, 9418, 9444, 9419, 9445, 9420, 9446, 9421,
+		9447, 9422, 9448, 9423, 9449, 11264, 11312, 11265, 11313, 11266, 11314, 11267, 11315, 11268, 11316, 11269,
+		11317, 11270, 11318, 11271, 11319, 11272, 11320, 11273, 11321, 11274, 11322, 11275, 11323, 11276, 11324, 11277,
+		11325, 11278, 11326, 11279, 11327, 11280, 11328, 11281, 11329, 11282, 11330, 11283, 11331, 11284, 11332, 11285,
+		11333, 11286, 11334, 11287, 11335, 11288, 11336, 11289, 11337, 11290, 11338, 11291, 11339, 11292, 11340, 11293,
+		11341, 11294, 11342, 11295, 11343, 11296, 11344, 11297, 11345, 11298, 11346, 11299, 11347, 11300, 11348, 11301,
+		11349, 11302, 11350, 11303, 11351, 11304, 11352, 11305, 11353, 11306, 11354, 11307, 11355, 11308, 11356, 11309,
+		11357, 11310, 11358, 11311, 11359, 11360, 11361, 570, 11365, 574, 11366, 11367, 11368, 11369, 11370, 11371,
+		11372, 11378, 11379, 11381, 11382, 11392, 11393, 11394, 11395, 11396, 11397, 11398, 11399, 11400, 11401, 11402,
+		11403, 11404, 11405, 11406, 11407, 11408, 11409, 11410, 11411, 11412, 11413, 11414, 11415, 11416, 11417, 11418,
+		11419, 11420, 11421, 11422, 11423, 11424, 11425, 11426, 11427, 11428, 11429, 11430, 11431, 11432, 11433, 11434,
+		11435, 11436, 11437, 11438, 11439, 11440, 11441, 11442, 11443, 11444, 11445, 11446, 11447, 11448, 11449, 11450,
+		11451, 11452, 11453, 11454, 11455, 11456, 11457, 11458, 11459, 11460, 11461, 11462, 11463, 11464, 11465, 11466,
+		11467, 11468, 11469, 11470, 11471, 11472, 11473, 11474, 11475, 11476, 11477, 11478, 11479, 11480, 11481, 11482,
+		11483, 11484, 11485, 11486, 11487, 11488, 11489, 11490, 11491, 11499, 11500, 11501, 11502, 11506, 11507, 4256,
+		11520, 4257, 11521, 4258, 11522, 4259, 11523, 4260, 11524, 4261, 11525, 4262, 11526, 4263, 11527, 4264,
+		11528, 4265, 11529, 4266, 11530, 4267, 11531, 4268, 11532, 4269, 11533, 4270, 11534, 4271, 11535, 4272,
+		11536, 4273, 11537, 4274, 11538, 4275, 11539, 4276, 11540, 4277, 11541, 4278, 11542, 4279, 11543, 4280,
+		11544, 4281, 11545, 4282, 11546, 4283, 11547, 4284, 11548, 4285, 11549, 4286, 11550, 4287, 11551, 4288,
+		11552, 4289, 11553, 4290, 11554, 4291, 11555, 4292, 11556, 4293, 11557, 4295, 11559, 4301, 11565, 42560,
+		42561, 42562, 42563, 42564, 42565, 42566, 42567, 42568, 42569, 42570, 42571, 42572, 42573, 42574, 42575, 42576,
+		42577, 42578, 42579, 42580, 42581, 42582, 42583, 42584, 42585, 42586, 42587, 42588, 42589, 42590, 42591, 42592,
+		42593, 42594, 42595, 42596, 42597, 42598, 42599, 42600, 42601, 42602, 42603, 42604, 42605, 42624, 42625, 42626,
+		42627, 42628, 42629, 42630, 42631, 42632, 42633, 42634, 42635, 42636, 42637, 42638, 42639, 42640, 42641, 42642,
+		42643, 42644, 42645, 42646, 42647, 42648, 42649, 42650, 42651, 42786, 42787, 42788, 42789, 42790, 42791, 42792,
+		42793, 42794, 42795, 42796, 42797, 42798, 42799, 42802, 42803, 42804, 42805, 42806, 42807, 42808, 42809, 42810,
+		42811, 42812, 42813, 42814, 42815, 42816, 42817, 42818, 42819, 42820, 42821, 42822, 42823, 42824, 42825, 42826,
+		42827, 42828, 42829, 42830, 42831, 42832, 42833, 42834, 42835, 42836, 42837, 42838, 42839, 42840, 42841, 42842,
+		42843, 42844, 42845, 42846, 42847, 42848, 42849, 42850, 42851, 42852, 42853, 42854, 42855, 42856, 42857, 42858,
+		42859, 42860, 42861, 42862, 42863, 42873, 42874, 42875, 42876, 42878, 42879, 42880, 42881, 42882, 42883, 42884,
+		42885, 42886, 42887, 42891, 42892, 42896, 42897, 42898, 42899, 42900, 42948, 42902, 42903, 42904, 42905, 42906,
+		42907, 42908, 42909, 42910, 42911, 42912, 42913, 42914, 42915, 42916, 42917, 42918, 42919, 42920, 42921, 42932,
+		42933, 42934, 42935, 42936, 42937, 42938, 42939, 42940, 42941, 42942, 42943, 42944, 42945, 42946, 42947, 42951,
+		42952, 42953, 42954, 42960, 42961, 42966, 42967, 42968, 42969, 42997, 42998, 42931, 43859, 5024, 43888, 5025,
+		43889, 5026, 43890, 5027, 43891, 5028, 43892, 5029, 43893, 5030, 43894, 5031, 43895, 5032, 43896, 5033,
+		43897, 5034, 43898, 5035, 43899, 5036, 43900, 5037, 43901, 5038, 43902, 5039, 43903, 5040, 43904, 5041,
+		43905, 5042, 43906, 5043, 43907, 5044, 43908, 5045, 43909, 5046, 43910, 5047, 43911, 5048, 43912, 5049,
+		43913, 5050, 43914, 5051, 43915, 5052, 43916, 5053, 43917, 5054, 43918, 5055, 43919, 5056, 43920, 5057,
+		43921, 5058, 43922, 5059, 43923, 5060, 43924, 5061, 43925, 5062, 43926, 5063, 43927, 5064, 43928, 5065,
+		43929, 5066, 43930, 5067, 43931, 5068, 43932, 5069, 43933, 5070, 43934, 5071, 43935, 5072, 43936, 5073,
+		43937, 5074, 43938, 5075, 43939, 5076, 43940, 5077, 43941, 5078, 43942, 5079, 43943, 5080, 43944, 5081,
+		43945, 5082, 43946, 5083, 43947, 5084, 43948, 5085, 43949, 5086, 43950, 5087, 43951, 5088, 43952, 5089,
+		43953, 5090, 43954, 5091, 43955, 5092, 43956, 5093, 43957, 5094, 43958, 5095, 43959, 5096, 43960, 5097,
+		43961, 5098, 43962, 5099, 43963, 5100, 43964, 5101, 43965, 5102, 43966, 5103, 43967, 65313, 65345, 65314,
+		65346, 65315, 65347, 65316, 65348, 65317, 65349, 65318, 65350, 65319, 65351, 65320, 65352, 65321, 65353, 65322,
+		65354, 65323, 65355, 65324, 65356, 65325, 65357, 65326, 65358, 65327, 65359, 65328, 65360, 65329, 65361, 65330,
+		65362, 65331, 65363, 65332, 65364, 65333, 65365, 65334, 65366, 65335, 65367, 65336, 65368, 65337, 65369, 65338,
+		65370,
+	};
+
+	struct NormProps
+	{
+		//canonical combining class
+		uint8_t ccc;
+		uint8_t flags;
+	};
+
+	//quick check values other than Yes
+	inline constexpr uint8_t normFlagNfdNo = 1;
+	inline constexpr uint8_t normFlagNfcNo = 2;
+	inline constexpr uint8_t normFlagNfcMaybe = 4;
+	inline constexpr uint8_t normFlagNfkdNo = 8;
+	inline constexpr uint8_t normFlagNfkcNo = 16;
+	inline constexpr uint8_t normFlagNfkcMaybe = 32;
+
+	inline constexpr NormProps normProps[69] = {
+		{ 0, 0 },
+		{ 0, 24 },
+		{ 0, 9 },
+		{ 230, 36 },
+		{ 230, 0 },
+		{ 232, 0 },
+		{ 220, 0 },
+		{ 216, 36 },
+		{ 202, 0 },
+		{ 220, 36 },
+		{ 202, 36 },
+		{ 1, 0 },
+		{ 1, 36 },
+		{ 230, 27 },
+		{ 240, 36 },
+		{ 233, 0 },
+		{ 234, 0 },
+		{ 0, 27 },
+		{ 0, 25 },
+		{ 222, 0 },
+		{ 228, 0 },
+		{ 10, 0 },
+		{ 11, 0 },
+		{ 12, 0 },
+		{ 13, 0 },
+		{ 14, 0 },
+		{ 15, 0 },
+		{ 16, 0 },
+		{ 17, 0 },
+		{ 18, 0 },
+		{ 19, 0 },
+		{ 20, 0 },
+		{ 21, 0 },
+		{ 22, 0 },
+		{ 23, 0 },
+		{ 24, 0 },
+		{ 25, 0 },
+		{ 30, 0 },
+		{ 31, 0 },
+		{ 32, 0 },
+		{ 27, 0 },
+		{ 28, 0 },
+		{ 29, 0 },
+		{ 33, 0 },
+		{ 34, 0 },
+		{ 35, 0 },
+		{ 36, 0 },
+		{ 7, 36 },
+		{ 9, 0 },
+		{ 7, 0 },
+		{ 0, 36 },
+		{ 84, 0 },
+		{ 91, 36 },
+		{ 9, 36 },
+		{ 103, 0 },
+		{ 107, 0 },
+		{ 118, 0 },
+		{ 122, 0 },
+		{ 216, 0 },
+		{ 129, 0 },
+		{ 130, 0 },
+		{ 132, 0 },
+		{ 214, 0 },
+		{ 218, 0 },
+		{ 224, 0 },
+		{ 8, 36 },
+		{ 26, 0 },
+		{ 6, 0 },
+		{ 226, 0 },
+	};
+
+	inline constexpr uint8_t normPropsStage1[8704] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+		15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+		31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+		0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+		52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+		70, 71, 72, 73, 74, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 78,
+		79, 80, 81, 82, 0, 83, 84, 85, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 86,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 87, 87, 88, 89, 90, 91, 68, 68, 92, 93, 94, 95, 96, 97,
+		0, 0, 0, 98, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+		0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 104, 0, 0, 105, 106, 107,
+		108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 119, 120, 0,
+		121, 0, 122, 123, 124, 125, 0, 0, 118, 0, 126, 127, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 132, 133, 134, 0, 0, 0, 135, 136, 137, 68, 68, 138, 68, 139,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		140, 0, 129, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 142, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 145, 0, 0,
+		0, 0, 146, 147, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		87, 87, 87, 87, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	inline constexpr uint8_t normPropsStage2[19328] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+		0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0,
+		2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 0, 1, 1, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 1,
+		1, 0, 0, 2, 2, 2, 2, 2, 2, 1, 0, 0, 2, 2, 2, 2,
+		2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+		2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 1, 1, 1, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+		1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3,
+		4, 3, 4, 3, 3, 5, 6, 6, 6, 6, 5, 7, 6, 6, 6, 6,
+		6, 8, 8, 9, 9, 9, 9, 10, 10, 6, 6, 6, 6, 9, 9, 6,
+		9, 9, 6, 6, 11, 11, 11, 11, 12, 6, 6, 6, 6, 4, 4, 4,
+		13, 13, 3, 13, 13, 14, 4, 6, 6, 6, 4, 4, 4, 6, 6, 0,
+		4, 4, 4, 6, 6, 6, 6, 4, 5, 6, 6, 4, 15, 16, 16, 15,
+		16, 16, 15, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 1, 0, 0, 0, 17, 0,
+		0, 0, 0, 0, 1, 18, 2, 17, 2, 2, 2, 0, 2, 0, 2, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0,
+		1, 1, 1, 18, 18, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 6, 4, 4, 4, 4, 6, 4, 4, 4, 19, 6, 4, 4, 4, 4,
+		4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 4, 4, 19, 20, 4,
+		21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 30, 31, 32, 33, 0, 34,
+		0, 35, 36, 0, 4, 6, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 37, 38, 39, 0, 0, 0, 0, 0,
+		0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 37, 38,
+		39, 43, 44, 3, 3, 9, 6, 4, 4, 4, 4, 4, 6, 4, 4, 6,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		45, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+		4, 4, 4, 6, 4, 0, 0, 4, 4, 0, 6, 4, 4, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 6, 4, 4, 6, 4, 4, 6, 6, 6, 4, 6, 6, 4, 6, 4,
+		4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 6, 6, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 6,
+		6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 0, 6, 4, 4, 6, 4, 4, 6, 4, 4, 4, 6, 6, 6,
+		40, 41, 42, 4, 4, 4, 6, 4, 4, 6, 6, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 4, 6, 4, 4, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 17, 17, 0, 17,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 17, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 0, 0, 17, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 17, 17, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+		2, 0, 50, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 54, 54, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 56, 56, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 6, 0, 6, 0, 58, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+		0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+		0, 59, 60, 17, 61, 17, 17, 1, 17, 1, 60, 60, 60, 60, 0, 0,
+		60, 17, 4, 4, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+		0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 6,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 0, 6,
+		6, 4, 4, 6, 6, 4, 4, 4, 4, 4, 6, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+		2, 2, 0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 11, 6, 6, 6, 6, 6, 4, 4, 6, 6, 6, 6,
+		4, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 4, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 16, 62, 6,
+		8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 5, 20, 20, 6, 63, 4, 15, 6, 4, 6,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 18, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 17, 2, 1, 17, 1,
+		1, 18, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 18, 18, 18,
+		2, 2, 2, 17, 0, 0, 2, 2, 2, 2, 2, 17, 0, 18, 18, 18,
+		2, 2, 2, 17, 2, 2, 2, 2, 2, 2, 2, 17, 2, 18, 17, 17,
+		0, 0, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 17, 1, 0,
+		17, 17, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 11, 11, 4, 4, 4, 4, 11, 11, 11, 4, 4, 0, 0, 0,
+		0, 4, 0, 0, 0, 11, 11, 4, 6, 4, 11, 11, 6, 6, 6, 6,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+		1, 1, 1, 0, 1, 0, 17, 0, 1, 0, 17, 17, 1, 1, 0, 1,
+		1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2, 0, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+		2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 20, 5, 19, 64, 64,
+		0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 65, 65, 1, 1, 0, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 4, 4, 6, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+		0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		17, 0, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+		17, 0, 17, 0, 0, 17, 17, 0, 0, 0, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 66, 17,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 17, 0,
+		17, 17, 0, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4, 4,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+		1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+		0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 11, 6, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 6, 6, 4, 4, 4, 6, 4, 6, 6, 6,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 6, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 47, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 2, 2,
+		0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 2, 2, 50, 2, 0,
+		0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 48,
+		49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		50, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 48, 0,
+		0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17,
+		17, 17, 17, 17, 17, 58, 58, 11, 11, 11, 0, 0, 0, 68, 58, 58,
+		58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+		6, 6, 6, 0, 0, 4, 4, 4, 4, 4, 6, 6, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17,
+		17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+		0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	constexpr const NormProps& normPropsOf(char32_t cp) noexcept
+	{
+		constexpr unsigned mask = (1u << unicodeBlockShift) - 1;
+		return normProps[normPropsStage2[(unsigned(normPropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)]];
+	}
+
+	//full decompositions of the code points other than hangul syllables, sorted: the canonical one at offset
+	//in decompositionCodePoints and the compatibility one after it. compat is 0 if both are the same, canonical is 0 if there is none
+	struct Decomposition
+	{
+		char32_t cp;
+		uint16_t offset;
+		uint8_t canonical;
+		uint8_t compat;
+	};
+
+	inline constexpr Decomposition decompositions[5795] = {
+		{ 160, 0, 0, 1 },
+		{ 168, 1, 0, 2 },
+		{ 170, 3, 0, 1 },
+		{ 175, 4, 0, 2 },
+		{ 178, 6, 0, 1 },
+		{ 179, 7, 0, 1 },
+		{ 180, 8, 0, 2 },
+		{ 181, 10, 0, 1 },
+		{ 184, 11, 0, 2 },
+		{ 185, 13, 0, 1 },
+		{ 186, 14, 0, 1 },
+		{ 188, 15, 0, 3 },
+		{ 189, 18, 0, 3 },
+		{ 190, 21, 0, 3 },
+		{ 192, 24, 2, 0 },
+		{ 193, 26, 2, 0 },
+		{ 194, 28, 2, 0 },
+		{ 195, 30, 2, 0 },
+		{ 196, 32, 2, 0 },
+		{ 197, 34, 2, 0 },
+		{ 199, 36, 2, 0 },
+		{ 200, 38, 2, 0 },
+		{ 201, 40, 2, 0 },
+		{ 202, 42, 2, 0 },
+		{ 203, 44, 2, 0 },
+		{ 204, 46, 2, 0 },
+		{ 205, 48, 2, 0 },
+		{ 206, 50, 2, 0 },
+		{ 207, 52, 2, 0 },
+		{ 209, 54, 2, 0 },
+		{ 210, 56, 2, 0 },
+		{ 211, 58, 2, 0 },
+		{ 212, 60, 2, 0 },
+		{ 213, 62, 2, 0 },
+		{ 214, 64, 2, 0 },
+		{ 217, 66, 2, 0 },
+		{ 218, 68, 2, 0 },
+		{ 219, 70, 2, 0 },
+		{ 220, 72, 2, 0 },
+		{ 221, 74, 2, 0 },
+		{ 224, 76, 2, 0 },
+		{ 225, 78, 2, 0 },
+		{ 226, 80, 2, 0 },
+		{ 227, 82, 2, 0 },
+		{ 228, 84, 2, 0 },
+		{ 229, 86, 2, 0 },
+		{ 231, 88, 2, 0 },
+		{ 232, 90, 2, 0 },
+		{ 233, 92, 2, 0 },
+		{ 234, 94, 2, 0 },
+		{ 235, 96, 2, 0 },
+		{ 236, 98, 2, 0 },
+		{ 237, 100, 2, 0 },
+		{ 238, 102, 2, 0 },
+		{ 239, 104, 2, 0 },
+		{ 241, 106, 2, 0 },
+		{ 242, 108, 2, 0 },
+		{ 243, 110, 2, 0 },
+		{ 244, 112, 2, 0 },
+		{ 245, 114, 2, 0 },
+		{ 246, 116, 2, 0 },
+		{ 249, 118, 2, 0 },
+		{ 250, 120, 2, 0 },
+		{ 251, 122, 2, 0 },
+		{ 252, 124, 2, 0 },
+		{ 253, 126, 2, 0 },
+		{ 255, 128, 2, 0 },
+		{ 256, 130, 2, 0 },
+		{ 257, 132, 2, 0 },
+		{ 258, 134, 2, 0 },
+		{ 259, 136, 2, 0 },
+		{ 260, 138, 2, 0 },
+		{ 261, 140, 2, 0 },
+		{ 262, 142, 2, 0 },
+		{ 263, 144, 2, 0 },
+		{ 264, 146, 2, 0 },
+		{ 265, 148, 2, 0 },
+		{ 266, 150, 2, 0 },
+		{ 267, 152, 2, 0 },
+		{ 268, 154, 2, 0 },
+		{ 269, 156, 2, 0 },
+		{ 270, 158, 2, 0 },
+		{ 271, 160, 2, 0 },
+		{ 274, 162, 2, 0 },
+		{ 275, 164, 2, 0 },
+		{ 276, 166, 2, 0 },
+		{ 277, 168, 2, 0 },
+		{ 278, 170, 2, 0 },
+		{ 279, 172, 2, 0 },
+		{ 280, 174, 2, 0 },
+		{ 281, 176, 2, 0 },
+		{ 282, 178, 2, 0 },
+		{ 283, 180, 2, 0 },
+		{ 284, 182, 2, 0 },
+		{ 285, 184, 2, 0 },
+		{ 286, 186, 2, 0 },
+		{ 287, 188, 2, 0 },
+		{ 288, 190, 2, 0 },
+		{ 289, 192, 2, 0 },
+		{ 290, 194, 2, 0 },
+		{ 291, 196, 2, 0 },
+		{ 292, 198, 2, 0 },
+		{ 293, 200, 2, 0 },
+		{ 296, 202, 2, 0 },
+		{ 297, 204, 2, 0 },
+		{ 298, 206, 2, 0 },
+		{ 299, 208, 2, 0 },
+		{ 300, 210, 2, 0 },
+		{ 301, 212, 2, 0 },
+		{ 302, 214, 2, 0 },
+		{ 303, 216, 2, 0 },
+		{ 304, 218, 2, 0 },
+		{ 306, 220, 0, 2 },
+		{ 307, 222, 0, 2 },
+		{ 308, 224, 2, 0 },
+		{ 309, 226, 2, 0 },
+		{ 310, 228, 2, 0 },
+		{ 311, 230, 2, 0 },
+		{ 313, 232, 2, 0 },
+		{ 314, 234, 2, 0 },
+		{ 315, 236, 2, 0 },
+		{ 316, 238, 2, 0 },
+		{ 317, 240, 2, 0 },
+		{ 318, 242, 2, 0 },
+		{ 319, 244, 0, 2 },
+		{ 320, 246, 0, 2 },
+		{ 323, 248, 2, 0 },
+		{ 324, 250, 2, 0 },
+		{ 325, 252, 2, 0 },
+		{ 326, 254, 2, 0 },
+		{ 327, 256, 2, 0 },
+		{ 328, 258, 2, 0 },
+		{ 329, 260, 0, 2 },
+		{ 332, 262, 2, 0 },
+		{ 333, 264, 2, 0 },
+		{ 334, 266, 2, 0 },
+		{ 335, 268, 2, 0 },
+		{ 336, 270, 2, 0 },
+		{ 337, 272, 2, 0 },
+		{ 340, 274, 2, 0 },
+		{ 341, 276, 2, 0 },
+		{ 342, 278, 2, 0 },
+		{ 343, 280, 2, 0 },
+		{ 344, 282, 2, 0 },
+		{ 345, 284, 2, 0 },
+		{ 346, 286, 2, 0 },
+		{ 347, 288, 2, 0 },
+		{ 348, 290, 2, 0 },
+		{ 349, 292, 2, 0 },
+		{ 350, 294, 2, 0 },
+		{ 351, 296, 2, 0 },
+		{ 352, 298, 2, 0 },
+		{ 353, 300, 2, 0 },
+		{ 354, 302, 2, 0 },
+		{ 355, 304, 2, 0 },
+		{ 356, 306, 2, 0 },
+		{ 357, 308, 2, 0 },
+		{ 360, 310, 2, 0 },
+		{ 361, 312, 2, 0 },
+		{ 362, 314, 2, 0 },
+		{ 363, 316, 2, 0 },
+		{ 364, 318, 2, 0 },
+		{ 365, 320, 2, 0 },
+		{ 366, 322, 2, 0 },
+		{ 367, 324, 2, 0 },
+		{ 368, 326, 2, 0 },
+		{ 369, 328, 2, 0 },
+		{ 370, 330, 2, 0 },
+		{ 371, 332, 2, 0 },
+		{ 372, 334, 2, 0 },
+		{ 373, 336, 2, 0 },
+		{ 374, 338, 2, 0 },
+		{ 375, 340, 2, 0 },
+		{ 376, 342, 2, 0 },
+		{ 377, 344, 2, 0 },
+		{ 378, 346, 2, 0 },
+		{ 379, 348, 2, 0 },
+		{ 380, 350, 2, 0 },
+		{ 381, 352, 2, 0 },
+		{ 382, 354, 2, 0 },
+		{ 383, 356, 0, 1 },
+		{ 416, 357, 2, 0 },
+		{ 417, 359, 2, 0 },
+		{ 431, 361, 2, 0 },
+		{ 432, 363, 2, 0 },
+		{ 452, 365, 0, 3 },
+		{ 453, 368, 0, 3 },
+		{ 454, 371, 0, 3 },
+		{ 455, 374, 0, 2 },
+		{ 456, 376, 0, 2 },
+		{ 457, 378, 0, 2 },
+		{ 458, 380, 0, 2 },
+		{ 459, 382, 0, 2 },
+		{ 460, 384, 0, 2 },
+		{ 461, 386, 2, 0 },
+		{ 462, 388, 2, 0 },
+		{ 463, 390, 2, 0 },
+		{ 464, 392, 2, 0 },
+		{ 465, 394, 2, 0 },
+		{ 466, 396, 2, 0 },
+		{ 467, 398, 2, 0 },
+		{ 468, 400, 2, 0 },
+		{ 469, 402, 3, 0 },
+		{ 470, 405, 3, 0 },
+		{ 471, 408, 3, 0 },
+		{ 472, 411, 3, 0 },
+		{ 473, 414, 3, 0 },
+		{ 474, 417, 3, 0 },
+		{ 475, 420, 3, 0 },
+		{ 476, 423, 3, 0 },
+		{ 478, 426, 3, 0 },
+		{ 479, 429, 3, 0 },
+		{ 480, 432, 3, 0 },
+		{ 481, 435, 3, 0 },
+		{ 482, 438, 2, 0 },
+		{ 483, 440, 2, 0 },
+		{ 486, 442, 2, 0 },
+		{ 487, 444, 2, 0 },
+		{ 488, 446, 2, 0 },
+		{ 489, 448, 2, 0 },
+		{ 490, 450, 2, 0 },
+		{ 491, 452, 2, 0 },
+		{ 492, 454, 3, 0 },
+		{ 493, 457, 3, 0 },
+		{ 494, 460, 2, 0 },
+		{ 495, 462, 2, 0 },
+		{ 496, 464, 2, 0 },
+		{ 497, 466, 0, 2 },
+		{ 498, 468, 0, 2 },
+		{ 499, 470, 0, 2 },
+		{ 500, 472, 2, 0 },
+		{ 501, 474, 2, 0 },
+		{ 504, 476, 2, 0 },
+		{ 505, 478, 2, 0 },
+		{ 506, 480, 3, 0 },
+		{ 507, 483, 3, 0 },
+		{ 508, 486, 2, 0 },
+		{ 509, 488, 2, 0 },
+		{ 510, 490, 2, 0 },
+		{ 511, 492, 2, 0 },
+		{ 512, 494, 2, 0 },
+		{ 513, 496, 2, 0 },
+		{ 514, 498, 2, 0 },
+		{ 515, 500, 2, 0 },
+		{ 516, 502, 2, 0 },
+		{ 517, 504, 2, 0 },
+		{ 518, 506, 2, 0 },
+		{ 519, 508, 2, 0 },
+		{ 520, 510, 2, 0 },
+		{ 521, 512, 2, 0 },
+		{ 522, 514, 2, 0 },
+		{ 523, 516, 2, 0 },
+		{ 524, 518, 2, 0 },
+		{ 525, 520, 2, 0 },
+		{ 526, 522, 2, 0 },
+		{ 527, 524, 2, 0 },
+		{ 528, 526, 2, 0 },
+		{ 529, 528, 2, 0 },
+		{ 530, 530, 2, 0 },
+		{ 531, 532, 2, 0 },
+		{ 532, 534, 2, 0 },
+		{ 533, 536, 2, 0 },
+		{ 534, 538, 2, 0 },
+		{ 535, 540, 2, 0 },
+		{ 536, 542, 2, 0 },
+		{ 537, 544, 2, 0 },
+		{ 538, 546, 2, 0 },
+		{ 539, 548, 2, 0 },
+		{ 542, 550, 2, 0 },
+		{ 543, 552, 2, 0 },
+		{ 550, 554, 2, 0 },
+		{ 551, 556, 2, 0 },
+		{ 552, 558, 2, 0 },
+		{ 553, 560, 2, 0 },
+		{ 554, 562, 3, 0 },
+		{ 555, 565, 3, 0 },
+		{ 556, 568, 3, 0 },
+		{ 557, 571, 3, 0 },
+		{ 558, 574, 2, 0 },
+		{ 559, 576, 2, 0 },
+		{ 560, 578, 3, 0 },
+		{ 561, 581, 3, 0 },
+		{ 562, 584, 2, 0 },
+		{ 563, 586, 2, 0 },
+		{ 688, 588, 0, 1 },
+		{ 689, 589, 0, 1 },
+		{ 690, 590, 0, 1 },
+		{ 691, 591, 0, 1 },
+		{ 692, 592, 0, 1 },
+		{ 693, 593, 0, 1 },
+		{ 694, 594, 0, 1 },
+		{ 695, 595, 0, 1 },
+		{ 696, 596, 0, 1 },
+		{ 728, 597, 0, 2 },
+		{ 729, 599, 0, 2 },
+		{ 730, 601, 0, 2 },
+		{ 731, 603, 0, 2 },
+		{ 732, 605, 0, 2 },
+		{ 733, 607, 0, 2 },
+		{ 736, 609, 0, 1 },
+		{ 737, 610, 0, 1 },
+		{ 738, 611, 0, 1 },
+		{ 739, 612, 0, 1 },
+		{ 740, 613, 0, 1 },
+		{ 832, 614, 1, 0 },
+		{ 833, 615, 1, 0 },
+		{ 835, 616, 1, 0 },
+		{ 836, 617, 2, 0 },
+		{ 884, 619, 1, 0 },
+		{ 890, 620, 0, 2 },
+		{ 894, 622, 1, 0 },
+		{ 900, 623, 0, 2 },
+		{ 901, 625, 2, 3 },
+		{ 902, 630, 2, 0 },
+		{ 903, 632, 1, 0 },
+		{ 904, 633, 2, 0 },
+		{ 905, 635, 2, 0 },
+		{ 906, 637, 2, 0 },
+		{ 908, 639, 2, 0 },
+		{ 910, 641, 2, 0 },
+		{ 911, 643, 2, 0 },
+		{ 912, 645, 3, 0 },
+		{ 938, 648, 2, 0 },
+		{ 939, 650, 2, 0 },
+		{ 940, 652, 2, 0 },
+		{ 941, 654, 2, 0 },
+		{ 942, 656, 2, 0 },
+		{ 943, 658, 2, 0 },
+		{ 944, 660, 3, 0 },
+		{ 970, 663, 2, 0 },
+		{ 971, 665, 2, 0 },
+		{ 972, 667, 2, 0 },
+		{ 973, 669, 2, 0 },
+		{ 974, 671, 2, 0 },
+		{ 976, 673, 0, 1 },
+		{ 977, 674, 0, 1 },
+		{ 978, 675, 0, 1 },
+		{ 979, 676, 2, 2 },
+		{ 980, 680, 2, 2 },
+		{ 981, 684, 0, 1 },
+		{ 982, 685, 0, 1 },
+		{ 1008, 686, 0, 1 },
+		{ 1009, 687, 0, 1 },
+		{ 1010, 688, 0, 1 },
+		{ 1012, 689, 0, 1 },
+		{ 1013, 690, 0, 1 },
+		{ 1017, 691, 0, 1 },
+		{ 1024, 692, 2, 0 },
+		{ 1025, 694, 2, 0 },
+		{ 1027, 696, 2, 0 },
+		{ 1031, 698, 2, 0 },
+		{ 1036, 700, 2, 0 },
+		{ 1037, 702, 2, 0 },
+		{ 1038, 704, 2, 0 },
+		{ 1049, 706, 2, 0 },
+		{ 1081, 708, 2, 0 },
+		{ 1104, 710, 2, 0 },
+		{ 1105, 712, 2, 0 },
+		{ 1107, 714, 2, 0 },
+		{ 1111, 716, 2, 0 },
+		{ 1116, 718, 2, 0 },
+		{ 1117, 720, 2, 0 },
+		{ 1118, 722, 2, 0 },
+		{ 1142, 724, 2, 0 },
+		{ 1143, 726, 2, 0 },
+		{ 1217, 728, 2, 0 },
+		{ 1218, 730, 2, 0 },
+		{ 1232, 732, 2, 0 },
+		{ 1233, 734, 2, 0 },
+		{ 1234, 736, 2, 0 },
+		{ 1235, 738, 2, 0 },
+		{ 1238, 740, 2, 0 },
+		{ 1239, 742, 2, 0 },
+		{ 1242, 744, 2, 0 },
+		{ 1243, 746, 2, 0 },
+		{ 1244, 748, 2, 0 },
+		{ 1245, 750, 2, 0 },
+		{ 1246, 752, 2, 0 },
+		{ 1247, 754, 2, 0 },
+		{ 1250, 756, 2, 0 },
+		{ 1251, 758, 2, 0 },
+		{ 1252, 760, 2, 0 },
+		{ 1253, 762, 2, 0 },
+		{ 1254, 764, 2, 0 },
+		{ 1255, 766, 2, 0 },
+		{ 1258, 768, 2, 0 },
+		{ 1259, 770, 2, 0 },
+		{ 1260, 772, 2, 0 },
+		{ 1261, 774, 2, 0 },
+		{ 1262, 776, 2, 0 },
+		{ 1263, 778, 2, 0 },
+		{ 1264, 780, 2, 0 },
+		{ 1265, 782, 2, 0 },
+		{ 1266, 784, 2, 0 },
+		{ 1267, 786, 2, 0 },
+		{ 1268, 788, 2, 0 },
+		{ 1269, 790, 2, 0 },
+		{ 1272, 792, 2, 0 },
+		{ 1273, 794, 2, 0 },
+		{ 1415, 796, 0, 2 },
+		{ 1570, 798, 2, 0 },
+		{ 1571, 800, 2, 0 },
+		{ 1572, 802, 2, 0 },
+		{ 1573, 804, 2, 0 },
+		{ 1574, 806, 2, 0 },
+		{ 1653, 808, 0, 2 },
+		{ 1654, 810, 0, 2 },
+		{ 1655, 812, 0, 2 },
+		{ 1656, 814, 0, 2 },
+		{ 1728, 816, 2, 0 },
+		{ 1730, 818, 2, 0 },
+		{ 1747, 820, 2, 0 },
+		{ 2345, 822, 2, 0 },
+		{ 2353, 824, 2, 0 },
+		{ 2356, 826, 2, 0 },
+		{ 2392, 828, 2, 0 },
+		{ 2393, 830, 2, 0 },
+		{ 2394, 832, 2, 0 },
+		{ 2395, 834, 2, 0 },
+		{ 2396, 836, 2, 0 },
+		{ 2397, 838, 2, 0 },
+		{ 2398, 840, 2, 0 },
+		{ 2399, 842, 2, 0 },
+		{ 2507, 844, 2, 0 },
+		{ 2508, 846, 2, 0 },
+		{ 2524, 848, 2, 0 },
+		{ 2525, 850, 2, 0 },
+		{ 2527, 852, 2, 0 },
+		{ 2611, 854, 2, 0 },
+		{ 2614, 856, 2, 0 },
+		{ 2649, 858, 2, 0 },
+		{ 2650, 860, 2, 0 },
+		{ 2651, 862, 2, 0 },
+		{ 2654, 864, 2, 0 },
+		{ 2888, 866, 2, 0 },
+		{ 2891, 868, 2, 0 },
+		{ 2892, 870, 2, 0 },
+		{ 2908, 872, 2, 0 },
+		{ 2909, 874, 2, 0 },
+		{ 2964, 876, 2, 0 },
+		{ 3018, 878, 2, 0 },
+		{ 3019, 880, 2, 0 },
+		{ 3020, 882, 2, 0 },
+		{ 3144, 884, 2, 0 },
+		{ 3264, 886, 2, 0 },
+		{ 3271, 888, 2, 0 },
+		{ 3272, 890, 2, 0 },
+		{ 3274, 892, 2, 0 },
+		{ 3275, 894, 3, 0 },
+		{ 3402, 897, 2, 0 },
+		{ 3403, 899, 2, 0 },
+		{ 3404, 901, 2, 0 },
+		{ 3546, 903, 2, 0 },
+		{ 3548, 905, 2, 0 },
+		{ 3549, 907, 3, 0 },
+		{ 3550, 910, 2, 0 },
+		{ 3635, 912, 0, 2 },
+		{ 3763, 914, 0, 2 },
+		{ 3804, 916, 0, 2 },
+		{ 3805, 918, 0, 2 },
+		{ 3852, 920, 0, 1 },
+		{ 3907, 921, 2, 0 },
+		{ 3917, 923, 2, 0 },
+		{ 3922, 925, 2, 0 },
+		{ 3927, 927, 2, 0 },
+		{ 3932, 929, 2, 0 },
+		{ 3945, 931, 2, 0 },
+		{ 3955, 933, 2, 0 },
+		{ 3957, 935, 2, 0 },
+		{ 3958, 937, 2, 0 },
+		{ 3959, 939, 0, 3 },
+		{ 3960, 942, 2, 0 },
+		{ 3961, 944, 0, 3 },
+		{ 3969, 947, 2, 0 },
+		{ 3987, 949, 2, 0 },
+		{ 3997, 951, 2, 0 },
+		{ 4002, 953, 2, 0 },
+		{ 4007, 955, 2, 0 },
+		{ 4012, 957, 2, 0 },
+		{ 4025, 959, 2, 0 },
+		{ 4134, 961, 2, 0 },
+		{ 4348, 963, 0, 1 },
+		{ 6918, 964, 2, 0 },
+		{ 6920, 966, 2, 0 },
+		{ 6922, 968, 2, 0 },
+		{ 6924, 970, 2, 0 },
+		{ 6926, 972, 2, 0 },
+		{ 6930, 974, 2, 0 },
+		{ 6971, 976, 2, 0 },
+		{ 6973, 978, 2, 0 },
+		{ 6976, 980, 2, 0 },
+		{ 6977, 982, 2, 0 },
+		{ 6979, 984, 2, 0 },
+		{ 7468, 986, 0, 1 },
+		{ 7469, 987, 0, 1 },
+		{ 7470, 988, 0, 1 },
+		{ 7472, 989, 0, 1 },
+		{ 7473, 990, 0, 1 },
+		{ 7474, 991, 0, 1 },
+		{ 7475, 992, 0, 1 },
+		{ 7476, 993, 0, 1 },
+		{ 7477, 994, 0, 1 },
+		{ 7478, 995, 0, 1 },
+		{ 7479, 996, 0, 1 },
+		{ 7480, 997, 0, 1 },
+		{ 7481, 998, 0, 1 },
+		{ 7482, 999, 0, 1 },
+		{ 7484, 1000, 0, 1 },
+		{ 7485, 1001, 0, 1 },
+		{ 7486, 1002, 0, 1 },
+		{ 7487, 1003, 0, 1 },
+		{ 7488, 1004, 0, 1 },
+		{ 7489, 1005, 0, 1 },
+		{ 7490, 1006, 0, 1 },
+		{ 7491, 1007, 0, 1 },
+		{ 7492, 1008, 0, 1 },
+		{ 7493, 1009, 0, 1 },
+		{ 7494, 1010, 0, 1 },
+		{ 7495, 1011, 0, 1 },
+		{ 7496, 1012, 0, 1 },
+		{ 7497, 1013, 0, 1 },
+		{ 7498, 1014, 0, 1 },
+		{ 7499, 1015, 0, 1 },
+		{ 7500, 1016, 0, 1 },
+		{ 7501, 1017, 0, 1 },
+		{ 7503, 1018, 0, 1 },
+		{ 7504, 1019, 0, 1 },
+		{ 7505, 1020, 0, 1 },
+		{ 7506, 1021, 0, 1 },
+		{ 7507, 1022, 0, 1 },
+		{ 7508, 1023, 0, 1 },
+		{ 7509, 1024, 0, 1 },
+		{ 7510, 1025, 0, 1 },
+		{ 7511, 1026, 0, 1 },
+		{ 7512, 1027, 0, 1 },
+		{ 7513, 1028, 0, 1 },
+		{ 7514, 1029, 0, 1 },
+		{ 7515, 1030, 0, 1 },
+		{ 7516, 1031, 0, 1 },
+		{ 7517, 1032, 0, 1 },
+		{ 7518, 1033, 0, 1 },
+		{ 7519, 1034, 0, 1 },
+		{ 7520, 1035, 0, 1 },
+		{ 7521, 1036, 0, 1 },
+		{ 7522, 1037, 0, 1 },
+		{ 7523, 1038, 0, 1 },
+		{ 7524, 1039, 0, 1 },
+		{ 7525, 1040, 0, 1 },
+		{ 7526, 1041, 0, 1 },
+		{ 7527, 1042, 0, 1 },
+		{ 7528, 1043, 0, 1 },
+		{ 7529, 1044, 0, 1 },
+		{ 7530, 1045, 0, 1 },
+		{ 7544, 1046, 0, 1 },
+		{ 7579, 1047, 0, 1 },
+		{ 7580, 1048, 0, 1 },
+		{ 7581, 1049, 0, 1 },
+		{ 7582, 1050, 0, 1 },
+		{ 7583, 1051, 0, 1 },
+		{ 7584, 1052, 0, 1 },
+		{ 7585, 1053, 0, 1 },
+		{ 7586, 1054, 0, 1 },
+		{ 7587, 1055, 0, 1 },
+		{ 7588, 1056, 0, 1 },
+		{ 7589, 1057, 0, 1 },
+		{ 7590, 1058, 0, 1 },
+		{ 7591, 1059, 0, 1 },
+		{ 7592, 1060, 0, 1 },
+		{ 7593, 1061, 0, 1 },
+		{ 7594, 1062, 0, 1 },
+		{ 7595, 1063, 0, 1 },
+		{ 7596, 1064, 0, 1 },
+		{ 7597, 1065, 0, 1 },
+		{ 7598, 1066, 0, 1 },
+		{ 7599, 1067, 0, 1 },
+		{ 7600, 1068, 0, 1 },
+		{ 7601, 1069, 0, 1 },
+		{ 7602, 1070, 0, 1 },
+		{ 7603, 1071, 0, 1 },
+		{ 7604, 1072, 0, 1 },
+		{ 7605, 1073, 0, 1 },
+		{ 7606, 1074, 0, 1 },
+		{ 7607, 1075, 0, 1 },
+		{ 7608, 1076, 0, 1 },
+		{ 7609, 1077, 0, 1 },
+		{ 7610, 1078, 0, 1 },
+		{ 7611, 1079, 0, 1 },
+		{ 7612, 1080, 0, 1 },
+		{ 7613, 1081, 0, 1 },
+		{ 7614, 1082, 0, 1 },
+		{ 7615, 1083, 0, 1 },
+		{ 7680, 1084, 2, 0 },
+		{ 7681, 1086, 2, 0 },
+		{ 7682, 1088, 2, 0 },
+		{ 7683, 1090, 2, 0 },
+		{ 7684, 1092, 2, 0 },
+		{ 7685, 1094, 2, 0 },
+		{ 7686, 1096, 2, 0 },
+		{ 7687, 1098, 2, 0 },
+		{ 7688, 1100, 3, 0 },
+		{ 7689, 1103, 3, 0 },
+		{ 7690, 1106, 2, 0 },
+		{ 7691, 1108, 2, 0 },
+		{ 7692, 1110, 2, 0 },
+		{ 7693, 1112, 2, 0 },
+		{ 7694, 1114, 2, 0 },
+		{ 7695, 1116, 2, 0 },
+		{ 7696, 1118, 2, 0 },
+		{ 7697, 1120, 2, 0 },
+		{ 7698, 1122, 2, 0 },
+		{ 7699, 1124, 2, 0 },
+		{ 7700, 1126, 3, 0 },
+		{ 7701, 1129, 3, 0 },
+		{ 7702, 1132, 3, 0 },
+		{ 7703, 1135, 3, 0 },
+		{ 7704, 1138, 2, 0 },
+		{ 7705, 1140, 2, 0 },
+		{ 7706, 1142, 2, 0 },
+		{ 7707, 1144, 2, 0 },
+		{ 7708, 1146, 3, 0 },
+		{ 7709, 1149, 3, 0 },
+		{ 7710, 1152, 2, 0 },
+		{ 7711, 1154, 2, 0 },
+		{ 7712, 1156, 2, 0 },
+		{ 7713, 1158, 2, 0 },
+		{ 7714, 1160, 2, 0 },
+		{ 7715, 1162, 2, 0 },
+		{ 7716, 1164, 2, 0 },
+		{ 7717, 1166, 2, 0 },
+		{ 7718, 1168, 2, 0 },
+		{ 7719, 1170, 2, 0 },
+		{ 7720, 1172, 2, 0 },
+		{ 7721, 1174, 2, 0 },
+		{ 7722, 1176, 2, 0 },
+		{ 7723, 1178, 2, 0 },
+		{ 7724, 1180, 2, 0 },
+		{ 7725, 1182, 2, 0 },
+		{ 7726, 1184, 3, 0 },
+		{ 7727, 1187, 3, 0 },
+		{ 7728, 1190, 2, 0 },
+		{ 7729, 1192, 2, 0 },
+		{ 7730, 1194, 2, 0 },
+		{ 7731, 1196, 2, 0 },
+		{ 7732, 1198, 2, 0 },
+		{ 7733, 1200, 2, 0 },
+		{ 7734, 1202, 2, 0 },
+		{ 7735, 1204, 2, 0 },
+		{ 7736, 1206, 3, 0 },
+		{ 7737, 1209, 3, 0 },
+		{ 7738, 1212, 2, 0 },
+		{ 7739, 1214, 2, 0 },
+		{ 7740, 1216, 2, 0 },
+		{ 7741, 1218, 2, 0 },
+		{ 7742, 1220, 2, 0 },
+		{ 7743, 1222, 2, 0 },
+		{ 7744, 1224, 2, 0 },
+		{ 7745, 1226, 2, 0 },
+		{ 7746, 1228, 2, 0 },
+		{ 7747, 1230, 2, 0 },
+		{ 7748, 1232, 2, 0 },
+		{ 7749, 1234, 2, 0 },
+		{ 7750, 1236, 2, 0 },
+		{ 7751, 1238, 2, 0 },
+		{ 7752, 1240, 2, 0 },
+		{ 7753, 1242, 2, 0 },
+		{ 7754, 1244, 2, 0 },
+		{ 7755, 1246, 2, 0 },
+		{ 7756, 1248, 3, 0 },
+		{ 7757, 1251, 3, 0 },
+		{ 7758, 1254, 3, 0 },
+		{ 7759, 1257, 3, 0 },
+		{ 7760, 1260, 3, 0 },
+		{ 7761, 1263, 3, 0 },
+		{ 7762, 1266, 3, 0 },
+		{ 7763, 1269, 3, 0 },
+		{ 7764, 1272, 2, 0 },
+		{ 7765, 1274, 2, 0 },
+		{ 7766, 1276, 2, 0 },
+		{ 7767, 1278, 2, 0 },
+		{ 7768, 1280, 2, 0 },
+		{ 7769, 1282, 2, 0 },
+		{ 7770, 1284, 2, 0 },
+		{ 7771, 1286, 2, 0 },
+		{ 7772, 1288, 3, 0 },
+		{ 7773, 1291, 3, 0 },
+		{ 7774, 1294, 2, 0 },
+		{ 7775, 1296, 2, 0 },
+		{ 7776, 1298, 2, 0 },
+		{ 7777, 1300, 2, 0 },
+		{ 7778, 1302, 2, 0 },
+		{ 7779, 1304, 2, 0 },
+		{ 7780, 1306, 3, 0 },
+		{ 7781, 1309, 3, 0 },
+		{ 7782, 1312, 3, 0 },
+		{ 7783, 1315, 3, 0 },
+		{ 7784, 1318, 3, 0 },
+		{ 7785, 1321, 3, 0 },
+		{ 7786, 1324, 2, 0 },
+		{ 7787, 1326, 2, 0 },
+		{ 7788, 1328, 2, 0 },
+		{ 7789, 1330, 2, 0 },
+		{ 7790, 1332, 2, 0 },
+		{ 7791, 1334, 2, 0 },
+		{ 7792, 1336, 2, 0 },
+		{ 7793, 1338, 2, 0 },
+		{ 7794, 1340, 2, 0 },
+		{ 7795, 1342, 2, 0 },
+		{ 7796, 1344, 2, 0 },
+		{ 7797, 1346, 2, 0 },
+		{ 7798, 1348, 2, 0 },
+		{ 7799, 1350, 2, 0 },
+		{ 7800, 1352, 3, 0 },
+		{ 7801, 1355, 3, 0 },
+		{ 7802, 1358, 3, 0 },
+		{ 7803, 1361, 3, 0 },
+		{ 7804, 1364, 2, 0 },
+		{ 7805, 1366, 2, 0 },
+		{ 7806, 1368, 2, 0 },
+		{ 7807, 1370, 2, 0 },
+		{ 7808, 1372, 2, 0 },
+		{ 7809, 1374, 2, 0 },
+		{ 7810, 1376, 2, 0 },
+		{ 7811, 1378, 2, 0 },
+		{ 7812, 1380, 2, 0 },
+		{ 7813, 1382, 2, 0 },
+		{ 7814, 1384, 2, 0 },
+		{ 7815, 1386, 2, 0 },
+		{ 7816, 1388, 2, 0 },
+		{ 7817, 1390, 2, 0 },
+		{ 7818, 1392, 2, 0 },
+		{ 7819, 1394, 2, 0 },
+		{ 7820, 1396, 2, 0 },
+		{ 7821, 1398, 2, 0 },
+		{ 7822, 1400, 2, 0 },
+		{ 7823, 1402, 2, 0 },
+		{ 7824, 1404, 2, 0 },
+		{ 7825, 1406, 2, 0 },
+		{ 7826, 1408, 2, 0 },
+		{ 7827, 1410, 2, 0 },
+		{ 7828, 1412, 2, 0 },
+		{ 7829, 1414, 2, 0 },
+		{ 7830, 1416, 2, 0 },
+		{ 7831, 1418, 2, 0 },
+		{ 7832, 1420, 2, 0 },
+		{ 7833, 1422, 2, 0 },
+		{ 7834, 1424, 0, 2 },
+		{ 7835, 1426, 2, 2 },
+		{ 7840, 1430, 2, 0 },
+		{ 7841, 1432, 2, 0 },
+		{ 7842, 1434, 2, 0 },
+		{ 7843, 1436, 2, 0 },
+		{ 7844, 1438, 3, 0 },
+		{ 7845, 1441, 3, 0 },
+		{ 7846, 1444, 3, 0 },
+		{ 7847, 1447, 3, 0 },
+		{ 7848, 1450, 3, 0 },
+		{ 7849, 1453, 3, 0 },
+		{ 7850, 1456, 3, 0 },
+		{ 7851, 1459, 3, 0 },
+		{ 7852, 1462, 3, 0 },
+		{ 7853, 1465, 3, 0 },
+		{ 7854, 1468, 3, 0 },
+		{ 7855, 1471, 3, 0 },
+		{ 7856, 1474, 3, 0 },
+		{ 7857, 1477, 3, 0 },
+		{ 7858, 1480, 3, 0 },
+		{ 7859, 1483, 3, 0 },
+		{ 7860, 1486, 3, 0 },
+		{ 7861, 1489, 3, 0 },
+		{ 7862, 1492, 3, 0 },
+		{ 7863, 1495, 3, 0 },
+		{ 7864, 1498, 2, 0 },
+		{ 7865, 1500, 2, 0 },
+		{ 7866, 1502, 2, 0 },
+		{ 7867, 1504, 2, 0 },
+		{ 7868, 1506, 2, 0 },
+		{ 7869, 1508, 2, 0 },
+		{ 7870, 1510, 3, 0 },
+		{ 7871, 1513, 3, 0 },
+		{ 7872, 1516, 3, 0 },
+		{ 7873, 1519, 3, 0 },
+		{ 7874, 1522, 3, 0 },
+		{ 7875, 1525, 3, 0 },
+		{ 7876, 1528, 3, 0 },
+		{ 7877, 1531, 3, 0 },
+		{ 7878, 1534, 3, 0 },
+		{ 7879, 1537, 3, 0 },
+		{ 7880, 1540, 2, 0 },
+		{ 7881, 1542, 2, 0 },
+		{ 7882, 1544, 2, 0 },
+		{ 7883, 1546, 2, 0 },
+		{ 7884, 1548, 2, 0 },
+		{ 7885, 1550, 2, 0 },
+		{ 7886, 1552, 2, 0 },
+		{ 7887, 1554, 2, 0 },
+		{ 7888, 1556, 3, 0 },
+		{ 7889, 1559, 3, 0 },
+		{ 7890, 1562, 3, 0 },
+		{ 7891, 1565, 3, 0 },
+		{ 7892, 1568, 3, 0 },
+		{ 7893, 1571, 3, 0 },
+		{ 7894, 1574, 3, 0 },
+		{ 7895, 1577, 3, 0 },
+		{ 7896, 1580, 3, 0 },
+		{ 7897, 1583, 3, 0 },
+		{ 7898, 1586, 3, 0 },
+		{ 7899, 1589, 3, 0 },
+		{ 7900, 1592, 3, 0 },
+		{ 7901, 1595, 3, 0 },
+		{ 7902, 1598, 3, 0 },
+		{ 7903, 1601, 3, 0 },
+		{ 7904, 1604, 3, 0 },
+		{ 7905, 1607, 3, 0 },
+		{ 7906, 1610, 3, 0 },
+		{ 7907, 1613, 3, 0 },
+		{ 7908, 1616, 2, 0 },
+		{ 7909, 1618, 2, 0 },
+		{ 7910, 1620, 2, 0 },
+		{ 7911, 1622, 2, 0 },
+		{ 7912, 1624, 3, 0 },
+		{ 7913, 1627, 3, 0 },
+		{ 7914, 1630, 3, 0 },
+		{ 7915, 1633, 3, 0 },
+		{ 7916, 1636, 3, 0 },
+		{ 7917, 1639, 3, 0 },
+		{ 7918, 1642, 3, 0 },
+		{ 7919, 1645, 3, 0 },
+		{ 7920, 1648, 3, 0 },
+		{ 7921, 1651, 3, 0 },
+		{ 7922, 1654, 2, 0 },
+		{ 7923, 1656, 2, 0 },
+		{ 7924, 1658, 2, 0 },
+		{ 7925, 1660, 2, 0 },
+		{ 7926, 1662, 2, 0 },
+		{ 7927, 1664, 2, 0 },
+		{ 7928, 1666, 2, 0 },
+		{ 7929, 1668, 2, 0 },
+		{ 7936, 1670, 2, 0 },
+		{ 7937, 1672, 2, 0 },
+		{ 7938, 1674, 3, 0 },
+		{ 7939, 1677, 3, 0 },
+		{ 7940, 1680, 3, 0 },
+		{ 7941, 1683, 3, 0 },
+		{ 7942, 1686, 3, 0 },
+		{ 7943, 1689, 3, 0 },
+		{ 7944, 1692, 2, 0 },
+		{ 7945, 1694, 2, 0 },
+		{ 7946, 1696, 3, 0 },
+		{ 7947, 1699, 3, 0 },
+		{ 7948, 1702, 3, 0 },
+		{ 7949, 1705, 3, 0 },
+		{ 7950, 1708, 3, 0 },
+		{ 7951, 1711, 3, 0 },
+		{ 7952, 1714, 2, 0 },
+		{ 7953, 1716, 2, 0 },
+		{ 7954, 1718, 3, 0 },
+		{ 7955, 1721, 3, 0 },
+		{ 7956, 1724, 3, 0 },
+		{ 7957, 1727, 3, 0 },
+		{ 7960, 1730, 2, 0 },
+		{ 7961, 1732, 2, 0 },
+		{ 7962, 1734, 3, 0 },
+		{ 7963, 1737, 3, 0 },
+		{ 7964, 1740, 3, 0 },
+		{ 7965, 1743, 3, 0 },
+		{ 7968, 1746, 2, 0 },
+		{ 7969, 1748, 2, 0 },
+		{ 7970, 1750, 3, 0 },
+		{ 7971, 1753, 3, 0 },
+		{ 7972, 1756, 3, 0 },
+		{ 7973, 1759, 3, 0 },
+		{ 7974, 1762, 3, 0 },
+		{ 7975, 1765, 3, 0 },
+		{ 7976, 1768, 2, 0 },
+		{ 7977, 1770, 2, 0 },
+		{ 7978, 1772, 3, 0 },
+		{ 7979, 1775, 3, 0 },
+		{ 7980, 1778, 3, 0 },
+		{ 7981, 1781, 3, 0 },
+		{ 7982, 1784, 3, 0 },
+		{ 7983, 1787, 3, 0 },
+		{ 7984, 1790, 2, 0 },
+		{ 7985, 1792, 2, 0 },
+		{ 7986, 1794, 3, 0 },
+		{ 7987, 1797, 3, 0 },
+		{ 7988, 1800, 3, 0 },
+		{ 7989, 1803, 3, 0 },
+		{ 7990, 1806, 3, 0 },
+		{ 7991, 1809, 3, 0 },
+		{ 7992, 1812, 2, 0 },
+		{ 7993, 1814, 2, 0 },
+		{ 7994, 1816, 3, 0 },
+		{ 7995, 1819, 3, 0 },
+		{ 7996, 1822, 3, 0 },
+		{ 7997, 1825, 3, 0 },
+		{ 7998, 1828, 3, 0 },
+		{ 7999, 1831, 3, 0 },
+		{ 8000, 1834, 2, 0 },
+		{ 8001, 1836, 2, 0 },
+		{ 8002, 1838, 3, 0 },
+		{ 8003, 1841, 3, 0 },
+		{ 8004, 1844, 3, 0 },
+		{ 8005, 1847, 3, 0 },
+		{ 8008, 1850, 2, 0 },
+		{ 8009, 1852, 2, 0 },
+		{ 8010, 1854, 3, 0 },
+		{ 8011, 1857, 3, 0 },
+		{ 8012, 1860, 3, 0 },
+		{ 8013, 1863, 3, 0 },
+		{ 8016, 1866, 2, 0 },
+		{ 8017, 1868, 2, 0 },
+		{ 8018, 1870, 3, 0 },
+		{ 8019, 1873, 3, 0 },
+		{ 8020, 1876, 3, 0 },
+		{ 8021, 1879, 3, 0 },
+		{ 8022, 1882, 3, 0 },
+		{ 8023, 1885, 3, 0 },
+		{ 8025, 1888, 2, 0 },
+		{ 8027, 1890, 3, 0 },
+		{ 8029, 1893, 3, 0 },
+		{ 8031, 1896, 3, 0 },
+		{ 8032, 1899, 2, 0 },
+		{ 8033, 1901, 2, 0 },
+		{ 8034, 1903, 3, 0 },
+		{ 8035, 1906, 3, 0 },
+		{ 8036, 1909, 3, 0 },
+		{ 8037, 1912, 3, 0 },
+		{ 8038, 1915, 3, 0 },
+		{ 8039, 1918, 3, 0 },
+		{ 8040, 1921, 2, 0 },
+		{ 8041, 1923, 2, 0 },
+		{ 8042, 1925, 3, 0 },
+		{ 8043, 1928, 3, 0 },
+		{ 8044, 1931, 3, 0 },
+		{ 8045, 1934, 3, 0 },
+		{ 8046, 1937, 3, 0 },
+		{ 8047, 1940, 3, 0 },
+		{ 8048, 1943, 2, 0 },
+		{ 8049, 1945, 2, 0 },
+		{ 8050, 1947, 2, 0 },
+		{ 8051, 1949, 2, 0 },
+		{ 8052, 1951, 2, 0 },
+		{ 8053, 1953, 2, 0 },
+		{ 8054, 1955, 2, 0 },
+		{ 8055, 1957, 2, 0 },
+		{ 8056, 1959, 2, 0 },
+		{ 8057, 1961, 2, 0 },
+		{ 8058, 1963, 2, 0 },
+		{ 8059, 1965, 2, 0 },
+		{ 8060, 1967, 2, 0 },
+		{ 8061, 1969, 2, 0 },
+		{ 8064, 1971, 3, 0 },
+		{ 8065, 1974, 3, 0 },
+		{ 8066, 1977, 4, 0 },
+		{ 8067, 1981, 4, 0 },
+		{ 8068, 1985, 4, 0 },
+		{ 8069, 1989, 4, 0 },
+		{ 8070, 1993, 4, 0 },
+		{ 8071, 1997, 4, 0 },
+		{ 8072, 2001, 3, 0 },
+		{ 8073, 2004, 3, 0 },
+		{ 8074, 2007, 4, 0 },
+		{ 8075, 2011, 4, 0 },
+		{ 8076, 2015, 4, 0 },
+		{ 8077, 2019, 4, 0 },
+		{ 8078, 2023, 4, 0 },
+		{ 8079, 2027, 4, 0 },
+		{ 8080, 2031, 3, 0 },
+		{ 8081, 2034, 3, 0 },
+		{ 8082, 2037, 4, 0 },
+		{ 8083, 2041, 4, 0 },
+		{ 8084, 2045, 4, 0 },
+		{ 8085, 2049, 4, 0 },
+		{ 8086, 2053, 4, 0 },
+		{ 8087, 2057, 4, 0 },
+		{ 8088, 2061, 3, 0 },
+		{ 8089, 2064, 3, 0 },
+		{ 8090, 2067, 4, 0 },
+		{ 8091, 2071, 4, 0 },
+		{ 8092, 2075, 4, 0 },
+		{ 8093, 2079, 4, 0 },
+		{ 8094, 2083, 4, 0 },
+		{ 8095, 2087, 4, 0 },
+		{ 8096, 2091, 3, 0 },
+		{ 8097, 2094, 3, 0 },
+		{ 8098, 2097, 4, 0 },
+		{ 8099, 2101, 4, 0 },
+		{ 8100, 2105, 4, 0 },
+		{ 8101, 2109, 4, 0 },
+		{ 8102, 2113, 4, 0 },
+		{ 8103, 2117, 4, 0 },
+		{ 8104, 2121, 3, 0 },
+		{ 8105, 2124, 3, 0 },
+		{ 8106, 2127, 4, 0 },
+		{ 8107, 2131, 4, 0 },
+		{ 8108, 2135, 4, 0 },
+		{ 8109, 2139, 4, 0 },
+		{ 8110, 2143, 4, 0 },
+		{ 8111, 2147, 4, 0 },
+		{ 8112, 2151, 2, 0 },
+		{ 8113, 2153, 2, 0 },
+		{ 8114, 2155, 3, 0 },
+		{ 8115, 2158, 2, 0 },
+		{ 8116, 2160, 3, 0 },
+		{ 8118, 2163, 2, 0 },
+		{ 8119, 2165, 3, 0 },
+		{ 8120, 2168, 2, 0 },
+		{ 8121, 2170, 2, 0 },
+		{ 8122, 2172, 2, 0 },
+		{ 8123, 2174, 2, 0 },
+		{ 8124, 2176, 2, 0 },
+		{ 8125, 2178, 0, 2 },
+		{ 8126, 2180, 1, 0 },
+		{ 8127, 2181, 0, 2 },
+		{ 8128, 2183, 0, 2 },
+		{ 8129, 2185, 2, 3 },
+		{ 8130, 2190, 3, 0 },
+		{ 8131, 2193, 2, 0 },
+		{ 8132, 2195, 3, 0 },
+		{ 8134, 2198, 2, 0 },
+		{ 8135, 2200, 3, 0 },
+		{ 8136, 2203, 2, 0 },
+		{ 8137, 2205, 2, 0 },
+		{ 8138, 2207, 2, 0 },
+		{ 8139, 2209, 2, 0 },
+		{ 8140, 2211, 2, 0 },
+		{ 8141, 2213, 2, 3 },
+		{ 8142, 2218, 2, 3 },
+		{ 8143, 2223, 2, 3 },
+		{ 8144, 2228, 2, 0 },
+		{ 8145, 2230, 2, 0 },
+		{ 8146, 2232, 3, 0 },
+		{ 8147, 2235, 3, 0 },
+		{ 8150, 2238, 2, 0 },
+		{ 8151, 2240, 3, 0 },
+		{ 8152, 2243, 2, 0 },
+		{ 8153, 2245, 2, 0 },
+		{ 8154, 2247, 2, 0 },
+		{ 8155, 2249, 2, 0 },
+		{ 8157, 2251, 2, 3 },
+		{ 8158, 2256, 2, 3 },
+		{ 8159, 2261, 2, 3 },
+		{ 8160, 2266, 2, 0 },
+		{ 8161, 2268, 2, 0 },
+		{ 8162, 2270, 3, 0 },
+		{ 8163, 2273, 3, 0 },
+		{ 8164, 2276, 2, 0 },
+		{ 8165, 2278, 2, 0 },
+		{ 8166, 2280, 2, 0 },
+		{ 8167, 2282, 3, 0 },
+		{ 8168, 2285, 2, 0 },
+		{ 8169, 2287, 2, 0 },
+		{ 8170, 2289, 2, 0 },
+		{ 8171, 2291, 2, 0 },
+		{ 8172, 2293, 2, 0 },
+		{ 8173, 2295, 2, 3 },
+		{ 8174, 2300, 2, 3 },
+		{ 8175, 2305, 1, 0 },
+		{ 8178, 2306, 3, 0 },
+		{ 8179, 2309, 2, 0 },
+		{ 8180, 2311, 3, 0 },
+		{ 8182, 2314, 2, 0 },
+		{ 8183, 2316, 3, 0 },
+		{ 8184, 2319, 2, 0 },
+		{ 8185, 2321, 2, 0 },
+		{ 8186, 2323, 2, 0 },
+		{ 8187, 2325, 2, 0 },
+		{ 8188, 2327, 2, 0 },
+		{ 8189, 2329, 1, 2 },
+		{ 8190, 2332, 0, 2 },
+		{ 8192, 2334, 1, 1 },
+		{ 8193, 2336, 1, 1 },
+		{ 8194, 2338, 0, 1 },
+		{ 8195, 2339, 0, 1 },
+		{ 8196, 2340, 0, 1 },
+		{ 8197, 2341, 0, 1 },
+		{ 8198, 2342, 0, 1 },
+		{ 8199, 2343, 0, 1 },
+		{ 8200, 2344, 0, 1 },
+		{ 8201, 2345, 0, 1 },
+		{ 8202, 2346, 0, 1 },
+		{ 8209, 2347, 0, 1 },
+		{ 8215, 2348, 0, 2 },
+		{ 8228, 2350, 0, 1 },
+		{ 8229, 2351, 0, 2 },
+		{ 8230, 2353, 0, 3 },
+		{ 8239, 2356, 0, 1 },
+		{ 8243, 2357, 0, 2 },
+		{ 8244, 2359, 0, 3 },
+		{ 8246, 2362, 0, 2 },
+		{ 8247, 2364, 0, 3 },
+		{ 8252, 2367, 0, 2 },
+		{ 8254, 2369, 0, 2 },
+		{ 8263, 2371, 0, 2 },
+		{ 8264, 2373, 0, 2 },
+		{ 8265, 2375, 0, 2 },
+		{ 8279, 2377, 0, 4 },
+		{ 8287, 2381, 0, 1 },
+		{ 8304, 2382, 0, 1 },
+		{ 8305, 2383, 0, 1 },
+		{ 8308, 2384, 0, 1 },
+		{ 8309, 2385, 0, 1 },
+		{ 8310, 2386, 0, 1 },
+		{ 8311, 2387, 0, 1 },
+		{ 8312, 2388, 0, 1 },
+		{ 8313, 2389, 0, 1 },
+		{ 8314, 2390, 0, 1 },
+		{ 8315, 2391, 0, 1 },
+		{ 8316, 2392, 0, 1 },
+		{ 8317, 2393, 0, 1 },
+		{ 8318, 2394, 0, 1 },
+		{ 8319, 2395, 0, 1 },
+		{ 8320, 2396, 0, 1 },
+		{ 8321, 2397, 0, 1 },
+		{ 8322, 2398, 0, 1 },
+		{ 8323, 2399, 0, 1 },
+		{ 8324, 2400, 0, 1 },
+		{ 8325, 2401, 0, 1 },
+		{ 8326, 2402, 0, 1 },
+		{ 8327, 2403, 0, 1 },
+		{ 8328, 2404, 0, 1 },
+		{ 8329, 2405, 0, 1 },
+		{ 8330, 2406, 0, 1 },
+		{ 8331, 2407, 0, 1 },
+		{ 8332, 2408, 0, 1 },
+		{ 8333, 2409, 0, 1 },
+		{ 8334, 2410, 0, 1 },
+		{ 8336, 2411, 0, 1 },
+		{ 8337, 2412, 0, 1 },
+		{ 8338, 2413, 0, 1 },
+		{ 8339, 2414, 0, 1 },
+		{ 8340, 2415, 0, 1 },
+		{ 8341, 2416, 0, 1 },
+		{ 8342, 2417, 0, 1 },
+		{ 8343, 2418, 0, 1 },
+		{ 8344, 2419, 0, 1 },
+		{ 8345, 2420, 0, 1 },
+		{ 8346, 2421, 0, 1 },
+		{ 8347, 2422, 0, 1 },
+		{ 8348, 2423, 0, 1 },
+		{ 8360, 2424, 0, 2 },
+		{ 8448, 2426, 0, 3 },
+		{ 8449, 2429, 0, 3 },
+		{ 8450, 2432, 0, 1 },
+		{ 8451, 2433, 0, 2 },
+		{ 8453, 2435, 0, 3 },
+		{ 8454, 2438, 0, 3 },
+		{ 8455, 2441, 0, 1 },
+		{ 8457, 2442, 0, 2 },
+		{ 8458, 2444, 0, 1 },
+		{ 8459, 2445, 0, 1 },
+		{ 8460, 2446, 0, 1 },
+		{ 8461, 2447, 0, 1 },
+		{ 8462, 2448, 0, 1 },
+		{ 8463, 2449, 0, 1 },
+		{ 8464, 2450, 0, 1 },
+		{ 8465, 2451, 0, 1 },
+		{ 8466, 2452, 0, 1 },
+		{ 8467, 2453, 0, 1 },
+		{ 8469, 2454, 0, 1 },
+		{ 8470, 2455, 0, 2 },
+		{ 8473, 2457, 0, 1 },
+		{ 8474, 2458, 0, 1 },
+		{ 8475, 2459, 0, 1 },
+		{ 8476, 2460, 0, 1 },
+		{ 8477, 2461, 0, 1 },
+		{ 8480, 2462, 0, 2 },
+		{ 8481, 2464, 0, 3 },
+		{ 8482, 2467, 0, 2 },
+		{ 8484, 2469, 0, 1 },
+		{ 8486, 2470, 1, 0 },
+		{ 8488, 2471, 0, 1 },
+		{ 8490, 2472, 1, 0 },
+		{ 8491, 2473, 2, 0 },
+		{ 8492, 2475, 0, 1 },
+		{ 8493, 2476, 0, 1 },
+		{ 8495, 2477, 0, 1 },
+		{ 8496, 2478, 0, 1 },
+		{ 8497, 2479, 0, 1 },
+		{ 8499, 2480, 0, 1 },
+		{ 8500, 2481, 0, 1 },
+		{ 8501, 2482, 0, 1 },
+		{ 8502, 2483, 0, 1 },
+		{ 8503, 2484, 0, 1 },
+		{ 8504, 2485, 0, 1 },
+		{ 8505, 2486, 0, 1 },
+		{ 8507, 2487, 0, 3 },
+		{ 8508, 2490, 0, 1 },
+		{ 8509, 2491, 0, 1 },
+		{ 8510, 2492, 0, 1 },
+		{ 8511, 2493, 0, 1 },
+		{ 8512, 2494, 0, 1 },
+		{ 8517, 2495, 0, 1 },
+		{ 8518, 2496, 0, 1 },
+		{ 8519, 2497, 0, 1 },
+		{ 8520, 2498, 0, 1 },
+		{ 8521, 2499, 0, 1 },
+		{ 8528, 2500, 0, 3 },
+		{ 8529, 2503, 0, 3 },
+		{ 8530, 2506, 0, 4 },
+		{ 8531, 2510, 0, 3 },
+		{ 8532, 2513, 0, 3 },
+		{ 8533, 2516, 0, 3 },
+		{ 8534, 2519, 0, 3 },
+		{ 8535, 2522, 0, 3 },
+		{ 8536, 2525, 0, 3 },
+		{ 8537, 2528, 0, 3 },
+		{ 8538, 2531, 0, 3 },
+		{ 8539, 2534, 0, 3 },
+		{ 8540, 2537, 0, 3 },
+		{ 8541, 2540, 0, 3 },
+		{ 8542, 2543, 0, 3 },
+		{ 8543, 2546, 0, 2 },
+		{ 8544, 2548, 0, 1 },
+		{ 8545, 2549, 0, 2 },
+		{ 8546, 2551, 0, 3 },
+		{ 8547, 2554, 0, 2 },
+		{ 8548, 2556, 0, 1 },
+		{ 8549, 2557, 0, 2 },
+		{ 8550, 2559, 0, 3 },
+		{ 8551, 2562, 0, 4 },
+		{ 8552, 2566, 0, 2 },
+		{ 8553, 2568, 0, 1 },
+		{ 8554, 2569, 0, 2 },
+		{ 8555, 2571, 0, 3 },
+		{ 8556, 2574, 0, 1 },
+		{ 8557, 2575, 0, 1 },
+		{ 8558, 2576, 0, 1 },
+		{ 8559, 2577, 0, 1 },
+		{ 8560, 2578, 0, 1 },
+		{ 8561, 2579, 0, 2 },
+		{ 8562, 2581, 0, 3 },
+		{ 8563, 2584, 0, 2 },
+		{ 8564, 2586, 0, 1 },
+		{ 8565, 2587, 0, 2 },
+		{ 8566, 2589, 0, 3 },
+		{ 8567, 2592, 0, 4 },
+		{ 8568, 2596, 0, 2 },
+		{ 8569, 2598, 0, 1 },
+		{ 8570, 2599, 0, 2 },
+		{ 8571, 2601, 0, 3 },
+		{ 8572, 2604, 0, 1 },
+		{ 8573, 2605, 0, 1 },
+		{ 8574, 2606, 0, 1 },
+		{ 8575, 2607, 0, 1 },
+		{ 8585, 2608, 0, 3 },
+		{ 8602, 2611, 2, 0 },
+		{ 8603, 2613, 2, 0 },
+		{ 8622, 2615, 2, 0 },
+		{ 8653, 2617, 2, 0 },
+		{ 8654, 2619, 2, 0 },
+		{ 8655, 2621, 2, 0 },
+		{ 8708, 2623, 2, 0 },
+		{ 8713, 2625, 2, 0 },
+		{ 8716, 2627, 2, 0 },
+		{ 8740, 2629, 2, 0 },
+		{ 8742, 2631, 2, 0 },
+		{ 8748, 2633, 0, 2 },
+		{ 8749, 2635, 0, 3 },
+		{ 8751, 2638, 0, 2 },
+		{ 8752, 2640, 0, 3 },
+		{ 8769, 2643, 2, 0 },
+		{ 8772, 2645, 2, 0 },
+		{ 8775, 2647, 2, 0 },
+		{ 8777, 2649, 2, 0 },
+		{ 8800, 2651, 2, 0 },
+		{ 8802, 2653, 2, 0 },
+		{ 8813, 2655, 2, 0 },
+		{ 8814, 2657, 2, 0 },
+		{ 8815, 2659, 2, 0 },
+		{ 8816, 2661, 2, 0 },
+		{ 8817, 2663, 2, 0 },
+		{ 8820, 2665, 2, 0 },
+		{ 8821, 2667, 2, 0 },
+		{ 8824, 2669, 2, 0 },
+		{ 8825, 2671, 2, 0 },
+		{ 8832, 2673, 2, 0 },
+		{ 8833, 2675, 2, 0 },
+		{ 8836, 2677, 2, 0 },
+		{ 8837, 2679, 2, 0 },
+		{ 8840, 2681, 2, 0 },
+		{ 8841, 2683, 2, 0 },
+		{ 8876, 2685, 2, 0 },
+		{ 8877, 2687, 2, 0 },
+		{ 8878, 2689, 2, 0 },
+		{ 8879, 2691, 2, 0 },
+		{ 8928, 2693, 2, 0 },
+		{ 8929, 2695, 2, 0 },
+		{ 8930, 2697, 2, 0 },
+		{ 8931, 2699, 2, 0 },
+		{ 8938, 2701, 2, 0 },
+		{ 8939, 2703, 2, 0 },
+		{ 8940, 2705, 2, 0 },
+		{ 8941, 2707, 2, 0 },
+		{ 9001, 2709, 1, 0 },
+		{ 9002, 2710, 1, 0 },
+		{ 9312, 2711, 0, 1 },
+		{ 9313, 2712, 0, 1 },
+		{ 9314, 2713, 0, 1 },
+		{ 9315, 2714, 0, 1 },
+		{ 9316, 2715, 0, 1 },
+		{ 9317, 2716, 0, 1 },
+		{ 9318, 2717, 0, 1 },
+		{ 9319, 2718, 0, 1 },
+		{ 9320, 2719, 0, 1 },
+		{ 9321, 2720, 0, 2 },
+		{ 9322, 2722, 0, 2 },
+		{ 9323, 2724, 0, 2 },
+		{ 9324, 2726, 0, 2 },
+		{ 9325, 2728, 0, 2 },
+		{ 9326, 2730, 0, 2 },
+		{ 9327, 2732, 0, 2 },
+		{ 9328, 2734, 0, 2 },
+		{ 9329, 2736, 0, 2 },
+		{ 9330, 2738, 0, 2 },
+		{ 9331, 2740, 0, 2 },
+		{ 9332, 2742, 0, 3 },
+		{ 9333, 2745, 0, 3 },
+		{ 9334, 2748, 0, 3 },
+		{ 9335, 2751, 0, 3 },
+		{ 9336, 2754, 0, 3 },
+		{ 9337, 2757, 0, 3 },
+		{ 9338, 2760, 0, 3 },
+		{ 9339, 2763, 0, 3 },
+		{ 9340, 2766, 0, 3 },
+		{ 9341, 2769, 0, 4 },
+		{ 9342, 2773, 0, 4 },
+		{ 9343, 2777, 0, 4 },
+		{ 9344, 2781, 0, 4 },
+		{ 9345, 2785, 0, 4 },
+		{ 9346, 2789, 0, 4 },
+		{ 9347, 2793, 0, 4 },
+		{ 9348, 2797, 0, 4 },
+		{ 9349, 2801, 0, 4 },
+		{ 9350, 2805, 0, 4 },
+		{ 9351, 2809, 0, 4 },
+		{ 9352, 2813, 0, 2 },
+		{ 9353, 2815, 0, 2 },
+		{ 9354, 2817, 0, 2 },
+		{ 9355, 2819, 0, 2 },
+		{ 9356, 2821, 0, 2 },
+		{ 9357, 2823, 0, 2 },
+		{ 9358, 2825, 0, 2 },
+		{ 9359, 2827, 0, 2 },
+		{ 9360, 2829, 0, 2 },
+		{ 9361, 2831, 0, 3 },
+		{ 9362, 2834, 0, 3 },
+		{ 9363, 2837, 0, 3 },
+		{ 9364, 2840, 0, 3 },
+		{ 9365, 2843, 0, 3 },
+		{ 9366, 2846, 0, 3 },
+		{ 9367, 2849, 0, 3 },
+		{ 9368, 2852, 0, 3 },
+		{ 9369, 2855, 0, 3 },
+		{ 9370, 2858, 0, 3 },
+		{ 9371, 2861, 0, 3 },
+		{ 9372, 2864, 0, 3 },
+		{ 9373, 2867, 0, 3 },
+		{ 9374, 2870, 0, 3 },
+		{ 9375, 2873, 0, 3 },
+		{ 9376, 2876, 0, 3 },
+		{ 9377, 2879, 0, 3 },
+		{ 9378, 2882, 0, 3 },
+		{ 9379, 2885, 0, 3 },
+		{ 9380, 2888, 0, 3 },
+		{ 9381, 2891, 0, 3 },
+		{ 9382, 2894, 0, 3 },
+		{ 9383, 2897, 0, 3 },
+		{ 9384, 2900, 0, 3 },
+		{ 9385, 2903, 0, 3 },
+		{ 9386, 2906, 0, 3 },
+		{ 9387, 2909, 0, 3 },
+		{ 9388, 2912, 0, 3 },
+		{ 9389, 2915, 0, 3 },
+		{ 9390, 2918, 0, 3 },
+		{ 9391, 2921, 0, 3 },
+		{ 9392, 2924, 0, 3 },
+		{ 9393, 2927, 0, 3 },
+		{ 9394, 2930, 0, 3 },
+		{ 9395, 2933, 0, 3 },
+		{ 9396, 2936, 0, 3 },
+		{ 9397, 2939, 0, 3 },
+		{ 9398, 2942, 0, 1 },
+		{ 9399, 2943, 0, 1 },
+		{ 9400, 2944, 0, 1 },
+		{ 9401, 2945, 0, 1 },
+		{ 9402, 2946, 0, 1 },
+		{ 9403, 2947, 0, 1 },
+		{ 9404, 2948, 0, 1 },
+		{ 9405, 2949, 0, 1 },
+		{ 9406, 2950, 0, 1 },
+		{ 9407, 2951, 0, 1 },
+		{ 9408, 2952, 0, 1 },
+		{ 9409, 2953, 0, 1 },
+		{ 9410, 2954, 0, 1 },
+		{ 9411, 2955, 0, 1 },
+		{ 9412, 2956, 0, 1 },
+		{ 9413, 2957, 0, 1 },
+		{ 9414, 2958, 0, 1 },
+		{ 9415, 2959, 0, 1 },
+		{ 9416, 2960, 0, 1 },
+		{ 9417, 2961, 0, 1 },
+		{ 9418, 2962, 0, 1 },
+		{ 9419, 2963, 0, 1 },
+		{ 9420, 2964, 0, 1 },
+		{ 9421, 2965, 0, 1 },
+		{ 9422, 2966, 0, 1 },
+		{ 9423, 2967, 0, 1 },
+		{ 9424, 2968, 0, 1 },
+		{ 9425, 2969, 0, 1 },
+		{ 9426, 2970, 0, 1 },
+		{ 9427, 2971, 0, 1 },
+		{ 9428, 2972, 0, 1 },
+		{ 9429, 2973, 0, 1 },
+		{ 9430, 2974, 0, 1 },
+		{ 9431, 2975, 0, 1 },
+		{ 9432, 2976, 0, 1 },
+		{ 9433, 2977, 0, 1 },
+		{ 9434, 2978, 0, 1 },
+		{ 9435, 2979, 0, 1 },
+		{ 9436, 2980, 0, 1 },
+		{ 9437, 2981, 0, 1 },
+		{ 9438, 2982, 0, 1 },
+		{ 9439, 2983, 0, 1 },
+		{ 9440, 2984, 0, 1 },
+		{ 9441, 2985, 0, 1 },
+		{ 9442, 2986, 0, 1 },
+		{ 9443, 2987, 0, 1 },
+		{ 9444, 2988, 0, 1 },
+		{ 9445, 2989, 0, 1 },
+		{ 9446, 2990, 0, 1 },
+		{ 9447, 2991, 0, 1 },
+		{ 9448, 2992, 0, 1 },
+		{ 9449, 2993, 0, 1 },
+		{ 9450, 2994, 0, 1 },
+		{ 10764, 2995, 0, 4 },
+		{ 10868, 2999, 0, 3 },
+		{ 10869, 3002, 0, 2 },
+		{ 10870, 3004, 0, 3 },
+		{ 10972, 3007, 2, 0 },
+		{ 11388, 3009, 0, 1 },
+		{ 11389, 3010, 0, 1 },
+		{ 11631, 3011, 0, 1 },
+		{ 11935, 3012, 0, 1 },
+		{ 12019, 3013, 0, 1 },
+		{ 12032, 3014, 0, 1 },
+		{ 12033, 3015, 0, 1 },
+		{ 12034, 3016, 0, 1 },
+		{ 12035, 3017, 0, 1 },
+		{ 12036, 3018, 0, 1 },
+		{ 12037, 3019, 0, 1 },
+		{ 12038, 3020, 0, 1 },
+		{ 12039, 3021, 0, 1 },
+		{ 12040, 3022, 0, 1 },
+		{ 12041, 3023, 0, 1 },
+		{ 12042, 3024, 0, 1 },
+		{ 12043, 3025, 0, 1 },
+		{ 12044, 3026, 0, 1 },
+		{ 12045, 3027, 0, 1 },
+		{ 12046, 3028, 0, 1 },
+		{ 12047, 3029, 0, 1 },
+		{ 12048, 3030, 0, 1 },
+		{ 12049, 3031, 0, 1 },
+		{ 12050, 3032, 0, 1 },
+		{ 12051, 3033, 0, 1 },
+		{ 12052, 3034, 0, 1 },
+		{ 12053, 3035, 0, 1 },
+		{ 12054, 3036, 0, 1 },
+		{ 12055, 3037, 0, 1 },
+		{ 12056, 3038, 0, 1 },
+		{ 12057, 3039, 0, 1 },
+		{ 12058, 3040, 0, 1 },
+		{ 12059, 3041, 0, 1 },
+		{ 12060, 3042, 0, 1 },
+		{ 12061, 3043, 0, 1 },
+		{ 12062, 3044, 0, 1 },
+		{ 12063, 3045, 0, 1 },
+		{ 12064, 3046, 0, 1 },
+		{ 12065, 3047, 0, 1 },
+		{ 12066, 3048, 0, 1 },
+		{ 12067, 3049, 0, 1 },
+		{ 12068, 3050, 0, 1 },
+		{ 12069, 3051, 0, 1 },
+		{ 12070, 3052, 0, 1 },
+		{ 12071, 3053, 0, 1 },
+		{ 12072, 3054, 0, 1 },
+		{ 12073, 3055, 0, 1 },
+		{ 12074, 3056, 0, 1 },
+		{ 12075, 3057, 0, 1 },
+		{ 12076, 3058, 0, 1 },
+		{ 12077, 3059, 0, 1 },
+		{ 12078, 3060, 0, 1 },
+		{ 12079, 3061, 0, 1 },
+		{ 12080, 3062, 0, 1 },
+		{ 12081, 3063, 0, 1 },
+		{ 12082, 3064, 0, 1 },
+		{ 12083, 3065, 0, 1 },
+		{ 12084, 3066, 0, 1 },
+		{ 12085, 3067, 0, 1 },
+		{ 12086, 3068, 0, 1 },
+		{ 12087, 3069, 0, 1 },
+		{ 12088, 3070, 0, 1 },
+		{ 12089, 3071, 0, 1 },
+		{ 12090, 3072, 0, 1 },
+		{ 12091, 3073, 0, 1 },
+		{ 12092, 3074, 0, 1 },
+		{ 12093, 3075, 0, 1 },
+		{ 12094, 3076, 0, 1 },
+		{ 12095, 3077, 0, 1 },
+		{ 12096, 3078, 0, 1 },
+		{ 12097, 3079, 0, 1 },
+		{ 12098, 3080, 0, 1 },
+		{ 12099, 3081, 0, 1 },
+		{ 12100, 3082, 0, 1 },
+		{ 12101, 3083, 0, 1 },
+		{ 12102, 3084, 0, 1 },
+		{ 12103, 3085, 0, 1 },
+		{ 12104, 3086, 0, 1 },
+		{ 12105, 3087, 0, 1 },
+		{ 12106, 3088, 0, 1 },
+		{ 12107, 3089, 0, 1 },
+		{ 12108, 3090, 0, 1 },
+		{ 12109, 3091, 0, 1 },
+		{ 12110, 3092, 0, 1 },
+		{ 12111, 3093, 0, 1 },
+		{ 12112, 3094, 0, 1 },
+		{ 12113, 3095, 0, 1 },
+		{ 12114, 3096, 0, 1 },
+		{ 12115, 3097, 0, 1 },
+		{ 12116, 3098, 0, 1 },
+		{ 12117, 3099, 0, 1 },
+		{ 12118, 3100, 0, 1 },
+		{ 12119, 3101, 0, 1 },
+		{ 12120, 3102, 0, 1 },
+		{ 12121, 3103, 0, 1 },
+		{ 12122, 3104, 0, 1 },
+		{ 12123, 3105, 0, 1 },
+		{ 12124, 3106, 0, 1 },
+		{ 12125, 3107, 0, 1 },
+		{ 12126, 3108, 0, 1 },
+		{ 12127, 3109, 0, 1 },
+		{ 12128, 3110, 0, 1 },
+		{ 12129, 3111, 0, 1 },
+		{ 12130, 3112, 0, 1 },
+		{ 12131, 3113, 0, 1 },
+		{ 12132, 3114, 0, 1 },
+		{ 12133, 3115, 0, 1 },
+		{ 12134, 3116, 0, 1 },
+		{ 12135, 3117, 0, 1 },
+		{ 12136, 3118, 0, 1 },
+		{ 12137, 3119, 0, 1 },
+		{ 12138, 3120, 0, 1 },
+		{ 12139, 3121, 0, 1 },
+		{ 12140, 3122, 0, 1 },
+		{ 12141, 3123, 0, 1 },
+		{ 12142, 3124, 0, 1 },
+		{ 12143, 3125, 0, 1 },
+		{ 12144, 3126, 0, 1 },
+		{ 12145, 3127, 0, 1 },
+		{ 12146, 3128, 0, 1 },
+		{ 12147, 3129, 0, 1 },
+		{ 12148, 3130, 0, 1 },
+		{ 12149, 3131, 0, 1 },
+		{ 12150, 3132, 0, 1 },
+		{ 12151, 3133, 0, 1 },
+		{ 12152, 3134, 0, 1 },
+		{ 12153, 3135, 0, 1 },
+		{ 12154, 3136, 0, 1 },
+		{ 12155, 3137, 0, 1 },
+		{ 12156, 3138, 0, 1 },
+		{ 12157, 3139, 0, 1 },
+		{ 12158, 3140, 0, 1 },
+		{ 12159, 3141, 0, 1 },
+		{ 12160, 3142, 0, 1 },
+		{ 12161, 3143, 0, 1 },
+		{ 12162, 3144, 0, 1 },
+		{ 12163, 3145, 0, 1 },
+		{ 12164, 3146, 0, 1 },
+		{ 12165, 3147, 0, 1 },
+		{ 12166, 3148, 0, 1 },
+		{ 12167, 3149, 0, 1 },
+		{ 12168, 3150, 0, 1 },
+		{ 12169, 3151, 0, 1 },
+		{ 12170, 3152, 0, 1 },
+		{ 12171, 3153, 0, 1 },
+		{ 12172, 3154, 0, 1 },
+		{ 12173, 3155, 0, 1 },
+		{ 12174, 3156, 0, 1 },
+		{ 12175, 3157, 0, 1 },
+		{ 12176, 3158, 0, 1 },
+		{ 12177, 3159, 0, 1 },
+		{ 12178, 3160, 0, 1 },
+		{ 12179, 3161, 0, 1 },
+		{ 12180, 3162, 0, 1 },
+		{ 12181, 3163, 0, 1 },
+		{ 12182, 3164, 0, 1 },
+		{ 12183, 3165, 0, 1 },
+		{ 12184, 3166, 0, 1 },
+		{ 12185, 3167, 0, 1 },
+		{ 12186, 3168, 0, 1 },
+		{ 12187, 3169, 0, 1 },
+		{ 12188, 3170, 0, 1 },
+		{ 12189, 3171, 0, 1 },
+		{ 12190, 3172, 0, 1 },
+		{ 12191, 3173, 0, 1 },
+		{ 12192, 3174, 0, 1 },
+		{ 12193, 3175, 0, 1 },
+		{ 12194, 3176, 0, 1 },
+		{ 12195, 3177, 0, 1 },
+		{ 12196, 3178, 0, 1 },
+		{ 12197, 3179, 0, 1 },
+		{ 12198, 3180, 0, 1 },
+		{ 12199, 3181, 0, 1 },
+		{ 12200, 3182, 0, 1 },
+		{ 12201, 3183, 0, 1 },
+		{ 12202, 3184, 0, 1 },
+		{ 12203, 3185, 0, 1 },
+		{ 12204, 3186, 0, 1 },
+		{ 12205, 3187, 0, 1 },
+		{ 12206, 3188, 0, 1 },
+		{ 12207, 3189, 0, 1 },
+		{ 12208, 3190, 0, 1 },
+		{ 12209, 3191, 0, 1 },
+		{ 12210, 3192, 0, 1 },
+		{ 12211, 3193, 0, 1 },
+		{ 12212, 3194, 0, 1 },
+		{ 12213, 3195, 0, 1 },
+		{ 12214, 3196, 0, 1 },
+		{ 12215, 3197, 0, 1 },
+		{ 12216, 3198, 0, 1 },
+		{ 12217, 3199, 0, 1 },
+		{ 12218, 3200, 0, 1 },
+		{ 12219, 3201, 0, 1 },
+		{ 12220, 3202, 0, 1 },
+		{ 12221, 3203, 0, 1 },
+		{ 12222, 3204, 0, 1 },
+		{ 12223, 3205, 0, 1 },
+		{ 12224, 3206, 0, 1 },
+		{ 12225, 3207, 0, 1 },
+		{ 12226, 3208, 0, 1 },
+		{ 12227, 3209, 0, 1 },
+		{ 12228, 3210, 0, 1 },
+		{ 12229, 3211, 0, 1 },
+		{ 12230, 3212, 0, 1 },
+		{ 12231, 3213, 0, 1 },
+		{ 12232, 3214, 0, 1 },
+		{ 12233, 3215, 0, 1 },
+		{ 12234, 3216, 0, 1 },
+		{ 12235, 3217, 0, 1 },
+		{ 12236, 3218, 0, 1 },
+		{ 12237, 3219, 0, 1 },
+		{ 12238, 3220, 0, 1 },
+		{ 12239, 3221, 0, 1 },
+		{ 12240, 3222, 0, 1 },
+		{ 12241, 3223, 0, 1 },
+		{ 12242, 3224, 0, 1 },
+		{ 12243, 3225, 0, 1 },
+		{ 12244, 3226, 0, 1 },
+		{ 12245, 3227, 0, 1 },
+		{ 12288, 3228, 0, 1 },
+		{ 12342, 3229, 0, 1 },
+		{ 12344, 3230, 0, 1 },
+		{ 12345, 3231, 0, 1 },
+		{ 12346, 3232, 0, 1 },
+		{ 12364, 3233, 2, 0 },
+		{ 12366, 3235, 2, 0 },
+		{ 12368, 3237, 2, 0 },
+		{ 12370, 3239, 2, 0 },
+		{ 12372, 3241, 2, 0 },
+		{ 12374, 3243, 2, 0 },
+		{ 12376, 3245, 2, 0 },
+		{ 12378, 3247, 2, 0 },
+		{ 12380, 3249, 2, 0 },
+		{ 12382, 3251, 2, 0 },
+		{ 12384, 3253, 2, 0 },
+		{ 12386, 3255, 2, 0 },
+		{ 12389, 3257, 2, 0 },
+		{ 12391, 3259, 2, 0 },
+		{ 12393, 3261, 2, 0 },
+		{ 12400, 3263, 2, 0 },
+		{ 12401, 3265, 2, 0 },
+		{ 12403, 3267, 2, 0 },
+		{ 12404, 3269, 2, 0 },
+		{ 12406, 3271, 2, 0 },
+		{ 12407, 3273, 2, 0 },
+		{ 12409, 3275, 2, 0 },
+		{ 12410, 3277, 2, 0 },
+		{ 12412, 3279, 2, 0 },
+		{ 12413, 3281, 2, 0 },
+		{ 12436, 3283, 2, 0 },
+		{ 12443, 3285, 0, 2 },
+		{ 12444, 3287, 0, 2 },
+		{ 12446, 3289, 2, 0 },
+		{ 12447, 3291, 0, 2 },
+		{ 12460, 3293, 2, 0 },
+		{ 12462, 3295, 2, 0 },
+		{ 12464, 3297, 2, 0 },
+		{ 12466, 3299, 2, 0 },
+		{ 12468, 3301, 2, 0 },
+		{ 12470, 3303, 2, 0 },
+		{ 12472, 3305, 2, 0 },
+		{ 12474, 3307, 2, 0 },
+		{ 12476, 3309, 2, 0 },
+		{ 12478, 3311, 2, 0 },
+		{ 12480, 3313, 2, 0 },
+		{ 12482, 3315, 2, 0 },
+		{ 12485, 3317, 2, 0 },
+		{ 12487, 3319, 2, 0 },
+		{ 12489, 3321, 2, 0 },
+		{ 12496, 3323, 2, 0 },
+		{ 12497, 3325, 2, 0 },
+		{ 12499, 3327, 2, 0 },
+		{ 12500, 3329, 2, 0 },
+		{ 12502, 3331, 2, 0 },
+		{ 12503, 3333, 2, 0 },
+		{ 12505, 3335, 2, 0 },
+		{ 12506, 3337, 2, 0 },
+		{ 12508, 3339, 2, 0 },
+		{ 12509, 3341, 2, 0 },
+		{ 12532, 3343, 2, 0 },
+		{ 12535, 3345, 2, 0 },
+		{ 12536, 3347, 2, 0 },
+		{ 12537, 3349, 2, 0 },
+		{ 12538, 3351, 2, 0 },
+		{ 12542, 3353, 2, 0 },
+		{ 12543, 3355, 0, 2 },
+		{ 12593, 3357, 0, 1 },
+		{ 12594, 3358, 0, 1 },
+		{ 12595, 3359, 0, 1 },
+		{ 12596, 3360, 0, 1 },
+		{ 12597, 3361, 0, 1 },
+		{ 12598, 3362, 0, 1 },
+		{ 12599, 3363, 0, 1 },
+		{ 12600, 3364, 0, 1 },
+		{ 12601, 3365, 0, 1 },
+		{ 12602, 3366, 0, 1 },
+		{ 12603, 3367, 0, 1 },
+		{ 12604, 3368, 0, 1 },
+		{ 12605, 3369, 0, 1 },
+		{ 12606, 3370, 0, 1 },
+		{ 12607, 3371, 0, 1 },
+		{ 12608, 3372, 0, 1 },
+		{ 12609, 3373, 0, 1 },
+		{ 12610, 3374, 0, 1 },
+		{ 12611, 3375, 0, 1 },
+		{ 12612, 3376, 0, 1 },
+		{ 12613, 3377, 0, 1 },
+		{ 12614, 3378, 0, 1 },
+		{ 12615, 3379, 0, 1 },
+		{ 12616, 3380, 0, 1 },
+		{ 12617, 3381, 0, 1 },
+		{ 12618, 3382, 0, 1 },
+		{ 12619, 3383, 0, 1 },
+		{ 12620, 3384, 0, 1 },
+		{ 12621, 3385, 0, 1 },
+		{ 12622, 3386, 0, 1 },
+		{ 12623, 3387, 0, 1 },
+		{ 12624, 3388, 0, 1 },
+		{ 12625, 3389, 0, 1 },
+		{ 12626, 3390, 0, 1 },
+		{ 12627, 3391, 0, 1 },
+		{ 12628, 3392, 0, 1 },
+		{ 12629, 3393, 0, 1 },
+		{ 12630, 3394, 0, 1 },
+		{ 12631, 3395, 0, 1 },
+		{ 12632, 3396, 0, 1 },
+		{ 12633, 3397, 0, 1 },
+		{ 12634, 3398, 0, 1 },
+		{ 12635, 3399, 0, 1 },
+		{ 12636, 3400, 0, 1 },
+		{ 12637, 3401, 0, 1 },
+		{ 12638, 3402, 0, 1 },
+		{ 12639, 3403, 0, 1 },
+		{ 12640, 3404, 0, 1 },
+		{ 12641, 3405, 0, 1 },
+		{ 12642, 3406, 0, 1 },
+		{ 12643, 3407, 0, 1 },
+		{ 12644, 3408, 0, 1 },
+		{ 12645, 3409, 0, 1 },
+		{ 12646, 3410, 0, 1 },
+		{ 12647, 3411, 0, 1 },
+		{ 12648, 3412, 0, 1 },
+		{ 12649, 3413, 0, 1 },
+		{ 12650, 3414, 0, 1 },
+		{ 12651, 3415, 0, 1 },
+		{ 12652, 3416, 0, 1 },
+		{ 12653, 3417, 0, 1 },
+		{ 12654, 3418, 0, 1 },
+		{ 12655, 3419, 0, 1 },
+		{ 12656, 3420, 0, 1 },
+		{ 12657, 3421, 0, 1 },
+		{ 12658, 3422, 0, 1 },
+		{ 12659, 3423, 0, 1 },
+		{ 12660, 3424, 0, 1 },
+		{ 12661, 3425, 0, 1 },
+		{ 12662, 3426, 0, 1 },
+		{ 12663, 3427, 0, 1 },
+		{ 12664, 3428, 0, 1 },
+		{ 12665, 3429, 0, 1 },
+		{ 12666, 3430, 0, 1 },
+		{ 12667, 3431, 0, 1 },
+		{ 12668, 3432, 0, 1 },
+		{ 12669, 3433, 0, 1 },
+		{ 12670, 3434, 0, 1 },
+		{ 12671, 3435, 0, 1 },
+		{ 12672, 3436, 0, 1 },
+		{ 12673, 3437, 0, 1 },
+		{ 12674, 3438, 0, 1 },
+		{ 12675, 3439, 0, 1 },
+		{ 12676, 3440, 0, 1 },
+		{ 12677, 3441, 0, 1 },
+		{ 12678, 3442, 0, 1 },
+		{ 12679, 3443, 0, 1 },
+		{ 12680, 3444, 0, 1 },
+		{ 12681, 3445, 0, 1 },
+		{ 12682, 3446, 0, 1 },
+		{ 12683, 3447, 0, 1 },
+		{ 12684, 3448, 0, 1 },
+		{ 12685, 3449, 0, 1 },
+		{ 12686, 3450, 0, 1 },
+		{ 12690, 3451, 0, 1 },
+		{ 12691, 3452, 0, 1 },
+		{ 12692, 3453, 0, 1 },
+		{ 12693, 3454, 0, 1 },
+		{ 12694, 3455, 0, 1 },
+		{ 12695, 3456, 0, 1 },
+		{ 12696, 3457, 0, 1 },
+		{ 12697, 3458, 0, 1 },
+		{ 12698, 3459, 0, 1 },
+		{ 12699, 3460, 0, 1 },
+		{ 12700, 3461, 0, 1 },
+		{ 12701, 3462, 0, 1 },
+		{ 12702, 3463, 0, 1 },
+		{ 12703, 3464, 0, 1 },
+		{ 12800, 3465, 0, 3 },
+		{ 12801, 3468, 0, 3 },
+		{ 12802, 3471, 0, 3 },
+		{ 12803, 3474, 0, 3 },
+		{ 12804, 3477, 0, 3 },
+		{ 12805, 3480, 0, 3 },
+		{ 12806, 3483, 0, 3 },
+		{ 12807, 3486, 0, 3 },
+		{ 12808, 3489, 0, 3 },
+		{ 12809, 3492, 0, 3 },
+		{ 12810, 3495, 0, 3 },
+		{ 12811, 3498, 0, 3 },
+		{ 12812, 3501, 0, 3 },
+		{ 12813, 3504, 0, 3 },
+		{ 12814, 3507, 0, 4 },
+		{ 12815, 3511, 0, 4 },
+		{ 12816, 3515, 0, 4 },
+		{ 12817, 3519, 0, 4 },
+		{ 12818, 3523, 0, 4 },
+		{ 12819, 3527, 0, 4 },
+		{ 12820, 3531, 0, 4 },
+		{ 12821, 3535, 0, 4 },
+		{ 12822, 3539, 0, 4 },
+		{ 12823, 3543, 0, 4 },
+		{ 12824, 3547, 0, 4 },
+		{ 12825, 3551, 0, 4 },
+		{ 12826, 3555, 0, 4 },
+		{ 12827, 3559, 0, 4 },
+		{ 12828, 3563, 0, 4 },
+		{ 12829, 3567, 0, 7 },
+		{ 12830, 3574, 0, 6 },
+		{ 12832, 3580, 0, 3 },
+		{ 12833, 3583, 0, 3 },
+		{ 12834, 3586, 0, 3 },
+		{ 12835, 3589, 0, 3 },
+		{ 12836, 3592, 0, 3 },
+		{ 12837, 3595, 0, 3 },
+		{ 12838, 3598, 0, 3 },
+		{ 12839, 3601, 0, 3 },
+		{ 12840, 3604, 0, 3 },
+		{ 12841, 3607, 0, 3 },
+		{ 12842, 3610, 0, 3 },
+		{ 12843, 3613, 0, 3 },
+		{ 12844, 3616, 0, 3 },
+		{ 12845, 3619, 0, 3 },
+		{ 12846, 3622, 0, 3 },
+		{ 12847, 3625, 0, 3 },
+		{ 12848, 3628, 0, 3 },
+		{ 12849, 3631, 0, 3 },
+		{ 12850, 3634, 0, 3 },
+		{ 12851, 3637, 0, 3 },
+		{ 12852, 3640, 0, 3 },
+		{ 12853, 3643, 0, 3 },
+		{ 12854, 3646, 0, 3 },
+		{ 12855, 3649, 0, 3 },
+		{ 12856, 3652, 0, 3 },
+		{ 12857, 3655, 0, 3 },
+		{ 12858, 3658, 0, 3 },
+		{ 12859, 3661, 0, 3 },
+		{ 12860, 3664, 0, 3 },
+		{ 12861, 3667, 0, 3 },
+		{ 12862, 3670, 0, 3 },
+		{ 12863, 3673, 0, 3 },
+		{ 12864, 3676, 0, 3 },
+		{ 12865, 3679, 0, 3 },
+		{ 12866, 3682, 0, 3 },
+		{ 12867, 3685, 0, 3 },
+		{ 12868, 3688, 0, 1 },
+		{ 12869, 3689, 0, 1 },
+		{ 12870, 3690, 0, 1 },
+		{ 12871, 3691, 0, 1 },
+		{ 12880, 3692, 0, 3 },
+		{ 12881, 3695, 0, 2 },
+		{ 12882, 3697, 0, 2 },
+		{ 12883, 3699, 0, 2 },
+		{ 12884, 3701, 0, 2 },
+		{ 12885, 3703, 0, 2 },
+		{ 12886, 3705, 0, 2 },
+		{ 12887, 3707, 0, 2 },
+		{ 12888, 3709, 0, 2 },
+		{ 12889, 3711, 0, 2 },
+		{ 12890, 3713, 0, 2 },
+		{ 12891, 3715, 0, 2 },
+		{ 12892, 3717, 0, 2 },
+		{ 12893, 3719, 0, 2 },
+		{ 12894, 3721, 0, 2 },
+		{ 12895, 3723, 0, 2 },
+		{ 12896, 3725, 0, 1 },
+		{ 12897, 3726, 0, 1 },
+		{ 12898, 3727, 0, 1 },
+		{ 12899, 3728, 0, 1 },
+		{ 12900, 3729, 0, 1 },
+		{ 12901, 3730, 0, 1 },
+		{ 12902, 3731, 0, 1 },
+		{ 12903, 3732, 0, 1 },
+		{ 12904, 3733, 0, 1 },
+		{ 12905, 3734, 0, 1 },
+		{ 12906, 3735, 0, 1 },
+		{ 12907, 3736, 0, 1 },
+		{ 12908, 3737, 0, 1 },
+		{ 12909, 3738, 0, 1 },
+		{ 12910, 3739, 0, 2 },
+		{ 12911, 3741, 0, 2 },
+		{ 12912, 3743, 0, 2 },
+		{ 12913, 3745, 0, 2 },
+		{ 12914, 3747, 0, 2 },
+		{ 12915, 3749, 0, 2 },
+		{ 12916, 3751, 0, 2 },
+		{ 12917, 3753, 0, 2 },
+		{ 12918, 3755, 0, 2 },
+		{ 12919, 3757, 0, 2 },
+		{ 12920, 3759, 0, 2 },
+		{ 12921, 3761, 0, 2 },
+		{ 12922, 3763, 0, 2 },
+		{ 12923, 3765, 0, 2 },
+		{ 12924, 3767, 0, 5 },
+		{ 12925, 3772, 0, 4 },
+		{ 12926, 3776, 0, 2 },
+		{ 12928, 3778, 0, 1 },
+		{ 12929, 3779, 0, 1 },
+		{ 12930, 3780, 0, 1 },
+		{ 12931, 3781, 0, 1 },
+		{ 12932, 3782, 0, 1 },
+		{ 12933, 3783, 0, 1 },
+		{ 12934, 3784, 0, 1 },
+		{ 12935, 3785, 0, 1 },
+		{ 12936, 3786, 0, 1 },
+		{ 12937, 3787, 0, 1 },
+		{ 12938, 3788, 0, 1 },
+		{ 12939, 3789, 0, 1 },
+		{ 12940, 3790, 0, 1 },
+		{ 12941, 3791, 0, 1 },
+		{ 12942, 3792, 0, 1 },
+		{ 12943, 3793, 0, 1 },
+		{ 12944, 3794, 0, 1 },
+		{ 12945, 3795, 0, 1 },
+		{ 12946, 3796, 0, 1 },
+		{ 12947, 3797, 0, 1 },
+		{ 12948, 3798, 0, 1 },
+		{ 12949, 3799, 0, 1 },
+		{ 12950, 3800, 0, 1 },
+		{ 12951, 3801, 0, 1 },
+		{ 12952, 3802, 0, 1 },
+		{ 12953, 3803, 0, 1 },
+		{ 12954, 3804, 0, 1 },
+		{ 12955, 3805, 0, 1 },
+		{ 12956, 3806, 0, 1 },
+		{ 12957, 3807, 0, 1 },
+		{ 12958, 3808, 0, 1 },
+		{ 12959, 3809, 0, 1 },
+		{ 12960, 3810, 0, 1 },
+		{ 12961, 3811, 0, 1 },
+		{ 12962, 3812, 0, 1 },
+		{ 12963, 3813, 0, 1 },
+		{ 12964, 3814, 0, 1 },
+		{ 12965, 3815, 0, 1 },
+		{ 12966, 3816, 0, 1 },
+		{ 12967, 3817, 0, 1 },
+		{ 12968, 3818, 0, 1 },
+		{ 12969, 3819, 0, 1 },
+		{ 12970, 3820, 0, 1 },
+		{ 12971, 3821, 0, 1 },
+		{ 12972, 3822, 0, 1 },
+		{ 12973, 3823, 0, 1 },
+		{ 12974, 3824, 0, 1 },
+		{ 12975, 3825, 0, 1 },
+		{ 12976, 3826, 0, 1 },
+		{ 12977, 3827, 0, 2 },
+		{ 12978, 3829, 0, 2 },
+		{ 12979, 3831, 0, 2 },
+		{ 12980, 3833, 0, 2 },
+		{ 12981, 3835, 0, 2 },
+		{ 12982, 3837, 0, 2 },
+		{ 12983, 3839, 0, 2 },
+		{ 12984, 3841, 0, 2 },
+		{ 12985, 3843, 0, 2 },
+		{ 12986, 3845, 0, 2 },
+		{ 12987, 3847, 0, 2 },
+		{ 12988, 3849, 0, 2 },
+		{ 12989, 3851, 0, 2 },
+		{ 12990, 3853, 0, 2 },
+		{ 12991, 3855, 0, 2 },
+		{ 12992, 3857, 0, 2 },
+		{ 12993, 3859, 0, 2 },
+		{ 12994, 3861, 0, 2 },
+		{ 12995, 3863, 0, 2 },
+		{ 12996, 3865, 0, 2 },
+		{ 12997, 3867, 0, 2 },
+		{ 12998, 3869, 0, 2 },
+		{ 12999, 3871, 0, 2 },
+		{ 13000, 3873, 0, 2 },
+		{ 13001, 3875, 0, 3 },
+		{ 13002, 3878, 0, 3 },
+		{ 13003, 3881, 0, 3 },
+		{ 13004, 3884, 0, 2 },
+		{ 13005, 3886, 0, 3 },
+		{ 13006, 3889, 0, 2 },
+		{ 13007, 3891, 0, 3 },
+		{ 13008, 3894, 0, 1 },
+		{ 13009, 3895, 0, 1 },
+		{ 13010, 3896, 0, 1 },
+		{ 13011, 3897, 0, 1 },
+		{ 13012, 3898, 0, 1 },
+		{ 13013, 3899, 0, 1 },
+		{ 13014, 3900, 0, 1 },
+		{ 13015, 3901, 0, 1 },
+		{ 13016, 3902, 0, 1 },
+		{ 13017, 3903, 0, 1 },
+		{ 13018, 3904, 0, 1 },
+		{ 13019, 3905, 0, 1 },
+		{ 13020, 3906, 0, 1 },
+		{ 13021, 3907, 0, 1 },
+		{ 13022, 3908, 0, 1 },
+		{ 13023, 3909, 0, 1 },
+		{ 13024, 3910, 0, 1 },
+		{ 13025, 3911, 0, 1 },
+		{ 13026, 3912, 0, 1 },
+		{ 13027, 3913, 0, 1 },
+		{ 13028, 3914, 0, 1 },
+		{ 13029, 3915, 0, 1 },
+		{ 13030, 3916, 0, 1 },
+		{ 13031, 3917, 0, 1 },
+		{ 13032, 3918, 0, 1 },
+		{ 13033, 3919, 0, 1 },
+		{ 13034, 3920, 0, 1 },
+		{ 13035, 3921, 0, 1 },
+		{ 13036, 3922, 0, 1 },
+		{ 13037, 3923, 0, 1 },
+		{ 13038, 3924, 0, 1 },
+		{ 13039, 3925, 0, 1 },
+		{ 13040, 3926, 0, 1 },
+		{ 13041, 3927, 0, 1 },
+		{ 13042, 3928, 0, 1 },
+		{ 13043, 3929, 0, 1 },
+		{ 13044, 3930, 0, 1 },
+		{ 13045, 3931, 0, 1 },
+		{ 13046, 3932, 0, 1 },
+		{ 13047, 3933, 0, 1 },
+		{ 13048, 3934, 0, 1 },
+		{ 13049, 3935, 0, 1 },
+		{ 13050, 3936, 0, 1 },
+		{ 13051, 3937, 0, 1 },
+		{ 13052, 3938, 0, 1 },
+		{ 13053, 3939, 0, 1 },
+		{ 13054, 3940, 0, 1 },
+		{ 13055, 3941, 0, 2 },
+		{ 13056, 3943, 0, 5 },
+		{ 13057, 3948, 0, 4 },
+		{ 13058, 3952, 0, 5 },
+		{ 13059, 3957, 0, 3 },
+		{ 13060, 3960, 0, 5 },
+		{ 13061, 3965, 0, 3 },
+		{ 13062, 3968, 0, 3 },
+		{ 13063, 3971, 0, 6 },
+		{ 13064, 3977, 0, 4 },
+		{ 13065, 3981, 0, 3 },
+		{ 13066, 3984, 0, 3 },
+		{ 13067, 3987, 0, 3 },
+		{ 13068, 3990, 0, 4 },
+		{ 13069, 3994, 0, 4 },
+		{ 13070, 3998, 0, 4 },
+		{ 13071, 4002, 0, 4 },
+		{ 13072, 4006, 0, 4 },
+		{ 13073, 4010, 0, 4 },
+		{ 13074, 4014, 0, 4 },
+		{ 13075, 4018, 0, 6 },
+		{ 13076, 4024, 0, 2 },
+		{ 13077, 4026, 0, 6 },
+		{ 13078, 4032, 0, 6 },
+		{ 13079, 4038, 0, 5 },
+		{ 13080, 4043, 0, 4 },
+		{ 13081, 4047, 0, 6 },
+		{ 13082, 4053, 0, 6 },
+		{ 13083, 4059, 0, 4 },
+		{ 13084, 4063, 0, 3 },
+		{ 13085, 4066, 0, 3 },
+		{ 13086, 4069, 0, 4 },
+		{ 13087, 4073, 0, 4 },
+		{ 13088, 4077, 0, 5 },
+		{ 13089, 4082, 0, 5 },
+		{ 13090, 4087, 0, 3 },
+		{ 13091, 4090, 0, 3 },
+		{ 13092, 4093, 0, 4 },
+		{ 13093, 4097, 0, 3 },
+		{ 13094, 4100, 0, 3 },
+		{ 13095, 4103, 0, 2 },
+		{ 13096, 4105, 0, 2 },
+		{ 13097, 4107, 0, 3 },
+		{ 13098, 4110, 0, 3 },
+		{ 13099, 4113, 0, 6 },
+		{ 13100, 4119, 0, 4 },
+		{ 13101, 4123, 0, 5 },
+		{ 13102, 4128, 0, 6 },
+		{ 13103, 4134, 0, 4 },
+		{ 13104, 4138, 0, 3 },
+		{ 13105, 4141, 0, 3 },
+		{ 13106, 4144, 0, 6 },
+		{ 13107, 4150, 0, 4 },
+		{ 13108, 4154, 0, 6 },
+		{ 13109, 4160, 0, 3 },
+		{ 13110, 4163, 0, 5 },
+		{ 13111, 4168, 0, 3 },
+		{ 13112, 4171, 0, 4 },
+		{ 13113, 4175, 0, 3 },
+		{ 13114, 4178, 0, 4 },
+		{ 13115, 4182, 0, 5 },
+		{ 13116, 4187, 0, 4 },
+		{ 13117, 4191, 0, 5 },
+		{ 13118, 4196, 0, 4 },
+		{ 13119, 4200, 0, 2 },
+		{ 13120, 4202, 0, 5 },
+		{ 13121, 4207, 0, 3 },
+		{ 13122, 4210, 0, 3 },
+		{ 13123, 4213, 0, 4 },
+		{ 13124, 4217, 0, 3 },
+		{ 13125, 4220, 0, 3 },
+		{ 13126, 4223, 0, 3 },
+		{ 13127, 4226, 0, 5 },
+		{ 13128, 4231, 0, 4 },
+		{ 13129, 4235, 0, 2 },
+		{ 13130, 4237, 0, 6 },
+		{ 13131, 4243, 0, 3 },
+		{ 13132, 4246, 0, 5 },
+		{ 13133, 4251, 0, 4 },
+		{ 13134, 4255, 0, 4 },
+		{ 13135, 4259, 0, 3 },
+		{ 13136, 4262, 0, 3 },
+		{ 13137, 4265, 0, 4 },
+		{ 13138, 4269, 0, 2 },
+		{ 13139, 4271, 0, 4 },
+		{ 13140, 4275, 0, 5 },
+		{ 13141, 4280, 0, 2 },
+		{ 13142, 4282, 0, 6 },
+		{ 13143, 4288, 0, 3 },
+		{ 13144, 4291, 0, 2 },
+		{ 13145, 4293, 0, 2 },
+		{ 13146, 4295, 0, 2 },
+		{ 13147, 4297, 0, 2 },
+		{ 13148, 4299, 0, 2 },
+		{ 13149, 4301, 0, 2 },
+		{ 13150, 4303, 0, 2 },
+		{ 13151, 4305, 0, 2 },
+		{ 13152, 4307, 0, 2 },
+		{ 13153, 4309, 0, 2 },
+		{ 13154, 4311, 0, 3 },
+		{ 13155, 4314, 0, 3 },
+		{ 13156, 4317, 0, 3 },
+		{ 13157, 4320, 0, 3 },
+		{ 13158, 4323, 0, 3 },
+		{ 13159, 4326, 0, 3 },
+		{ 13160, 4329, 0, 3 },
+		{ 13161, 4332, 0, 3 },
+		{ 13162, 4335, 0, 3 },
+		{ 13163, 4338, 0, 3 },
+		{ 13164, 4341, 0, 3 },
+		{ 13165, 4344, 0, 3 },
+		{ 13166, 4347, 0, 3 },
+		{ 13167, 4350, 0, 3 },
+		{ 13168, 4353, 0, 3 },
+		{ 13169, 4356, 0, 3 },
+		{ 13170, 4359, 0, 2 },
+		{ 13171, 4361, 0, 2 },
+		{ 13172, 4363, 0, 3 },
+		{ 13173, 4366, 0, 2 },
+		{ 13174, 4368, 0, 2 },
+		{ 13175, 4370, 0, 2 },
+		{ 13176, 4372, 0, 3 },
+		{ 13177, 4375, 0, 3 },
+		{ 13178, 4378, 0, 2 },
+		{ 13179, 4380, 0, 2 },
+		{ 13180, 4382, 0, 2 },
+		{ 13181, 4384, 0, 2 },
+		{ 13182, 4386, 0, 2 },
+		{ 13183, 4388, 0, 4 },
+		{ 13184, 4392, 0, 2 },
+		{ 13185, 4394, 0, 2 },
+		{ 13186, 4396, 0, 2 },
+		{ 13187, 4398, 0, 2 },
+		{ 13188, 4400, 0, 2 },
+		{ 13189, 4402, 0, 2 },
+		{ 13190, 4404, 0, 2 },
+		{ 13191, 4406, 0, 2 },
+		{ 13192, 4408, 0, 3 },
+		{ 13193, 4411, 0, 4 },
+		{ 13194, 4415, 0, 2 },
+		{ 13195, 4417, 0, 2 },
+		{ 13196, 4419, 0, 2 },
+		{ 13197, 4421, 0, 2 },
+		{ 13198, 4423, 0, 2 },
+		{ 13199, 4425, 0, 2 },
+		{ 13200, 4427, 0, 2 },
+		{ 13201, 4429, 0, 3 },
+		{ 13202, 4432, 0, 3 },
+		{ 13203, 4435, 0, 3 },
+		{ 13204, 4438, 0, 3 },
+		{ 13205, 4441, 0, 2 },
+		{ 13206, 4443, 0, 2 },
+		{ 13207, 4445, 0, 2 },
+		{ 13208, 4447, 0, 2 },
+		{ 13209, 4449, 0, 2 },
+		{ 13210, 4451, 0, 2 },
+		{ 13211, 4453, 0, 2 },
+		{ 13212, 4455, 0, 2 },
+		{ 13213, 4457, 0, 2 },
+		{ 13214, 4459, 0, 2 },
+		{ 13215, 4461, 0, 3 },
+		{ 13216, 4464, 0, 3 },
+		{ 13217, 4467, 0, 2 },
+		{ 13218, 4469, 0, 3 },
+		{ 13219, 4472, 0, 3 },
+		{ 13220, 4475, 0, 3 },
+		{ 13221, 4478, 0, 2 },
+		{ 13222, 4480, 0, 3 },
+		{ 13223, 4483, 0, 3 },
+		{ 13224, 4486, 0, 4 },
+		{ 13225, 4490, 0, 2 },
+		{ 13226, 4492, 0, 3 },
+		{ 13227, 4495, 0, 3 },
+		{ 13228, 4498, 0, 3 },
+		{ 13229, 4501, 0, 3 },
+		{ 13230, 4504, 0, 5 },
+		{ 13231, 4509, 0, 6 },
+		{ 13232, 4515, 0, 2 },
+		{ 13233, 4517, 0, 2 },
+		{ 13234, 4519, 0, 2 },
+		{ 13235, 4521, 0, 2 },
+		{ 13236, 4523, 0, 2 },
+		{ 13237, 4525, 0, 2 },
+		{ 13238, 4527, 0, 2 },
+		{ 13239, 4529, 0, 2 },
+		{ 13240, 4531, 0, 2 },
+		{ 13241, 4533, 0, 2 },
+		{ 13242, 4535, 0, 2 },
+		{ 13243, 4537, 0, 2 },
+		{ 13244, 4539, 0, 2 },
+		{ 13245, 4541, 0, 2 },
+		{ 13246, 4543, 0, 2 },
+		{ 13247, 4545, 0, 2 },
+		{ 13248, 4547, 0, 2 },
+		{ 13249, 4549, 0, 2 },
+		{ 13250, 4551, 0, 4 },
+		{ 13251, 4555, 0, 2 },
+		{ 13252, 4557, 0, 2 },
+		{ 13253, 4559, 0, 2 },
+		{ 13254, 4561, 0, 4 },
+		{ 13255, 4565, 0, 3 },
+		{ 13256, 4568, 0, 2 },
+		{ 13257, 4570, 0, 2 },
+		{ 13258, 4572, 0, 2 },
+		{ 13259, 4574, 0, 2 },
+		{ 13260, 4576, 0, 2 },
+		{ 13261, 4578, 0, 2 },
+		{ 13262, 4580, 0, 2 },
+		{ 13263, 4582, 0, 2 },
+		{ 13264, 4584, 0, 2 },
+		{ 13265, 4586, 0, 2 },
+		{ 13266, 4588, 0, 3 },
+		{ 13267, 4591, 0, 2 },
+		{ 13268, 4593, 0, 2 },
+		{ 13269, 4595, 0, 3 },
+		{ 13270, 4598, 0, 3 },
+		{ 13271, 4601, 0, 2 },
+		{ 13272, 4603, 0, 4 },
+		{ 13273, 4607, 0, 3 },
+		{ 13274, 4610, 0, 2 },
+		{ 13275, 4612, 0, 2 },
+		{ 13276, 4614, 0, 2 },
+		{ 13277, 4616, 0, 2 },
+		{ 13278, 4618, 0, 3 },
+		{ 13279, 4621, 0, 3 },
+		{ 13280, 4624, 0, 2 },
+		{ 13281, 4626, 0, 2 },
+		{ 13282, 4628, 0, 2 },
+		{ 13283, 4630, 0, 2 },
+		{ 13284, 4632, 0, 2 },
+		{ 13285, 4634, 0, 2 },
+		{ 13286, 4636, 0, 2 },
+		{ 13287, 4638, 0, 2 },
+		{ 13288, 4640, 0, 2 },
+		{ 13289, 4642, 0, 3 },
+		{ 13290, 4645, 0, 3 },
+		{ 13291, 4648, 0, 3 },
+		{ 13292, 4651, 0, 3 },
+		{ 13293, 4654, 0, 3 },
+		{ 13294, 4657, 0, 3 },
+		{ 13295, 4660, 0, 3 },
+		{ 13296, 4663, 0, 3 },
+		{ 13297, 4666, 0, 3 },
+		{ 13298, 4669, 0, 3 },
+		{ 13299, 4672, 0, 3 },
+		{ 13300, 4675, 0, 3 },
+		{ 13301, 4678, 0, 3 },
+		{ 13302, 4681, 0, 3 },
+		{ 13303, 4684, 0, 3 },
+		{ 13304, 4687, 0, 3 },
+		{ 13305, 4690, 0, 3 },
+		{ 13306, 4693, 0, 3 },
+		{ 13307, 4696, 0, 3 },
+		{ 13308, 4699, 0, 3 },
+		{ 13309, 4702, 0, 3 },
+		{ 13310, 4705, 0, 3 },
+		{ 13311, 4708, 0, 3 },
+		{ 42652, 4711, 0, 1 },
+		{ 42653, 4712, 0, 1 },
+		{ 42864, 4713, 0, 1 },
+		{ 42994, 4714, 0, 1 },
+		{ 42995, 4715, 0, 1 },
+		{ 42996, 4716, 0, 1 },
+		{ 43000, 4717, 0, 1 },
+		{ 43001, 4718, 0, 1 },
+		{ 43868, 4719, 0, 1 },
+		{ 43869, 4720, 0, 1 },
+		{ 43870, 4721, 0, 1 },
+		{ 43871, 4722, 0, 1 },
+		{ 43881, 4723, 0, 1 },
+		{ 63744, 4724, 1, 0 },
+		{ 63745, 4725, 1, 0 },
+		{ 63746, 4726, 1, 0 },
+		{ 63747, 4727, 1, 0 },
+		{ 63748, 4728, 1, 0 },
+		{ 63749, 4729, 1, 0 },
+		{ 63750, 4730, 1, 0 },
+		{ 63751, 4731, 1, 0 },
+		{ 63752, 4732, 1, 0 },
+		{ 63753, 4733, 1, 0 },
+		{ 63754, 4734, 1, 0 },
+		{ 63755, 4735, 1, 0 },
+		{ 63756, 4736, 1, 0 },
+		{ 63757, 4737, 1, 0 },
+		{ 63758, 4738, 1, 0 },
+		{ 63759, 4739, 1, 0 },
+		{ 63760, 4740, 1, 0 },
+		{ 63761, 4741, 1, 0 },
+		{ 63762, 4742, 1, 0 },
+		{ 63763, 4743, 1, 0 },
+		{ 63764, 4744, 1, 0 },
+		{ 63765, 4745, 1, 0 },
+		{ 63766, 4746, 1, 0 },
+		{ 63767, 4747, 1, 0 },
+		{ 63768, 4748, 1, 0 },
+		{ 63769, 4749, 1, 0 },
+		{ 63770, 4750, 1, 0 },
+		{ 63771, 4751, 1, 0 },
+		{ 63772, 4752, 1, 0 },
+		{ 63773, 4753, 1, 0 },
+		{ 63774, 4754, 1, 0 },
+		{ 63775, 4755, 1, 0 },
+		{ 63776, 4756, 1, 0 },
+		{ 63777, 4757, 1, 0 },
+		{ 63778, 4758, 1, 0 },
+		{ 63779, 4759, 1, 0 },
+		{ 63780, 4760, 1, 0 },
+		{ 63781, 4761, 1, 0 },
+		{ 63782, 4762, 1, 0 },
+		{ 63783, 4763, 1, 0 },
+		{ 63784, 4764, 1, 0 },
+		{ 63785, 4765, 1, 0 },
+		{ 63786, 4766, 1, 0 },
+		{ 63787, 4767, 1, 0 },
+		{ 63788, 4768, 1, 0 },
+		{ 63789, 4769, 1, 0 },
+		{ 63790, 4770, 1, 0 },
+		{ 63791, 4771, 1, 0 },
+		{ 63792, 4772, 1, 0 },
+		{ 63793, 4773, 1, 0 },
+		{ 63794, 4774, 1, 0 },
+		{ 63795, 4775, 1, 0 },
+		{ 63796, 4776, 1, 0 },
+		{ 63797, 4777, 1, 0 },
+		{ 63798, 4778, 1, 0 },
+		{ 63799, 4779, 1, 0 },
+		{ 63800, 4780, 1, 0 },
+		{ 63801, 4781, 1, 0 },
+		{ 63802, 4782, 1, 0 },
+		{ 63803, 4783, 1, 0 },
+		{ 63804, 4784, 1, 0 },
+		{ 63805, 4785, 1, 0 },
+		{ 63806, 4786, 1, 0 },
+		{ 63807, 4787, 1, 0 },
+		{ 63808, 4788, 1, 0 },
+		{ 63809, 4789, 1, 0 },
+		{ 63810, 4790, 1, 0 },
+		{ 63811, 4791, 1, 0 },
+		{ 63812, 4792, 1, 0 },
+		{ 63813, 4793, 1, 0 },
+		{ 63814, 4794, 1, 0 },
+		{ 63815, 4795, 1, 0 },
+		{ 63816, 4796, 1, 0 },
+		{ 63817, 4797, 1, 0 },
+		{ 63818, 4798, 1, 0 },
+		{ 63819, 4799, 1, 0 },
+		{ 63820, 4800, 1, 0 },
+		{ 63821, 4801, 1, 0 },
+		{ 63822, 4802, 1, 0 },
+		{ 63823, 4803, 1, 0 },
+		{ 63824, 4804, 1, 0 },
+		{ 63825, 4805, 1, 0 },
+		{ 63826, 4806, 1, 0 },
+		{ 63827, 4807, 1, 0 },
+		{ 63828, 4808, 1, 0 },
+		{ 63829, 4809, 1, 0 },
+		{ 63830, 4810, 1, 0 },
+		{ 63831, 4811, 1, 0 },
+		{ 63832, 4812, 1, 0 },
+		{ 63833, 4813, 1, 0 },
+		{ 63834, 4814, 1, 0 },
+		{ 63835, 4815, 1, 0 },
+		{ 63836, 4816, 1, 0 },
+		{ 63837, 4817, 1, 0 },
+		{ 63838, 4818, 1, 0 },
+		{ 63839, 4819, 1, 0 },
+		{ 63840, 4820, 1, 0 },
+		{ 63841, 4821, 1, 0 },
+		{ 63842, 4822, 1, 0 },
+		{ 63843, 4823, 1, 0 },
+		{ 63844, 4824, 1, 0 },
+		{ 63845, 4825, 1, 0 },
+		{ 63846, 4826, 1, 0 },
+		{ 63847, 4827, 1, 0 },
+		{ 63848, 4828, 1, 0 },
+		{ 63849, 4829, 1, 0 },
+		{ 63850, 4830, 1, 0 },
+		{ 63851, 4831, 1, 0 },
+		{ 63852, 4832, 1, 0 },
+		{ 63853, 4833, 1, 0 },
+		{ 63854, 4834, 1, 0 },
+		{ 63855, 4835, 1, 0 },
+		{ 63856, 4836, 1, 0 },
+		{ 63857, 4837, 1, 0 },
+		{ 63858, 4838, 1, 0 },
+		{ 63859, 4839, 1, 0 },
+		{ 63860, 4840, 1, 0 },
+		{ 63861, 4841, 1, 0 },
+		{ 63862, 4842, 1, 0 },
+		{ 63863, 4843, 1, 0 },
+		{ 63864, 4844, 1, 0 },
+		{ 63865, 4845, 1, 0 },
+		{ 63866, 4846, 1, 0 },
+		{ 63867, 4847, 1, 0 },
+		{ 63868, 4848, 1, 0 },
+		{ 63869, 4849, 1, 0 },
+		{ 63870, 4850, 1, 0 },
+		{ 63871, 4851, 1, 0 },
+		{ 63872, 4852, 1, 0 },
+		{ 63873, 4853, 1, 0 },
+		{ 63874, 4854, 1, 0 },
+		{ 63875, 4855, 1, 0 },
+		{ 63876, 4856, 1, 0 },
+		{ 63877, 4857, 1, 0 },
+		{ 63878, 4858, 1, 0 },
+		{ 63879, 4859, 1, 0 },
+		{ 63880, 4860, 1, 0 },
+		{ 63881, 4861, 1, 0 },
+		{ 63882, 4862, 1, 0 },
+		{ 63883, 4863, 1, 0 },
+		{ 63884, 4864, 1, 0 },
+		{ 63885, 4865, 1, 0 },
+		{ 63886, 4866, 1, 0 },
+		{ 63887, 4867, 1, 0 },
+		{ 63888, 4868, 1, 0 },
+		{ 63889, 4869, 1, 0 },
+		{ 63890, 4870, 1, 0 },
+		{ 63891, 4871, 1, 0 },
+		{ 63892, 4872, 1, 0 },
+		{ 63893, 4873, 1, 0 },
+		{ 63894, 4874, 1, 0 },
+		{ 63895, 4875, 1, 0 },
+		{ 63896, 4876, 1, 0 },
+		{ 63897, 4877, 1, 0 },
+		{ 63898, 4878, 1, 0 },
+		{ 63899, 4879, 1, 0 },
+		{ 63900, 4880, 1, 0 },
+		{ 63901, 4881, 1, 0 },
+		{ 63902, 4882, 1, 0 },
+		{ 63903, 4883, 1, 0 },
+		{ 63904, 4884, 1, 0 },
+		{ 63905, 4885, 1, 0 },
+		{ 63906, 4886, 1, 0 },
+		{ 63907, 4887, 1, 0 },
+		{ 63908, 4888, 1, 0 },
+		{ 63909, 4889, 1, 0 },
+		{ 63910, 4890, 1, 0 },
+		{ 63911, 4891, 1, 0 },
+		{ 63912, 4892, 1, 0 },
+		{ 63913, 4893, 1, 0 },
+		{ 63914, 4894, 1, 0 },
+		{ 63915, 4895, 1, 0 },
+		{ 63916, 4896, 1, 0 },
+		{ 63917, 4897, 1, 0 },
+		{ 63918, 4898, 1, 0 },
+		{ 63919, 4899, 1, 0 },
+		{ 63920, 4900, 1, 0 },
+		{ 63921, 4901, 1, 0 },
+		{ 63922, 4902, 1, 0 },
+		{ 63923, 4903, 1, 0 },
+		{ 63924, 4904, 1, 0 },
+		{ 63925, 4905, 1, 0 },
+		{ 63926, 4906, 1, 0 },
+		{ 63927, 4907, 1, 0 },
+		{ 63928, 4908, 1, 0 },
+		{ 63929, 4909, 1, 0 },
+		{ 63930, 4910, 1, 0 },
+		{ 63931, 4911, 1, 0 },
+		{ 63932, 4912, 1, 0 },
+		{ 63933, 4913, 1, 0 },
+		{ 63934, 4914, 1, 0 },
+		{ 63935, 4915, 1, 0 },
+		{ 63936, 4916, 1, 0 },
+		{ 63937, 4917, 1, 0 },
+		{ 63938, 4918, 1, 0 },
+		{ 63939, 4919, 1, 0 },
+		{ 63940, 4920, 1, 0 },
+		{ 63941, 4921, 1, 0 },
+		{ 63942, 4922, 1, 0 },
+		{ 63943, 4923, 1, 0 },
+		{ 63944, 4924, 1, 0 },
+		{ 63945, 4925, 1, 0 },
+		{ 63946, 4926, 1, 0 },
+		{ 63947, 4927, 1, 0 },
+		{ 63948, 4928, 1, 0 },
+		{ 63949, 4929, 1, 0 },
+		{ 63950, 4930, 1, 0 },
+		{ 63951, 4931, 1, 0 },
+		{ 63952, 4932, 1, 0 },
+		{ 63953, 4933, 1, 0 },
+		{ 63954, 4934, 1, 0 },
+		{ 63955, 4935, 1, 0 },
+		{ 63956, 4936, 1, 0 },
+		{ 63957, 4937, 1, 0 },
+		{ 63958, 4938, 1, 0 },
+		{ 63959, 4939, 1, 0 },
+		{ 63960, 4940, 1, 0 },
+		{ 63961, 4941, 1, 0 },
+		{ 63962, 4942, 1, 0 },
+		{ 63963, 4943, 1, 0 },
+		{ 63964, 4944, 1, 0 },
+		{ 63965, 4945, 1, 0 },
+		{ 63966, 4946, 1, 0 },
+		{ 63967, 4947, 1, 0 },
+		{ 63968, 4948, 1, 0 },
+		{ 63969, 4949, 1, 0 },
+		{ 63970, 4950, 1, 0 },
+		{ 63971, 4951, 1, 0 },
+		{ 63972, 4952, 1, 0 },
+		{ 63973, 4953, 1, 0 },
+		{ 63974, 4954, 1, 0 },
+		{ 63975, 4955, 1, 0 },
+		{ 63976, 4956, 1, 0 },
+		{ 63977, 4957, 1, 0 },
+		{ 63978, 4958, 1, 0 },
+		{ 63979, 4959, 1, 0 },
+		{ 63980, 4960, 1, 0 },
+		{ 63981, 4961, 1, 0 },
+		{ 63982, 4962, 1, 0 },
+		{ 63983, 4963, 1, 0 },
+		{ 63984, 4964, 1, 0 },
+		{ 63985, 4965, 1, 0 },
+		{ 63986, 4966, 1, 0 },
+		{ 63987, 4967, 1, 0 },
+		{ 63988, 4968, 1, 0 },
+		{ 63989, 4969, 1, 0 },
+		{ 63990, 4970, 1, 0 },
+		{ 63991, 4971, 1, 0 },
+		{ 63992, 4972, 1, 0 },
+		{ 63993, 4973, 1, 0 },
+		{ 63994, 4974, 1, 0 },
+		{ 63995, 4975, 1, 0 },
+		{ 63996, 4976, 1, 0 },
+		{ 63997, 4977, 1, 0 },
+		{ 63998, 4978, 1, 0 },
+		{ 63999, 4979, 1, 0 },
+		{ 64000, 4980, 1, 0 },
+		{ 64001, 4981, 1, 0 },
+		{ 64002, 4982, 1, 0 },
+		{ 64003, 4983, 1, 0 },
+		{ 64004, 4984, 1, 0 },
+		{ 64005, 4985, 1, 0 },
+		{ 64006, 4986, 1, 0 },
+		{ 64007, 4987, 1, 0 },
+		{ 64008, 4988, 1, 0 },
+		{ 64009, 4989, 1, 0 },
+		{ 64010, 4990, 1, 0 },
+		{ 64011, 4991, 1, 0 },
+		{ 64012, 4992, 1, 0 },
+		{ 64013, 4993, 1, 0 },
+		{ 64016, 4994, 1, 0 },
+		{ 64018, 4995, 1, 0 },
+		{ 64021, 4996, 1, 0 },
+		{ 64022, 4997, 1, 0 },
+		{ 64023, 4998, 1, 0 },
+		{ 64024, 4999, 1, 0 },
+		{ 64025, 5000, 1, 0 },
+		{ 64026, 5001, 1, 0 },
+		{ 64027, 5002, 1, 0 },
+		{ 64028, 5003, 1, 0 },
+		{ 64029, 5004, 1, 0 },
+		{ 64030, 5005, 1, 0 },
+		{ 64032, 5006, 1, 0 },
+		{ 64034, 5007, 1, 0 },
+		{ 64037, 5008, 1, 0 },
+		{ 64038, 5009, 1, 0 },
+		{ 64042, 5010, 1, 0 },
+		{ 64043, 5011, 1, 0 },
+		{ 64044, 5012, 1, 0 },
+		{ 64045, 5013, 1, 0 },
+		{ 64046, 5014, 1, 0 },
+		{ 64047, 5015, 1, 0 },
+		{ 64048, 5016, 1, 0 },
+		{ 64049, 5017, 1, 0 },
+		{ 64050, 5018, 1, 0 },
+		{ 64051, 5019, 1, 0 },
+		{ 64052, 5020, 1, 0 },
+		{ 64053, 5021, 1, 0 },
+		{ 64054, 5022, 1, 0 },
+		{ 64055, 5023, 1, 0 },
+		{ 64056, 5024, 1, 0 },
+		{ 64057, 5025, 1, 0 },
+		{ 64058, 5026, 1, 0 },
+		{ 64059, 5027, 1, 0 },
+		{ 64060, 5028, 1, 0 },
+		{ 64061, 5029, 1, 0 },
+		{ 64062, 5030, 1, 0 },
+		{ 64063, 5031, 1, 0 },
+		{ 64064, 5032, 1, 0 },
+		{ 64065, 5033, 1, 0 },
+		{ 64066, 5034, 1, 0 },
+		{ 64067, 5035, 1, 0 },
+		{ 64068, 5036, 1, 0 },
+		{ 64069, 5037, 1, 0 },
+		{ 64070, 5038, 1, 0 },
+		{ 64071, 5039, 1, 0 },
+		{ 64072, 5040, 1, 0 },
+		{ 64073, 5041, 1, 0 },
+		{ 64074, 5042, 1, 0 },
+		{ 64075, 5043, 1, 0 },
+		{ 64076, 5044, 1, 0 },
+		{ 64077, 5045, 1, 0 },
+		{ 64078, 5046, 1, 0 },
+		{ 64079, 5047, 1, 0 },
+		{ 64080, 5048, 1, 0 },
+		{ 64081, 5049, 1, 0 },
+		{ 64082, 5050, 1, 0 },
+		{ 64083, 5051, 1, 0 },
+		{ 64084, 5052, 1, 0 },
+		{ 64085, 5053, 1, 0 },
+		{ 64086, 5054, 1, 0 },
+		{ 64087, 5055, 1, 0 },
+		{ 64088, 5056, 1, 0 },
+		{ 64089, 5057, 1, 0 },
+		{ 64090, 5058, 1, 0 },
+		{ 64091, 5059, 1, 0 },
+		{ 64092, 5060, 1, 0 },
+		{ 64093, 5061, 1, 0 },
+		{ 64094, 5062, 1, 0 },
+		{ 64095, 5063, 1, 0 },
+		{ 64096, 5064, 1, 0 },
+		{ 64097, 5065, 1, 0 },
+		{ 64098, 5066, 1, 0 },
+		{ 64099, 5067, 1, 0 },
+		{ 64100, 5068, 1, 0 },
+		{ 64101, 5069, 1, 0 },
+		{ 64102, 5070, 1, 0 },
+		{ 64103, 5071, 1, 0 },
+		{ 64104, 5072, 1, 0 },
+		{ 64105, 5073, 1, 0 },
+		{ 64106, 5074, 1, 0 },
+		{ 64107, 5075, 1, 0 },
+		{ 64108, 5076, 1, 0 },
+		{ 64109, 5077, 1, 0 },
+		{ 64112, 5078, 1, 0 },
+		{ 64113, 5079, 1, 0 },
+		{ 64114, 5080, 1, 0 },
+		{ 64115, 5081, 1, 0 },
+		{ 64116, 5082, 1, 0 },
+		{ 64117, 5083, 1, 0 },
+		{ 64118, 5084, 1, 0 },
+		{ 64119, 5085, 1, 0 },
+		{ 64120, 5086, 1, 0 },
+		{ 64121, 5087, 1, 0 },
+		{ 64122, 5088, 1, 0 },
+		{ 64123, 5089, 1, 0 },
+		{ 64124, 5090, 1, 0 },
+		{ 64125, 5091, 1, 0 },
+		{ 64126, 5092, 1, 0 },
+		{ 64127, 5093, 1, 0 },
+		{ 64128, 5094, 1, 0 },
+		{ 64129, 5095, 1, 0 },
+		{ 64130, 5096, 1, 0 },
+		{ 64131, 5097, 1, 0 },
+		{ 64132, 5098, 1, 0 },
+		{ 64133, 5099, 1, 0 },
+		{ 64134, 5100, 1, 0 },
+		{ 64135, 5101, 1, 0 },
+		{ 64136, 5102, 1, 0 },
+		{ 64137, 5103, 1, 0 },
+		{ 64138, 5104, 1, 0 },
+		{ 64139, 5105, 1, 0 },
+		{ 64140, 5106, 1, 0 },
+		{ 64141, 5107, 1, 0 },
+		{ 64142, 5108, 1, 0 },
+		{ 64143, 5109, 1, 0 },
+		{ 64144, 5110, 1, 0 },
+		{ 64145, 5111, 1, 0 },
+		{ 64146, 5112, 1, 0 },
+		{ 64147, 5113, 1, 0 },
+		{ 64148, 5114, 1, 0 },
+		{ 64149, 5115, 1, 0 },
+		{ 64150, 5116, 1, 0 },
+		{ 64151, 5117, 1, 0 },
+		{ 64152, 5118, 1, 0 },
+		{ 64153, 5119, 1, 0 },
+		{ 64154, 5120, 1, 0 },
+		{ 64155, 5121, 1, 0 },
+		{ 64156, 5122, 1, 0 },
+		{ 64157, 5123, 1, 0 },
+		{ 64158, 5124, 1, 0 },
+		{ 64159, 5125, 1, 0 },
+		{ 64160, 5126, 1, 0 },
+		{ 64161, 5127, 1, 0 },
+		{ 64162, 5128, 1, 0 },
+		{ 64163, 5129, 1, 0 },
+		{ 64164, 5130, 1, 0 },
+		{ 64165, 5131, 1, 0 },
+		{ 64166, 5132, 1, 0 },
+		{ 64167, 5133, 1, 0 },
+		{ 64168, 5134, 1, 0 },
+		{ 64169, 5135, 1, 0 },
+		{ 64170, 5136, 1, 0 },
+		{ 64171, 5137, 1, 0 },
+		{ 64172, 5138, 1, 0 },
+		{ 64173, 5139, 1, 0 },
+		{ 64174, 5140, 1, 0 },
+		{ 64175, 5141, 1, 0 },
+		{ 64176, 5142, 1, 0 },
+		{ 64177, 5143, 1, 0 },
+		{ 64178, 5144, 1, 0 },
+		{ 64179, 5145, 1, 0 },
+		{ 64180, 5146, 1, 0 },
+		{ 64181, 5147, 1, 0 },
+		{ 64182, 5148, 1, 0 },
+		{ 64183, 5149, 1, 0 },
+		{ 64184, 5150, 1, 0 },
+		{ 64185, 5151, 1, 0 },
+		{ 64186, 5152, 1, 0 },
+		{ 64187, 5153, 1, 0 },
+		{ 64188, 5154, 1, 0 },
+		{ 64189, 5155, 1, 0 },
+		{ 64190, 5156, 1, 0 },
+		{ 64191, 5157, 1, 0 },
+		{ 64192, 5158, 1, 0 },
+		{ 64193, 5159, 1, 0 },
+		{ 64194, 5160, 1, 0 },
+		{ 64195, 5161, 1, 0 },
+		{ 64196, 5162, 1, 0 },
+		{ 64197, 5163, 1, 0 },
+		{ 64198, 5164, 1, 0 },
+		{ 64199, 5165, 1, 0 },
+		{ 64200, 5166, 1, 0 },
+		{ 64201, 5167, 1, 0 },
+		{ 64202, 5168, 1, 0 },
+		{ 64203, 5169, 1, 0 },
+		{ 64204, 5170, 1, 0 },
+		{ 64205, 5171, 1, 0 },
+		{ 64206, 5172, 1, 0 },
+		{ 64207, 5173, 1, 0 },
+		{ 64208, 5174, 1, 0 },
+		{ 64209, 5175, 1, 0 },
+		{ 64210, 5176, 1, 0 },
+		{ 64211, 5177, 1, 0 },
+		{ 64212, 5178, 1, 0 },
+		{ 64213, 5179, 1, 0 },
+		{ 64214, 5180, 1, 0 },
+		{ 64215, 5181, 1, 0 },
+		{ 64216, 5182, 1, 0 },
+		{ 64217, 5183, 1, 0 },
+		{ 64256, 5184, 0, 2 },
+		{ 64257, 5186, 0, 2 },
+		{ 64258, 5188, 0, 2 },
+		{ 64259, 5190, 0, 3 },
+		{ 64260, 5193, 0, 3 },
+		{ 64261, 5196, 0, 2 },
+		{ 64262, 5198, 0, 2 },
+		{ 64275, 5200, 0, 2 },
+		{ 64276, 5202, 0, 2 },
+		{ 64277, 5204, 0, 2 },
+		{ 64278, 5206, 0, 2 },
+		{ 64279, 5208, 0, 2 },
+		{ 64285, 5210, 2, 0 },
+		{ 64287, 5212, 2, 0 },
+		{ 64288, 5214, 0, 1 },
+		{ 64289, 5215, 0, 1 },
+		{ 64290, 5216, 0, 1 },
+		{ 64291, 5217, 0, 1 },
+		{ 64292, 5218, 0, 1 },
+		{ 64293, 5219, 0, 1 },
+		{ 64294, 5220, 0, 1 },
+		{ 64295, 5221, 0, 1 },
+		{ 64296, 5222, 0, 1 },
+		{ 64297, 5223, 0, 1 },
+		{ 64298, 5224, 2, 0 },
+		{ 64299, 5226, 2, 0 },
+		{ 64300, 5228, 3, 0 },
+		{ 64301, 5231, 3, 0 },
+		{ 64302, 5234, 2, 0 },
+		{ 64303, 5236, 2, 0 },
+		{ 64304, 5238, 2, 0 },
+		{ 64305, 5240, 2, 0 },
+		{ 64306, 5242, 2, 0 },
+		{ 64307, 5244, 2, 0 },
+		{ 64308, 5246, 2, 0 },
+		{ 64309, 5248, 2, 0 },
+		{ 64310, 5250, 2, 0 },
+		{ 64312, 5252, 2, 0 },
+		{ 64313, 5254, 2, 0 },
+		{ 64314, 5256, 2, 0 },
+		{ 64315, 5258, 2, 0 },
+		{ 64316, 5260, 2, 0 },
+		{ 64318, 5262, 2, 0 },
+		{ 64320, 5264, 2, 0 },
+		{ 64321, 5266, 2, 0 },
+		{ 64323, 5268, 2, 0 },
+		{ 64324, 5270, 2, 0 },
+		{ 64326, 5272, 2, 0 },
+		{ 64327, 5274, 2, 0 },
+		{ 64328, 5276, 2, 0 },
+		{ 64329, 5278, 2, 0 },
+		{ 64330, 5280, 2, 0 },
+		{ 64331, 5282, 2, 0 },
+		{ 64332, 5284, 2, 0 },
+		{ 64333, 5286, 2, 0 },
+		{ 64334, 5288, 2, 0 },
+		{ 64335, 5290, 0, 2 },
+		{ 64336, 5292, 0, 1 },
+		{ 64337, 5293, 0, 1 },
+		{ 64338, 5294, 0, 1 },
+		{ 64339, 5295, 0, 1 },
+		{ 64340, 5296, 0, 1 },
+		{ 64341, 5297, 0, 1 },
+		{ 64342, 5298, 0, 1 },
+		{ 64343, 5299, 0, 1 },
+		{ 64344, 5300, 0, 1 },
+		{ 64345, 5301, 0, 1 },
+		{ 64346, 5302, 0, 1 },
+		{ 64347, 5303, 0, 1 },
+		{ 64348, 5304, 0, 1 },
+		{ 64349, 5305, 0, 1 },
+		{ 64350, 5306, 0, 1 },
+		{ 64351, 5307, 0, 1 },
+		{ 64352, 5308, 0, 1 },
+		{ 64353, 5309, 0, 1 },
+		{ 64354, 5310, 0, 1 },
+		{ 64355, 5311, 0, 1 },
+		{ 64356, 5312, 0, 1 },
+		{ 64357, 5313, 0, 1 },
+		{ 64358, 5314, 0, 1 },
+		{ 64359, 5315, 0, 1 },
+		{ 64360, 5316, 0, 1 },
+		{ 64361, 5317, 0, 1 },
+		{ 64362, 5318, 0, 1 },
+		{ 64363, 5319, 0, 1 },
+		{ 64364, 5320, 0, 1 },
+		{ 64365, 5321, 0, 1 },
+		{ 64366, 5322, 0, 1 },
+		{ 64367, 5323, 0, 1 },
+		{ 64368, 5324, 0, 1 },
+		{ 64369, 5325, 0, 1 },
+		{ 64370, 5326, 0, 1 },
+		{ 64371, 5327, 0, 1 },
+		{ 64372, 5328, 0, 1 },
+		{ 64373, 5329, 0, 1 },
+		{ 64374, 5330, 0, 1 },
+		{ 64375, 5331, 0, 1 },
+		{ 64376, 5332, 0, 1 },
+		{ 64377, 5333, 0, 1 },
+		{ 64378, 5334, 0, 1 },
+		{ 64379, 5335, 0, 1 },
+		{ 64380, 5336, 0, 1 },
+		{ 64381, 5337, 0, 1 },
+		{ 64382, 5338, 0, 1 },
+		{ 64383, 5339, 0, 1 },
+		{ 64384, 5340, 0, 1 },
+		{ 64385, 5341, 0, 1 },
+		{ 64386, 5342, 0, 1 },
+		{ 64387, 5343, 0, 1 },
+		{ 64388, 5344, 0, 1 },
+		{ 64389, 5345, 0, 1 },
+		{ 64390, 5346, 0, 1 },
+		{ 64391, 5347, 0, 1 },
+		{ 64392, 5348, 0, 1 },
+		{ 64393, 5349, 0, 1 },
+		{ 64394, 5350, 0, 1 },
+		{ 64395, 5351, 0, 1 },
+		{ 64396, 5352, 0, 1 },
+		{ 64397, 5353, 0, 1 },
+		{ 64398, 5354, 0, 1 },
+		{ 64399, 5355, 0, 1 },
+		{ 64400, 5356, 0, 1 },
+		{ 64401, 5357, 0, 1 },
+		{ 64402, 5358, 0, 1 },
+		{ 64403, 5359, 0, 1 },
+		{ 64404, 5360, 0, 1 },
+		{ 64405, 5361, 0, 1 },
+		{ 64406, 5362, 0, 1 },
+		{ 64407, 5363, 0, 1 },
+		{ 64408, 5364, 0, 1 },
+		{ 64409, 5365, 0, 1 },
+		{ 64410, 5366, 0, 1 },
+		{ 64411, 5367, 0, 1 },
+		{ 64412, 5368, 0, 1 },
+		{ 64413, 5369, 0, 1 },
+		{ 64414, 5370, 0, 1 },
+		{ 64415, 5371, 0, 1 },
+		{ 64416, 5372, 0, 1 },
+		{ 64417, 5373, 0, 1 },
+		{ 64418, 5374, 0, 1 },
+		{ 64419, 5375, 0, 1 },
+		{ 64420, 5376, 0, 2 },
+		{ 64421, 5378, 0, 2 },
+		{ 64422, 5380, 0, 1 },
+		{ 64423, 5381, 0, 1 },
+		{ 64424, 5382, 0, 1 },
+		{ 64425, 5383, 0, 1 },
+		{ 64426, 5384, 0, 1 },
+		{ 64427, 5385, 0, 1 },
+		{ 64428, 5386, 0, 1 },
+		{ 64429, 5387, 0, 1 },
+		{ 64430, 5388, 0, 1 },
+		{ 64431, 5389, 0, 1 },
+		{ 64432, 5390, 0, 2 },
+		{ 64433, 5392, 0, 2 },
+		{ 64467, 5394, 0, 1 },
+		{ 64468, 5395, 0, 1 },
+		{ 64469, 5396, 0, 1 },
+		{ 64470, 5397, 0, 1 },
+		{ 64471, 5398, 0, 1 },
+		{ 64472, 5399, 0, 1 },
+		{ 64473, 5400, 0, 1 },
+		{ 64474, 5401, 0, 1 },
+		{ 64475, 5402, 0, 1 },
+		{ 64476, 5403, 0, 1 },
+		{ 64477, 5404, 0, 2 },
+		{ 64478, 5406, 0, 1 },
+		{ 64479, 5407, 0, 1 },
+		{ 64480, 5408, 0, 1 },
+		{ 64481, 5409, 0, 1 },
+		{ 64482, 5410, 0, 1 },
+		{ 64483, 5411, 0, 1 },
+		{ 64484, 5412, 0, 1 },
+		{ 64485, 5413, 0, 1 },
+		{ 64486, 5414, 0, 1 },
+		{ 64487, 5415, 0, 1 },
+		{ 64488, 5416, 0, 1 },
+		{ 64489, 5417, 0, 1 },
+		{ 64490, 5418, 0, 3 },
+		{ 64491, 5421, 0, 3 },
+		{ 64492, 5424, 0, 3 },
+		{ 64493, 5427, 0, 3 },
+		{ 64494, 5430, 0, 3 },
+		{ 64495, 5433, 0, 3 },
+		{ 64496, 5436, 0, 3 },
+		{ 64497, 5439, 0, 3 },
+		{ 64498, 5442, 0, 3 },
+		{ 64499, 5445, 0, 3 },
+		{ 64500, 5448, 0, 3 },
+		{ 64501, 5451, 0, 3 },
+		{ 64502, 5454, 0, 3 },
+		{ 64503, 5457, 0, 3 },
+		{ 64504, 5460, 0, 3 },
+		{ 64505, 5463, 0, 3 },
+		{ 64506, 5466, 0, 3 },
+		{ 64507, 5469, 0, 3 },
+		{ 64508, 5472, 0, 1 },
+		{ 64509, 5473, 0, 1 },
+		{ 64510, 5474, 0, 1 },
+		{ 64511, 5475, 0, 1 },
+		{ 64512, 5476, 0, 3 },
+		{ 64513, 5479, 0, 3 },
+		{ 64514, 5482, 0, 3 },
+		{ 64515, 5485, 0, 3 },
+		{ 64516, 5488, 0, 3 },
+		{ 64517, 5491, 0, 2 },
+		{ 64518, 5493, 0, 2 },
+		{ 64519, 5495, 0, 2 },
+		{ 64520, 5497, 0, 2 },
+		{ 64521, 5499, 0, 2 },
+		{ 64522, 5501, 0, 2 },
+		{ 64523, 5503, 0, 2 },
+		{ 64524, 5505, 0, 2 },
+		{ 64525, 5507, 0, 2 },
+		{ 64526, 5509, 0, 2 },
+		{ 64527, 5511, 0, 2 },
+		{ 64528, 5513, 0, 2 },
+		{ 64529, 5515, 0, 2 },
+		{ 64530, 5517, 0, 2 },
+		{ 64531, 5519, 0, 2 },
+		{ 64532, 5521, 0, 2 },
+		{ 64533, 5523, 0, 2 },
+		{ 64534, 5525, 0, 2 },
+		{ 64535, 5527, 0, 2 },
+		{ 64536, 5529, 0, 2 },
+		{ 64537, 5531, 0, 2 },
+		{ 64538, 5533, 0, 2 },
+		{ 64539, 5535, 0, 2 },
+		{ 64540, 5537, 0, 2 },
+		{ 64541, 5539, 0, 2 },
+		{ 64542, 5541, 0, 2 },
+		{ 64543, 5543, 0, 2 },
+		{ 64544, 5545, 0, 2 },
+		{ 64545, 5547, 0, 2 },
+		{ 64546, 5549, 0, 2 },
+		{ 64547, 5551, 0, 2 },
+		{ 64548, 5553, 0, 2 },
+		{ 64549, 5555, 0, 2 },
+		{ 64550, 5557, 0, 2 },
+		{ 64551, 5559, 0, 2 },
+		{ 64552, 5561, 0, 2 },
+		{ 64553, 5563, 0, 2 },
+		{ 64554, 5565, 0, 2 },
+		{ 64555, 5567, 0, 2 },
+		{ 64556, 5569, 0, 2 },
+		{ 64557, 5571, 0, 2 },
+		{ 64558, 5573, 0, 2 },
+		{ 64559, 5575, 0, 2 },
+		{ 64560, 5577, 0, 2 },
+		{ 64561, 5579, 0, 2 },
+		{ 64562, 5581, 0, 2 },
+		{ 64563, 5583, 0, 2 },
+		{ 64564, 5585, 0, 2 },
+		{ 64565, 5587, 0, 2 },
+		{ 64566, 5589, 0, 2 },
+		{ 64567, 5591, 0, 2 },
+		{ 64568, 5593, 0, 2 },
+		{ 64569, 5595, 0, 2 },
+		{ 64570, 5597, 0, 2 },
+		{ 64571, 5599, 0, 2 },
+		{ 64572, 5601, 0, 2 },
+		{ 64573, 5603, 0, 2 },
+		{ 64574, 5605, 0, 2 },
+		{ 64575, 5607, 0, 2 },
+		{ 64576, 5609, 0, 2 },
+		{ 64577, 5611, 0, 2 },
+		{ 64578, 5613, 0, 2 },
+		{ 64579, 5615, 0, 2 },
+		{ 64580, 5617, 0, 2 },
+		{ 64581, 5619, 0, 2 },
+		{ 64582, 5621, 0, 2 },
+		{ 64583, 5623, 0, 2 },
+		{ 64584, 5625, 0, 2 },
+		{ 64585, 5627, 0, 2 },
+		{ 64586, 5629, 0, 2 },
+		{ 64587, 5631, 0, 2 },
+		{ 64588, 5633, 0, 2 },
+		{ 64589, 5635, 0, 2 },
+		{ 64590, 5637, 0, 2 },
+		{ 64591, 5639, 0, 2 },
+		{ 64592, 5641, 0, 2 },
+		{ 64593, 5643, 0, 2 },
+		{ 64594, 5645, 0, 2 },
+		{ 64595, 5647, 0, 2 },
+		{ 64596, 5649, 0, 2 },
+		{ 64597, 5651, 0, 2 },
+		{ 64598, 5653, 0, 2 },
+		{ 64599, 5655, 0, 2 },
+		{ 64600, 5657, 0, 2 },
+		{ 64601, 5659, 0, 2 },
+		{ 64602, 5661, 0, 2 },
+		{ 64603, 5663, 0, 2 },
+		{ 64604, 5665, 0, 2 },
+		{ 64605, 5667, 0, 2 },
+		{ 64606, 5669, 0, 3 },
+		{ 64607, 5672, 0, 3 },
+		{ 64608, 5675, 0, 3 },
+		{ 64609, 5678, 0, 3 },
+		{ 64610, 5681, 0, 3 },
+		{ 64611, 5684, 0, 3 },
+		{ 64612, 5687, 0, 3 },
+		{ 64613, 5690, 0, 3 },
+		{ 64614, 5693, 0, 3 },
+		{ 64615, 5696, 0, 3 },
+		{ 64616, 5699, 0, 3 },
+		{ 64617, 5702, 0, 3 },
+		{ 64618, 5705, 0, 2 },
+		{ 64619, 5707, 0, 2 },
+		{ 64620, 5709, 0, 2 },
+		{ 64621, 5711, 0, 2 },
+		{ 64622, 5713, 0, 2 },
+		{ 64623, 5715, 0, 2 },
+		{ 64624, 5717, 0, 2 },
+		{ 64625, 5719, 0, 2 },
+		{ 64626, 5721, 0, 2 },
+		{ 64627, 5723, 0, 2 },
+		{ 64628, 5725, 0, 2 },
+		{ 64629, 5727, 0, 2 },
+		{ 64630, 5729, 0, 2 },
+		{ 64631, 5731, 0, 2 },
+		{ 64632, 5733, 0, 2 },
+		{ 64633, 5735, 0, 2 },
+		{ 64634, 5737, 0, 2 },
+		{ 64635, 5739, 0, 2 },
+		{ 64636, 5741, 0, 2 },
+		{ 64637, 5743, 0, 2 },
+		{ 64638, 5745, 0, 2 },
+		{ 64639, 5747, 0, 2 },
+		{ 64640, 5749, 0, 2 },
+		{ 64641, 5751, 0, 2 },
+		{ 64642, 5753, 0, 2 },
+		{ 64643, 5755, 0, 2 },
+		{ 64644, 5757, 0, 2 },
+		{ 64645, 5759, 0, 2 },
+		{ 64646, 5761, 0, 2 },
+		{ 64647, 5763, 0, 2 },
+		{ 64648, 5765, 0, 2 },
+		{ 64649, 5767, 0, 2 },
+		{ 64650, 5769, 0, 2 },
+		{ 64651, 5771, 0, 2 },
+		{ 64652, 5773, 0, 2 },
+		{ 64653, 5775, 0, 2 },
+		{ 64654, 5777, 0, 2 },
+		{ 64655, 5779, 0, 2 },
+		{ 64656, 5781, 0, 2 },
+		{ 64657, 5783, 0, 2 },
+		{ 64658, 5785, 0, 2 },
+		{ 64659, 5787, 0, 2 },
+		{ 64660, 5789, 0, 2 },
+		{ 64661, 5791, 0, 2 },
+		{ 64662, 5793, 0, 2 },
+		{ 64663, 5795, 0, 3 },
+		{ 64664, 5798, 0, 3 },
+		{ 64665, 5801, 0, 3 },
+		{ 64666, 5804, 0, 3 },
+		{ 64667, 5807, 0, 3 },
+		{ 64668, 5810, 0, 2 },
+		{ 64669, 5812, 0, 2 },
+		{ 64670, 5814, 0, 2 },
+		{ 64671, 5816, 0, 2 },
+		{ 64672, 5818, 0, 2 },
+		{ 64673, 5820, 0, 2 },
+		{ 64674, 5822, 0, 2 },
+		{ 64675, 5824, 0, 2 },
+		{ 64676, 5826, 0, 2 },
+		{ 64677, 5828, 0, 2 },
+		{ 64678, 5830, 0, 2 },
+		{ 64679, 5832, 0, 2 },
+		{ 64680, 5834, 0, 2 },
+		{ 64681, 5836, 0, 2 },
+		{ 64682, 5838, 0, 2 },
+		{ 64683, 5840, 0, 2 },
+		{ 64684, 5842, 0, 2 },
+		{ 64685, 5844, 0, 2 },
+		{ 64686, 5846, 0, 2 },
+		{ 64687, 5848, 0, 2 },
+		{ 64688, 5850, 0, 2 },
+		{ 64689, 5852, 0, 2 },
+		{ 64690, 5854, 0, 2 },
+		{ 64691, 5856, 0, 2 },
+		{ 64692, 5858, 0, 2 },
+		{ 64693, 5860, 0, 2 },
+		{ 64694, 5862, 0, 2 },
+		{ 64695, 5864, 0, 2 },
+		{ 64696, 5866, 0, 2 },
+		{ 64697, 5868, 0, 2 },
+		{ 64698, 5870, 0, 2 },
+		{ 64699, 5872, 0, 2 },
+		{ 64700, 5874, 0, 2 },
+		{ 64701, 5876, 0, 2 },
+		{ 64702, 5878, 0, 2 },
+		{ 64703, 5880, 0, 2 },
+		{ 64704, 5882, 0, 2 },
+		{ 64705, 5884, 0, 2 },
+		{ 64706, 5886, 0, 2 },
+		{ 64707, 5888, 0, 2 },
+		{ 64708, 5890, 0, 2 },
+		{ 64709, 5892, 0, 2 },
+		{ 64710, 5894, 0, 2 },
+		{ 64711, 5896, 0, 2 },
+		{ 64712, 5898, 0, 2 },
+		{ 64713, 5900, 0, 2 },
+		{ 64714, 5902, 0, 2 },
+		{ 64715, 5904, 0, 2 },
+		{ 64716, 5906, 0, 2 },
+		{ 64717, 5908, 0, 2 },
+		{ 64718, 5910, 0, 2 },
+		{ 64719, 5912, 0, 2 },
+		{ 64720, 5914, 0, 2 },
+		{ 64721, 5916, 0, 2 },
+		{ 64722, 5918, 0, 2 },
+		{ 64723, 5920, 0, 2 },
+		{ 64724, 5922, 0, 2 },
+		{ 64725, 5924, 0, 2 },
+		{ 64726, 5926, 0, 2 },
+		{ 64727, 5928, 0, 2 },
+		{ 64728, 5930, 0, 2 },
+		{ 64729, 5932, 0, 2 },
+		{ 64730, 5934, 0, 2 },
+		{ 64731, 5936, 0, 2 },
+		{ 64732, 5938, 0, 2 },
+		{ 64733, 5940, 0, 2 },
+		{ 64734, 5942, 0, 2 },
+		{ 64735, 5944, 0, 3 },
+		{ 64736, 5947, 0, 3 },
+		{ 64737, 5950, 0, 2 },
+		{ 64738, 5952, 0, 2 },
+		{ 64739, 5954, 0, 2 },
+		{ 64740, 5956, 0, 2 },
+		{ 64741, 5958, 0, 2 },
+		{ 64742, 5960, 0, 2 },
+		{ 64743, 5962, 0, 2 },
+		{ 64744, 5964, 0, 2 },
+		{ 64745, 5966, 0, 2 },
+		{ 64746, 5968, 0, 2 },
+		{ 64747, 5970, 0, 2 },
+		{ 64748, 5972, 0, 2 },
+		{ 64749, 5974, 0, 2 },
+		{ 64750, 5976, 0, 2 },
+		{ 64751, 5978, 0, 2 },
+		{ 64752, 5980, 0, 2 },
+		{ 64753, 5982, 0, 2 },
+		{ 64754, 5984, 0, 3 },
+		{ 64755, 5987, 0, 3 },
+		{ 64756, 5990, 0, 3 },
+		{ 64757, 5993, 0, 2 },
+		{ 64758, 5995, 0, 2 },
+		{ 64759, 5997, 0, 2 },
+		{ 64760, 5999, 0, 2 },
+		{ 64761, 6001, 0, 2 },
+		{ 64762, 6003, 0, 2 },
+		{ 64763, 6005, 0, 2 },
+		{ 64764, 6007, 0, 2 },
+		{ 64765, 6009, 0, 2 },
+		{ 64766, 6011, 0, 2 },
+		{ 64767, 6013, 0, 2 },
+		{ 64768, 6015, 0, 2 },
+		{ 64769, 6017, 0, 2 },
+		{ 64770, 6019, 0, 2 },
+		{ 64771, 6021, 0, 2 },
+		{ 64772, 6023, 0, 2 },
+		{ 64773, 6025, 0, 2 },
+		{ 64774, 6027, 0, 2 },
+		{ 64775, 6029, 0, 2 },
+		{ 64776, 6031, 0, 2 },
+		{ 64777, 6033, 0, 2 },
+		{ 64778, 6035, 0, 2 },
+		{ 64779, 6037, 0, 2 },
+		{ 64780, 6039, 0, 2 },
+		{ 64781, 6041, 0, 2 },
+		{ 64782, 6043, 0, 2 },
+		{ 64783, 6045, 0, 2 },
+		{ 64784, 6047, 0, 2 },
+		{ 64785, 6049, 0, 2 },
+		{ 64786, 6051, 0, 2 },
+		{ 64787, 6053, 0, 2 },
+		{ 64788, 6055, 0, 2 },
+		{ 64789, 6057, 0, 2 },
+		{ 64790, 6059, 0, 2 },
+		{ 64791, 6061, 0, 2 },
+		{ 64792, 6063, 0, 2 },
+		{ 64793, 6065, 0, 2 },
+		{ 64794, 6067, 0, 2 },
+		{ 64795, 6069, 0, 2 },
+		{ 64796, 6071, 0, 2 },
+		{ 64797, 6073, 0, 2 },
+		{ 64798, 6075, 0, 2 },
+		{ 64799, 6077, 0, 2 },
+		{ 64800, 6079, 0, 2 },
+		{ 64801, 6081, 0, 2 },
+		{ 64802, 6083, 0, 2 },
+		{ 64803, 6085, 0, 2 },
+		{ 64804, 6087, 0, 2 },
+		{ 64805, 6089, 0, 2 },
+		{ 64806, 6091, 0, 2 },
+		{ 64807, 6093, 0, 2 },
+		{ 64808, 6095, 0, 2 },
+		{ 64809, 6097, 0, 2 },
+		{ 64810, 6099, 0, 2 },
+		{ 64811, 6101, 0, 2 },
+		{ 64812, 6103, 0, 2 },
+		{ 64813, 6105, 0, 2 },
+		{ 64814, 6107, 0, 2 },
+		{ 64815, 6109, 0, 2 },
+		{ 64816, 6111, 0, 2 },
+		{ 64817, 6113, 0, 2 },
+		{ 64818, 6115, 0, 2 },
+		{ 64819, 6117, 0, 2 },
+		{ 64820, 6119, 0, 2 },
+		{ 64821, 6121, 0, 2 },
+		{ 64822, 6123, 0, 2 },
+		{ 64823, 6125, 0, 2 },
+		{ 64824, 6127, 0, 2 },
+		{ 64825, 6129, 0, 2 },
+		{ 64826, 6131, 0, 2 },
+		{ 64827, 6133, 0, 2 },
+		{ 64828, 6135, 0, 2 },
+		{ 64829, 6137, 0, 2 },
+		{ 64848, 6139, 0, 3 },
+		{ 64849, 6142, 0, 3 },
+		{ 64850, 6145, 0, 3 },
+		{ 64851, 6148, 0, 3 },
+		{ 64852, 6151, 0, 3 },
+		{ 64853, 6154, 0, 3 },
+		{ 64854, 6157, 0, 3 },
+		{ 64855, 6160, 0, 3 },
+		{ 64856, 6163, 0, 3 },
+		{ 64857, 6166, 0, 3 },
+		{ 64858, 6169, 0, 3 },
+		{ 64859, 6172, 0, 3 },
+		{ 64860, 6175, 0, 3 },
+		{ 64861, 6178, 0, 3 },
+		{ 64862, 6181, 0, 3 },
+		{ 64863, 6184, 0, 3 },
+		{ 64864, 6187, 0, 3 },
+		{ 64865, 6190, 0, 3 },
+		{ 64866, 6193, 0, 3 },
+		{ 64867, 6196, 0, 3 },
+		{ 64868, 6199, 0, 3 },
+		{ 64869, 6202, 0, 3 },
+		{ 64870, 6205, 0, 3 },
+		{ 64871, 6208, 0, 3 },
+		{ 64872, 6211, 0, 3 },
+		{ 64873, 6214, 0, 3 },
+		{ 64874, 6217, 0, 3 },
+		{ 64875, 6220, 0, 3 },
+		{ 64876, 6223, 0, 3 },
+		{ 64877, 6226, 0, 3 },
+		{ 64878, 6229, 0, 3 },
+		{ 64879, 6232, 0, 3 },
+		{ 64880, 6235, 0, 3 },
+		{ 64881, 6238, 0, 3 },
+		{ 64882, 6241, 0, 3 },
+		{ 64883, 6244, 0, 3 },
+		{ 64884, 6247, 0, 3 },
+		{ 64885, 6250, 0, 3 },
+		{ 64886, 6253, 0, 3 },
+		{ 64887, 6256, 0, 3 },
+		{ 64888, 6259, 0, 3 },
+		{ 64889, 6262, 0, 3 },
+		{ 64890, 6265, 0, 3 },
+		{ 64891, 6268, 0, 3 },
+		{ 64892, 6271, 0, 3 },
+		{ 64893, 6274, 0, 3 },
+		{ 64894, 6277, 0, 3 },
+		{ 64895, 6280, 0, 3 },
+		{ 64896, 6283, 0, 3 },
+		{ 64897, 6286, 0, 3 },
+		{ 64898, 6289, 0, 3 },
+		{ 64899, 6292, 0, 3 },
+		{ 64900, 6295, 0, 3 },
+		{ 64901, 6298, 0, 3 },
+		{ 64902, 6301, 0, 3 },
+		{ 64903, 6304, 0, 3 },
+		{ 64904, 6307, 0, 3 },
+		{ 64905, 6310, 0, 3 },
+		{ 64906, 6313, 0, 3 },
+		{ 64907, 6316, 0, 3 },
+		{ 64908, 6319, 0, 3 },
+		{ 64909, 6322, 0, 3 },
+		{ 64910, 6325, 0, 3 },
+		{ 64911, 6328, 0, 3 },
+		{ 64914, 6331, 0, 3 },
+		{ 64915, 6334, 0, 3 },
+		{ 64916, 6337, 0, 3 },
+		{ 64917, 6340, 0, 3 },
+		{ 64918, 6343, 0, 3 },
+		{ 64919, 6346, 0, 3 },
+		{ 64920, 6349, 0, 3 },
+		{ 64921, 6352, 0, 3 },
+		{ 64922, 6355, 0, 3 },
+		{ 64923, 6358, 0, 3 },
+		{ 64924, 6361, 0, 3 },
+		{ 64925, 6364, 0, 3 },
+		{ 64926, 6367, 0, 3 },
+		{ 64927, 6370, 0, 3 },
+		{ 64928, 6373, 0, 3 },
+		{ 64929, 6376, 0, 3 },
+		{ 64930, 6379, 0, 3 },
+		{ 64931, 6382, 0, 3 },
+		{ 64932, 6385, 0, 3 },
+		{ 64933, 6388, 0, 3 },
+		{ 64934, 6391, 0, 3 },
+		{ 64935, 6394, 0, 3 },
+		{ 64936, 6397, 0, 3 },
+		{ 64937, 6400, 0, 3 },
+		{ 64938, 6403, 0, 3 },
+		{ 64939, 6406, 0, 3 },
+		{ 64940, 6409, 0, 3 },
+		{ 64941, 6412, 0, 3 },
+		{ 64942, 6415, 0, 3 },
+		{ 64943, 6418, 0, 3 },
+		{ 64944, 6421, 0, 3 },
+		{ 64945, 6424, 0, 3 },
+		{ 64946, 6427, 0, 3 },
+		{ 64947, 6430, 0, 3 },
+		{ 64948, 6433, 0, 3 },
+		{ 64949, 6436, 0, 3 },
+		{ 64950, 6439, 0, 3 },
+		{ 64951, 6442, 0, 3 },
+		{ 64952, 6445, 0, 3 },
+		{ 64953, 6448, 0, 3 },
+		{ 64954, 6451, 0, 3 },
+		{ 64955, 6454, 0, 3 },
+		{ 64956, 6457, 0, 3 },
+		{ 64957, 6460, 0, 3 },
+		{ 64958, 6463, 0, 3 },
+		{ 64959, 6466, 0, 3 },
+		{ 64960, 6469, 0, 3 },
+		{ 64961, 6472, 0, 3 },
+		{ 64962, 6475, 0, 3 },
+		{ 64963, 6478, 0, 3 },
+		{ 64964, 6481, 0, 3 },
+		{ 64965, 6484, 0, 3 },
+		{ 64966, 6487, 0, 3 },
+		{ 64967, 6490, 0, 3 },
+		{ 65008, 6493, 0, 3 },
+		{ 65009, 6496, 0, 3 },
+		{ 65010, 6499, 0, 4 },
+		{ 65011, 6503, 0, 4 },
+		{ 65012, 6507, 0, 4 },
+		{ 65013, 6511, 0, 4 },
+		{ 65014, 6515, 0, 4 },
+		{ 65015, 6519, 0, 4 },
+		{ 65016, 6523, 0, 4 },
+		{ 65017, 6527, 0, 3 },
+		{ 65018, 6530, 0, 18 },
+		{ 65019, 6548, 0, 8 },
+		{ 65020, 6556, 0, 4 },
+		{ 65040, 6560, 0, 1 },
+		{ 65041, 6561, 0, 1 },
+		{ 65042, 6562, 0, 1 },
+		{ 65043, 6563, 0, 1 },
+		{ 65044, 6564, 0, 1 },
+		{ 65045, 6565, 0, 1 },
+		{ 65046, 6566, 0, 1 },
+		{ 65047, 6567, 0, 1 },
+		{ 65048, 6568, 0, 1 },
+		{ 65049, 6569, 0, 3 },
+		{ 65072, 6572, 0, 2 },
+		{ 65073, 6574, 0, 1 },
+		{ 65074, 6575, 0, 1 },
+		{ 65075, 6576, 0, 1 },
+		{ 65076, 6577, 0, 1 },
+		{ 65077, 6578, 0, 1 },
+		{ 65078, 6579, 0, 1 },
+		{ 65079, 6580, 0, 1 },
+		{ 65080, 6581, 0, 1 },
+		{ 65081, 6582, 0, 1 },
+		{ 65082, 6583, 0, 1 },
+		{ 65083, 6584, 0, 1 },
+		{ 65084, 6585, 0, 1 },
+		{ 65085, 6586, 0, 1 },
+		{ 65086, 6587, 0, 1 },
+		{ 65087, 6588, 0, 1 },
+		{ 65088, 6589, 0, 1 },
+		{ 65089, 6590, 0, 1 },
+		{ 65090, 6591, 0, 1 },
+		{ 65091, 6592, 0, 1 },
+		{ 65092, 6593, 0, 1 },
+		{ 65095, 6594, 0, 1 },
+		{ 65096, 6595, 0, 1 },
+		{ 65097, 6596, 0, 2 },
+		{ 65098, 6598, 0, 2 },
+		{ 65099, 6600, 0, 2 },
+		{ 65100, 6602, 0, 2 },
+		{ 65101, 6604, 0, 1 },
+		{ 65102, 6605, 0, 1 },
+		{ 65103, 6606, 0, 1 },
+		{ 65104, 6607, 0, 1 },
+		{ 65105, 6608, 0, 1 },
+		{ 65106, 6609, 0, 1 },
+		{ 65108, 6610, 0, 1 },
+		{ 65109, 6611, 0, 1 },
+		{ 65110, 6612, 0, 1 },
+		{ 65111, 6613, 0, 1 },
+		{ 65112, 6614, 0, 1 },
+		{ 65113, 6615, 0, 1 },
+		{ 65114, 6616, 0, 1 },
+		{ 65115, 6617, 0, 1 },
+		{ 65116, 6618, 0, 1 },
+		{ 65117, 6619, 0, 1 },
+		{ 65118, 6620, 0, 1 },
+		{ 65119, 6621, 0, 1 },
+		{ 65120, 6622, 0, 1 },
+		{ 65121, 6623, 0, 1 },
+		{ 65122, 6624, 0, 1 },
+		{ 65123, 6625, 0, 1 },
+		{ 65124, 6626, 0, 1 },
+		{ 65125, 6627, 0, 1 },
+		{ 65126, 6628, 0, 1 },
+		{ 65128, 6629, 0, 1 },
+		{ 65129, 6630, 0, 1 },
+		{ 65130, 6631, 0, 1 },
+		{ 65131, 6632, 0, 1 },
+		{ 65136, 6633, 0, 2 },
+		{ 65137, 6635, 0, 2 },
+		{ 65138, 6637, 0, 2 },
+		{ 65140, 6639, 0, 2 },
+		{ 65142, 6641, 0, 2 },
+		{ 65143, 6643, 0, 2 },
+		{ 65144, 6645, 0, 2 },
+		{ 65145, 6647, 0, 2 },
+		{ 65146, 6649, 0, 2 },
+		{ 65147, 6651, 0, 2 },
+		{ 65148, 6653, 0, 2 },
+		{ 65149, 6655, 0, 2 },
+		{ 65150, 6657, 0, 2 },
+		{ 65151, 6659, 0, 2 },
+		{ 65152, 6661, 0, 1 },
+		{ 65153, 6662, 0, 2 },
+		{ 65154, 6664, 0, 2 },
+		{ 65155, 6666, 0, 2 },
+		{ 65156, 6668, 0, 2 },
+		{ 65157, 6670, 0, 2 },
+		{ 65158, 6672, 0, 2 },
+		{ 65159, 6674, 0, 2 },
+		{ 65160, 6676, 0, 2 },
+		{ 65161, 6678, 0, 2 },
+		{ 65162, 6680, 0, 2 },
+		{ 65163, 6682, 0, 2 },
+		{ 65164, 6684, 0, 2 },
+		{ 65165, 6686, 0, 1 },
+		{ 65166, 6687, 0, 1 },
+		{ 65167, 6688, 0, 1 },
+		{ 65168, 6689, 0, 1 },
+		{ 65169, 6690, 0, 1 },
+		{ 65170, 6691, 0, 1 },
+		{ 65171, 6692, 0, 1 },
+		{ 65172, 6693, 0, 1 },
+		{ 65173, 6694, 0, 1 },
+		{ 65174, 6695, 0, 1 },
+		{ 65175, 6696, 0, 1 },
+		{ 65176, 6697, 0, 1 },
+		{ 65177, 6698, 0, 1 },
+		{ 65178, 6699, 0, 1 },
+		{ 65179, 6700, 0, 1 },
+		{ 65180, 6701, 0, 1 },
+		{ 65181, 6702, 0, 1 },
+		{ 65182, 6703, 0, 1 },
+		{ 65183, 6704, 0, 1 },
+		{ 65184, 6705, 0, 1 },
+		{ 65185, 6706, 0, 1 },
+		{ 65186, 6707, 0, 1 },
+		{ 65187, 6708, 0, 1 },
+		{ 65188, 6709, 0, 1 },
+		{ 65189, 6710, 0, 1 },
+		{ 65190, 6711, 0, 1 },
+		{ 65191, 6712, 0, 1 },
+		{ 65192, 6713, 0, 1 },
+		{ 65193, 6714, 0, 1 },
+		{ 65194, 6715, 0, 1 },
+		{ 65195, 6716, 0, 1 },
+		{ 65196, 6717, 0, 1 },
+		{ 65197, 6718, 0, 1 },
+		{ 65198, 6719, 0, 1 },
+		{ 65199, 6720, 0, 1 },
+		{ 65200, 6721, 0, 1 },
+		{ 65201, 6722, 0, 1 },
+		{ 65202, 6723, 0, 1 },
+		{ 65203, 6724, 0, 1 },
+		{ 65204, 6725, 0, 1 },
+		{ 65205, 6726, 0, 1 },
+		{ 65206, 6727, 0, 1 },
+		{ 65207, 6728, 0, 1 },
+		{ 65208, 6729, 0, 1 },
+		{ 65209, 6730, 0, 1 },
+		{ 65210, 6731, 0, 1 },
+		{ 65211, 6732, 0, 1 },
+		{ 65212, 6733, 0, 1 },
+		{ 65213, 6734, 0, 1 },
+		{ 65214, 6735, 0, 1 },
+		{ 65215, 6736, 0, 1 },
+		{ 65216, 6737, 0, 1 },
+		{ 65217, 6738, 0, 1 },
+		{ 65218, 6739, 0, 1 },
+		{ 65219, 6740, 0, 1 },
+		{ 65220, 6741, 0, 1 },
+		{ 65221, 6742, 0, 1 },
+		{ 65222, 6743, 0, 1 },
+		{ 65223, 6744, 0, 1 },
+		{ 65224, 6745, 0, 1 },
+		{ 65225, 6746, 0, 1 },
+		{ 65226, 6747, 0, 1 },
+		{ 65227, 6748, 0, 1 },
+		{ 65228, 6749, 0, 1 },
+		{ 65229, 6750, 0, 1 },
+		{ 65230, 6751, 0, 1 },
+		{ 65231, 6752, 0, 1 },
+		{ 65232, 6753, 0, 1 },
+		{ 65233, 6754, 0, 1 },
+		{ 65234, 6755, 0, 1 },
+		{ 65235, 6756, 0, 1 },
+		{ 65236, 6757, 0, 1 },
+		{ 65237, 6758, 0, 1 },
+		{ 65238, 6759, 0, 1 },
+		{ 65239, 6760, 0, 1 },
+		{ 65240, 6761, 0, 1 },
+		{ 65241, 6762, 0, 1 },
+		{ 65242, 6763, 0, 1 },
+		{ 65243, 6764, 0, 1 },
+		{ 65244, 6765, 0, 1 },
+		{ 65245, 6766, 0, 1 },
+		{ 65246, 6767, 0, 1 },
+		{ 65247, 6768, 0, 1 },
+		{ 65248, 6769, 0, 1 },
+		{ 65249, 6770, 0, 1 },
+		{ 65250, 6771, 0, 1 },
+		{ 65251, 6772, 0, 1 },
+		{ 65252, 6773, 0, 1 },
+		{ 65253, 6774, 0, 1 },
+		{ 65254, 6775, 0, 1 },
+		{ 65255, 6776, 0, 1 },
+		{ 65256, 6777, 0, 1 },
+		{ 65257, 6778, 0, 1 },
+		{ 65258, 6779, 0, 1 },
+		{ 65259, 6780, 0, 1 },
+		{ 65260, 6781, 0, 1 },
+		{ 65261, 6782, 0, 1 },
+		{ 65262, 6783, 0, 1 },
+		{ 65263, 6784, 0, 1 },
+		{ 65264, 6785, 0, 1 },
+		{ 65265, 6786, 0, 1 },
+		{ 65266, 6787, 0, 1 },
+		{ 65267, 6788, 0, 1 },
+		{ 65268, 6789, 0, 1 },
+		{ 65269, 6790, 0, 3 },
+		{ 65270, 6793, 0, 3 },
+		{ 65271, 6796, 0, 3 },
+		{ 65272, 6799, 0, 3 },
+		{ 65273, 6802, 0, 3 },
+		{ 65274, 6805, 0, 3 },
+		{ 65275, 6808, 0, 2 },
+		{ 65276, 6810, 0, 2 },
+		{ 65281, 6812, 0, 1 },
+		{ 65282, 6813, 0, 1 },
+		{ 65283, 6814, 0, 1 },
+		{ 65284, 6815, 0, 1 },
+		{ 65285, 6816, 0, 1 },
+		{ 65286, 6817, 0, 1 },
+		{ 65287, 6818, 0, 1 },
+		{ 65288, 6819, 0, 1 },
+		{ 65289, 6820, 0, 1 },
+		{ 65290, 6821, 0, 1 },
+		{ 65291, 6822, 0, 1 },
+		{ 65292, 6823, 0, 1 },
+		{ 65293, 6824, 0, 1 },
+		{ 65294, 6825, 0, 1 },
+		{ 65295, 6826, 0, 1 },
+		{ 65296, 6827, 0, 1 },
+		{ 65297, 6828, 0, 1 },
+		{ 65298, 6829, 0, 1 },
+		{ 65299, 6830, 0, 1 },
+		{ 65300, 6831, 0, 1 },
+		{ 65301, 6832, 0, 1 },
+		{ 65302, 6833, 0, 1 },
+		{ 65303, 6834, 0, 1 },
+		{ 65304, 6835, 0, 1 },
+		{ 65305, 6836, 0, 1 },
+		{ 65306, 6837, 0, 1 },
+		{ 65307, 6838, 0, 1 },
+		{ 65308, 6839, 0, 1 },
+		{ 65309, 6840, 0, 1 },
+		{ 65310, 6841, 0, 1 },
+		{ 65311, 6842, 0, 1 },
+		{ 65312, 6843, 0, 1 },
+		{ 65313, 6844, 0, 1 },
+		{ 65314, 6845, 0, 1 },
+		{ 65315, 6846, 0, 1 },
+		{ 65316, 6847, 0, 1 },
+		{ 65317, 6848, 0, 1 },
+		{ 65318, 6849, 0, 1 },
+		{ 65319, 6850, 0, 1 },
+		{ 65320, 6851, 0, 1 },
+		{ 65321, 6852, 0, 1 },
+		{ 65322, 6853, 0, 1 },
+		{ 65323, 6854, 0, 1 },
+		{ 65324, 6855, 0, 1 },
+		{ 65325, 6856, 0, 1 },
+		{ 65326, 6857, 0, 1 },
+		{ 65327, 6858, 0, 1 },
+		{ 65328, 6859, 0, 1 },
+		{ 65329, 6860, 0, 1 },
+		{ 65330, 6861, 0, 1 },
+		{ 65331, 6862, 0, 1 },
+		{ 65332, 6863, 0, 1 },
+		{ 65333, 6864, 0, 1 },
+		{ 65334, 6865, 0, 1 },
+		{ 65335, 6866, 0, 1 },
+		{ 65336, 6867, 0, 1 },
+		{ 65337, 6868, 0, 1 },
+		{ 65338, 6869, 0, 1 },
+		{ 65339, 6870, 0, 1 },
+		{ 65340, 6871, 0, 1 },
+		{ 65341, 6872, 0, 1 },
+		{ 65342, 6873, 0, 1 },
+		{ 65343, 6874, 0, 1 },
+		{ 65344, 6875, 0, 1 },
+		{ 65345, 6876, 0, 1 },
+		{ 65346, 6877, 0, 1 },
+		{ 65347, 6878, 0, 1 },
+		{ 65348, 6879, 0, 1 },
+		{ 65349, 6880, 0, 1 },
+		{ 65350, 6881, 0, 1 },
+		{ 65351, 6882, 0, 1 },
+		{ 65352, 6883, 0, 1 },
+		{ 65353, 6884, 0, 1 },
+		{ 65354, 6885, 0, 1 },
+		{ 65355, 6886, 0, 1 },
+		{ 65356, 6887, 0, 1 },
+		{ 65357, 6888, 0, 1 },
+		{ 65358, 6889, 0, 1 },
+		{ 65359, 6890, 0, 1 },
+		{ 65360, 6891, 0, 1 },
+		{ 65361, 6892, 0, 1 },
+		{ 65362, 6893, 0, 1 },
+		{ 65363, 6894, 0, 1 },
+		{ 65364, 6895, 0, 1 },
+		{ 65365, 6896, 0, 1 },
+		{ 65366, 6897, 0, 1 },
+		{ 65367, 6898, 0, 1 },
+		{ 65368, 6899, 0, 1 },
+		{ 65369, 6900, 0, 1 },
+		{ 65370, 6901, 0, 1 },
+		{ 65371, 6902, 0, 1 },
+		{ 65372, 6903, 0, 1 },
+		{ 65373, 6904, 0, 1 },
+		{ 65374, 6905, 0, 1 },
+		{ 65375, 6906, 0, 1 },
+		{ 65376, 6907, 0, 1 },
+		{ 65377, 6908, 0, 1 },
+		{ 65378, 6909, 0, 1 },
+		{ 65379, 6910, 0, 1 },
+		{ 65380, 6911, 0, 1 },
+		{ 65381, 6912, 0, 1 },
+		{ 65382, 6913, 0, 1 },
+		{ 65383, 6914, 0, 1 },
+		{ 65384, 6915, 0, 1 },
+		{ 65385, 6916, 0, 1 },
+		{ 65386, 6917, 0, 1 },
+		{ 65387, 6918, 0, 1 },
+		{ 65388, 6919, 0, 1 },
+		{ 65389, 6920, 0, 1 },
+		{ 65390, 6921, 0, 1 },
+		{ 65391, 6922, 0, 1 },
+		{ 65392, 6923, 0, 1 },
+		{ 65393, 6924, 0, 1 },
+		{ 65394, 6925, 0, 1 },
+		{ 65395, 6926, 0, 1 },
+		{ 65396, 6927, 0, 1 },
+		{ 65397, 6928, 0, 1 },
+		{ 65398, 6929, 0, 1 },
+		{ 65399, 6930, 0, 1 },
+		{ 65400, 6931, 0, 1 },
+		{ 65401, 6932, 0, 1 },
+		{ 65402, 6933, 0, 1 },
+		{ 65403, 6934, 0, 1 },
+		{ 65404, 6935, 0, 1 },
+		{ 65405, 6936, 0, 1 },
+		{ 65406, 6937, 0, 1 },
+		{ 65407, 6938, 0, 1 },
+		{ 65408, 6939, 0, 1 },
+		{ 65409, 6940, 0, 1 },
+		{ 65410, 6941, 0, 1 },
+		{ 65411, 6942, 0, 1 },
+		{ 65412, 6943, 0, 1 },
+		{ 65413, 6944, 0, 1 },
+		{ 65414, 6945, 0, 1 },
+		{ 65415, 6946, 0, 1 },
+		{ 65416, 6947, 0, 1 },
+		{ 65417, 6948, 0, 1 },
+		{ 65418, 6949, 0, 1 },
+		{ 65419, 6950, 0, 1 },
+		{ 65420, 6951, 0, 1 },
+		{ 65421, 6952, 0, 1 },
+		{ 65422, 6953, 0, 1 },
+		{ 65423, 6954, 0, 1 },
+		{ 65424, 6955, 0, 1 },
+		{ 65425, 6956, 0, 1 },
+		{ 65426, 6957, 0, 1 },
+		{ 65427, 6958, 0, 1 },
+		{ 65428, 6959, 0, 1 },
+		{ 65429, 6960, 0, 1 },
+		{ 65430, 6961, 0, 1 },
+		{ 65431, 6962, 0, 1 },
+		{ 65432, 6963, 0, 1 },
+		{ 65433, 6964, 0, 1 },
+		{ 65434, 6965, 0, 1 },
+		{ 65435, 6966, 0, 1 },
+		{ 65436, 6967, 0, 1 },
+		{ 65437, 6968, 0, 1 },
+		{ 65438, 6969, 0, 1 },
+		{ 65439, 6970, 0, 1 },
+		{ 65440, 6971, 0, 1 },
+		{ 65441, 6972, 0, 1 },
+		{ 65442, 6973, 0, 1 },
+		{ 65443, 6974, 0, 1 },
+		{ 65444, 6975, 0, 1 },
+		{ 65445, 6976, 0, 1 },
+		{ 65446, 6977, 0, 1 },
+		{ 65447, 6978, 0, 1 },
+		{ 65448, 6979, 0, 1 },
+		{ 65449, 6980, 0, 1 },
+		{ 65450, 6981, 0, 1 },
+		{ 65451, 6982, 0, 1 },
+		{ 65452, 6983, 0, 1 },
+		{ 65453, 6984, 0, 1 },
+		{ 65454, 6985, 0, 1 },
+		{ 65455, 6986, 0, 1 },
+		{ 65456, 6987, 0, 1 },
+		{ 65457, 6988, 0, 1 },
+		{ 65458, 6989, 0, 1 },
+		{ 65459, 6990, 0, 1 },
+		{ 65460, 6991, 0, 1 },
+		{ 65461, 6992, 0, 1 },
+		{ 65462, 6993, 0, 1 },
+		{ 65463, 6994, 0, 1 },
+		{ 65464, 6995, 0, 1 },
+		{ 65465, 6996, 0, 1 },
+		{ 65466, 6997, 0, 1 },
+		{ 65467, 6998, 0, 1 },
+		{ 65468, 6999, 0, 1 },
+		{ 65469, 7000, 0, 1 },
+		{ 65470, 7001, 0, 1 },
+		{ 65474, 7002, 0, 1 },
+		{ 65475, 7003, 0, 1 },
+		{ 65476, 7004, 0, 1 },
+		{ 65477, 7005, 0, 1 },
+		{ 65478, 7006, 0, 1 },
+		{ 65479, 7007, 0, 1 },
+		{ 65482, 7008, 0, 1 },
+		{ 65483, 7009, 0, 1 },
+		{ 65484, 7010, 0, 1 },
+		{ 65485, 7011, 0, 1 },
+		{ 65486, 7012, 0, 1 },
+		{ 65487, 7013, 0, 1 },
+		{ 65490, 7014, 0, 1 },
+		{ 65491, 7015, 0, 1 },
+		{ 65492, 7016, 0, 1 },
+		{ 65493, 7017, 0, 1 },
+		{ 65494, 7018, 0, 1 },
+		{ 65495, 7019, 0, 1 },
+		{ 65498, 7020, 0, 1 },
+		{ 65499, 7021, 0, 1 },
+		{ 65500, 7022, 0, 1 },
+		{ 65504, 7023, 0, 1 },
+		{ 65505, 7024, 0, 1 },
+		{ 65506, 7025, 0, 1 },
+		{ 65507, 7026, 0, 2 },
+		{ 65508, 7028, 0, 1 },
+		{ 65509, 7029, 0, 1 },
+		{ 65510, 7030, 0, 1 },
+		{ 65512, 7031, 0, 1 },
+		{ 65513, 7032, 0, 1 },
+		{ 65514, 7033, 0, 1 },
+		{ 65515, 7034, 0, 1 },
+		{ 65516, 7035, 0, 1 },
+		{ 65517, 7036, 0, 1 },
+		{ 65518, 7037, 0, 1 },
+		{ 67457, 7038, 0, 1 },
+		{ 67458, 7039, 0, 1 },
+		{ 67459, 7040, 0, 1 },
+		{ 67460, 7041, 0, 1 },
+		{ 67461, 7042, 0, 1 },
+		{ 67463, 7043, 0, 1 },
+		{ 67464, 7044, 0, 1 },
+		{ 67465, 7045, 0, 1 },
+		{ 67466, 7046, 0, 1 },
+		{ 67467, 7047, 0, 1 },
+		{ 67468, 7048, 0, 1 },
+		{ 67469, 7049, 0, 1 },
+		{ 67470, 7050, 0, 1 },
+		{ 67471, 7051, 0, 1 },
+		{ 67472, 7052, 0, 1 },
+		{ 67473, 7053, 0, 1 },
+		{ 67474, 7054, 0, 1 },
+		{ 67475, 7055, 0, 1 },
+		{ 67476, 7056, 0, 1 },
+		{ 67477, 7057, 0, 1 },
+		{ 67478, 7058, 0, 1 },
+		{ 67479, 7059, 0, 1 },
+		{ 67480, 7060, 0, 1 },
+		{ 67481, 7061, 0, 1 },
+		{ 67482, 7062, 0, 1 },
+		{ 67483, 7063, 0, 1 },
+		{ 67484, 7064, 0, 1 },
+		{ 67485, 7065, 0, 1 },
+		{ 67486, 7066, 0, 1 },
+		{ 67487, 7067, 0, 1 },
+		{ 67488, 7068, 0, 1 },
+		{ 67489, 7069, 0, 1 },
+		{ 67490, 7070, 0, 1 },
+		{ 67491, 7071, 0, 1 },
+		{ 67492, 7072, 0, 1 },
+		{ 67493, 7073, 0, 1 },
+		{ 67494, 7074, 0, 1 },
+		{ 67495, 7075, 0, 1 },
+		{ 67496, 7076, 0, 1 },
+		{ 67497, 7077, 0, 1 },
+		{ 67498, 7078, 0, 1 },
+		{ 67499, 7079, 0, 1 },
+		{ 67500, 7080, 0, 1 },
+		{ 67501, 7081, 0, 1 },
+		{ 67502, 7082, 0, 1 },
+		{ 67503, 7083, 0, 1 },
+		{ 67504, 7084, 0, 1 },
+		{ 67506, 7085, 0, 1 },
+		{ 67507, 7086, 0, 1 },
+		{ 67508, 7087, 0, 1 },
+		{ 67509, 7088, 0, 1 },
+		{ 67510, 7089, 0, 1 },
+		{ 67511, 7090, 0, 1 },
+		{ 67512, 7091, 0, 1 },
+		{ 67513, 7092, 0, 1 },
+		{ 67514, 7093, 0, 1 },
+		{ 69786, 7094, 2, 0 },
+		{ 69788, 7096, 2, 0 },
+		{ 69803, 7098, 2, 0 },
+		{ 69934, 7100, 2, 0 },
+		{ 69935, 7102, 2, 0 },
+		{ 70475, 7104, 2, 0 },
+		{ 70476, 7106, 2, 0 },
+		{ 70843, 7108, 2, 0 },
+		{ 70844, 7110, 2, 0 },
+		{ 70846, 7112, 2, 0 },
+		{ 71098, 7114, 2, 0 },
+		{ 71099, 7116, 2, 0 },
+		{ 71992, 7118, 2, 0 },
+		{ 119134, 7120, 2, 0 },
+		{ 119135, 7122, 2, 0 },
+		{ 119136, 7124, 3, 0 },
+		{ 119137, 7127, 3, 0 },
+		{ 119138, 7130, 3, 0 },
+		{ 119139, 7133, 3, 0 },
+		{ 119140, 7136, 3, 0 },
+		{ 119227, 7139, 2, 0 },
+		{ 119228, 7141, 2, 0 },
+		{ 119229, 7143, 3, 0 },
+		{ 119230, 7146, 3, 0 },
+		{ 119231, 7149, 3, 0 },
+		{ 119232, 7152, 3, 0 },
+		{ 119808, 7155, 0, 1 },
+		{ 119809, 7156, 0, 1 },
+		{ 119810, 7157, 0, 1 },
+		{ 119811, 7158, 0, 1 },
+		{ 119812, 7159, 0, 1 },
+		{ 119813, 7160, 0, 1 },
+		{ 119814, 7161, 0, 1 },
+		{ 119815, 7162, 0, 1 },
+		{ 119816, 7163, 0, 1 },
+		{ 119817, 7164, 0, 1 },
+		{ 119818, 7165, 0, 1 },
+		{ 119819, 7166, 0, 1 },
+		{ 119820, 7167, 0, 1 },
+		{ 119821, 7168, 0, 1 },
+		{ 119822, 7169, 0, 1 },
+		{ 119823, 7170, 0, 1 },
+		{ 119824, 7171, 0, 1 },
+		{ 119825, 7172, 0, 1 },
+		{ 119826, 7173, 0, 1 },
+		{ 119827, 7174, 0, 1 },
+		{ 119828, 7175, 0, 1 },
+		{ 119829, 7176, 0, 1 },
+		{ 119830, 7177, 0, 1 },
+		{ 119831, 7178, 0, 1 },
+		{ 119832, 7179, 0, 1 },
+		{ 119833, 7180, 0, 1 },
+		{ 119834, 7181, 0, 1 },
+		{ 119835, 7182, 0, 1 },
+		{ 119836, 7183, 0, 1 },
+		{ 119837, 7184, 0, 1 },
+		{ 119838, 7185, 0, 1 },
+		{ 119839, 7186, 0, 1 },
+		{ 119840, 7187, 0, 1 },
+		{ 119841, 7188, 0, 1 },
+		{ 119842, 7189, 0, 1 },
+		{ 119843, 7190, 0, 1 },
+		{ 119844, 7191, 0, 1 },
+		{ 119845, 7192, 0, 1 },
+		{ 119846, 7193, 0, 1 },
+		{ 119847, 7194, 0, 1 },
+		{ 119848, 7195, 0, 1 },
+		{ 119849, 7196, 0, 1 },
+		{ 119850, 7197, 0, 1 },
+		{ 119851, 7198, 0, 1 },
+		{ 119852, 7199, 0, 1 },
+		{ 119853, 7200, 0, 1 },
+		{ 119854, 7201, 0, 1 },
+		{ 119855, 7202, 0, 1 },
+		{ 119856, 7203, 0, 1 },
+		{ 119857, 7204, 0, 1 },
+		{ 119858, 7205, 0, 1 },
+		{ 119859, 7206, 0, 1 },
+		{ 119860, 7207, 0, 1 },
+		{ 119861, 7208, 0, 1 },
+		{ 119862, 7209, 0, 1 },
+		{ 119863, 7210, 0, 1 },
+		{ 119864, 7211, 0, 1 },
+		{ 119865, 7212, 0, 1 },
+		{ 119866, 7213, 0, 1 },
+		{ 119867, 7214, 0, 1 },
+		{ 119868, 7215, 0, 1 },
+		{ 119869, 7216, 0, 1 },
+		{ 119870, 7217, 0, 1 },
+		{ 119871, 7218, 0, 1 },
+		{ 119872, 7219, 0, 1 },
+		{ 119873, 7220, 0, 1 },
+		{ 119874, 7221, 0, 1 },
+		{ 119875, 7222, 0, 1 },
+		{ 119876, 7223, 0, 1 },
+		{ 119877, 7224, 0, 1 },
+		{ 119878, 7225, 0, 1 },
+		{ 119879, 7226, 0, 1 },
+		{ 119880, 7227, 0, 1 },
+		{ 119881, 7228, 0, 1 },
+		{ 119882, 7229, 0, 1 },
+		{ 119883, 7230, 0, 1 },
+		{ 119884, 7231, 0, 1 },
+		{ 119885, 7232, 0, 1 },
+		{ 119886, 7233, 0, 1 },
+		{ 119887, 7234, 0, 1 },
+		{ 119888, 7235, 0, 1 },
+		{ 119889, 7236, 0, 1 },
+		{ 119890, 7237, 0, 1 },
+		{ 119891, 7238, 0, 1 },
+		{ 119892, 7239, 0, 1 },
+		{ 119894, 7240, 0, 1 },
+		{ 119895, 7241, 0, 1 },
+		{ 119896, 7242, 0, 1 },
+		{ 119897, 7243, 0, 1 },
+		{ 119898, 7244, 0, 1 },
+		{ 119899, 7245, 0, 1 },
+		{ 119900, 7246, 0, 1 },
+		{ 119901, 7247, 0, 1 },
+		{ 119902, 7248, 0, 1 },
+		{ 119903, 7249, 0, 1 },
+		{ 119904, 7250, 0, 1 },
+		{ 119905, 7251, 0, 1 },
+		{ 119906, 7252, 0, 1 },
+		{ 119907, 7253, 0, 1 },
+		{ 119908, 7254, 0, 1 },
+		{ 119909, 7255, 0, 1 },
+		{ 119910, 7256, 0, 1 },
+		{ 119911, 7257, 0, 1 },
+		{ 119912, 7258, 0, 1 },
+		{ 119913, 7259, 0, 1 },
+		{ 119914, 7260, 0, 1 },
+		{ 119915, 7261, 0, 1 },
+		{ 119916, 7262, 0, 1 },
+		{ 119917, 7263, 0, 1 },
+		{ 119918, 7264, 0, 1 },
+		{ 119919, 7265, 0, 1 },
+		{ 119920, 7266, 0, 1 },
+		{ 119921, 7267, 0, 1 },
+		{ 119922, 7268, 0, 1 },
+		{ 119923, 7269, 0, 1 },
+		{ 119924, 7270, 0, 1 },
+		{ 119925, 7271, 0, 1 },
+		{ 119926, 7272, 0, 1 },
+		{ 119927, 7273, 0, 1 },
+		{ 119928, 7274, 0, 1 },
+		{ 119929, 7275, 0, 1 },
+		{ 119930, 7276, 0, 1 },
+		{ 119931, 7277, 0, 1 },
+		{ 119932, 7278, 0, 1 },
+		{ 119933, 7279, 0, 1 },
+		{ 119934, 7280, 0, 1 },
+		{ 119935, 7281, 0, 1 },
+		{ 119936, 7282, 0, 1 },
+		{ 119937, 7283, 0, 1 },
+		{ 119938, 7284, 0, 1 },
+		{ 119939, 7285, 0, 1 },
+		{ 119940, 7286, 0, 1 },
+		{ 119941, 7287, 0, 1 },
+		{ 119942, 7288, 0, 1 },
+		{ 119943, 7289, 0, 1 },
+		{ 119944, 7290, 0, 1 },
+		{ 119945, 7291, 0, 1 },
+		{ 119946, 7292, 0, 1 },
+		{ 119947, 7293, 0, 1 },
+		{ 119948, 7294, 0, 1 },
+		{ 119949, 7295, 0, 1 },
+		{ 119950, 7296, 0, 1 },
+		{ 119951, 7297, 0, 1 },
+		{ 119952, 7298, 0, 1 },
+		{ 119953, 7299, 0, 1 },
+		{ 119954, 7300, 0, 1 },
+		{ 119955, 7301, 0, 1 },
+		{ 119956, 7302, 0, 1 },
+		{ 119957, 7303, 0, 1 },
+		{ 119958, 7304, 0, 1 },
+		{ 119959, 7305, 0, 1 },
+		{ 119960, 7306, 0, 1 },
+		{ 119961, 7307, 0, 1 },
+		{ 119962, 7308, 0, 1 },
+		{ 119963, 7309, 0, 1 },
+		{ 119964, 7310, 0, 1 },
+		{ 119966, 7311, 0, 1 },
+		{ 119967, 7312, 0, 1 },
+		{ 119970, 7313, 0, 1 },
+		{ 119973, 7314, 0, 1 },
+		{ 119974, 7315, 0, 1 },
+		{ 119977, 7316, 0, 1 },
+		{ 119978, 7317, 0, 1 },
+		{ 119979, 7318, 0, 1 },
+		{ 119980, 7319, 0, 1 },
+		{ 119982, 7320, 0, 1 },
+		{ 119983, 7321, 0, 1 },
+		{ 119984, 7322, 0, 1 },
+		{ 119985, 7323, 0, 1 },
+		{ 119986, 7324, 0, 1 },
+		{ 119987, 7325, 0, 1 },
+		{ 119988, 7326, 0, 1 },
+		{ 119989, 7327, 0, 1 },
+		{ 119990, 7328, 0, 1 },
+		{ 119991, 7329, 0, 1 },
+		{ 119992, 7330, 0, 1 },
+		{ 119993, 7331, 0, 1 },
+		{ 119995, 7332, 0, 1 },
+		{ 119997, 7333, 0, 1 },
+		{ 119998, 7334, 0, 1 },
+		{ 119999, 7335, 0, 1 },
+		{ 120000, 7336, 0, 1 },
+		{ 120001, 7337, 0, 1 },
+		{ 120002, 7338, 0, 1 },
+		{ 120003, 7339, 0, 1 },
+		{ 120005, 7340, 0, 1 },
+		{ 120006, 7341, 0, 1 },
+		{ 120007, 7342, 0, 1 },
+		{ 120008, 7343, 0, 1 },
+		{ 120009, 7344, 0, 1 },
+		{ 120010, 7345, 0, 1 },
+		{ 120011, 7346, 0, 1 },
+		{ 120012, 7347, 0, 1 },
+		{ 120013, 7348, 0, 1 },
+		{ 120014, 7349, 0, 1 },
+		{ 120015, 7350, 0, 1 },
+		{ 120016, 7351, 0, 1 },
+		{ 120017, 7352, 0, 1 },
+		{ 120018, 7353, 0, 1 },
+		{ 120019, 7354, 0, 1 },
+		{ 120020, 7355, 0, 1 },
+		{ 120021, 7356, 0, 1 },
+		{ 120022, 7357, 0, 1 },
+		{ 120023, 7358, 0, 1 },
+		{ 120024, 7359, 0, 1 },
+		{ 120025, 7360, 0, 1 },
+		{ 120026, 7361, 0, 1 },
+		{ 120027, 7362, 0, 1 },
+		{ 120028, 7363, 0, 1 },
+		{ 120029, 7364, 0, 1 },
+		{ 120030, 7365, 0, 1 },
+		{ 120031, 7366, 0, 1 },
+		{ 120032, 7367, 0, 1 },
+		{ 120033, 7368, 0, 1 },
+		{ 120034, 7369, 0, 1 },
+		{ 120035, 7370, 0, 1 },
+		{ 120036, 7371, 0, 1 },
+		{ 120037, 7372, 0, 1 },
+		{ 120038, 7373, 0, 1 },
+		{ 120039, 7374, 0, 1 },
+		{ 120040, 7375, 0, 1 },
+		{ 120041, 7376, 0, 1 },
+		{ 120042, 7377, 0, 1 },
+		{ 120043, 7378, 0, 1 },
+		{ 120044, 7379, 0, 1 },
+		{ 120045, 7380, 0, 1 },
+		{ 120046, 7381, 0, 1 },
+		{ 120047, 7382, 0, 1 },
+		{ 120048, 7383, 0, 1 },
+		{ 120049, 7384, 0, 1 },
+		{ 120050, 7385, 0, 1 },
+		{ 120051, 7386, 0, 1 },
+		{ 120052, 7387, 0, 1 },
+		{ 120053, 7388, 0, 1 },
+		{ 120054, 7389, 0, 1 },
+		{ 120055, 7390, 0, 1 },
+		{ 120056, 7391, 0, 1 },
+		{ 120057, 7392, 0, 1 },
+		{ 120058, 7393, 0, 1 },
+		{ 120059, 7394, 0, 1 },
+		{ 120060, 7395, 0, 1 },
+		{ 120061, 7396, 0, 1 },
+		{ 120062, 7397, 0, 1 },
+		{ 120063, 7398, 0, 1 },
+		{ 120064, 7399, 0, 1 },
+		{ 120065, 7400, 0, 1 },
+		{ 120066, 7401, 0, 1 },
+		{ 120067, 7402, 0, 1 },
+		{ 120068, 7403, 0, 1 },
+		{ 120069, 7404, 0, 1 },
+		{ 120071, 7405, 0, 1 },
+		{ 120072, 7406, 0, 1 },
+		{ 120073, 7407, 0, 1 },
+		{ 120074, 7408, 0, 1 },
+		{ 120077, 7409, 0, 1 },
+		{ 120078, 7410, 0, 1 },
+		{ 120079, 7411, 0, 1 },
+		{ 120080, 7412, 0, 1 },
+		{ 120081, 7413, 0, 1 },
+		{ 120082, 7414, 0, 1 },
+		{ 120083, 7415, 0, 1 },
+		{ 120084, 7416, 0, 1 },
+		{ 120086, 7417, 0, 1 },
+		{ 120087, 7418, 0, 1 },
+		{ 120088, 7419, 0, 1 },
+		{ 120089, 7420, 0, 1 },
+		{ 120090, 7421, 0, 1 },
+		{ 120091, 7422, 0, 1 },
+		{ 120092, 7423, 0, 1 },
+		{ 120094, 7424, 0, 1 },
+		{ 120095, 7425, 0, 1 },
+		{ 120096, 7426, 0, 1 },
+		{ 120097, 7427, 0, 1 },
+		{ 120098, 7428, 0, 1 },
+		{ 120099, 7429, 0, 1 },
+		{ 120100, 7430, 0, 1 },
+		{ 120101, 7431, 0, 1 },
+		{ 120102, 7432, 0, 1 },
+		{ 120103, 7433, 0, 1 },
+		{ 120104, 7434, 0, 1 },
+		{ 120105, 7435, 0, 1 },
+		{ 120106, 7436, 0, 1 },
+		{ 120107, 7437, 0, 1 },
+		{ 120108, 7438, 0, 1 },
+		{ 120109, 7439, 0, 1 },
+		{ 120110, 7440, 0, 1 },
+		{ 120111, 7441, 0, 1 },
+		{ 120112, 7442, 0, 1 },
+		{ 120113, 7443, 0, 1 },
+		{ 120114, 7444, 0, 1 },
+		{ 120115, 7445, 0, 1 },
+		{ 120116, 7446, 0, 1 },
+		{ 120117, 7447, 0, 1 },
+		{ 120118, 7448, 0, 1 },
+		{ 120119, 7449, 0, 1 },
+		{ 120120, 7450, 0, 1 },
+		{ 120121, 7451, 0, 1 },
+		{ 120123, 7452, 0, 1 },
+		{ 120124, 7453, 0, 1 },
+		{ 120125, 7454, 0, 1 },
+		{ 120126, 7455, 0, 1 },
+		{ 120128, 7456, 0, 1 },
+		{ 120129, 7457, 0, 1 },
+		{ 120130, 7458, 0, 1 },
+		{ 120131, 7459, 0, 1 },
+		{ 120132, 7460, 0, 1 },
+		{ 120134, 7461, 0, 1 },
+		{ 120138, 7462, 0, 1 },
+		{ 120139, 7463, 0, 1 },
+		{ 120140, 7464, 0, 1 },
+		{ 120141, 7465, 0, 1 },
+		{ 120142, 7466, 0, 1 },
+		{ 120143, 7467, 0, 1 },
+		{ 120144, 7468, 0, 1 },
+		{ 120146, 7469, 0, 1 },
+		{ 120147, 7470, 0, 1 },
+		{ 120148, 7471, 0, 1 },
+		{ 120149, 7472, 0, 1 },
+		{ 120150, 7473, 0, 1 },
+		{ 120151, 7474, 0, 1 },
+		{ 120152, 7475, 0, 1 },
+		{ 120153, 7476, 0, 1 },
+		{ 120154, 7477, 0, 1 },
+		{ 120155, 7478, 0, 1 },
+		{ 120156, 7479, 0, 1 },
+		{ 120157, 7480, 0, 1 },
+		{ 120158, 7481, 0, 1 },
+		{ 120159, 7482, 0, 1 },
+		{ 120160, 7483, 0, 1 },
+		{ 120161, 7484, 0, 1 },
+		{ 120162, 7485, 0, 1 },
+		{ 120163, 7486, 0, 1 },
+		{ 120164, 7487, 0, 1 },
+		{ 120165, 7488, 0, 1 },
+		{ 120166, 7489, 0, 1 },
+		{ 120167, 7490, 0, 1 },
+		{ 120168, 7491, 0, 1 },
+		{ 120169, 7492, 0, 1 },
+		{ 120170, 7493, 0, 1 },
+		{ 120171, 7494, 0, 1 },
+		{ 120172, 7495, 0, 1 },
+		{ 120173, 7496, 0, 1 },
+		{ 120174, 7497, 0, 1 },
+		{ 120175, 7498, 0, 1 },
+		{ 120176, 7499, 0, 1 },
+		{ 120177, 7500, 0, 1 },
+		{ 120178, 7501, 0, 1 },
+		{ 120179, 7502, 0, 1 },
+		{ 120180, 7503, 0, 1 },
+		{ 120181, 7504, 0, 1 },
+		{ 120182, 7505, 0, 1 },
+		{ 120183, 7506, 0, 1 },
+		{ 120184, 7507, 0, 1 },
+		{ 120185, 7508, 0, 1 },
+		{ 120186, 7509, 0, 1 },
+		{ 120187, 7510, 0, 1 },
+		{ 120188, 7511, 0, 1 },
+		{ 120189, 7512, 0, 1 },
+		{ 120190, 7513, 0, 1 },
+		{ 120191, 7514, 0, 1 },
+		{ 120192, 7515, 0, 1 },
+		{ 120193, 7516, 0, 1 },
+		{ 120194, 7517, 0, 1 },
+		{ 120195, 7518, 0, 1 },
+		{ 120196, 7519, 0, 1 },
+		{ 120197, 7520, 0, 1 },
+		{ 120198, 7521, 0, 1 },
+		{ 120199, 7522, 0, 1 },
+		{ 120200, 7523, 0, 1 },
+		{ 120201, 7524, 0, 1 },
+		{ 120202, 7525, 0, 1 },
+		{ 120203, 7526, 0, 1 },
+		{ 120204, 7527, 0, 1 },
+		{ 120205, 7528, 0, 1 },
+		{ 120206, 7529, 0, 1 },
+		{ 120207, 7530, 0, 1 },
+		{ 120208, 7531, 0, 1 },
+		{ 120209, 7532, 0, 1 },
+		{ 120210, 7533, 0, 1 },
+		{ 120211, 7534, 0, 1 },
+		{ 120212, 7535, 0, 1 },
+		{ 120213, 7536, 0, 1 },
+		{ 120214, 7537, 0, 1 },
+		{ 120215, 7538, 0, 1 },
+		{ 120216, 7539, 0, 1 },
+		{ 120217, 7540, 0, 1 },
+		{ 120218, 7541, 0, 1 },
+		{ 120219, 7542, 0, 1 },
+		{ 120220, 7543, 0, 1 },
+		{ 120221, 7544, 0, 1 },
+		{ 120222, 7545, 0, 1 },
+		{ 120223, 7546, 0, 1 },
+		{ 120224, 7547, 0, 1 },
+		{ 120225, 7548, 0, 1 },
+		{ 120226, 7549, 0, 1 },
+		{ 120227, 7550, 0, 1 },
+		{ 120228, 7551, 0, 1 },
+		{ 120229, 7552, 0, 1 },
+		{ 120230, 7553, 0, 1 },
+		{ 120231, 7554, 0, 1 },
+		{ 120232, 7555, 0, 1 },
+		{ 120233, 7556, 0, 1 },
+		{ 120234, 7557, 0, 1 },
+		{ 120235, 7558, 0, 1 },
+		{ 120236, 7559, 0, 1 },
+		{ 120237, 7560, 0, 1 },
+		{ 120238, 7561, 0, 1 },
+		{ 120239, 7562, 0, 1 },
+		{ 120240, 7563, 0, 1 },
+		{ 120241, 7564, 0, 1 },
+		{ 120242, 7565, 0, 1 },
+		{ 120243, 7566, 0, 1 },
+		{ 120244, 7567, 0, 1 },
+		{ 120245, 7568, 0, 1 },
+		{ 120246, 7569, 0, 1 },
+		{ 120247, 7570, 0, 1 },
+		{ 120248, 7571, 0, 1 },
+		{ 120249, 7572, 0, 1 },
+		{ 120250, 7573, 0, 1 },
+		{ 120251, 7574, 0, 1 },
+		{ 120252, 7575, 0, 1 },
+		{ 120253, 7576, 0, 1 },
+		{ 120254, 7577, 0, 1 },
+		{ 120255, 7578, 0, 1 },
+		{ 120256, 7579, 0, 1 },
+		{ 120257, 7580, 0, 1 },
+		{ 120258, 7581, 0, 1 },
+		{ 120259, 7582, 0, 1 },
+		{ 120260, 7583, 0, 1 },
+		{ 120261, 7584, 0, 1 },
+		{ 120262, 7585, 0, 1 },
+		{ 120263, 7586, 0, 1 },
+		{ 120264, 7587, 0, 1 },
+		{ 120265, 7588, 0, 1 },
+		{ 120266, 7589, 0, 1 },
+		{ 120267, 7590, 0, 1 },
+		{ 120268, 7591, 0, 1 },
+		{ 120269, 7592, 0, 1 },
+		{ 120270, 7593, 0, 1 },
+		{ 120271, 7594, 0, 1 },
+		{ 120272, 7595, 0, 1 },
+		{ 120273, 7596, 0, 1 },
+		{ 120274, 7597, 0, 1 },
+		{ 120275, 7598, 0, 1 },
+		{ 120276, 7599, 0, 1 },
+		{ 120277, 7600, 0, 1 },
+		{ 120278, 7601, 0, 1 },
+		{ 120279, 7602, 0, 1 },
+		{ 120280, 7603, 0, 1 },
+		{ 120281, 7604, 0, 1 },
+		{ 120282, 7605, 0, 1 },
+		{ 120283, 7606, 0, 1 },
+		{ 120284, 7607, 0, 1 },
+		{ 120285, 7608, 0, 1 },
+		{ 120286, 7609, 0, 1 },
+		{ 120287, 7610, 0, 1 },
+		{ 120288, 7611, 0, 1 },
+		{ 120289, 7612, 0, 1 },
+		{ 120290, 7613, 0, 1 },
+		{ 120291, 7614, 0, 1 },
+		{ 120292, 7615, 0, 1 },
+		{ 120293, 7616, 0, 1 },
+		{ 120294, 7617, 0, 1 },
+		{ 120295, 7618, 0, 1 },
+		{ 120296, 7619, 0, 1 },
+		{ 120297, 7620, 0, 1 },
+		{ 120298, 7621, 0, 1 },
+		{ 120299, 7622, 0, 1 },
+		{ 120300, 7623, 0, 1 },
+		{ 120301, 7624, 0, 1 },
+		{ 120302, 7625, 0, 1 },
+		{ 120303, 7626, 0, 1 },
+		{ 120304, 7627, 0, 1 },
+		{ 120305, 7628, 0, 1 },
+		{ 120306, 7629, 0, 1 },
+		{ 120307, 7630, 0, 1 },
+		{ 120308, 7631, 0, 1 },
+		{ 120309, 7632, 0, 1 },
+		{ 120310, 7633, 0, 1 },
+		{ 120311, 7634, 0, 1 },
+		{ 120312, 7635, 0, 1 },
+		{ 120313, 7636, 0, 1 },
+		{ 120314, 7637, 0, 1 },
+		{ 120315, 7638, 0, 1 },
+		{ 120316, 7639, 0, 1 },
+		{ 120317, 7640, 0, 1 },
+		{ 120318, 7641, 0, 1 },
+		{ 120319, 7642, 0, 1 },
+		{ 120320, 7643, 0, 1 },
+		{ 120321, 7644, 0, 1 },
+		{ 120322, 7645, 0, 1 },
+		{ 120323, 7646, 0, 1 },
+		{ 120324, 7647, 0, 1 },
+		{ 120325, 7648, 0, 1 },
+		{ 120326, 7649, 0, 1 },
+		{ 120327, 7650, 0, 1 },
+		{ 120328, 7651, 0, 1 },
+		{ 120329, 7652, 0, 1 },
+		{ 120330, 7653, 0, 1 },
+		{ 120331, 7654, 0, 1 },
+		{ 120332, 7655, 0, 1 },
+		{ 120333, 7656, 0, 1 },
+		{ 120334, 7657, 0, 1 },
+		{ 120335, 7658, 0, 1 },
+		{ 120336, 7659, 0, 1 },
+		{ 120337, 7660, 0, 1 },
+		{ 120338, 7661, 0, 1 },
+		{ 120339, 7662, 0, 1 },
+		{ 120340, 7663, 0, 1 },
+		{ 120341, 7664, 0, 1 },
+		{ 120342, 7665, 0, 1 },
+		{ 120343, 7666, 0, 1 },
+		{ 120344, 7667, 0, 1 },
+		{ 120345, 7668, 0, 1 },
+		{ 120346, 7669, 0, 1 },
+		{ 120347, 7670, 0, 1 },
+		{ 120348, 7671, 0, 1 },
+		{ 120349, 7672, 0, 1 },
+		{ 120350, 7673, 0, 1 },
+		{ 120351, 7674, 0, 1 },
+		{ 120352, 7675, 0, 1 },
+		{ 120353, 7676, 0, 1 },
+		{ 120354, 7677, 0, 1 },
+		{ 120355, 7678, 0, 1 },
+		{ 120356, 7679, 0, 1 },
+		{ 120357, 7680, 0, 1 },
+		{ 120358, 7681, 0, 1 },
+		{ 120359, 7682, 0, 1 },
+		{ 120360, 7683, 0, 1 },
+		{ 120361, 7684, 0, 1 },
+		{ 120362, 7685, 0, 1 },
+		{ 120363, 7686, 0, 1 },
+		{ 120364, 7687, 0, 1 },
+		{ 120365, 7688, 0, 1 },
+		{ 120366, 7689, 0, 1 },
+		{ 120367, 7690, 0, 1 },
+		{ 120368, 7691, 0, 1 },
+		{ 120369, 7692, 0, 1 },
+		{ 120370, 7693, 0, 1 },
+		{ 120371, 7694, 0, 1 },
+		{ 120372, 7695, 0, 1 },
+		{ 120373, 7696, 0, 1 },
+		{ 120374, 7697, 0, 1 },
+		{ 120375, 7698, 0, 1 },
+		{ 120376, 7699, 0, 1 },
+		{ 120377, 7700, 0, 1 },
+		{ 120378, 7701, 0, 1 },
+		{ 120379, 7702, 0, 1 },
+		{ 120380, 7703, 0, 1 },
+		{ 120381, 7704, 0, 1 },
+		{ 120382, 7705, 0, 1 },
+		{ 120383, 7706, 0, 1 },
+		{ 120384, 7707, 0, 1 },
+		{ 120385, 7708, 0, 1 },
+		{ 120386, 7709, 0, 1 },
+		{ 120387, 7710, 0, 1 },
+		{ 120388, 7711, 0, 1 },
+		{ 120389, 7712, 0, 1 },
+		{ 120390, 7713, 0, 1 },
+		{ 120391, 7714, 0, 1 },
+		{ 120392, 7715, 0, 1 },
+		{ 120393, 7716, 0, 1 },
+		{ 120394, 7717, 0, 1 },
+		{ 120395, 7718, 0, 1 },
+		{ 120396, 7719, 0, 1 },
+		{ 120397, 7720, 0, 1 },
+		{ 120398, 7721, 0, 1 },
+		{ 120399, 7722, 0, 1 },
+		{ 120400, 7723, 0, 1 },
+		{ 120401, 7724, 0, 1 },
+		{ 120402, 7725, 0, 1 },
+		{ 120403, 7726, 0, 1 },
+		{ 120404, 7727, 0, 1 },
+		{ 120405, 7728, 0, 1 },
+		{ 120406, 7729, 0, 1 },
+		{ 120407, 7730, 0, 1 },
+		{ 120408, 7731, 0, 1 },
+		{ 120409, 7732, 0, 1 },
+		{ 120410, 7733, 0, 1 },
+		{ 120411, 7734, 0, 1 },
+		{ 120412, 7735, 0, 1 },
+		{ 120413, 7736, 0, 1 },
+		{ 120414, 7737, 0, 1 },
+		{ 120415, 7738, 0, 1 },
+		{ 120416, 7739, 0, 1 },
+		{ 120417, 7740, 0, 1 },
+		{ 120418, 7741, 0, 1 },
+		{ 120419, 7742, 0, 1 },
+		{ 120420, 7743, 0, 1 },
+		{ 120421, 7744, 0, 1 },
+		{ 120422, 7745, 0, 1 },
+		{ 120423, 7746, 0, 1 },
+		{ 120424, 7747, 0, 1 },
+		{ 120425, 7748, 0, 1 },
+		{ 120426, 7749, 0, 1 },
+		{ 120427, 7750, 0, 1 },
+		{ 120428, 7751, 0, 1 },
+		{ 120429, 7752, 0, 1 },
+		{ 120430, 7753, 0, 1 },
+		{ 120431, 7754, 0, 1 },
+		{ 120432, 7755, 0, 1 },
+		{ 120433, 7756, 0, 1 },
+		{ 120434, 7757, 0, 1 },
+		{ 120435, 7758, 0, 1 },
+		{ 120436, 7759, 0, 1 },
+		{ 120437, 7760, 0, 1 },
+		{ 120438, 7761, 0, 1 },
+		{ 120439, 7762, 0, 1 },
+		{ 120440, 7763, 0, 1 },
+		{ 120441, 7764, 0, 1 },
+		{ 120442, 7765, 0, 1 },
+		{ 120443, 7766, 0, 1 },
+		{ 120444, 7767, 0, 1 },
+		{ 120445, 7768, 0, 1 },
+		{ 120446, 7769, 0, 1 },
+		{ 120447, 7770, 0, 1 },
+		{ 120448, 7771, 0, 1 },
+		{ 120449, 7772, 0, 1 },
+		{ 120450, 7773, 0, 1 },
+		{ 120451, 7774, 0, 1 },
+		{ 120452, 7775, 0, 1 },
+		{ 120453, 7776, 0, 1 },
+		{ 120454, 7777, 0, 1 },
+		{ 120455, 7778, 0, 1 },
+		{ 120456, 7779, 0, 1 },
+		{ 120457, 7780, 0, 1 },
+		{ 120458, 7781, 0, 1 },
+		{ 120459, 7782, 0, 1 },
+		{ 120460, 7783, 0, 1 },
+		{ 120461, 7784, 0, 1 },
+		{ 120462, 7785, 0, 1 },
+		{ 120463, 7786, 0, 1 },
+		{ 120464, 7787, 0, 1 },
+		{ 120465, 7788, 0, 1 },
+		{ 120466, 7789, 0, 1 },
+		{ 120467, 7790, 0, 1 },
+		{ 120468, 7791, 0, 1 },
+		{ 120469, 7792, 0, 1 },
+		{ 120470, 7793, 0, 1 },
+		{ 120471, 7794, 0, 1 },
+		{ 120472, 7795, 0, 1 },
+		{ 120473, 7796, 0, 1 },
+		{ 120474, 7797, 0, 1 },
+		{ 120475, 7798, 0, 1 },
+		{ 120476, 7799, 0, 1 },
+		{ 120477, 7800, 0, 1 },
+		{ 120478, 7801, 0, 1 },
+		{ 120479, 7802, 0, 1 },
+		{ 120480, 7803, 0, 1 },
+		{ 120481, 7804, 0, 1 },
+		{ 120482, 7805, 0, 1 },
+		{ 120483, 7806, 0, 1 },
+		{ 120484, 7807, 0, 1 },
+		{ 120485, 7808, 0, 1 },
+		{ 120488, 7809, 0, 1 },
+		{ 120489, 7810, 0, 1 },
+		{ 120490, 7811, 0, 1 },
+		{ 120491, 7812, 0, 1 },
+		{ 120492, 7813, 0, 1 },
+		{ 120493, 7814, 0, 1 },
+		{ 120494, 7815, 0, 1 },
+		{ 120495, 7816, 0, 1 },
+		{ 120496, 7817, 0, 1 },
+		{ 120497, 7818, 0, 1 },
+		{ 120498, 7819, 0, 1 },
+		{ 120499, 7820, 0, 1 },
+		{ 120500, 7821, 0, 1 },
+		{ 120501, 7822, 0, 1 },
+		{ 120502, 7823, 0, 1 },
+		{ 120503, 7824, 0, 1 },
+		{ 120504, 7825, 0, 1 },
+		{ 120505, 7826, 0, 1 },
+		{ 120506, 7827, 0, 1 },
+		{ 120507, 7828, 0, 1 },
+		{ 120508, 7829, 0, 1 },
+		{ 120509, 7830, 0, 1 },
+		{ 120510, 7831, 0, 1 },
+		{ 120511, 7832, 0, 1 },
+		{ 120512, 7833, 0, 1 },
+		{ 120513, 7834, 0, 1 },
+		{ 120514, 7835, 0, 1 },
+		{ 120515, 7836, 0, 1 },
+		{ 120516, 7837, 0, 1 },
+		{ 120517, 7838, 0, 1 },
+		{ 120518, 7839, 0, 1 },
+		{ 120519, 7840, 0, 1 },
+		{ 120520, 7841, 0, 1 },
+		{ 120521, 7842, 0, 1 },
+		{ 120522, 7843, 0, 1 },
+		{ 120523, 7844, 0, 1 },
+		{ 120524, 7845, 0, 1 },
+		{ 120525, 7846, 0, 1 },
+		{ 120526, 7847, 0, 1 },
+		{ 120527, 7848, 0, 1 },
+		{ 120528, 7849, 0, 1 },
+		{ 120529, 7850, 0, 1 },
+		{ 120530, 7851, 0, 1 },
+		{ 120531, 7852, 0, 1 },
+		{ 120532, 7853, 0, 1 },
+		{ 120533, 7854, 0, 1 },
+		{ 120534, 7855, 0, 1 },
+		{ 120535, 7856, 0, 1 },
+		{ 120536, 7857, 0, 1 },
+		{ 120537, 7858, 0, 1 },
+		{ 120538, 7859, 0, 1 },
+		{ 120539, 7860, 0, 1 },
+		{ 120540, 7861, 0, 1 },
+		{ 120541, 7862, 0, 1 },
+		{ 120542, 7863, 0, 1 },
+		{ 120543, 7864, 0, 1 },
+		{ 120544, 7865, 0, 1 },
+		{ 120545, 7866, 0, 1 },
+		{ 120546, 7867, 0, 1 },
+		{ 120547, 7868, 0, 1 },
+		{ 120548, 7869, 0, 1 },
+		{ 120549, 7870, 0, 1 },
+		{ 120550, 7871, 0, 1 },
+		{ 120551, 7872, 0, 1 },
+		{ 120552, 7873, 0, 1 },
+		{ 120553, 7874, 0, 1 },
+		{ 120554, 7875, 0, 1 },
+		{ 120555, 7876, 0, 1 },
+		{ 120556, 7877, 0, 1 },
+		{ 120557, 7878, 0, 1 },
+		{ 120558, 7879, 0, 1 },
+		{ 120559, 7880, 0, 1 },
+		{ 120560, 7881, 0, 1 },
+		{ 120561, 7882, 0, 1 },
+		{ 120562, 7883, 0, 1 },
+		{ 120563, 7884, 0, 1 },
+		{ 120564, 7885, 0, 1 },
+		{ 120565, 7886, 0, 1 },
+		{ 120566, 7887, 0, 1 },
+		{ 120567, 7888, 0, 1 },
+		{ 120568, 7889, 0, 1 },
+		{ 120569, 7890, 0, 1 },
+		{ 120570, 7891, 0, 1 },
+		{ 120571, 7892, 0, 1 },
+		{ 120572, 7893, 0, 1 },
+		{ 120573, 7894, 0, 1 },
+		{ 120574, 7895, 0, 1 },
+		{ 120575, 7896, 0, 1 },
+		{ 120576, 7897, 0, 1 },
+		{ 120577, 7898, 0, 1 },
+		{ 120578, 7899, 0, 1 },
+		{ 120579, 7900, 0, 1 },
+		{ 120580, 7901, 0, 1 },
+		{ 120581, 7902, 0, 1 },
+		{ 120582, 7903, 0, 1 },
+		{ 120583, 7904, 0, 1 },
+		{ 120584, 7905, 0, 1 },
+		{ 120585, 7906, 0, 1 },
+		{ 120586, 7907, 0, 1 },
+		{ 120587, 7908, 0, 1 },
+		{ 120588, 7909, 0, 1 },
+		{ 120589, 7910, 0, 1 },
+		{ 120590, 7911, 0, 1 },
+		{ 120591, 7912, 0, 1 },
+		{ 120592, 7913, 0, 1 },
+		{ 120593, 7914, 0, 1 },
+		{ 120594, 7915, 0, 1 },
+		{ 120595, 7916, 0, 1 },
+		{ 120596, 7917, 0, 1 },
+		{ 120597, 7918, 0, 1 },
+		{ 120598, 7919, 0, 1 },
+		{ 120599, 7920, 0, 1 },
+		{ 120600, 7921, 0, 1 },
+		{ 120601, 7922, 0, 1 },
+		{ 120602, 7923, 0, 1 },
+		{ 120603, 7924, 0, 1 },
+		{ 120604, 7925, 0, 1 },
+		{ 120605, 7926, 0, 1 },
+		{ 120606, 7927, 0, 1 },
+		{ 120607, 7928, 0, 1 },
+		{ 120608, 7929, 0, 1 },
+		{ 120609, 7930, 0, 1 },
+		{ 120610, 7931, 0, 1 },
+		{ 120611, 7932, 0, 1 },
+		{ 120612, 7933, 0, 1 },
+		{ 120613, 7934, 0, 1 },
+		{ 120614, 7935, 0, 1 },
+		{ 120615, 7936, 0, 1 },
+		{ 120616, 7937, 0, 1 },
+		{ 120617, 7938, 0, 1 },
+		{ 120618, 7939, 0, 1 },
+		{ 120619, 7940, 0, 1 },
+		{ 120620, 7941, 0, 1 },
+		{ 120621, 7942, 0, 1 },
+		{ 120622, 7943, 0, 1 },
+		{ 120623, 7944, 0, 1 },
+		{ 120624, 7945, 0, 1 },
+		{ 120625, 7946, 0, 1 },
+		{ 120626, 7947, 0, 1 },
+		{ 120627, 7948, 0, 1 },
+		{ 120628, 7949, 0, 1 },
+		{ 120629, 7950, 0, 1 },
+		{ 120630, 7951, 0, 1 },
+		{ 120631, 7952, 0, 1 },
+		{ 120632, 7953, 0, 1 },
+		{ 120633, 7954, 0, 1 },
+		{ 120634, 7955, 0, 1 },
+		{ 120635, 7956, 0, 1 },
+		{ 120636, 7957, 0, 1 },
+		{ 120637, 7958, 0, 1 },
+		{ 120638, 7959, 0, 1 },
+		{ 120639, 7960, 0, 1 },
+		{ 120640, 7961, 0, 1 },
+		{ 120641, 7962, 0, 1 },
+		{ 120642, 7963, 0, 1 },
+		{ 120643, 7964, 0, 1 },
+		{ 120644, 7965, 0, 1 },
+		{ 120645, 7966, 0, 1 },
+		{ 120646, 7967, 0, 1 },
+		{ 120647, 7968, 0, 1 },
+		{ 120648, 7969, 0, 1 },
+		{ 120649, 7970, 0, 1 },
+		{ 120650, 7971, 0, 1 },
+		{ 120651, 7972, 0, 1 },
+		{ 120652, 7973, 0, 1 },
+		{ 120653, 7974, 0, 1 },
+		{ 120654, 7975, 0, 1 },
+		{ 120655, 7976, 0, 1 },
+		{ 120656, 7977, 0, 1 },
+		{ 120657, 7978, 0, 1 },
+		{ 120658, 7979, 0, 1 },
+		{ 120659, 7980, 0, 1 },
+		{ 120660, 7981, 0, 1 },
+		{ 120661, 7982, 0, 1 },
+		{ 120662, 7983, 0, 1 },
+		{ 120663, 7984, 0, 1 },
+		{ 120664, 7985, 0, 1 },
+		{ 120665, 7986, 0, 1 },
+		{ 120666, 7987, 0, 1 },
+		{ 120667, 7988, 0, 1 },
+		{ 120668, 7989, 0, 1 },
+		{ 120669, 7990, 0, 1 },
+		{ 120670, 7991, 0, 1 },
+		{ 120671, 7992, 0, 1 },
+		{ 120672, 7993, 0, 1 },
+		{ 120673, 7994, 0, 1 },
+		{ 120674, 7995, 0, 1 },
+		{ 120675, 7996, 0, 1 },
+		{ 120676, 7997, 0, 1 },
+		{ 120677, 7998, 0, 1 },
+		{ 120678, 7999, 0, 1 },
+		{ 120679, 8000, 0, 1 },
+		{ 120680, 8001, 0, 1 },
+		{ 120681, 8002, 0, 1 },
+		{ 120682, 8003, 0, 1 },
+		{ 120683, 8004, 0, 1 },
+		{ 120684, 8005, 0, 1 },
+		{ 120685, 8006, 0, 1 },
+		{ 120686, 8007, 0, 1 },
+		{ 120687, 8008, 0, 1 },
+		{ 120688, 8009, 0, 1 },
+		{ 120689, 8010, 0, 1 },
+		{ 120690, 8011, 0, 1 },
+		{ 120691, 8012, 0, 1 },
+		{ 120692, 8013, 0, 1 },
+		{ 120693, 8014, 0, 1 },
+		{ 120694, 8015, 0, 1 },
+		{ 120695, 8016, 0, 1 },
+		{ 120696, 8017, 0, 1 },
+		{ 120697, 8018, 0, 1 },
+		{ 120698, 8019, 0, 1 },
+		{ 120699, 8020, 0, 1 },
+		{ 120700, 8021, 0, 1 },
+		{ 120701, 8022, 0, 1 },
+		{ 120702, 8023, 0, 1 },
+		{ 120703, 8024, 0, 1 },
+		{ 120704, 8025, 0, 1 },
+		{ 120705, 8026, 0, 1 },
+		{ 120706, 8027, 0, 1 },
+		{ 120707, 8028, 0, 1 },
+		{ 120708, 8029, 0, 1 },
+		{ 120709, 8030, 0, 1 },
+		{ 120710, 8031, 0, 1 },
+		{ 120711, 8032, 0, 1 },
+		{ 120712, 8033, 0, 1 },
+		{ 120713, 8034, 0, 1 },
+		{ 120714, 8035, 0, 1 },
+		{ 120715, 8036, 0, 1 },
+		{ 120716, 8037, 0, 1 },
+		{ 120717, 8038, 0, 1 },
+		{ 120718, 8039, 0, 1 },
+		{ 120719, 8040, 0, 1 },
+		{ 120720, 8041, 0, 1 },
+		{ 120721, 8042, 0, 1 },
+		{ 120722, 8043, 0, 1 },
+		{ 120723, 8044, 0, 1 },
+		{ 120724, 8045, 0, 1 },
+		{ 120725, 8046, 0, 1 },
+		{ 120726, 8047, 0, 1 },
+		{ 120727, 8048, 0, 1 },
+		{ 120728, 8049, 0, 1 },
+		{ 120729, 8050, 0, 1 },
+		{ 120730, 8051, 0, 1 },
+		{ 120731, 8052, 0, 1 },
+		{ 120732, 8053, 0, 1 },
+		{ 120733, 8054, 0, 1 },
+		{ 120734, 8055, 0, 1 },
+		{ 120735, 8056, 0, 1 },
+		{ 120736, 8057, 0, 1 },
+		{ 120737, 8058, 0, 1 },
+		{ 120738, 8059, 0, 1 },
+		{ 120739, 8060, 0, 1 },
+		{ 120740, 8061, 0, 1 },
+		{ 120741, 8062, 0, 1 },
+		{ 120742, 8063, 0, 1 },
+		{ 120743, 8064, 0, 1 },
+		{ 120744, 8065, 0, 1 },
+		{ 120745, 8066, 0, 1 },
+		{ 120746, 8067, 0, 1 },
+		{ 120747, 8068, 0, 1 },
+		{ 120748, 8069, 0, 1 },
+		{ 120749, 8070, 0, 1 },
+		{ 120750, 8071, 0, 1 },
+		{ 120751, 8072, 0, 1 },
+		{ 120752, 8073, 0, 1 },
+		{ 120753, 8074, 0, 1 },
+		{ 120754, 8075, 0, 1 },
+		{ 120755, 8076, 0, 1 },
+		{ 120756, 8077, 0, 1 },
+		{ 120757, 8078, 0, 1 },
+		{ 120758, 8079, 0, 1 },
+		{ 120759, 8080, 0, 1 },
+		{ 120760, 8081, 0, 1 },
+		{ 120761, 8082, 0, 1 },
+		{ 120762, 8083, 0, 1 },
+		{ 120763, 8084, 0, 1 },
+		{ 120764, 8085, 0, 1 },
+		{ 120765, 8086, 0, 1 },
+		{ 120766, 8087, 0, 1 },
+		{ 120767, 8088, 0, 1 },
+		{ 120768, 8089, 0, 1 },
+		{ 120769, 8090, 0, 1 },
+		{ 120770, 8091, 0, 1 },
+		{ 120771, 8092, 0, 1 },
+		{ 120772, 8093, 0, 1 },
+		{ 120773, 8094, 0, 1 },
+		{ 120774, 8095, 0, 1 },
+		{ 120775, 8096, 0, 1 },
+		{ 120776, 8097, 0, 1 },
+		{ 120777, 8098, 0, 1 },
+		{ 120778, 8099, 0, 1 },
+		{ 120779, 8100, 0, 1 },
+		{ 120782, 8101, 0, 1 },
+		{ 120783, 8102, 0, 1 },
+		{ 120784, 8103, 0, 1 },
+		{ 120785, 8104, 0, 1 },
+		{ 120786, 8105, 0, 1 },
+		{ 120787, 8106, 0, 1 },
+		{ 120788, 8107, 0, 1 },
+		{ 120789, 8108, 0, 1 },
+		{ 120790, 8109, 0, 1 },
+		{ 120791, 8110, 0, 1 },
+		{ 120792, 8111, 0, 1 },
+		{ 120793, 8112, 0, 1 },
+		{ 120794, 8113, 0, 1 },
+		{ 120795, 8114, 0, 1 },
+		{ 120796, 8115, 0, 1 },
+		{ 120797, 8116, 0, 1 },
+		{ 120798, 8117, 0, 1 },
+		{ 120799, 8118, 0, 1 },
+		{ 120800, 8119, 0, 1 },
+		{ 120801, 8120, 0, 1 },
+		{ 120802, 8121, 0, 1 },
+		{ 120803, 8122, 0, 1 },
+		{ 120804, 8123, 0, 1 },
+		{ 120805, 8124, 0, 1 },
+		{ 120806, 8125, 0, 1 },
+		{ 120807, 8126, 0, 1 },
+		{ 120808, 8127, 0, 1 },
+		{ 120809, 8128, 0, 1 },
+		{ 120810, 8129, 0, 1 },
+		{ 120811, 8130, 0, 1 },
+		{ 120812, 8131, 0, 1 },
+		{ 120813, 8132, 0, 1 },
+		{ 120814, 8133, 0, 1 },
+		{ 120815, 8134, 0, 1 },
+		{ 120816, 8135, 0, 1 },
+		{ 120817, 8136, 0, 1 },
+		{ 120818, 8137, 0, 1 },
+		{ 120819, 8138, 0, 1 },
+		{ 120820, 8139, 0, 1 },
+		{ 120821, 8140, 0, 1 },
+		{ 120822, 8141, 0, 1 },
+		{ 120823, 8142, 0, 1 },
+		{ 120824, 8143, 0, 1 },
+		{ 120825, 8144, 0, 1 },
+		{ 120826, 8145, 0, 1 },
+		{ 120827, 8146, 0, 1 },
+		{ 120828, 8147, 0, 1 },
+		{ 120829, 8148, 0, 1 },
+		{ 120830, 8149, 0, 1 },
+		{ 120831, 8150, 0, 1 },
+		{ 126464, 8151, 0, 1 },
+		{ 126465, 8152, 0, 1 },
+		{ 126466, 8153, 0, 1 },
+		{ 126467, 8154, 0, 1 },
+		{ 126469, 8155, 0, 1 },
+		{ 126470, 8156, 0, 1 },
+		{ 126471, 8157, 0, 1 },
+		{ 126472, 8158, 0, 1 },
+		{ 126473, 8159, 0, 1 },
+		{ 126474, 8160, 0, 1 },
+		{ 126475, 8161, 0, 1 },
+		{ 126476, 8162, 0, 1 },
+		{ 126477, 8163, 0, 1 },
+		{ 126478, 8164, 0, 1 },
+		{ 126479, 8165, 0, 1 },
+		{ 126480, 8166, 0, 1 },
+		{ 126481, 8167, 0, 1 },
+		{ 126482, 8168, 0, 1 },
+		{ 126483, 8169, 0, 1 },
+		{ 126484, 8170, 0, 1 },
+		{ 126485, 8171, 0, 1 },
+		{ 126486, 8172, 0, 1 },
+		{ 126487, 8173, 0, 1 },
+		{ 126488, 8174, 0, 1 },
+		{ 126489, 8175, 0, 1 },
+		{ 126490, 8176, 0, 1 },
+		{ 126491, 8177, 0, 1 },
+		{ 126492, 8178, 0, 1 },
+		{ 126493, 8179, 0, 1 },
+		{ 126494, 8180, 0, 1 },
+		{ 126495, 8181, 0, 1 },
+		{ 126497, 8182, 0, 1 },
+		{ 126498, 8183, 0, 1 },
+		{ 126500, 8184, 0, 1 },
+		{ 126503, 8185, 0, 1 },
+		{ 126505, 8186, 0, 1 },
+		{ 126506, 8187, 0, 1 },
+		{ 126507, 8188, 0, 1 },
+		{ 126508, 8189, 0, 1 },
+		{ 126509, 8190, 0, 1 },
+		{ 126510, 8191, 0, 1 },
+		{ 126511, 8192, 0, 1 },
+		{ 126512, 8193, 0, 1 },
+		{ 126513, 8194, 0, 1 },
+		{ 126514, 8195, 0, 1 },
+		{ 126516, 8196, 0, 1 },
+		{ 126517, 8197, 0, 1 },
+		{ 126518, 8198, 0, 1 },
+		{ 126519, 8199, 0, 1 },
+		{ 126521, 8200, 0, 1 },
+		{ 126523, 8201, 0, 1 },
+		{ 126530, 8202, 0, 1 },
+		{ 126535, 8203, 0, 1 },
+		{ 126537, 8204, 0, 1 },
+		{ 126539, 8205, 0, 1 },
+		{ 126541, 8206, 0, 1 },
+		{ 126542, 8207, 0, 1 },
+		{ 126543, 8208, 0, 1 },
+		{ 126545, 8209, 0, 1 },
+		{ 126546, 8210, 0, 1 },
+		{ 126548, 8211, 0, 1 },
+		{ 126551, 8212, 0, 1 },
+		{ 126553, 8213, 0, 1 },
+		{ 126555, 8214, 0, 1 },
+		{ 126557, 8215, 0, 1 },
+		{ 126559, 8216, 0, 1 },
+		{ 126561, 8217, 0, 1 },
+		{ 126562, 8218, 0, 1 },
+		{ 126564, 8219, 0, 1 },
+		{ 126567, 8220, 0, 1 },
+		{ 126568, 8221, 0, 1 },
+		{ 126569, 8222, 0, 1 },
+		{ 126570, 8223, 0, 1 },
+		{ 126572, 8224, 0, 1 },
+		{ 126573, 8225, 0, 1 },
+		{ 126574, 8226, 0, 1 },
+		{ 126575, 8227, 0, 1 },
+		{ 126576, 8228, 0, 1 },
+		{ 126577, 8229, 0, 1 },
+		{ 126578, 8230, 0, 1 },
+		{ 126580, 8231, 0, 1 },
+		{ 126581, 8232, 0, 1 },
+		{ 126582, 8233, 0, 1 },
+		{ 126583, 8234, 0, 1 },
+		{ 126585, 8235, 0, 1 },
+		{ 126586, 8236, 0, 1 },
+		{ 126587, 8237, 0, 1 },
+		{ 126588, 8238, 0, 1 },
+		{ 126590, 8239, 0, 1 },
+		{ 126592, 8240, 0, 1 },
+		{ 126593, 8241, 0, 1 },
+		{ 126594, 8242, 0, 1 },
+		{ 126595, 8243, 0, 1 },
+		{ 126596, 8244, 0, 1 },
+		{ 126597, 8245, 0, 1 },
+		{ 126598, 8246, 0, 1 },
+		{ 126599, 8247, 0, 1 },
+		{ 126600, 8248, 0, 1 },
+		{ 126601, 8249, 0, 1 },
+		{ 126603, 8250, 0, 1 },
+		{ 126604, 8251, 0, 1 },
+		{ 126605, 8252, 0, 1 },
+		{ 126606, 8253, 0, 1 },
+		{ 126607, 8254, 0, 1 },
+		{ 126608, 8255, 0, 1 },
+		{ 126609, 8256, 0, 1 },
+		{ 126610, 8257, 0, 1 },
+		{ 126611, 8258, 0, 1 },
+		{ 126612, 8259, 0, 1 },
+		{ 126613, 8260, 0, 1 },
+		{ 126614, 8261, 0, 1 },
+		{ 126615, 8262, 0, 1 },
+		{ 126616, 8263, 0, 1 },
+		{ 126617, 8264, 0, 1 },
+		{ 126618, 8265, 0, 1 },
+		{ 126619, 8266, 0, 1 },
+		{ 126625, 8267, 0, 1 },
+		{ 126626, 8268, 0, 1 },
+		{ 126627, 8269, 0, 1 },
+		{ 126629, 8270, 0, 1 },
+		{ 126630, 8271, 0, 1 },
+		{ 126631, 8272, 0, 1 },
+		{ 126632, 8273, 0, 1 },
+		{ 126633, 8274, 0, 1 },
+		{ 126635, 8275, 0, 1 },
+		{ 126636, 8276, 0, 1 },
+		{ 126637, 8277, 0, 1 },
+		{ 126638, 8278, 0, 1 },
+		{ 126639, 8279, 0, 1 },
+		{ 126640, 8280, 0, 1 },
+		{ 126641, 8281, 0, 1 },
+		{ 126642, 8282, 0, 1 },
+		{ 126643, 8283, 0, 1 },
+		{ 126644, 8284, 0, 1 },
+		{ 126645, 8285, 0, 1 },
+		{ 126646, 8286, 0, 1 },
+		{ 126647, 8287, 0, 1 },
+		{ 126648, 8288, 0, 1 },
+		{ 126649, 8289, 0, 1 },
+		{ 126650, 8290, 0, 1 },
+		{ 126651, 8291, 0, 1 },
+		{ 127232, 8292, 0, 2 },
+		{ 127233, 8294, 0, 2 },
+		{ 127234, 8296, 0, 2 },
+		{ 127235, 8298, 0, 2 },
+		{ 127236, 8300, 0, 2 },
+		{ 127237, 8302, 0, 2 },
+		{ 127238, 8304, 0, 2 },
+		{ 127239, 8306, 0, 2 },
+		{ 127240, 8308, 0, 2 },
+		{ 127241, 8310, 0, 2 },
+		{ 127242, 8312, 0, 2 },
+		{ 127248, 8314, 0, 3 },
+		{ 127249, 8317, 0, 3 },
+		{ 127250, 8320, 0, 3 },
+		{ 127251, 8323, 0, 3 },
+		{ 127252, 8326, 0, 3 },
+		{ 127253, 8329, 0, 3 },
+		{ 127254, 8332, 0, 3 },
+		{ 127255, 8335, 0, 3 },
+		{ 127256, 8338, 0, 3 },
+		{ 127257, 8341, 0, 3 },
+		{ 127258, 8344, 0, 3 },
+		{ 127259, 8347, 0, 3 },
+		{ 127260, 8350, 0, 3 },
+		{ 127261, 8353, 0, 3 },
+		{ 127262, 8356, 0, 3 },
+		{ 127263, 8359, 0, 3 },
+		{ 127264, 8362, 0, 3 },
+		{ 127265, 8365, 0, 3 },
+		{ 127266, 8368, 0, 3 },
+		{ 127267, 8371, 0, 3 },
+		{ 127268, 8374, 0, 3 },
+		{ 127269, 8377, 0, 3 },
+		{ 127270, 8380, 0, 3 },
+		{ 127271, 8383, 0, 3 },
+		{ 127272, 8386, 0, 3 },
+		{ 127273, 8389, 0, 3 },
+		{ 127274, 8392, 0, 3 },
+		{ 127275, 8395, 0, 1 },
+		{ 127276, 8396, 0, 1 },
+		{ 127277, 8397, 0, 2 },
+		{ 127278, 8399, 0, 2 },
+		{ 127280, 8401, 0, 1 },
+		{ 127281, 8402, 0, 1 },
+		{ 127282, 8403, 0, 1 },
+		{ 127283, 8404, 0, 1 },
+		{ 127284, 8405, 0, 1 },
+		{ 127285, 8406, 0, 1 },
+		{ 127286, 8407, 0, 1 },
+		{ 127287, 8408, 0, 1 },
+		{ 127288, 8409, 0, 1 },
+		{ 127289, 8410, 0, 1 },
+		{ 127290, 8411, 0, 1 },
+		{ 127291, 8412, 0, 1 },
+		{ 127292, 8413, 0, 1 },
+		{ 127293, 8414, 0, 1 },
+		{ 127294, 8415, 0, 1 },
+		{ 127295, 8416, 0, 1 },
+		{ 127296, 8417, 0, 1 },
+		{ 127297, 8418, 0, 1 },
+		{ 127298, 8419, 0, 1 },
+		{ 127299, 8420, 0, 1 },
+		{ 127300, 8421, 0, 1 },
+		{ 127301, 8422, 0, 1 },
+		{ 127302, 8423, 0, 1 },
+		{ 127303, 8424, 0, 1 },
+		{ 127304, 8425, 0, 1 },
+		{ 127305, 8426, 0, 1 },
+		{ 127306, 8427, 0, 2 },
+		{ 127307, 8429, 0, 2 },
+		{ 127308, 8431, 0, 2 },
+		{ 127309, 8433, 0, 2 },
+		{ 127310, 8435, 0, 3 },
+		{ 127311, 8438, 0, 2 },
+		{ 127338, 8440, 0, 2 },
+		{ 127339, 8442, 0, 2 },
+		{ 127340, 8444, 0, 2 },
+		{ 127376, 8446, 0, 2 },
+		{ 127488, 8448, 0, 2 },
+		{ 127489, 8450, 0, 2 },
+		{ 127490, 8452, 0, 1 },
+		{ 127504, 8453, 0, 1 },
+		{ 127505, 8454, 0, 1 },
+		{ 127506, 8455, 0, 1 },
+		{ 127507, 8456, 0, 2 },
+		{ 127508, 8458, 0, 1 },
+		{ 127509, 8459, 0, 1 },
+		{ 127510, 8460, 0, 1 },
+		{ 127511, 8461, 0, 1 },
+		{ 127512, 8462, 0, 1 },
+		{ 127513, 8463, 0, 1 },
+		{ 127514, 8464, 0, 1 },
+		{ 127515, 8465, 0, 1 },
+		{ 127516, 8466, 0, 1 },
+		{ 127517, 8467, 0, 1 },
+		{ 127518, 8468, 0, 1 },
+		{ 127519, 8469, 0, 1 },
+		{ 127520, 8470, 0, 1 },
+		{ 127521, 8471, 0, 1 },
+		{ 127522, 8472, 0, 1 },
+		{ 127523, 8473, 0, 1 },
+		{ 127524, 8474, 0, 1 },
+		{ 127525, 8475, 0, 1 },
+		{ 127526, 8476, 0, 1 },
+		{ 127527, 8477, 0, 1 },
+		{ 127528, 8478, 0, 1 },
+		{ 127529, 8479, 0, 1 },
+		{ 127530, 8480, 0, 1 },
+		{ 127531, 8481, 0, 1 },
+		{ 127532, 8482, 0, 1 },
+		{ 127533, 8483, 0, 1 },
+		{ 127534, 8484, 0, 1 },
+		{ 127535, 8485, 0, 1 },
+		{ 127536, 8486, 0, 1 },
+		{ 127537, 8487, 0, 1 },
+		{ 127538, 8488, 0, 1 },
+		{ 127539, 8489, 0, 1 },
+		{ 127540, 8490, 0, 1 },
+		{ 127541, 8491, 0, 1 },
+		{ 127542, 8492, 0, 1 },
+		{ 127543, 8493, 0, 1 },
+		{ 127544, 8494, 0, 1 },
+		{ 127545, 8495, 0, 1 },
+		{ 127546, 8496, 0, 1 },
+		{ 127547, 8497, 0, 1 },
+		{ 127552, 8498, 0, 3 },
+		{ 127553, 8501, 0, 3 },
+		{ 127554, 8504, 0, 3 },
+		{ 127555, 8507, 0, 3 },
+		{ 127556, 8510, 0, 3 },
+		{ 127557, 8513, 0, 3 },
+		{ 127558, 8516, 0, 3 },
+		{ 127559, 8519, 0, 3 },
+		{ 127560, 8522, 0, 3 },
+		{ 127568, 8525, 0, 1 },
+		{ 127569, 8526, 0, 1 },
+		{ 130032, 8527, 0, 1 },
+		{ 130033, 8528, 0, 1 },
+		{ 130034, 8529, 0, 1 },
+		{ 130035, 8530, 0, 1 },
+		{ 130036, 8531, 0, 1 },
+		{ 130037, 8532, 0, 1 },
+		{ 130038, 8533, 0, 1 },
+		{ 130039, 8534, 0, 1 },
+		{ 130040, 8535, 0, 1 },
+		{ 130041, 8536, 0, 1 },
+		{ 194560, 8537, 1, 0 },
+		{ 194561, 8538, 1, 0 },
+		{ 194562, 8539, 1, 0 },
+		{ 194563, 8540, 1, 0 },
+		{ 194564, 8541, 1, 0 },
+		{ 194565, 8542, 1, 0 },
+		{ 194566, 8543, 1, 0 },
+		{ 194567, 8544, 1, 0 },
+		{ 194568, 8545, 1, 0 },
+		{ 194569, 8546, 1, 0 },
+		{ 194570, 8547, 1, 0 },
+		{ 194571, 8548, 1, 0 },
+		{ 194572, 8549, 1, 0 },
+		{ 194573, 8550, 1, 0 },
+		{ 194574, 8551, 1, 0 },
+		{ 194575, 8552, 1, 0 },
+		{ 194576, 8553, 1, 0 },
+		{ 194577, 8554, 1, 0 },
+		{ 194578, 8555, 1, 0 },
+		{ 194579, 8556, 1, 0 },
+		{ 194580, 8557, 1, 0 },
+		{ 194581, 8558, 1, 0 },
+		{ 194582, 8559, 1, 0 },
+		{ 194583, 8560, 1, 0 },
+		{ 194584, 8561, 1, 0 },
+		{ 194585, 8562, 1, 0 },
+		{ 194586, 8563, 1, 0 },
+		{ 194587, 8564, 1, 0 },
+		{ 194588, 8565, 1, 0 },
+		{ 194589, 8566, 1, 0 },
+		{ 194590, 8567, 1, 0 },
+		{ 194591, 8568, 1, 0 },
+		{ 194592, 8569, 1, 0 },
+		{ 194593, 8570, 1, 0 },
+		{ 194594, 8571, 1, 0 },
+		{ 194595, 8572, 1, 0 },
+		{ 194596, 8573, 1, 0 },
+		{ 194597, 8574, 1, 0 },
+		{ 194598, 8575, 1, 0 },
+		{ 194599, 8576, 1, 0 },
+		{ 194600, 8577, 1, 0 },
+		{ 194601, 8578, 1, 0 },
+		{ 194602, 8579, 1, 0 },
+		{ 194603, 8580, 1, 0 },
+		{ 194604, 8581, 1, 0 },
+		{ 194605, 8582, 1, 0 },
+		{ 194606, 8583, 1, 0 },
+		{ 194607, 8584, 1, 0 },
+		{ 194608, 8585, 1, 0 },
+		{ 194609, 8586, 1, 0 },
+		{ 194610, 8587, 1, 0 },
+		{ 194611, 8588, 1, 0 },
+		{ 194612, 8589, 1, 0 },
+		{ 194613, 8590, 1, 0 },
+		{ 194614, 8591, 1, 0 },
+		{ 194615, 8592, 1, 0 },
+		{ 194616, 8593, 1, 0 },
+		{ 194617, 8594, 1, 0 },
+		{ 194618, 8595, 1, 0 },
+		{ 194619, 8596, 1, 0 },
+		{ 194620, 8597, 1, 0 },
+		{ 194621, 8598, 1, 0 },
+		{ 194622, 8599, 1, 0 },
+		{ 194623, 8600, 1, 0 },
+		{ 194624, 8601, 1, 0 },
+		{ 194625, 8602, 1, 0 },
+		{ 194626, 8603, 1, 0 },
+		{ 194627, 8604, 1, 0 },
+		{ 194628, 8605, 1, 0 },
+		{ 194629, 8606, 1, 0 },
+		{ 194630, 8607, 1, 0 },
+		{ 194631, 8608, 1, 0 },
+		{ 194632, 8609, 1, 0 },
+		{ 194633, 8610, 1, 0 },
+		{ 194634, 8611, 1, 0 },
+		{ 194635, 8612, 1, 0 },
+		{ 194636, 8613, 1, 0 },
+		{ 194637, 8614, 1, 0 },
+		{ 194638, 8615, 1, 0 },
+		{ 194639, 8616, 1, 0 },
+		{ 194640, 8617, 1, 0 },
+		{ 194641, 8618, 1, 0 },
+		{ 194642, 8619, 1, 0 },
+		{ 194643, 8620, 1, 0 },
+		{ 194644, 8621, 1, 0 },
+		{ 194645, 8622, 1, 0 },
+		{ 194646, 8623, 1, 0 },
+		{ 194647, 8624, 1, 0 },
+		{ 194648, 8625, 1, 0 },
+		{ 194649, 8626, 1, 0 },
+		{ 194650, 8627, 1, 0 },
+		{ 194651, 8628, 1, 0 },
+		{ 194652, 8629, 1, 0 },
+		{ 194653, 8630, 1, 0 },
+		{ 194654, 8631, 1, 0 },
+		{ 194655, 8632, 1, 0 },
+		{ 194656, 8633, 1, 0 },
+		{ 194657, 8634, 1, 0 },
+		{ 194658, 8635, 1, 0 },
+		{ 194659, 8636, 1, 0 },
+		{ 194660, 8637, 1, 0 },
+		{ 194661, 8638, 1, 0 },
+		{ 194662, 8639, 1, 0 },
+		{ 194663, 8640, 1, 0 },
+		{ 194664, 8641, 1, 0 },
+		{ 194665, 8642, 1, 0 },
+		{ 194666, 8643, 1, 0 },
+		{ 194667, 8644, 1, 0 },
+		{ 194668, 8645, 1, 0 },
+		{ 194669, 8646, 1, 0 },
+		{ 194670, 8647, 1, 0 },
+		{ 194671, 8648, 1, 0 },
+		{ 194672, 8649, 1, 0 },
+		{ 194673, 8650, 1, 0 },
+		{ 194674, 8651, 1, 0 },
+		{ 194675, 8652, 1, 0 },
+		{ 194676, 8653, 1, 0 },
+		{ 194677, 8654, 1, 0 },
+		{ 194678, 8655, 1, 0 },
+		{ 194679, 8656, 1, 0 },
+		{ 194680, 8657, 1, 0 },
+		{ 194681, 8658, 1, 0 },
+		{ 194682, 8659, 1, 0 },
+		{ 194683, 8660, 1, 0 },
+		{ 194684, 8661, 1, 0 },
+		{ 194685, 8662, 1, 0 },
+		{ 194686, 8663, 1, 0 },
+		{ 194687, 8664, 1, 0 },
+		{ 194688, 8665, 1, 0 },
+		{ 194689, 8666, 1, 0 },
+		{ 194690, 8667, 1, 0 },
+		{ 194691, 8668, 1, 0 },
+		{ 194692, 8669, 1, 0 },
+		{ 194693, 8670, 1, 0 },
+		{ 194694, 8671, 1, 0 },
+		{ 194695, 8672, 1, 0 },
+		{ 194696, 8673, 1, 0 },
+		{ 194697, 8674, 1, 0 },
+		{ 194698, 8675, 1, 0 },
+		{ 194699, 8676, 1, 0 },
+		{ 194700, 8677, 1, 0 },
+		{ 194701, 8678, 1, 0 },
+		{ 194702, 8679, 1, 0 },
+		{ 194703, 8680, 1, 0 },
+		{ 194704, 8681, 1, 0 },
+		{ 194705, 8682, 1, 0 },
+		{ 194706, 8683, 1, 0 },
+		{ 194707, 8684, 1, 0 },
+		{ 194708, 8685, 1, 0 },
+		{ 194709, 8686, 1, 0 },
+		{ 194710, 8687, 1, 0 },
+		{ 194711, 8688, 1, 0 },
+		{ 194712, 8689, 1, 0 },
+		{ 194713, 8690, 1, 0 },
+		{ 194714, 8691, 1, 0 },
+		{ 194715, 8692, 1, 0 },
+		{ 194716, 8693, 1, 0 },
+		{ 194717, 8694, 1, 0 },
+		{ 194718, 8695, 1, 0 },
+		{ 194719, 8696, 1, 0 },
+		{ 194720, 8697, 1, 0 },
+		{ 194721, 8698, 1, 0 },
+		{ 194722, 8699, 1, 0 },
+		{ 194723, 8700, 1, 0 },
+		{ 194724, 8701, 1, 0 },
+		{ 194725, 8702, 1, 0 },
+		{ 194726, 8703, 1, 0 },
+		{ 194727, 8704, 1, 0 },
+		{ 194728, 8705, 1, 0 },
+		{ 194729, 8706, 1, 0 },
+		{ 194730, 8707, 1, 0 },
+		{ 194731, 8708, 1, 0 },
+		{ 194732, 8709, 1, 0 },
+		{ 194733, 8710, 1, 0 },
+		{ 194734, 8711, 1, 0 },
+		{ 194735, 8712, 1, 0 },
+		{ 194736, 8713, 1, 0 },
+		{ 194737, 8714, 1, 0 },
+		{ 194738, 8715, 1, 0 },
+		{ 194739, 8716, 1, 0 },
+		{ 194740, 8717, 1, 0 },
+		{ 194741, 8718, 1, 0 },
+		{ 194742, 8719, 1, 0 },
+		{ 194743, 8720, 1, 0 },
+		{ 194744, 8721, 1, 0 },
+		{ 194745, 8722, 1, 0 },
+		{ 194746, 8723, 1, 0 },
+		{ 194747, 8724, 1, 0 },
+		{ 194748, 8725, 1, 0 },
+		{ 194749, 8726, 1, 0 },
+		{ 194750, 8727, 1, 0 },
+		{ 194751, 8728, 1, 0 },
+		{ 194752, 8729, 1, 0 },
+		{ 194753, 8730, 1, 0 },
+		{ 194754, 8731, 1, 0 },
+		{ 194755, 8732, 1, 0 },
+		{ 194756, 8733, 1, 0 },
+		{ 194757, 8734, 1, 0 },
+		{ 194758, 8735, 1, 0 },
+		{ 194759, 8736, 1, 0 },
+		{ 194760, 8737, 1, 0 },
+		{ 194761, 8738, 1, 0 },
+		{ 194762, 8739, 1, 0 },
+		{ 194763, 8740, 1, 0 },
+		{ 194764, 8741, 1, 0 },
+		{ 194765, 8742, 1, 0 },
+		{ 194766, 8743, 1, 0 },
+		{ 194767, 8744, 1, 0 },
+		{ 194768, 8745, 1, 0 },
+		{ 194769, 8746, 1, 0 },
+		{ 194770, 8747, 1, 0 },
+		{ 194771, 8748, 1, 0 },
+		{ 194772, 8749, 1, 0 },
+		{ 194773, 8750, 1, 0 },
+		{ 194774, 8751, 1, 0 },
+		{ 194775, 8752, 1, 0 },
+		{ 194776, 8753, 1, 0 },
+		{ 194777, 8754, 1, 0 },
+		{ 194778, 8755, 1, 0 },
+		{ 194779, 8756, 1, 0 },
+		{ 194780, 8757, 1, 0 },
+		{ 194781, 8758, 1, 0 },
+		{ 194782, 8759, 1, 0 },
+		{ 194783, 8760, 1, 0 },
+		{ 194784, 8761, 1, 0 },
+		{ 194785, 8762, 1, 0 },
+		{ 194786, 8763, 1, 0 },
+		{ 194787, 8764, 1, 0 },
+		{ 194788, 8765, 1, 0 },
+		{ 194789, 8766, 1, 0 },
+		{ 194790, 8767, 1, 0 },
+		{ 194791, 8768, 1, 0 },
+		{ 194792, 8769, 1, 0 },
+		{ 194793, 8770, 1, 0 },
+		{ 194794, 8771, 1, 0 },
+		{ 194795, 8772, 1, 0 },
+		{ 194796, 8773, 1, 0 },
+		{ 194797, 8774, 1, 0 },
+		{ 194798, 8775, 1, 0 },
+		{ 194799, 8776, 1, 0 },
+		{ 194800, 8777, 1, 0 },
+		{ 194801, 8778, 1, 0 },
+		{ 194802, 8779, 1, 0 },
+		{ 194803, 8780, 1, 0 },
+		{ 194804, 8781, 1, 0 },
+		{ 194805, 8782, 1, 0 },
+		{ 194806, 8783, 1, 0 },
+		{ 194807, 8784, 1, 0 },
+		{ 194808, 8785, 1, 0 },
+		{ 194809, 8786, 1, 0 },
+		{ 194810, 8787, 1, 0 },
+		{ 194811, 8788, 1, 0 },
+		{ 194812, 8789, 1, 0 },
+		{ 194813, 8790, 1, 0 },
+		{ 194814, 8791, 1, 0 },
+		{ 194815, 8792, 1, 0 },
+		{ 194816, 8793, 1, 0 },
+		{ 194817, 8794, 1, 0 },
+		{ 194818, 8795, 1, 0 },
+		{ 194819, 8796, 1, 0 },
+		{ 194820, 8797, 1, 0 },
+		{ 194821, 8798, 1, 0 },
+		{ 194822, 8799, 1, 0 },
+		{ 194823, 8800, 1, 0 },
+		{ 194824, 8801, 1, 0 },
+		{ 194825, 8802, 1, 0 },
+		{ 194826, 8803, 1, 0 },
+		{ 194827, 8804, 1, 0 },
+		{ 194828, 8805, 1, 0 },
+		{ 194829, 8806, 1, 0 },
+		{ 194830, 8807, 1, 0 },
+		{ 194831, 8808, 1, 0 },
+		{ 194832, 8809, 1, 0 },
+		{ 194833, 8810, 1, 0 },
+		{ 194834, 8811, 1, 0 },
+		{ 194835, 8812, 1, 0 },
+		{ 194836, 8813, 1, 0 },
+		{ 194837, 8814, 1, 0 },
+		{ 194838, 8815, 1, 0 },
+		{ 194839, 8816, 1, 0 },
+		{ 194840, 8817, 1, 0 },
+		{ 194841, 8818, 1, 0 },
+		{ 194842, 8819, 1, 0 },
+		{ 194843, 8820, 1, 0 },
+		{ 194844, 8821, 1, 0 },
+		{ 194845, 8822, 1, 0 },
+		{ 194846, 8823, 1, 0 },
+		{ 194847, 8824, 1, 0 },
+		{ 194848, 8825, 1, 0 },
+		{ 194849, 8826, 1, 0 },
+		{ 194850, 8827, 1, 0 },
+		{ 194851, 8828, 1, 0 },
+		{ 194852, 8829, 1, 0 },
+		{ 194853, 8830, 1, 0 },
+		{ 194854, 8831, 1, 0 },
+		{ 194855, 8832, 1, 0 },
+		{ 194856, 8833, 1, 0 },
+		{ 194857, 8834, 1, 0 },
+		{ 194858, 8835, 1, 0 },
+		{ 194859, 8836, 1, 0 },
+		{ 194860, 8837, 1, 0 },
+		{ 194861, 8838, 1, 0 },
+		{ 194862, 8839, 1, 0 },
+		{ 194863, 8840, 1, 0 },
+		{ 194864, 8841, 1, 0 },
+		{ 194865, 8842, 1, 0 },
+		{ 194866, 8843, 1, 0 },
+		{ 194867, 8844, 1, 0 },
+		{ 194868, 8845, 1, 0 },
+		{ 194869, 8846, 1, 0 },
+		{ 194870, 8847, 1, 0 },
+		{ 194871, 8848, 1, 0 },
+		{ 194872, 8849, 1, 0 },
+		{ 194873, 8850, 1, 0 },
+		{ 194874, 8851, 1, 0 },
+		{ 194875, 8852, 1, 0 },
+		{ 194876, 8853, 1, 0 },
+		{ 194877, 8854, 1, 0 },
+		{ 194878, 8855, 1, 0 },
+		{ 194879, 8856, 1, 0 },
+		{ 194880, 8857, 1, 0 },
+		{ 194881, 8858, 1, 0 },
+		{ 194882, 8859, 1, 0 },
+		{ 194883, 8860, 1, 0 },
+		{ 194884, 8861, 1, 0 },
+		{ 194885, 8862, 1, 0 },
+		{ 194886, 8863, 1, 0 },
+		{ 194887, 8864, 1, 0 },
+		{ 194888, 8865, 1, 0 },
+		{ 194889, 8866, 1, 0 },
+		{ 194890, 8867, 1, 0 },
+		{ 194891, 8868, 1, 0 },
+		{ 194892, 8869, 1, 0 },
+		{ 194893, 8870, 1, 0 },
+		{ 194894, 8871, 1, 0 },
+		{ 194895, 8872, 1, 0 },
+		{ 194896, 8873, 1, 0 },
+		{ 194897, 8874, 1, 0 },
+		{ 194898, 8875, 1, 0 },
+		{ 194899, 8876, 1, 0 },
+		{ 194900, 8877, 1, 0 },
+		{ 194901, 8878, 1, 0 },
+		{ 194902, 8879, 1, 0 },
+		{ 194903, 8880, 1, 0 },
+		{ 194904, 8881, 1, 0 },
+		{ 194905, 8882, 1, 0 },
+		{ 194906, 8883, 1, 0 },
+		{ 194907, 8884, 1, 0 },
+		{ 194908, 8885, 1, 0 },
+		{ 194909, 8886, 1, 0 },
+		{ 194910, 8887, 1, 0 },
+		{ 194911, 8888, 1, 0 },
+		{ 194912, 8889, 1, 0 },
+		{ 194913, 8890, 1, 0 },
+		{ 194914, 8891, 1, 0 },
+		{ 194915, 8892, 1, 0 },
+		{ 194916, 8893, 1, 0 },
+		{ 194917, 8894, 1, 0 },
+		{ 194918, 8895, 1, 0 },
+		{ 194919, 8896, 1, 0 },
+		{ 194920, 8897, 1, 0 },
+		{ 194921, 8898, 1, 0 },
+		{ 194922, 8899, 1, 0 },
+		{ 194923, 8900, 1, 0 },
+		{ 194924, 8901, 1, 0 },
+		{ 194925, 8902, 1, 0 },
+		{ 194926, 8903, 1, 0 },
+		{ 194927, 8904, 1, 0 },
+		{ 194928, 8905, 1, 0 },
+		{ 194929, 8906, 1, 0 },
+		{ 194930, 8907, 1, 0 },
+		{ 194931, 8908, 1, 0 },
+		{ 194932, 8909, 1, 0 },
+		{ 194933, 8910, 1, 0 },
+		{ 194934, 8911, 1, 0 },
+		{ 194935, 8912, 1, 0 },
+		{ 194936, 8913, 1, 0 },
+		{ 194937, 8914, 1, 0 },
+		{ 194938, 8915, 1, 0 },
+		{ 194939, 8916, 1, 0 },
+		{ 194940, 8917, 1, 0 },
+		{ 194941, 8918, 1, 0 },
+		{ 194942, 8919, 1, 0 },
+		{ 194943, 8920, 1, 0 },
+		{ 194944, 8921, 1, 0 },
+		{ 194945, 8922, 1, 0 },
+		{ 194946, 8923, 1, 0 },
+		{ 194947, 8924, 1, 0 },
+		{ 194948, 8925, 1, 0 },
+		{ 194949, 8926, 1, 0 },
+		{ 194950, 8927, 1, 0 },
+		{ 194951, 8928, 1, 0 },
+		{ 194952, 8929, 1, 0 },
+		{ 194953, 8930, 1, 0 },
+		{ 194954, 8931, 1, 0 },
+		{ 194955, 8932, 1, 0 },
+		{ 194956, 8933, 1, 0 },
+		{ 194957, 8934, 1, 0 },
+		{ 194958, 8935, 1, 0 },
+		{ 194959, 8936, 1, 0 },
+		{ 194960, 8937, 1, 0 },
+		{ 194961, 8938, 1, 0 },
+		{ 194962, 8939, 1, 0 },
+		{ 194963, 8940, 1, 0 },
+		{ 194964, 8941, 1, 0 },
+		{ 194965, 8942, 1, 0 },
+		{ 194966, 8943, 1, 0 },
+		{ 194967, 8944, 1, 0 },
+		{ 194968, 8945, 1, 0 },
+		{ 194969, 8946, 1, 0 },
+		{ 194970, 8947, 1, 0 },
+		{ 194971, 8948, 1, 0 },
+		{ 194972, 8949, 1, 0 },
+		{ 194973, 8950, 1, 0 },
+		{ 194974, 8951, 1, 0 },
+		{ 194975, 8952, 1, 0 },
+		{ 194976, 8953, 1, 0 },
+		{ 194977, 8954, 1, 0 },
+		{ 194978, 8955, 1, 0 },
+		{ 194979, 8956, 1, 0 },
+		{ 194980, 8957, 1, 0 },
+		{ 194981, 8958, 1, 0 },
+		{ 194982, 8959, 1, 0 },
+		{ 194983, 8960, 1, 0 },
+		{ 194984, 8961, 1, 0 },
+		{ 194985, 8962, 1, 0 },
+		{ 194986, 8963, 1, 0 },
+		{ 194987, 8964, 1, 0 },
+		{ 194988, 8965, 1, 0 },
+		{ 194989, 8966, 1, 0 },
+		{ 194990, 8967, 1, 0 },
+		{ 194991, 8968, 1, 0 },
+		{ 194992, 8969, 1, 0 },
+		{ 194993, 8970, 1, 0 },
+		{ 194994, 8971, 1, 0 },
+		{ 194995, 8972, 1, 0 },
+		{ 194996, 8973, 1, 0 },
+		{ 194997, 8974, 1, 0 },
+		{ 194998, 8975, 1, 0 },
+		{ 194999, 8976, 1, 0 },
+		{ 195000, 8977, 1, 0 },
+		{ 195001, 8978, 1, 0 },
+		{ 195002, 8979, 1, 0 },
+		{ 195003, 8980, 1, 0 },
+		{ 195004, 8981, 1, 0 },
+		{ 195005, 8982, 1, 0 },
+		{ 195006, 8983, 1, 0 },
+		{ 195007, 8984, 1, 0 },
+		{ 195008, 8985, 1, 0 },
+		{ 195009, 8986, 1, 0 },
+		{ 195010, 8987, 1, 0 },
+		{ 195011, 8988, 1, 0 },
+		{ 195012, 8989, 1, 0 },
+		{ 195013, 8990, 1, 0 },
+		{ 195014, 8991, 1, 0 },
+		{ 195015, 8992, 1, 0 },
+		{ 195016, 8993, 1, 0 },
+		{ 195017, 8994, 1, 0 },
+		{ 195018, 8995, 1, 0 },
+		{ 195019, 8996, 1, 0 },
+		{ 195020, 8997, 1, 0 },
+		{ 195021, 8998, 1, 0 },
+		{ 195022, 8999, 1, 0 },
+		{ 195023, 9000, 1, 0 },
+		{ 195024, 9001, 1, 0 },
+		{ 195025, 9002, 1, 0 },
+		{ 195026, 9003, 1, 0 },
+		{ 195027, 9004, 1, 0 },
+		{ 195028, 9005, 1, 0 },
+		{ 195029, 9006, 1, 0 },
+		{ 195030, 9007, 1, 0 },
+		{ 195031, 9008, 1, 0 },
+		{ 195032, 9009, 1, 0 },
+		{ 195033, 9010, 1, 0 },
+		{ 195034, 9011, 1, 0 },
+		{ 195035, 9012, 1, 0 },
+		{ 195036, 9013, 1, 0 },
+		{ 195037, 9014, 1, 0 },
+		{ 195038, 9015, 1, 0 },
+		{ 195039, 9016, 1, 0 },
+		{ 195040, 9017, 1, 0 },
+		{ 195041, 9018, 1, 0 },
+		{ 195042, 9019, 1, 0 },
+		{ 195043, 9020, 1, 0 },
+		{ 195044, 9021, 1, 0 },
+		{ 195045, 9022, 1, 0 },
+		{ 195046, 9023, 1, 0 },
+		{ 195047, 9024, 1, 0 },
+		{ 195048, 9025, 1, 0 },
+		{ 195049, 9026, 1, 0 },
+		{ 195050, 9027, 1, 0 },
+		{ 195051, 9028, 1, 0 },
+		{ 195052, 9029, 1, 0 },
+		{ 195053, 9030, 1, 0 },
+		{ 195054, 9031, 1, 0 },
+		{ 195055, 9032, 1, 0 },
+		{ 195056, 9033, 1, 0 },
+		{ 195057, 9034, 1, 0 },
+		{ 195058, 9035, 1, 0 },
+		{ 195059, 9036, 1, 0 },
+		{ 195060, 9037, 1, 0 },
+		{ 195061, 9038, 1, 0 },
+		{ 195062, 9039, 1, 0 },
+		{ 195063, 9040, 1, 0 },
+		{ 195064, 9041, 1, 0 },
+		{ 195065, 9042, 1, 0 },
+		{ 195066, 9043, 1, 0 },
+		{ 195067, 9044, 1, 0 },
+		{ 195068, 9045, 1, 0 },
+		{ 195069, 9046, 1, 0 },
+		{ 195070, 9047, 1, 0 },
+		{ 195071, 9048, 1, 0 },
+		{ 195072, 9049, 1, 0 },
+		{ 195073, 9050, 1, 0 },
+		{ 195074, 9051, 1, 0 },
+		{ 195075, 9052, 1, 0 },
+		{ 195076, 9053, 1, 0 },
+		{ 195077, 9054, 1, 0 },
+		{ 195078, 9055, 1, 0 },
+		{ 195079, 9056, 1, 0 },
+		{ 195080, 9057, 1, 0 },
+		{ 195081, 9058, 1, 0 },
+		{ 195082, 9059, 1, 0 },
+		{ 195083, 9060, 1, 0 },
+		{ 195084, 9061, 1, 0 },
+		{ 195085, 9062, 1, 0 },
+		{ 195086, 9063, 1, 0 },
+		{ 195087, 9064, 1, 0 },
+		{ 195088, 9065, 1, 0 },
+		{ 195089, 9066, 1, 0 },
+		{ 195090, 9067, 1, 0 },
+		{ 195091, 9068, 1, 0 },
+		{ 195092, 9069, 1, 0 },
+		{ 195093, 9070, 1, 0 },
+		{ 195094, 9071, 1, 0 },
+		{ 195095, 9072, 1, 0 },
+		{ 195096, 9073, 1, 0 },
+		{ 195097, 9074, 1, 0 },
+		{ 195098, 9075, 1, 0 },
+		{ 195099, 9076, 1, 0 },
+		{ 195100, 9077, 1, 0 },
+		{ 195101, 9078, 1, 0 },
+	};
+
+	inline constexpr char32_t decompositionCodePoints[9079] = {
+		32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32, 807, 49, 111, 49,
+		8260, 52, 49, 8260, 50, 51, 8260, 52, 65, 768, 65, 769, 65, 770, 65, 771,
+		65, 776, 65, 778, 67, 807, 69, 768, 69, 769, 69, 770, 69, 776, 73, 768,
+		73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769, 79, 770, 79, 771,
+		79, 776, 85, 768, 85, 769, 85, 770, 85, 776, 89, 769, 97, 768, 97, 769,
+		97, 770, 97, 771, 97, 776, 97, 778, 99, 807, 101, 768, 101, 769, 101, 770,
+		101, 776, 105, 768, 105, 769, 105, 770, 105, 776, 110, 771, 111, 768, 111, 769,
+		111, 770, 111, 771, 111, 776, 117, 768, 117, 769, 117, 770, 117, 776, 121, 769,
+		121, 776, 65, 772, 97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769,
+		99, 769, 67, 770, 99, 770, 67, 775, 99, 775, 67, 780, 99, 780, 68, 780,
+		100, 780, 69, 772, 101, 772, 69, 774, 101, 774, 69, 775, 101, 775, 69, 808,
+		101, 808, 69, 780, 101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+		103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771, 105, 771, 73, 772,
+		105, 772, 73, 774, 105, 774, 73, 808, 105, 808, 73, 775, 73, 74, 105, 106,
+		74, 770, 106, 770, 75, 807, 107, 807, 76, 769, 108, 769, 76, 807, 108, 807,
+		76, 780, 108, 780, 76, 183, 108, 183, 78, 769, 110, 769, 78, 807, 110, 807,
+		78, 780, 110, 780, 700, 110, 79, 772, 111, 772, 79, 774, 111, 774, 79, 779,
+		111, 779, 82, 769, 114, 769, 82, 807, 114, 807, 82, 780, 114, 780, 83, 769,
+		115, 769, 83, 770, 115, 770, 83, 807, 115, 807, 83, 780, 115, 780, 84, 807,
+		116, 807, 84, 780, 116, 780, 85, 771, 117, 771, 85, 772, 117, 772, 85, 774,
+		117, 774, 85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770,
+		119, 770, 89, 770, 121, 770, 89, 776, 90, 769, 122, 769, 90, 775, 122, 775,
+		90, 780, 122, 780, 115, 79, 795, 111, 795, 85, 795, 117, 795, 68, 90, 780,
+		68, 122, 780, 100, 122, 780, 76, 74, 76, 106, 108, 106, 78, 74, 78, 106,
+		110, 106, 65, 780, 97, 780, 73, 780, 105, 780, 79, 780, 111, 780, 85, 780,
+		117, 780, 85, 776, 772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776,
+		780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65, 776, 772, 97, 776, 772,
+		65, 775, 772, 97, 775, 772, 198, 772, 230, 772, 71, 780, 103, 780, 75, 780,
+		107, 780, 79, 808, 111, 808, 79, 808, 772, 111, 808, 772, 439, 780, 658, 780,
+		106, 780, 68, 90, 68, 122, 100, 122, 71, 769, 103, 769, 78, 768, 110, 768,
+		65, 778, 769, 97, 778, 769, 198, 769, 230, 769, 216, 769, 248, 769, 65, 783,
+		97, 783, 65, 785, 97, 785, 69, 783, 101, 783, 69, 785, 101, 785, 73, 783,
+		105, 783, 73, 785, 105, 785, 79, 783, 111, 783, 79, 785, 111, 785, 82, 783,
+		114, 783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785, 83, 806,
+		115, 806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775, 69, 807,
+		101, 807, 79, 776, 772, 111, 776, 772, 79, 771, 772, 111, 771, 772, 79, 775,
+		111, 775, 79, 775, 772, 111, 775, 772, 89, 772, 121, 772, 104, 614, 106, 114,
+		633, 635, 641, 119, 121, 32, 774, 32, 775, 32, 778, 32, 808, 32, 771, 32,
+		779, 611, 108, 115, 120, 661, 768, 769, 787, 776, 769, 697, 32, 837, 59, 32,
+		769, 168, 769, 32, 776, 769, 913, 769, 183, 917, 769, 919, 769, 921, 769, 927,
+		769, 933, 769, 937, 769, 953, 776, 769, 921, 776, 933, 776, 945, 769, 949, 769,
+		951, 769, 953, 769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769, 969,
+		769, 946, 952, 933, 978, 769, 933, 769, 978, 776, 933, 776, 966, 960, 954, 961,
+		962, 920, 949, 931, 1045, 768, 1045, 776, 1043, 769, 1030, 776, 1050, 769, 1048, 768,
+		1059, 774, 1048, 774, 1080, 774, 1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082, 769,
+		1080, 768, 1091, 774, 1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774, 1072, 774,
+		1040, 776, 1072, 776, 1045, 774, 1077, 774, 1240, 776, 1241, 776, 1046, 776, 1078, 776,
+		1047, 776, 1079, 776, 1048, 772, 1080, 772, 1048, 776, 1080, 776, 1054, 776, 1086, 776,
+		1256, 776, 1257, 776, 1069, 776, 1101, 776, 1059, 772, 1091, 772, 1059, 776, 1091, 776,
+		1059, 779, 1091, 779, 1063, 776, 1095, 776, 1067, 776, 1099, 776, 1381, 1410, 1575, 1619,
+		1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620, 1575, 1652, 1608, 1652, 1735, 1652, 1610, 1652,
+		1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364, 2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364,
+		2327, 2364, 2332, 2364, 2337, 2364, 2338, 2364, 2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519,
+		2465, 2492, 2466, 2492, 2479, 2492, 2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620,
+		2603, 2620, 2887, 2902, 2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006,
+		3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285, 3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266,
+		3285, 3398, 3390, 3399, 3390, 3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551,
+		3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745, 3851, 3906, 4023, 3916, 4023, 3921, 4023, 3926,
+		4023, 3931, 4023, 3904, 4021, 3953, 3954, 3953, 3956, 4018, 3968, 4018, 3953, 3968, 4019, 3968,
+		4019, 3953, 3968, 3953, 3968, 3986, 4023, 3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984,
+		4021, 4133, 4142, 4316, 6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965,
+		6970, 6965, 6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 198, 66, 68, 69, 398,
+		71, 72, 73, 74, 75, 76, 77, 78, 79, 546, 80, 82, 84, 85, 87, 97,
+		592, 593, 7426, 98, 100, 101, 601, 603, 604, 103, 107, 109, 331, 111, 596, 7446,
+		7447, 112, 116, 117, 7453, 623, 118, 7461, 946, 947, 948, 966, 967, 105, 114, 117,
+		118, 946, 947, 961, 966, 967, 1085, 594, 99, 597, 240, 604, 102, 607, 609, 613,
+		616, 617, 618, 7547, 669, 621, 7557, 671, 625, 624, 626, 627, 628, 629, 632, 642,
+		643, 427, 649, 650, 7452, 651, 652, 122, 656, 657, 658, 952, 65, 805, 97, 805,
+		66, 775, 98, 775, 66, 803, 98, 803, 66, 817, 98, 817, 67, 807, 769, 99,
+		807, 769, 68, 775, 100, 775, 68, 803, 100, 803, 68, 817, 100, 817, 68, 807,
+		100, 807, 68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772, 769, 101,
+		772, 769, 69, 813, 101, 813, 69, 816, 101, 816, 69, 807, 774, 101, 807, 774,
+		70, 775, 102, 775, 71, 772, 103, 772, 72, 775, 104, 775, 72, 803, 104, 803,
+		72, 776, 104, 776, 72, 807, 104, 807, 72, 814, 104, 814, 73, 816, 105, 816,
+		73, 776, 769, 105, 776, 769, 75, 769, 107, 769, 75, 803, 107, 803, 75, 817,
+		107, 817, 76, 803, 108, 803, 76, 803, 772, 108, 803, 772, 76, 817, 108, 817,
+		76, 813, 108, 813, 77, 769, 109, 769, 77, 775, 109, 775, 77, 803, 109, 803,
+		78, 775, 110, 775, 78, 803, 110, 803, 78, 817, 110, 817, 78, 813, 110, 813,
+		79, 771, 769, 111, 771, 769, 79, 771, 776, 111, 771, 776, 79, 772, 768, 111,
+		772, 768, 79, 772, 769, 111, 772, 769, 80, 769, 112, 769, 80, 775, 112, 775,
+		82, 775, 114, 775, 82, 803, 114, 803, 82, 803, 772, 114, 803, 772, 82, 817,
+		114, 817, 83, 775, 115, 775, 83, 803, 115, 803, 83, 769, 775, 115, 769, 775,
+		83, 780, 775, 115, 780, 775, 83, 803, 775, 115, 803, 775, 84, 775, 116, 775,
+		84, 803, 116, 803, 84, 817, 116, 817, 84, 813, 116, 813, 85, 804, 117, 804,
+		85, 816, 117, 816, 85, 813, 117, 813, 85, 771, 769, 117, 771, 769, 85, 772,
+		776, 117, 772, 776, 86, 771, 118, 771, 86, 803, 118, 803, 87, 768, 119, 768,
+		87, 769, 119, 769, 87, 776, 119, 776, 87, 775, 119, 775, 87, 803, 119, 803,
+		88, 775, 120, 775, 88, 776, 120, 776, 89, 775, 121, 775, 90, 770, 122, 770,
+		90, 803, 122, 803, 90, 817, 122, 817, 104, 817, 116, 776, 119, 778, 121, 778,
+		97, 702, 383, 775, 115, 775, 65, 803, 97, 803, 65, 777, 97, 777, 65, 770,
+		769, 97, 770, 769, 65, 770, 768, 97, 770, 768, 65, 770, 777, 97, 770, 777,
+		65, 770, 771, 97, 770, 771, 65, 803, 770, 97, 803, 770, 65, 774, 769, 97,
+		774, 769, 65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774, 777, 65, 774,
+		771, 97, 774, 771, 65, 803, 774, 97, 803, 774, 69, 803, 101, 803, 69, 777,
+		101, 777, 69, 771, 101, 771, 69, 770, 769, 101, 770, 769, 69, 770, 768, 101,
+		770, 768, 69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771, 69, 803,
+		770, 101, 803, 770, 73, 777, 105, 777, 73, 803, 105, 803, 79, 803, 111, 803,
+		79, 777, 111, 777, 79, 770, 769, 111, 770, 769, 79, 770, 768, 111, 770, 768,
+		79, 770, 777, 111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803, 770, 111,
+		803, 770, 79, 795, 769, 111, 795, 769, 79, 795, 768, 111, 795, 768, 79, 795,
+		777, 111, 795, 777, 79, 795, 771, 111, 795, 771, 79, 795, 803, 111, 795, 803,
+		85, 803, 117, 803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769, 85, 795,
+		768, 117, 795, 768, 85, 795, 777, 117, 795, 777, 85, 795, 771, 117, 795, 771,
+		85, 795, 803, 117, 795, 803, 89, 768, 121, 768, 89, 803, 121, 803, 89, 777,
+		121, 777, 89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945, 788, 768,
+		945, 787, 769, 945, 788, 769, 945, 787, 834, 945, 788, 834, 913, 787, 913, 788,
+		913, 787, 768, 913, 788, 768, 913, 787, 769, 913, 788, 769, 913, 787, 834, 913,
+		788, 834, 949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949, 787, 769, 949,
+		788, 769, 917, 787, 917, 788, 917, 787, 768, 917, 788, 768, 917, 787, 769, 917,
+		788, 769, 951, 787, 951, 788, 951, 787, 768, 951, 788, 768, 951, 787, 769, 951,
+		788, 769, 951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919, 787, 768, 919,
+		788, 768, 919, 787, 769, 919, 788, 769, 919, 787, 834, 919, 788, 834, 953, 787,
+		953, 788, 953, 787, 768, 953, 788, 768, 953, 787, 769, 953, 788, 769, 953, 787,
+		834, 953, 788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768, 921, 787,
+		769, 921, 788, 769, 921, 787, 834, 921, 788, 834, 959, 787, 959, 788, 959, 787,
+		768, 959, 788, 768, 959, 787, 769, 959, 788, 769, 927, 787, 927, 788, 927, 787,
+		768, 927, 788, 768, 927, 787, 769, 927, 788, 769, 965, 787, 965, 788, 965, 787,
+		768, 965, 788, 768, 965, 787, 769, 965, 788, 769, 965, 787, 834, 965, 788, 834,
+		933, 788, 933, 788, 768, 933, 788, 769, 933, 788, 834, 969, 787, 969, 788, 969,
+		787, 768, 969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834, 969, 788,
+		834, 937, 787, 937, 788, 937, 787, 768, 937, 788, 768, 937, 787, 769, 937, 788,
+		769, 937, 787, 834, 937, 788, 834, 945, 768, 945, 769, 949, 768, 949, 769, 951,
+		768, 951, 769, 953, 768, 953, 769, 959, 768, 959, 769, 965, 768, 965, 769, 969,
+		768, 969, 769, 945, 787, 837, 945, 788, 837, 945, 787, 768, 837, 945, 788, 768,
+		837, 945, 787, 769, 837, 945, 788, 769, 837, 945, 787, 834, 837, 945, 788, 834,
+		837, 913, 787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768, 837, 913,
+		787, 769, 837, 913, 788, 769, 837, 913, 787, 834, 837, 913, 788, 834, 837, 951,
+		787, 837, 951, 788, 837, 951, 787, 768, 837, 951, 788, 768, 837, 951, 787, 769,
+		837, 951, 788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837, 919, 787, 837,
+		919, 788, 837, 919, 787, 768, 837, 919, 788, 768, 837, 919, 787, 769, 837, 919,
+		788, 769, 837, 919, 787, 834, 837, 919, 788, 834, 837, 969, 787, 837, 969, 788,
+		837, 969, 787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969, 788, 769,
+		837, 969, 787, 834, 837, 969, 788, 834, 837, 937, 787, 837, 937, 788, 837, 937,
+		787, 768, 837, 937, 788, 768, 837, 937, 787, 769, 837, 937, 788, 769, 837, 937,
+		787, 834, 837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837, 945, 837,
+		945, 769, 837, 945, 834, 945, 834, 837, 913, 774, 913, 772, 913, 768, 913, 769,
+		913, 837, 32, 787, 953, 32, 787, 32, 834, 168, 834, 32, 776, 834, 951, 768,
+		837, 951, 837, 951, 769, 837, 951, 834, 951, 834, 837, 917, 768, 917, 769, 919,
+		768, 919, 769, 919, 837, 8127, 768, 32, 787, 768, 8127, 769, 32, 787, 769, 8127,
+		834, 32, 787, 834, 953, 774, 953, 772, 953, 776, 768, 953, 776, 769, 953, 834,
+		953, 776, 834, 921, 774, 921, 772, 921, 768, 921, 769, 8190, 768, 32, 788, 768,
+		8190, 769, 32, 788, 769, 8190, 834, 32, 788, 834, 965, 774, 965, 772, 965, 776,
+		768, 965, 776, 769, 961, 787, 961, 788, 965, 834, 965, 776, 834, 933, 774, 933,
+		772, 933, 768, 933, 769, 929, 788, 168, 768, 32, 776, 768, 168, 769, 32, 776,
+		769, 96, 969, 768, 837, 969, 837, 969, 769, 837, 969, 834, 969, 834, 837, 927,
+		768, 927, 769, 937, 768, 937, 769, 937, 837, 180, 32, 769, 32, 788, 8194, 32,
+		8195, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 8208, 32, 819, 46, 46,
+		46, 46, 46, 46, 32, 8242, 8242, 8242, 8242, 8242, 8245, 8245, 8245, 8245, 8245, 33,
+		33, 32, 773, 63, 63, 63, 33, 33, 63, 8242, 8242, 8242, 8242, 32, 48, 105,
+		52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 48, 49, 50, 51,
+		52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 97, 101, 111, 120, 601,
+		104, 107, 108, 109, 110, 112, 115, 116, 82, 115, 97, 47, 99, 97, 47, 115,
+		67, 176, 67, 99, 47, 111, 99, 47, 117, 400, 176, 70, 103, 72, 72, 72,
+		104, 295, 73, 73, 76, 108, 78, 78, 111, 80, 81, 82, 82, 82, 83, 77,
+		84, 69, 76, 84, 77, 90, 937, 90, 75, 65, 778, 66, 67, 101, 69, 70,
+		77, 111, 1488, 1489, 1490, 1491, 105, 70, 65, 88, 960, 947, 915, 928, 8721, 68,
+		100, 101, 105, 106, 49, 8260, 55, 49, 8260, 57, 49, 8260, 49, 48, 49, 8260,
+		51, 50, 8260, 51, 49, 8260, 53, 50, 8260, 53, 51, 8260, 53, 52, 8260, 53,
+		49, 8260, 54, 53, 8260, 54, 49, 8260, 56, 51, 8260, 56, 53, 8260, 56, 55,
+		8260, 56, 49, 8260, 73, 73, 73, 73, 73, 73, 73, 86, 86, 86, 73, 86,
+		73, 73, 86, 73, 73, 73, 73, 88, 88, 88, 73, 88, 73, 73, 76, 67,
+		68, 77, 105, 105, 105, 105, 105, 105, 105, 118, 118, 118, 105, 118, 105, 105,
+		118, 105, 105, 105, 105, 120, 120, 120, 105, 120, 105, 105, 108, 99, 100, 109,
+		48, 8260, 51, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658, 824, 8707,
+		824, 8712, 824, 8715, 824, 8739, 824, 8741, 824, 8747, 8747, 8747, 8747, 8747, 8750, 8750,
+		8750, 8750, 8750, 8764, 824, 8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781,
+		824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819, 824, 8822, 824, 8823,
+		824, 8826, 824, 8827, 824, 8834, 824, 8835, 824, 8838, 824, 8839, 824, 8866, 824, 8872,
+		824, 8873, 824, 8875, 824, 8828, 824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883,
+		824, 8884, 824, 8885, 824, 12296, 12297, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+		49, 48, 49, 49, 49, 50, 49, 51, 49, 52, 49, 53, 49, 54, 49, 55,
+		49, 56, 49, 57, 50, 48, 40, 49, 41, 40, 50, 41, 40, 51, 41, 40,
+		52, 41, 40, 53, 41, 40, 54, 41, 40, 55, 41, 40, 56, 41, 40, 57,
+		41, 40, 49, 48, 41, 40, 49, 49, 41, 40, 49, 50, 41, 40, 49, 51,
+		41, 40, 49, 52, 41, 40, 49, 53, 41, 40, 49, 54, 41, 40, 49, 55,
+		41, 40, 49, 56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46, 50,
+		46, 51, 46, 52, 46, 53, 46, 54, 46, 55, 46, 56, 46, 57, 46, 49,
+		48, 46, 49, 49, 46, 49, 50, 46, 49, 51, 46, 49, 52, 46, 49, 53,
+		46, 49, 54, 46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48, 46,
+		40, 97, 41, 40, 98, 41, 40, 99, 41, 40, 100, 41, 40, 101, 41, 40,
+		102, 41, 40, 103, 41, 40, 104, 41, 40, 105, 41, 40, 106, 41, 40, 107,
+		41, 40, 108, 41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40, 112, 41,
+		40, 113, 41, 40, 114, 41, 40, 115, 41, 40, 116, 41, 40, 117, 41, 40,
+		118, 41, 40, 119, 41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 65, 66,
+		67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+		83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104,
+		105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+		121, 122, 48, 8747, 8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61, 10973,
+		824, 106, 86, 11617, 27597, 40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108, 20128, 20154, 20799,
+		20837, 20843, 20866, 20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313, 21340, 21353,
+		21378, 21430, 21448, 21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823, 22899, 23376, 23424, 23544, 23567,
+		23586, 23608, 23662, 23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191, 24308, 24318, 24331, 24339, 24400,
+		24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908, 25991, 26007, 26020, 26041, 26080, 26085, 26352, 26376,
+		26408, 27424, 27490, 27513, 27571, 27595, 27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247,
+		29255, 29273, 29275, 29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333,
+		30382, 30399, 30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859, 31992, 32566, 32593,
+		32650, 32701, 32769, 32780, 32786, 32819, 32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307, 33311, 33390,
+		33394, 33400, 34381, 34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328, 35895, 35910, 35925, 35960, 35997,
+		36196, 36208, 36275, 36523, 36554, 36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263, 38272, 38428,
+		38582, 38585, 38632, 38737, 38750, 38754, 38761, 38859, 38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321,
+		39340, 39592, 39640, 39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565, 40575, 40613, 40635, 40643, 40653,
+		40657, 40697, 40701, 40718, 40723, 40736, 40763, 40778, 40786, 40845, 40860, 40864, 32, 12306, 21313, 21316,
+		21317, 12363, 12441, 12365, 12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441, 12375, 12441, 12377,
+		12441, 12379, 12441, 12381, 12441, 12383, 12441, 12385, 12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399,
+		12441, 12399, 12442, 12402, 12441, 12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411,
+		12441, 12411, 12442, 12358, 12441, 32, 12441, 32, 12442, 12445, 12441, 12424, 12426, 12459, 12441, 12461,
+		12441, 12463, 12441, 12465, 12441, 12467, 12441, 12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477,
+		12441, 12479, 12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495, 12442, 12498,
+		12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504, 12442, 12507, 12441, 12507, 12442, 12454,
+		12441, 12527, 12441, 12528, 12441, 12529, 12441, 12530, 12441, 12541, 12441, 12467, 12488, 4352, 4353, 4522,
+		4354, 4524, 4525, 4355, 4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360,
+		4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450, 4451, 4452, 4453,
+		4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469,
+		4448, 4372, 4373, 4551, 4552, 4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384,
+		4386, 4387, 4391, 4393, 4395, 4396, 4397, 4398, 4399, 4402, 4406, 4416, 4423, 4428, 4593, 4594,
+		4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498, 4500, 4510, 4513, 19968, 20108, 19977, 22235, 19978,
+		20013, 19979, 30002, 20057, 19993, 19969, 22825, 22320, 20154, 40, 4352, 41, 40, 4354, 41, 40,
+		4355, 41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41, 40, 4361, 41, 40, 4363,
+		41, 40, 4364, 41, 40, 4366, 41, 40, 4367, 41, 40, 4368, 41, 40, 4369, 41,
+		40, 4370, 41, 40, 4352, 4449, 41, 40, 4354, 4449, 41, 40, 4355, 4449, 41, 40,
+		4357, 4449, 41, 40, 4358, 4449, 41, 40, 4359, 4449, 41, 40, 4361, 4449, 41, 40,
+		4363, 4449, 41, 40, 4364, 4449, 41, 40, 4366, 4449, 41, 40, 4367, 4449, 41, 40,
+		4368, 4449, 41, 40, 4369, 4449, 41, 40, 4370, 4449, 41, 40, 4364, 4462, 41, 40,
+		4363, 4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462, 41, 40, 19968, 41, 40,
+		20108, 41, 40, 19977, 41, 40, 22235, 41, 40, 20116, 41, 40, 20845, 41, 40, 19971,
+		41, 40, 20843, 41, 40, 20061, 41, 40, 21313, 41, 40, 26376, 41, 40, 28779, 41,
+		40, 27700, 41, 40, 26408, 41, 40, 37329, 41, 40, 22303, 41, 40, 26085, 41, 40,
+		26666, 41, 40, 26377, 41, 40, 31038, 41, 40, 21517, 41, 40, 29305, 41, 40, 36001,
+		41, 40, 31069, 41, 40, 21172, 41, 40, 20195, 41, 40, 21628, 41, 40, 23398, 41,
+		40, 30435, 41, 40, 20225, 41, 40, 36039, 41, 40, 21332, 41, 40, 31085, 41, 40,
+		20241, 41, 40, 33258, 41, 40, 33267, 41, 21839, 24188, 25991, 31631, 80, 84, 69, 50,
+		49, 50, 50, 50, 51, 50, 52, 50, 53, 50, 54, 50, 55, 50, 56, 50,
+		57, 51, 48, 51, 49, 51, 50, 51, 51, 51, 52, 51, 53, 4352, 4354, 4355,
+		4357, 4358, 4359, 4361, 4363, 4364, 4366, 4367, 4368, 4369, 4370, 4352, 4449, 4354, 4449, 4355,
+		4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361, 4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367,
+		4449, 4368, 4449, 4369, 4449, 4370, 4449, 4366, 4449, 4535, 4352, 4457, 4364, 4462, 4363, 4468,
+		4363, 4462, 19968, 20108, 19977, 22235, 20116, 20845, 19971, 20843, 20061, 21313, 26376, 28779, 27700, 26408,
+		37329, 22303, 26085, 26666, 26377, 31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007, 22899, 36969, 20778,
+		21360, 27880, 38917, 20241, 20889, 27491, 19978, 20013, 19979, 24038, 21491, 21307, 23447, 23398, 30435, 20225,
+		36039, 21332, 22812, 51, 54, 51, 55, 51, 56, 51, 57, 52, 48, 52, 49, 52,
+		50, 52, 51, 52, 52, 52, 53, 52, 54, 52, 55, 52, 56, 52, 57, 53,
+		48, 49, 26376, 50, 26376, 51, 26376, 52, 26376, 53, 26376, 54, 26376, 55, 26376, 56,
+		26376, 57, 26376, 49, 48, 26376, 49, 49, 26376, 49, 50, 26376, 72, 103, 101, 114,
+		103, 101, 86, 76, 84, 68, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467,
+		12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495,
+		12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524,
+		12525, 12527, 12528, 12529, 12530, 20196, 21644, 12450, 12495, 12442, 12540, 12488, 12450, 12523, 12501, 12449,
+		12450, 12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531, 12463, 12441, 12452, 12531, 12481,
+		12454, 12457, 12531, 12456, 12473, 12463, 12540, 12488, 12441, 12456, 12540, 12459, 12540, 12458, 12531, 12473,
+		12458, 12540, 12512, 12459, 12452, 12522, 12459, 12521, 12483, 12488, 12459, 12525, 12522, 12540, 12459, 12441,
+		12525, 12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441, 12491, 12540, 12461, 12517,
+		12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540, 12461, 12525, 12461, 12525, 12463, 12441, 12521, 12512,
+		12461, 12525, 12513, 12540, 12488, 12523, 12461, 12525, 12527, 12483, 12488, 12463, 12441, 12521, 12512, 12463,
+		12441, 12521, 12512, 12488, 12531, 12463, 12523, 12475, 12441, 12452, 12525, 12463, 12525, 12540, 12493, 12465,
+		12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442, 12469, 12452, 12463, 12523, 12469, 12531, 12481,
+		12540, 12512, 12471, 12522, 12531, 12463, 12441, 12475, 12531, 12481, 12475, 12531, 12488, 12479, 12441, 12540,
+		12473, 12486, 12441, 12471, 12488, 12441, 12523, 12488, 12531, 12490, 12494, 12494, 12483, 12488, 12495, 12452,
+		12484, 12495, 12442, 12540, 12475, 12531, 12488, 12495, 12442, 12540, 12484, 12495, 12441, 12540, 12524, 12523,
+		12498, 12442, 12450, 12473, 12488, 12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441, 12523,
+		12501, 12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501, 12441, 12483, 12471, 12455, 12523,
+		12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523, 12504, 12442, 12477, 12504, 12442, 12491, 12498, 12504,
+		12523, 12484, 12504, 12442, 12531, 12473, 12504, 12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507,
+		12442, 12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507, 12442, 12531, 12488, 12441, 12507,
+		12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463, 12525, 12510, 12452, 12523, 12510, 12483, 12495, 12510,
+		12523, 12463, 12510, 12531, 12471, 12519, 12531, 12511, 12463, 12525, 12531, 12511, 12522, 12511, 12522, 12495,
+		12441, 12540, 12523, 12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531, 12513, 12540, 12488, 12523, 12516,
+		12540, 12488, 12441, 12516, 12540, 12523, 12518, 12450, 12531, 12522, 12483, 12488, 12523, 12522, 12521, 12523,
+		12498, 12442, 12540, 12523, 12540, 12501, 12441, 12523, 12524, 12512, 12524, 12531, 12488, 12465, 12441, 12531,
+		12527, 12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857, 52, 28857, 53, 28857, 54,
+		28857, 55, 28857, 56, 28857, 57, 28857, 49, 48, 28857, 49, 49, 28857, 49, 50, 28857,
+		49, 51, 28857, 49, 52, 28857, 49, 53, 28857, 49, 54, 28857, 49, 55, 28857, 49,
+		56, 28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857, 50, 50, 28857, 50, 51,
+		28857, 50, 52, 28857, 104, 80, 97, 100, 97, 65, 85, 98, 97, 114, 111, 86,
+		112, 99, 100, 109, 100, 109, 50, 100, 109, 51, 73, 85, 24179, 25104, 26157, 21644,
+		22823, 27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65, 110, 65, 956, 65, 109, 65,
+		107, 65, 75, 66, 77, 66, 71, 66, 99, 97, 108, 107, 99, 97, 108, 112,
+		70, 110, 70, 956, 70, 956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122,
+		77, 72, 122, 71, 72, 122, 84, 72, 122, 956, 108, 109, 108, 100, 108, 107,
+		108, 102, 109, 110, 109, 956, 109, 109, 109, 99, 109, 107, 109, 109, 109, 50,
+		99, 109, 50, 109, 50, 107, 109, 50, 109, 109, 51, 99, 109, 51, 109, 51,
+		107, 109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80, 97, 107, 80, 97, 77,
+		80, 97, 71, 80, 97, 114, 97, 100, 114, 97, 100, 8725, 115, 114, 97, 100,
+		8725, 115, 50, 112, 115, 110, 115, 956, 115, 109, 115, 112, 86, 110, 86, 956,
+		86, 109, 86, 107, 86, 77, 86, 112, 87, 110, 87, 956, 87, 109, 87, 107,
+		87, 77, 87, 107, 937, 77, 937, 97, 46, 109, 46, 66, 113, 99, 99, 99,
+		100, 67, 8725, 107, 103, 67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80,
+		105, 110, 75, 75, 75, 77, 107, 116, 108, 109, 108, 110, 108, 111, 103, 108,
+		120, 109, 98, 109, 105, 108, 109, 111, 108, 80, 72, 112, 46, 109, 46, 80,
+		80, 77, 80, 82, 115, 114, 83, 118, 87, 98, 86, 8725, 109, 65, 8725, 109,
+		49, 26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085, 55, 26085, 56, 26085,
+		57, 26085, 49, 48, 26085, 49, 49, 26085, 49, 50, 26085, 49, 51, 26085, 49, 52,
+		26085, 49, 53, 26085, 49, 54, 26085, 49, 55, 26085, 49, 56, 26085, 49, 57, 26085,
+		50, 48, 26085, 50, 49, 26085, 50, 50, 26085, 50, 51, 26085, 50, 52, 26085, 50,
+		53, 26085, 50, 54, 26085, 50, 55, 26085, 50, 56, 26085, 50, 57, 26085, 51, 48,
+		26085, 51, 49, 26085, 103, 97, 108, 1098, 1100, 42863, 67, 70, 81, 294, 339, 42791,
+		43831, 619, 43858, 653, 35912, 26356, 36554, 36040, 28369, 20018, 21477, 40860, 40860, 22865, 37329, 21895,
+		22856, 25078, 30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098,
+		21365, 27396, 29211, 34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436,
+		37070, 20358, 20919, 21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396, 36335, 38706, 39791, 40442, 30860,
+		31103, 32160, 33737, 37636, 40575, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744, 23650,
+		27155, 28122, 28431, 32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712, 25295,
+		27138, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489, 19981, 27852, 25976, 32034, 21443,
+		22622, 30465, 33865, 35498, 27578, 36784, 27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975,
+		33391, 35538, 37327, 21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147, 26310,
+		27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706,
+		21015, 21155, 21693, 28872, 35010, 35498, 24265, 24565, 25467, 27566, 31806, 29557, 20196, 22265, 23527, 23994,
+		24604, 29618, 29801, 32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698,
+		23534, 23615, 26009, 27138, 29134, 30274, 34044, 36988, 40845, 26248, 38446, 21129, 26491, 26611, 27969, 28316,
+		29705, 30041, 30827, 32016, 39006, 20845, 25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900, 26647, 29575,
+		38534, 21033, 21519, 23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324, 38626, 21311,
+		28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256, 31435, 31520, 31890, 29376, 28825,
+		35672, 20160, 33590, 21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275,
+		20800, 21952, 22618, 26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322, 35576,
+		36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813, 21193, 21220, 21329, 21917, 22022,
+		22120, 22592, 22696, 23652, 23662, 24724, 24936, 24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450,
+		29038, 29227, 29730, 30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680, 32244,
+		32265, 32321, 32626, 32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585, 35641, 36051, 36104, 36790, 36920,
+		38627, 38911, 38971, 24693, 148206, 33304, 20006, 20917, 20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845,
+		21913, 21986, 22618, 22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910, 24840, 24974,
+		24928, 25074, 25140, 25540, 25628, 25682, 25942, 26228, 26391, 26395, 26454, 27513, 27578, 27969, 28379, 28363,
+		28450, 28702, 29038, 30631, 29237, 29359, 29482, 29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538,
+		30528, 30924, 31409, 31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206, 35222, 35519,
+		35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273, 37494, 38524, 38627, 38742, 38875,
+		38911, 38923, 38971, 39698, 40860, 141386, 141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846,
+		102, 102, 102, 105, 102, 108, 102, 102, 105, 102, 102, 108, 115, 116, 115, 116,
+		1396, 1398, 1396, 1381, 1396, 1387, 1406, 1398, 1396, 1389, 1497, 1460, 1522, 1463, 1506, 1488,
+		1491, 1492, 1499, 1500, 1501, 1512, 1514, 43, 1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513,
+		1468, 1474, 1488, 1463, 1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492, 1468,
+		1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468, 1499, 1468, 1500, 1468, 1502, 1468,
+		1504, 1468, 1505, 1468, 1507, 1468, 1508, 1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468,
+		1514, 1468, 1493, 1465, 1489, 1471, 1499, 1471, 1508, 1471, 1488, 1500, 1649, 1649, 1659, 1659,
+		1659, 1659, 1662, 1662, 1662, 1662, 1664, 1664, 1664, 1664, 1658, 1658, 1658, 1658, 1663, 1663,
+		1663, 1663, 1657, 1657, 1657, 1657, 1700, 1700, 1700, 1700, 1702, 1702, 1702, 1702, 1668, 1668,
+		1668, 1668, 1667, 1667, 1667, 1667, 1670, 1670, 1670, 1670, 1671, 1671, 1671, 1671, 1677, 1677,
+		1676, 1676, 1678, 1678, 1672, 1672, 1688, 1688, 1681, 1681, 1705, 1705, 1705, 1705, 1711, 1711,
+		1711, 1711, 1715, 1715, 1715, 1715, 1713, 1713, 1713, 1713, 1722, 1722, 1723, 1723, 1723, 1723,
+		1749, 1620, 1749, 1620, 1729, 1729, 1729, 1729, 1726, 1726, 1726, 1726, 1746, 1746, 1746, 1620,
+		1746, 1620, 1709, 1709, 1709, 1709, 1735, 1735, 1734, 1734, 1736, 1736, 1735, 1652, 1739, 1739,
+		1733, 1733, 1737, 1737, 1744, 1744, 1744, 1744, 1609, 1609, 1610, 1620, 1575, 1610, 1620, 1575,
+		1610, 1620, 1749, 1610, 1620, 1749, 1610, 1620, 1608, 1610, 1620, 1608, 1610, 1620, 1735, 1610,
+		1620, 1735, 1610, 1620, 1734, 1610, 1620, 1734, 1610, 1620, 1736, 1610, 1620, 1736, 1610, 1620,
+		1744, 1610, 1620, 1744, 1610, 1620, 1744, 1610, 1620, 1609, 1610, 1620, 1609, 1610, 1620, 1609,
+		1740, 1740, 1740, 1740, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1609,
+		1610, 1620, 1610, 1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578,
+		1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578, 1610, 1579, 1580, 1579, 1605, 1579,
+		1609, 1579, 1610, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582,
+		1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590,
+		1581, 1590, 1582, 1590, 1605, 1591, 1581, 1591, 1605, 1592, 1605, 1593, 1580, 1593, 1605, 1594,
+		1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602,
+		1581, 1602, 1605, 1602, 1609, 1602, 1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603,
+		1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604,
+		1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606,
+		1580, 1606, 1581, 1606, 1582, 1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607,
+		1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605, 1610, 1609, 1610, 1610, 1584,
+		1648, 1585, 1648, 1609, 1648, 32, 1612, 1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615,
+		1617, 32, 1616, 1617, 32, 1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620, 1605,
+		1610, 1620, 1606, 1610, 1620, 1609, 1610, 1620, 1610, 1576, 1585, 1576, 1586, 1576, 1605, 1576,
+		1606, 1576, 1609, 1576, 1610, 1578, 1585, 1578, 1586, 1578, 1605, 1578, 1606, 1578, 1609, 1578,
+		1610, 1579, 1585, 1579, 1586, 1579, 1605, 1579, 1606, 1579, 1609, 1579, 1610, 1601, 1609, 1601,
+		1610, 1602, 1609, 1602, 1610, 1603, 1575, 1603, 1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604,
+		1605, 1604, 1609, 1604, 1610, 1605, 1575, 1605, 1605, 1606, 1585, 1606, 1586, 1606, 1605, 1606,
+		1606, 1606, 1609, 1606, 1610, 1609, 1648, 1610, 1585, 1610, 1586, 1610, 1605, 1610, 1606, 1610,
+		1609, 1610, 1610, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1582, 1610, 1620, 1605, 1610,
+		1620, 1607, 1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1607, 1578, 1580, 1578, 1581,
+		1578, 1582, 1578, 1605, 1578, 1607, 1579, 1605, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605,
+		1582, 1580, 1582, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1582,
+		1589, 1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591, 1581, 1592, 1605, 1593, 1580,
+		1593, 1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1602, 1581,
+		1602, 1605, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603, 1605, 1604, 1580, 1604, 1581,
+		1604, 1582, 1604, 1605, 1604, 1607, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1606, 1580,
+		1606, 1581, 1606, 1582, 1606, 1605, 1606, 1607, 1607, 1580, 1607, 1605, 1607, 1648, 1610, 1580,
+		1610, 1581, 1610, 1582, 1610, 1605, 1610, 1607, 1610, 1620, 1605, 1610, 1620, 1607, 1576, 1605,
+		1576, 1607, 1578, 1605, 1578, 1607, 1579, 1605, 1579, 1607, 1587, 1605, 1587, 1607, 1588, 1605,
+		1588, 1607, 1603, 1604, 1603, 1605, 1604, 1605, 1606, 1605, 1606, 1607, 1610, 1605, 1610, 1607,
+		1600, 1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609, 1591, 1610, 1593, 1609, 1593,
+		1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588, 1609, 1588, 1610, 1581, 1609, 1581,
+		1610, 1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590,
+		1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585, 1587, 1585, 1589, 1585, 1590,
+		1585, 1591, 1609, 1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587,
+		1610, 1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610, 1582, 1609, 1582,
+		1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588,
+		1605, 1588, 1585, 1587, 1585, 1589, 1585, 1590, 1585, 1588, 1580, 1588, 1581, 1588, 1582, 1588,
+		1605, 1587, 1607, 1588, 1607, 1591, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1588, 1580, 1588,
+		1581, 1588, 1582, 1591, 1605, 1592, 1605, 1575, 1611, 1575, 1611, 1578, 1580, 1605, 1578, 1581,
+		1580, 1578, 1581, 1580, 1578, 1581, 1605, 1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581,
+		1578, 1605, 1582, 1580, 1605, 1581, 1580, 1605, 1581, 1581, 1605, 1610, 1581, 1605, 1609, 1587,
+		1581, 1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605, 1581, 1587, 1605, 1581, 1587, 1605,
+		1580, 1587, 1605, 1605, 1587, 1605, 1605, 1589, 1581, 1581, 1589, 1581, 1581, 1589, 1605, 1605,
+		1588, 1581, 1605, 1588, 1581, 1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1582, 1588,
+		1605, 1605, 1588, 1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605, 1590, 1582, 1605, 1591, 1605,
+		1581, 1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605, 1610, 1593, 1580, 1605, 1593, 1605, 1605,
+		1593, 1605, 1605, 1593, 1605, 1609, 1594, 1605, 1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601,
+		1582, 1605, 1601, 1582, 1605, 1602, 1605, 1581, 1602, 1605, 1605, 1604, 1581, 1605, 1604, 1581,
+		1610, 1604, 1581, 1609, 1604, 1580, 1580, 1604, 1580, 1580, 1604, 1582, 1605, 1604, 1582, 1605,
+		1604, 1605, 1581, 1604, 1605, 1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605,
+		1580, 1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605, 1605, 1580, 1582, 1607, 1605,
+		1580, 1607, 1605, 1605, 1606, 1581, 1605, 1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1605,
+		1606, 1580, 1609, 1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1610, 1605, 1605, 1576,
+		1582, 1610, 1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582, 1610, 1578, 1582, 1609, 1578, 1605,
+		1610, 1578, 1605, 1609, 1580, 1605, 1610, 1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609,
+		1589, 1581, 1610, 1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605, 1610, 1610,
+		1581, 1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605, 1605, 1610, 1602, 1605, 1610, 1606, 1581,
+		1610, 1602, 1605, 1581, 1604, 1581, 1605, 1593, 1605, 1610, 1603, 1605, 1610, 1606, 1580, 1581,
+		1605, 1582, 1610, 1604, 1580, 1605, 1603, 1605, 1605, 1604, 1580, 1605, 1606, 1580, 1581, 1580,
+		1581, 1610, 1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605, 1610, 1576, 1581, 1610, 1603, 1605,
+		1605, 1593, 1580, 1605, 1589, 1605, 1605, 1587, 1582, 1610, 1606, 1580, 1610, 1589, 1604, 1746,
+		1602, 1604, 1746, 1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585, 1605, 1581, 1605, 1583, 1589,
+		1604, 1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607, 1608, 1587, 1604, 1605, 1589,
+		1604, 1609, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32,
+		1608, 1587, 1604, 1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607, 1585, 1740, 1575, 1604,
+		44, 12289, 12290, 58, 59, 33, 63, 12310, 12311, 46, 46, 46, 46, 46, 8212, 8211,
+		95, 95, 40, 41, 123, 125, 12308, 12309, 12304, 12305, 12298, 12299, 12296, 12297, 12300, 12301,
+		12302, 12303, 91, 93, 32, 773, 32, 773, 32, 773, 32, 773, 95, 95, 95, 44,
+		12289, 46, 59, 58, 63, 33, 8212, 40, 41, 123, 125, 12308, 12309, 35, 38, 42,
+		43, 45, 60, 62, 61, 92, 36, 37, 64, 32, 1611, 1600, 1611, 32, 1612, 32,
+		1613, 32, 1614, 1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616, 32, 1617, 1600,
+		1617, 32, 1618, 1600, 1618, 1569, 1575, 1619, 1575, 1619, 1575, 1620, 1575, 1620, 1608, 1620,
+		1608, 1620, 1575, 1621, 1575, 1621, 1610, 1620, 1610, 1620, 1610, 1620, 1610, 1620, 1575, 1575,
+		1576, 1576, 1576, 1576, 1577, 1577, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1580, 1580,
+		1580, 1580, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1583, 1583, 1584, 1584, 1585, 1585,
+		1586, 1586, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1589, 1589, 1589, 1589, 1590, 1590,
+		1590, 1590, 1591, 1591, 1591, 1591, 1592, 1592, 1592, 1592, 1593, 1593, 1593, 1593, 1594, 1594,
+		1594, 1594, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1603, 1603, 1603, 1603, 1604, 1604,
+		1604, 1604, 1605, 1605, 1605, 1605, 1606, 1606, 1606, 1606, 1607, 1607, 1607, 1607, 1608, 1608,
+		1609, 1609, 1610, 1610, 1610, 1610, 1604, 1575, 1619, 1604, 1575, 1619, 1604, 1575, 1620, 1604,
+		1575, 1620, 1604, 1575, 1621, 1604, 1575, 1621, 1604, 1575, 1604, 1575, 33, 34, 35, 36,
+		37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+		53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+		69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+		85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100,
+		101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+		117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 10629, 10630, 12290, 12300, 12301, 12289,
+		12539, 12530, 12449, 12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483, 12540, 12450, 12452, 12454, 12456,
+		12458, 12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488,
+		12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514, 12516,
+		12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12531, 12441, 12442, 4448, 4352, 4353, 4522, 4354,
+		4524, 4525, 4355, 4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385,
+		4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450, 4451, 4452, 4453, 4454,
+		4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 162,
+		163, 172, 32, 772, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632, 9675, 720, 721,
+		230, 665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600, 606, 681, 612, 610, 608,
+		667, 295, 668, 615, 644, 682, 683, 620, 122628, 42894, 622, 122629, 654, 122630, 248, 630,
+		631, 113, 634, 122632, 637, 638, 640, 680, 678, 43879, 679, 648, 11377, 655, 673, 674,
+		664, 448, 449, 450, 122634, 122654, 69785, 69818, 69787, 69818, 69797, 69818, 69937, 69927, 69938, 69927,
+		70471, 70462, 70471, 70487, 70841, 70842, 70841, 70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984,
+		119127, 119141, 119128, 119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128, 119141, 119153,
+		119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150, 119226, 119141, 119150, 119225, 119141, 119151,
+		119226, 119141, 119151, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+		78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+		100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+		116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+		74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+		90, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112,
+		113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70,
+		71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+		87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+		109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 67,
+		68, 71, 74, 75, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89, 90,
+		97, 98, 99, 100, 102, 104, 105, 106, 107, 108, 109, 110, 112, 113, 114, 115,
+		116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+		74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+		90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+		112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 68, 69, 70,
+		71, 74, 75, 76, 77, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89,
+		97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+		113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 68, 69, 70, 71,
+		73, 74, 75, 76, 77, 79, 83, 84, 85, 86, 87, 88, 89, 97, 98, 99,
+		100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+		116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+		74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+		90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+		112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69,
+		70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+		86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+		108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+		66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+		82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103,
+		104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+		120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+		78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99,
+		100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+		116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+		74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+		90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+		112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69,
+		70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+		86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+		108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 305,
+		567, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+		928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949,
+		950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965,
+		966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917,
+		918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933,
+		934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+		956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949,
+		952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923,
+		924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935, 936, 937, 8711, 945,
+		946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961,
+		962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913,
+		914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+		920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951,
+		952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967,
+		968, 969, 8706, 949, 952, 954, 966, 961, 960, 913, 914, 915, 916, 917, 918, 919,
+		920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933, 934, 935,
+		936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+		958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954,
+		966, 961, 960, 988, 989, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48,
+		49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50, 51, 52, 53, 54,
+		55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50,
+		51, 52, 53, 54, 55, 56, 57, 1575, 1576, 1580, 1583, 1608, 1586, 1581, 1591, 1610,
+		1603, 1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590,
+		1592, 1594, 1646, 1722, 1697, 1647, 1576, 1580, 1607, 1581, 1610, 1603, 1604, 1605, 1606, 1587,
+		1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1594, 1580, 1581, 1610, 1604, 1606, 1587,
+		1593, 1589, 1602, 1588, 1582, 1590, 1594, 1722, 1647, 1576, 1580, 1607, 1581, 1591, 1610, 1603,
+		1605, 1606, 1587, 1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1592, 1594, 1646, 1697,
+		1575, 1576, 1580, 1583, 1607, 1608, 1586, 1581, 1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601,
+		1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590, 1592, 1594, 1576, 1580, 1583, 1608, 1586,
+		1581, 1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582,
+		1584, 1590, 1592, 1594, 48, 46, 48, 44, 49, 44, 50, 44, 51, 44, 52, 44,
+		53, 44, 54, 44, 55, 44, 56, 44, 57, 44, 40, 65, 41, 40, 66, 41,
+		40, 67, 41, 40, 68, 41, 40, 69, 41, 40, 70, 41, 40, 71, 41, 40,
+		72, 41, 40, 73, 41, 40, 74, 41, 40, 75, 41, 40, 76, 41, 40, 77,
+		41, 40, 78, 41, 40, 79, 41, 40, 80, 41, 40, 81, 41, 40, 82, 41,
+		40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86, 41, 40, 87, 41, 40,
+		88, 41, 40, 89, 41, 40, 90, 41, 12308, 83, 12309, 67, 82, 67, 68, 87,
+		90, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+		80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 72, 86, 77, 86, 83,
+		68, 83, 83, 80, 80, 86, 87, 67, 77, 67, 77, 68, 77, 82, 68, 74,
+		12411, 12363, 12467, 12467, 12469, 25163, 23383, 21452, 12486, 12441, 20108, 22810, 35299, 22825, 20132, 26144,
+		28961, 26009, 21069, 24460, 20877, 26032, 21021, 32066, 29983, 36009, 22768, 21561, 28436, 25237, 25429, 19968,
+		19977, 36938, 24038, 20013, 21491, 25351, 36208, 25171, 31105, 31354, 21512, 28288, 26377, 26376, 30003, 21106,
+		21942, 37197, 12308, 26412, 12309, 12308, 19977, 12309, 12308, 20108, 12309, 12308, 23433, 12309, 12308, 28857,
+		12309, 12308, 25171, 12309, 12308, 30423, 12309, 12308, 21213, 12309, 12308, 25943, 12309, 24471, 21487, 48,
+		49, 50, 51, 52, 53, 54, 55, 56, 57, 20029, 20024, 20033, 131362, 20320, 20398, 20411,
+		20482, 20602, 20633, 20711, 20687, 13470, 132666, 20813, 20820, 20836, 20855, 132380, 13497, 20839, 20877, 132427,
+		20887, 20900, 20172, 20908, 20917, 168415, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589, 21191, 21193,
+		21220, 21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363, 21373, 21375, 21375, 21375, 133676, 28784, 21450,
+		21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608, 21666, 21750, 21776, 21843, 21859, 21892, 21892,
+		21913, 21931, 21939, 21954, 22294, 22022, 22295, 22097, 22132, 20999, 22766, 22478, 22516, 22541, 22411, 22578,
+		22577, 22700, 136420, 22770, 22775, 22790, 22810, 22818, 22882, 136872, 136938, 23020, 23067, 23079, 23000, 23142,
+		14062, 14076, 23304, 23358, 23358, 137672, 23491, 23512, 23527, 23539, 138008, 23551, 23558, 24403, 23586, 14209,
+		23648, 23662, 23744, 23693, 138724, 23875, 138726, 23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125,
+		24169, 14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946, 24318, 140081, 140081, 33281, 24354, 24354, 14535,
+		144056, 156122, 24418, 24427, 14563, 24474, 24525, 24535, 24569, 24705, 14650, 14620, 24724, 141012, 24775, 24904,
+		24908, 24910, 24908, 24954, 24974, 25010, 24996, 25007, 25054, 25074, 25078, 25104, 25115, 25181, 25265, 25300,
+		25424, 142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705, 25726, 25757, 25719,
+		14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257, 15112, 15076, 20882, 20885, 26368, 26268, 32941,
+		17369, 26391, 26395, 26401, 26462, 26451, 144323, 15177, 26618, 26501, 26706, 26757, 144493, 26766, 26655, 26900,
+		15261, 26946, 27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506, 27551, 27578, 27579,
+		146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926, 27966, 28023, 27969, 28009, 28024, 28037, 146718,
+		27956, 28207, 28270, 15667, 28363, 28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28702, 28699, 15766,
+		28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29237, 29264, 149000, 29312, 29333, 149301,
+		149524, 29562, 29579, 16044, 29605, 16056, 16056, 29767, 29788, 29809, 29829, 29898, 16155, 29988, 150582, 30014,
+		150674, 30064, 139679, 30224, 151457, 151480, 151620, 16380, 16392, 30452, 151795, 151794, 151833, 151859, 30494, 30495,
+		30495, 30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860, 30924, 16611, 153126, 31062, 153242, 153285, 31119,
+		31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279, 31470, 16898, 154539, 31686, 31689, 16935, 154752, 31954,
+		17056, 31976, 31971, 32000, 155526, 32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634,
+		156478, 32661, 32762, 32773, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086, 23221,
+		157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425, 33419, 33437, 21171, 33457, 33459, 33469, 33510,
+		158524, 33509, 33565, 33635, 33709, 33571, 33725, 33767, 33879, 33619, 33738, 33740, 33756, 158774, 159083, 158933,
+		17707, 34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665, 159954, 17771, 34384, 34396, 34407, 34409,
+		34473, 34440, 34574, 34530, 34681, 34600, 34667, 34694, 17879, 34785, 34817, 17913, 34912, 34915, 161383, 35031,
+		35038, 17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488, 35565, 35722, 35925, 162984, 36011, 36033, 36123,
+		36215, 163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664, 165330, 165357, 37012, 37105, 37137, 165678, 37147,
+		37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837, 38327, 167287, 18918, 38595, 23986, 38691, 168261,
+		168474, 19054, 19062, 38880, 168970, 19122, 169110, 38923, 38923, 38953, 169398, 39138, 19251, 39209, 39335, 39362,
+		39422, 19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558, 172689, 40635, 19798,
+		40697, 40702, 40709, 40719, 40726, 40763, 173568,
+	};
+
+	//primary composites other than hangul syllables, sorted by the pair they compose from
+	struct Composition
+	{
+		char32_t first;
+		char32_t second;
+		char32_t composite;
+	};
+
+	inline constexpr Composition compositions[941] = {
+		{ 60, 824, 8814 },
+		{ 61, 824, 8800 },
+		{ 62, 824, 8815 },
+		{ 65, 768, 192 },
+		{ 65, 769, 193 },
+		{ 65, 770, 194 },
+		{ 65, 771, 195 },
+		{ 65, 772, 256 },
+		{ 65, 774, 258 },
+		{ 65, 775, 550 },
+		{ 65, 776, 196 },
+		{ 65, 777, 7842 },
+		{ 65, 778, 197 },
+		{ 65, 780, 461 },
+		{ 65, 783, 512 },
+		{ 65, 785, 514 },
+		{ 65, 803, 7840 },
+		{ 65, 805, 7680 },
+		{ 65, 808, 260 },
+		{ 66, 775, 7682 },
+		{ 66, 803, 7684 },
+		{ 66, 817, 7686 },
+		{ 67, 769, 262 },
+		{ 67, 770, 264 },
+		{ 67, 775, 266 },
+		{ 67, 780, 268 },
+		{ 67, 807, 199 },
+		{ 68, 775, 7690 },
+		{ 68, 780, 270 },
+		{ 68, 803, 7692 },
+		{ 68, 807, 7696 },
+		{ 68, 813, 7698 },
+		{ 68, 817, 7694 },
+		{ 69, 768, 200 },
+		{ 69, 769, 201 },
+		{ 69, 770, 202 },
+		{ 69, 771, 7868 },
+		{ 69, 772, 274 },
+		{ 69, 774, 276 },
+		{ 69, 775, 278 },
+		{ 69, 776, 203 },
+		{ 69, 777, 7866 },
+		{ 69, 780, 282 },
+		{ 69, 783, 516 },
+		{ 69, 785, 518 },
+		{ 69, 803, 7864 },
+		{ 69, 807, 552 },
+		{ 69, 808, 280 },
+		{ 69, 813, 7704 },
+		{ 69, 816, 7706 },
+		{ 70, 775, 7710 },
+		{ 71, 769, 500 },
+		{ 71, 770, 284 },
+		{ 71, 772, 7712 },
+		{ 71, 774, 286 },
+		{ 71, 775, 288 },
+		{ 71, 780, 486 },
+		{ 71, 807, 290 },
+		{ 72, 770, 292 },
+		{ 72, 775, 7714 },
+		{ 72, 776, 7718 },
+		{ 72, 780, 542 },
+		{ 72, 803, 7716 },
+		{ 72, 807, 7720 },
+		{ 72, 814, 7722 },
+		{ 73, 768, 204 },
+		{ 73, 769, 205 },
+		{ 73, 770, 206 },
+		{ 73, 771, 296 },
+		{ 73, 772, 298 },
+		{ 73, 774, 300 },
+		{ 73, 775, 304 },
+		{ 73, 776, 207 },
+		{ 73, 777, 7880 },
+		{ 73, 780, 463 },
+		{ 73, 783, 520 },
+		{ 73, 785, 522 },
+		{ 73, 803, 7882 },
+		{ 73, 808, 302 },
+		{ 73, 816, 7724 },
+		{ 74, 770, 308 },
+		{ 75, 769, 7728 },
+		{ 75, 780, 488 },
+		{ 75, 803, 7730 },
+		{ 75, 807, 310 },
+		{ 75, 817, 7732 },
+		{ 76, 769, 313 },
+		{ 76, 780, 317 },
+		{ 76, 803, 7734 },
+		{ 76, 807, 315 },
+		{ 76, 813, 7740 },
+		{ 76, 817, 7738 },
+		{ 77, 769, 7742 },
+		{ 77, 775, 7744 },
+		{ 77, 803, 7746 },
+		{ 78, 768, 504 },
+		{ 78, 769, 323 },
+		{ 78, 771, 209 },
+		{ 78, 775, 7748 },
+		{ 78, 780, 327 },
+		{ 78, 803, 7750 },
+		{ 78, 807, 325 },
+		{ 78, 813, 7754 },
+		{ 78, 817, 7752 },
+		{ 79, 768, 210 },
+		{ 79, 769, 211 },
+		{ 79, 770, 212 },
+		{ 79, 771, 213 },
+		{ 79, 772, 332 },
+		{ 79, 774, 334 },
+		{ 79, 775, 558 },
+		{ 79, 776, 214 },
+		{ 79, 777, 7886 },
+		{ 79, 779, 336 },
+		{ 79, 780, 465 },
+		{ 79, 783, 524 },
+		{ 79, 785, 526 },
+		{ 79, 795, 416 },
+		{ 79, 803, 7884 },
+		{ 79, 808, 490 },
+		{ 80, 769, 7764 },
+		{ 80, 775, 7766 },
+		{ 82, 769, 340 },
+		{ 82, 775, 7768 },
+		{ 82, 780, 344 },
+		{ 82, 783, 528 },
+		{ 82, 785, 530 },
+		{ 82, 803, 7770 },
+		{ 82, 807, 342 },
+		{ 82, 817, 7774 },
+		{ 83, 769, 346 },
+		{ 83, 770, 348 },
+		{ 83, 775, 7776 },
+		{ 83, 780, 352 },
+		{ 83, 803, 7778 },
+		{ 83, 806, 536 },
+		{ 83, 807, 350 },
+		{ 84, 775, 7786 },
+		{ 84, 780, 356 },
+		{ 84, 803, 7788 },
+		{ 84, 806, 538 },
+		{ 84, 807, 354 },
+		{ 84, 813, 7792 },
+		{ 84, 817, 7790 },
+		{ 85, 768, 217 },
+		{ 85, 769, 218 },
+		{ 85, 770, 219 },
+		{ 85, 771, 360 },
+		{ 85, 772, 362 },
+		{ 85, 774, 364 },
+		{ 85, 776, 220 },
+		{ 85, 777, 7910 },
+		{ 85, 778, 366 },
+		{ 85, 779, 368 },
+		{ 85, 780, 467 },
+		{ 85, 783, 532 },
+		{ 85, 785, 534 },
+		{ 85, 795, 431 },
+		{ 85, 803, 7908 },
+		{ 85, 804, 7794 },
+		{ 85, 808, 370 },
+		{ 85, 813, 7798 },
+		{ 85, 816, 7796 },
+		{ 86, 771, 7804 },
+		{ 86, 803, 7806 },
+		{ 87, 768, 7808 },
+		{ 87, 769, 7810 },
+		{ 87, 770, 372 },
+		{ 87, 775, 7814 },
+		{ 87, 776, 7812 },
+		{ 87, 803, 7816 },
+		{ 88, 775, 7818 },
+		{ 88, 776, 7820 },
+		{ 89, 768, 7922 },
+		{ 89, 769, 221 },
+		{ 89, 770, 374 },
+		{ 89, 771, 7928 },
+		{ 89, 772, 562 },
+		{ 89, 775, 7822 },
+		{ 89, 776, 376 },
+		{ 89, 777, 7926 },
+		{ 89, 803, 7924 },
+		{ 90, 769, 377 },
+		{ 90, 770, 7824 },
+		{ 90, 775, 379 },
+		{ 90, 780, 381 },
+		{ 90, 803, 7826 },
+		{ 90, 817, 7828 },
+		{ 97, 768, 224 },
+		{ 97, 769, 225 },
+		{ 97, 770, 226 },
+		{ 97, 771, 227 },
+		{ 97, 772, 257 },
+		{ 97, 774, 259 },
+		{ 97, 775, 551 },
+		{ 97, 776, 228 },
+		{ 97, 777, 7843 },
+		{ 97, 778, 229 },
+		{ 97, 780, 462 },
+		{ 97, 783, 513 },
+		{ 97, 785, 515 },
+		{ 97, 803, 7841 },
+		{ 97, 805, 7681 },
+		{ 97, 808, 261 },
+		{ 98, 775, 7683 },
+		{ 98, 803, 7685 },
+		{ 98, 817, 7687 },
+		{ 99, 769, 263 },
+		{ 99, 770, 265 },
+		{ 99, 775, 267 },
+		{ 99, 780, 269 },
+		{ 99, 807, 231 },
+		{ 100, 775, 7691 },
+		{ 100, 780, 271 },
+		{ 100, 803, 7693 },
+		{ 100, 807, 7697 },
+		{ 100, 813, 7699 },
+		{ 100, 817, 7695 },
+		{ 101, 768, 232 },
+		{ 101, 769, 233 },
+		{ 101, 770, 234 },
+		{ 101, 771, 7869 },
+		{ 101, 772, 275 },
+		{ 101, 774, 277 },
+		{ 101, 775, 279 },
+		{ 101, 776, 235 },
+		{ 101, 777, 7867 },
+		{ 101, 780, 283 },
+		{ 101, 783, 517 },
+		{ 101, 785, 519 },
+		{ 101, 803, 7865 },
+		{ 101, 807, 553 },
+		{ 101, 808, 281 },
+		{ 101, 813, 7705 },
+		{ 101, 816, 7707 },
+		{ 102, 775, 7711 },
+		{ 103, 769, 501 },
+		{ 103, 770, 285 },
+		{ 103, 772, 7713 },
+		{ 103, 774, 287 },
+		{ 103, 775, 289 },
+		{ 103, 780, 487 },
+		{ 103, 807, 291 },
+		{ 104, 770, 293 },
+		{ 104, 775, 7715 },
+		{ 104, 776, 7719 },
+		{ 104, 780, 543 },
+		{ 104, 803, 7717 },
+		{ 104, 807, 7721 },
+		{ 104, 814, 7723 },
+		{ 104, 817, 7830 },
+		{ 105, 768, 236 },
+		{ 105, 769, 237 },
+		{ 105, 770, 238 },
+		{ 105, 771, 297 },
+		{ 105, 772, 299 },
+		{ 105, 774, 301 },
+		{ 105, 776, 239 },
+		{ 105, 777, 7881 },
+		{ 105, 780, 464 },
+		{ 105, 783, 521 },
+		{ 105, 785, 523 },
+		{ 105, 803, 7883 },
+		{ 105, 808, 303 },
+		{ 105, 816, 7725 },
+		{ 106, 770, 309 },
+		{ 106, 780, 496 },
+		{ 107, 769, 7729 },
+		{ 107, 780, 489 },
+		{ 107, 803, 7731 },
+		{ 107, 807, 311 },
+		{ 107, 817, 7733 },
+		{ 108, 769, 314 },
+		{ 108, 780, 318 },
+		{ 108, 803, 7735 },
+		{ 108, 807, 316 },
+		{ 108, 813, 7741 },
+		{ 108, 817, 7739 },
+		{ 109, 769, 7743 },
+		{ 109, 775, 7745 },
+		{ 109, 803, 7747 },
+		{ 110, 768, 505 },
+		{ 110, 769, 324 },
+		{ 110, 771, 241 },
+		{ 110, 775, 7749 },
+		{ 110, 780, 328 },
+		{ 110, 803, 7751 },
+		{ 110, 807, 326 },
+		{ 110, 813, 7755 },
+		{ 110, 817, 7753 },
+		{ 111, 768, 242 },
+		{ 111, 769, 243 },
+		{ 111, 770, 244 },
+		{ 111, 771, 245 },
+		{ 111, 772, 333 },
+		{ 111, 774, 335 },
+		{ 111, 775, 559 },
+		{ 111, 776, 246 },
+		{ 111, 777, 7887 },
+		{ 111, 779, 337 },
+		{ 111, 780, 466 },
+		{ 111, 783, 525 },
+		{ 111, 785, 527 },
+		{ 111, 795, 417 },
+		{ 111, 803, 7885 },
+		{ 111, 808, 491 },
+		{ 112, 769, 7765 },
+		{ 112, 775, 7767 },
+		{ 114, 769, 341 },
+		{ 114, 775, 7769 },
+		{ 114, 780, 345 },
+		{ 114, 783, 529 },
+		{ 114, 785, 531 },
+		{ 114, 803, 7771 },
+		{ 114, 807, 343 },
+		{ 114, 817, 7775 },
+		{ 115, 769, 347 },
+		{ 115, 770, 349 },
+		{ 115, 775, 7777 },
+		{ 115, 780, 353 },
+		{ 115, 803, 7779 },
+		{ 115, 806, 537 },
+		{ 115, 807, 351 },
+		{ 116, 775, 7787 },
+		{ 116, 776, 7831 },
+		{ 116, 780, 357 },
+		{ 116, 803, 7789 },
+		{ 116, 806, 539 },
+		{ 116, 807, 355 },
+		{ 116, 813, 7793 },
+		{ 116, 817, 7791 },
+		{ 117, 768, 249 },
+		{ 117, 769, 250 },
+		{ 117, 770, 251 },
+		{ 117, 771, 361 },
+		{ 117, 772, 363 },
+		{ 117, 774, 365 },
+		{ 117, 776, 252 },
+		{ 117, 777, 7911 },
+		{ 117, 778, 367 },
+		{ 117, 779, 369 },
+		{ 117, 780, 468 },
+		{ 117, 783, 533 },
+		{ 117, 785, 535 },
+		{ 117, 795, 432 },
+		{ 117, 803, 7909 },
+		{ 117, 804, 7795 },
+		{ 117, 808, 371 },
+		{ 117, 813, 7799 },
+		{ 117, 816, 7797 },
+		{ 118, 771, 7805 },
+		{ 118, 803, 7807 },
+		{ 119, 768, 7809 },
+		{ 119, 769, 7811 },
+		{ 119, 770, 373 },
+		{ 119, 775, 7815 },
+		{ 119, 776, 7813 },
+		{ 119, 778, 7832 },
+		{ 119, 803, 7817 },
+		{ 120, 775, 7819 },
+		{ 120, 776, 7821 },
+		{ 121, 768, 7923 },
+		{ 121, 769, 253 },
+		{ 121, 770, 375 },
+		{ 121, 771, 7929 },
+		{ 121, 772, 563 },
+		{ 121, 775, 7823 },
+		{ 121, 776, 255 },
+		{ 121, 777, 7927 },
+		{ 121, 778, 7833 },
+		{ 121, 803, 7925 },
+		{ 122, 769, 378 },
+		{ 122, 770, 7825 },
+		{ 122, 775, 380 },
+		{ 122, 780, 382 },
+		{ 122, 803, 7827 },
+		{ 122, 817, 7829 },
+		{ 168, 768, 8173 },
+		{ 168, 769, 901 },
+		{ 168, 834, 8129 },
+		{ 194, 768, 7846 },
+		{ 194, 769, 7844 },
+		{ 194, 771, 7850 },
+		{ 194, 777, 7848 },
+		{ 196, 772, 478 },
+		{ 197, 769, 506 },
+		{ 198, 769, 508 },
+		{ 198, 772, 482 },
+		{ 199, 769, 7688 },
+		{ 202, 768, 7872 },
+		{ 202, 769, 7870 },
+		{ 202, 771, 7876 },
+		{ 202, 777, 7874 },
+		{ 207, 769, 7726 },
+		{ 212, 768, 7890 },
+		{ 212, 769, 7888 },
+		{ 212, 771, 7894 },
+		{ 212, 777, 7892 },
+		{ 213, 769, 7756 },
+		{ 213, 772, 556 },
+		{ 213, 776, 7758 },
+		{ 214, 772, 554 },
+		{ 216, 769, 510 },
+		{ 220, 768, 475 },
+		{ 220, 769, 471 },
+		{ 220, 772, 469 },
+		{ 220, 780, 473 },
+		{ 226, 768, 7847 },
+		{ 226, 769, 7845 },
+		{ 226, 771, 7851 },
+		{ 226, 777, 7849 },
+		{ 228, 772, 479 },
+		{ 229, 769, 507 },
+		{ 230, 769, 509 },
+		{ 230, 772, 483 },
+		{ 231, 769, 7689 },
+		{ 234, 768, 7873 },
+		{ 234, 769, 7871 },
+		{ 234, 771, 7877 },
+		{ 234, 777, 7875 },
+		{ 239, 769, 7727 },
+		{ 244, 768, 7891 },
+		{ 244, 769, 7889 },
+		{ 244, 771, 7895 },
+		{ 244, 777, 7893 },
+		{ 245, 769, 7757 },
+		{ 245, 772, 557 },
+		{ 245, 776, 7759 },
+		{ 246, 772, 555 },
+		{ 248, 769, 511 },
+		{ 252, 768, 476 },
+		{ 252, 769, 472 },
+		{ 252, 772, 470 },
+		{ 252, 780, 474 },
+		{ 258, 768, 7856 },
+		{ 258, 769, 7854 },
+		{ 258, 771, 7860 },
+		{ 258, 777, 7858 },
+		{ 259, 768, 7857 },
+		{ 259, 769, 7855 },
+		{ 259, 771, 7861 },
+		{ 259, 777, 7859 },
+		{ 274, 768, 7700 },
+		{ 274, 769, 7702 },
+		{ 275, 768, 7701 },
+		{ 275, 769, 7703 },
+		{ 332, 768, 7760 },
+		{ 332, 769, 7762 },
+		{ 333, 768, 7761 },
+		{ 333, 769, 7763 },
+		{ 346, 775, 7780 },
+		{ 347, 775, 7781 },
+		{ 352, 775, 7782 },
+		{ 353, 775, 7783 },
+		{ 360, 769, 7800 },
+		{ 361, 769, 7801 },
+		{ 362, 776, 7802 },
+		{ 363, 776, 7803 },
+		{ 383, 775, 7835 },
+		{ 416, 768, 7900 },
+		{ 416, 769, 7898 },
+		{ 416, 771, 7904 },
+		{ 416, 777, 7902 },
+		{ 416, 803, 7906 },
+		{ 417, 768, 7901 },
+		{ 417, 769, 7899 },
+		{ 417, 771, 7905 },
+		{ 417, 777, 7903 },
+		{ 417, 803, 7907 },
+		{ 431, 768, 7914 },
+		{ 431, 769, 7912 },
+		{ 431, 771, 7918 },
+		{ 431, 777, 7916 },
+		{ 431, 803, 7920 },
+		{ 432, 768, 7915 },
+		{ 432, 769, 7913 },
+		{ 432, 771, 7919 },
+		{ 432, 777, 7917 },
+		{ 432, 803, 7921 },
+		{ 439, 780, 494 },
+		{ 490, 772, 492 },
+		{ 491, 772, 493 },
+		{ 550, 772, 480 },
+		{ 551, 772, 481 },
+		{ 552, 774, 7708 },
+		{ 553, 774, 7709 },
+		{ 558, 772, 560 },
+		{ 559, 772, 561 },
+		{ 658, 780, 495 },
+		{ 913, 768, 8122 },
+		{ 913, 769, 902 },
+		{ 913, 772, 8121 },
+		{ 913, 774, 8120 },
+		{ 913, 787, 7944 },
+		{ 913, 788, 7945 },
+		{ 913, 837, 8124 },
+		{ 917, 768, 8136 },
+		{ 917, 769, 904 },
+		{ 917, 787, 7960 },
+		{ 917, 788, 7961 },
+		{ 919, 768, 8138 },
+		{ 919, 769, 905 },
+		{ 919, 787, 7976 },
+		{ 919, 788, 7977 },
+		{ 919, 837, 8140 },
+		{ 921, 768, 8154 },
+		{ 921, 769, 906 },
+		{ 921, 772, 8153 },
+		{ 921, 774, 8152 },
+		{ 921, 776, 938 },
+		{ 921, 787, 7992 },
+		{ 921, 788, 7993 },
+		{ 927, 768, 8184 },
+		{ 927, 769, 908 },
+		{ 927, 787, 8008 },
+		{ 927, 788, 8009 },
+		{ 929, 788, 8172 },
+		{ 933, 768, 8170 },
+		{ 933, 769, 910 },
+		{ 933, 772, 8169 },
+		{ 933, 774, 8168 },
+		{ 933, 776, 939 },
+		{ 933, 788, 8025 },
+		{ 937, 768, 8186 },
+		{ 937, 769, 911 },
+		{ 937, 787, 8040 },
+		{ 937, 788, 8041 },
+		{ 937, 837, 8188 },
+		{ 940, 837, 8116 },
+		{ 942, 837, 8132 },
+		{ 945, 768, 8048 },
+		{ 945, 769, 940 },
+		{ 945, 772, 8113 },
+		{ 945, 774, 8112 },
+		{ 945, 787, 7936 },
+		{ 945, 788, 7937 },
+		{ 945, 834, 8118 },
+		{ 945, 837, 8115 },
+		{ 949, 768, 8050 },
+		{ 949, 769, 941 },
+		{ 949, 787, 7952 },
+		{ 949, 788, 7953 },
+		{ 951, 768, 8052 },
+		{ 951, 769, 942 },
+		{ 951, 787, 7968 },
+		{ 951, 788, 7969 },
+		{ 951, 834, 8134 },
+		{ 951, 837, 8131 },
+		{ 953, 768, 8054 },
+		{ 953, 769, 943 },
+		{ 953, 772, 8145 },
+		{ 953, 774, 8144 },
+		{ 953, 776, 970 },
+		{ 953, 787, 7984 },
+		{ 953, 788, 7985 },
+		{ 953, 834, 8150 },
+		{ 959, 768, 8056 },
+		{ 959, 769, 972 },
+		{ 959, 787, 8000 },
+		{ 959, 788, 8001 },
+		{ 961, 787, 8164 },
+		{ 961, 788, 8165 },
+		{ 965, 768, 8058 },
+		{ 965, 769, 973 },
+		{ 965, 772, 8161 },
+		{ 965, 774, 8160 },
+		{ 965, 776, 971 },
+		{ 965, 787, 8016 },
+		{ 965, 788, 8017 },
+		{ 965, 834, 8166 },
+		{ 969, 768, 8060 },
+		{ 969, 769, 974 },
+		{ 969, 787, 8032 },
+		{ 969, 788, 8033 },
+		{ 969, 834, 8182 },
+		{ 969, 837, 8179 },
+		{ 970, 768, 8146 },
+		{ 970, 769, 912 },
+		{ 970, 834, 8151 },
+		{ 971, 768, 8162 },
+		{ 971, 769, 944 },
+		{ 971, 834, 8167 },
+		{ 974, 837, 8180 },
+		{ 978, 769, 979 },
+		{ 978, 776, 980 },
+		{ 1030, 776, 1031 },
+		{ 1040, 774, 1232 },
+		{ 1040, 776, 1234 },
+		{ 1043, 769, 1027 },
+		{ 1045, 768, 1024 },
+		{ 1045, 774, 1238 },
+		{ 1045, 776, 1025 },
+		{ 1046, 774, 1217 },
+		{ 1046, 776, 1244 },
+		{ 1047, 776, 1246 },
+		{ 1048, 768, 1037 },
+		{ 1048, 772, 1250 },
+		{ 1048, 774, 1049 },
+		{ 1048, 776, 1252 },
+		{ 1050, 769, 1036 },
+		{ 1054, 776, 1254 },
+		{ 1059, 772, 1262 },
+		{ 1059, 774, 1038 },
+		{ 1059, 776, 1264 },
+		{ 1059, 779, 1266 },
+		{ 1063, 776, 1268 },
+		{ 1067, 776, 1272 },
+		{ 1069, 776, 1260 },
+		{ 1072, 774, 1233 },
+		{ 1072, 776, 1235 },
+		{ 1075, 769, 1107 },
+		{ 1077, 768, 1104 },
+		{ 1077, 774, 1239 },
+		{ 1077, 776, 1105 },
+		{ 1078, 774, 1218 },
+		{ 1078, 776, 1245 },
+		{ 1079, 776, 1247 },
+		{ 1080, 768, 1117 },
+		{ 1080, 772, 1251 },
+		{ 1080, 774, 1081 },
+		{ 1080, 776, 1253 },
+		{ 1082, 769, 1116 },
+		{ 1086, 776, 1255 },
+		{ 1091, 772, 1263 },
+		{ 1091, 774, 1118 },
+		{ 1091, 776, 1265 },
+		{ 1091, 779, 1267 },
+		{ 1095, 776, 1269 },
+		{ 1099, 776, 1273 },
+		{ 1101, 776, 1261 },
+		{ 1110, 776, 1111 },
+		{ 1140, 783, 1142 },
+		{ 1141, 783, 1143 },
+		{ 1240, 776, 1242 },
+		{ 1241, 776, 1243 },
+		{ 1256, 776, 1258 },
+		{ 1257, 776, 1259 },
+		{ 1575, 1619, 1570 },
+		{ 1575, 1620, 1571 },
+		{ 1575, 1621, 1573 },
+		{ 1608, 1620, 1572 },
+		{ 1610, 1620, 1574 },
+		{ 1729, 1620, 1730 },
+		{ 1746, 1620, 1747 },
+		{ 1749, 1620, 1728 },
+		{ 2344, 2364, 2345 },
+		{ 2352, 2364, 2353 },
+		{ 2355, 2364, 2356 },
+		{ 2503, 2494, 2507 },
+		{ 2503, 2519, 2508 },
+		{ 2887, 2878, 2891 },
+		{ 2887, 2902, 2888 },
+		{ 2887, 2903, 2892 },
+		{ 2962, 3031, 2964 },
+		{ 3014, 3006, 3018 },
+		{ 3014, 3031, 3020 },
+		{ 3015, 3006, 3019 },
+		{ 3142, 3158, 3144 },
+		{ 3263, 3285, 3264 },
+		{ 3270, 3266, 3274 },
+		{ 3270, 3285, 3271 },
+		{ 3270, 3286, 3272 },
+		{ 3274, 3285, 3275 },
+		{ 3398, 3390, 3402 },
+		{ 3398, 3415, 3404 },
+		{ 3399, 3390, 3403 },
+		{ 3545, 3530, 3546 },
+		{ 3545, 3535, 3548 },
+		{ 3545, 3551, 3550 },
+		{ 3548, 3530, 3549 },
+		{ 4133, 4142, 4134 },
+		{ 6917, 6965, 6918 },
+		{ 6919, 6965, 6920 },
+		{ 6921, 6965, 6922 },
+		{ 6923, 6965, 6924 },
+		{ 6925, 6965, 6926 },
+		{ 6929, 6965, 6930 },
+		{ 6970, 6965, 6971 },
+		{ 6972, 6965, 6973 },
+		{ 6974, 6965, 6976 },
+		{ 6975, 6965, 6977 },
+		{ 6978, 6965, 6979 },
+		{ 7734, 772, 7736 },
+		{ 7735, 772, 7737 },
+		{ 7770, 772, 7772 },
+		{ 7771, 772, 7773 },
+		{ 7778, 775, 7784 },
+		{ 7779, 775, 7785 },
+		{ 7840, 770, 7852 },
+		{ 7840, 774, 7862 },
+		{ 7841, 770, 7853 },
+		{ 7841, 774, 7863 },
+		{ 7864, 770, 7878 },
+		{ 7865, 770, 7879 },
+		{ 7884, 770, 7896 },
+		{ 7885, 770, 7897 },
+		{ 7936, 768, 7938 },
+		{ 7936, 769, 7940 },
+		{ 7936, 834, 7942 },
+		{ 7936, 837, 8064 },
+		{ 7937, 768, 7939 },
+		{ 7937, 769, 7941 },
+		{ 7937, 834, 7943 },
+		{ 7937, 837, 8065 },
+		{ 7938, 837, 8066 },
+		{ 7939, 837, 8067 },
+		{ 7940, 837, 8068 },
+		{ 7941, 837, 8069 },
+		{ 7942, 837, 8070 },
+		{ 7943, 837, 8071 },
+		{ 7944, 768, 7946 },
+		{ 7944, 769, 7948 },
+		{ 7944, 834, 7950 },
+		{ 7944, 837, 8072 },
+		{ 7945, 768, 7947 },
+		{ 7945, 769, 7949 },
+		{ 7945, 834, 7951 },
+		{ 7945, 837, 8073 },
+		{ 7946, 837, 8074 },
+		{ 7947, 837, 8075 },
+		{ 7948, 837, 8076 },
+		{ 7949, 837, 8077 },
+		{ 7950, 837, 8078 },
+		{ 7951, 837, 8079 },
+		{ 7952, 768, 7954 },
+		{ 7952, 769, 7956 },
+		{ 7953, 768, 7955 },
+		{ 7953, 769, 7957 },
+		{ 7960, 768, 7962 },
+		{ 7960, 769, 7964 },
+		{ 7961, 768, 7963 },
+		{ 7961, 769, 7965 },
+		{ 7968, 768, 7970 },
+		{ 7968, 769, 7972 },
+		{ 7968, 834, 7974 },
+		{ 7968, 837, 8080 },
+		{ 7969, 768, 7971 },
+		{ 7969, 769, 7973 },
+		{ 7969, 834, 7975 },
+		{ 7969, 837, 8081 },
+		{ 7970, 837, 8082 },
+		{ 7971, 837, 8083 },
+		{ 7972, 837, 8084 },
+		{ 7973, 837, 8085 },
+		{ 7974, 837, 8086 },
+		{ 7975, 837, 8087 },
+		{ 7976, 768, 7978 },
+		{ 7976, 769, 7980 },
+		{ 7976, 834, 7982 },
+		{ 7976, 837, 8088 },
+		{ 7977, 768, 7979 },
+		{ 7977, 769, 7981 },
+		{ 7977, 834, 7983 },
+		{ 7977, 837, 8089 },
+		{ 7978, 837, 8090 },
+		{ 7979, 837, 8091 },
+		{ 7980, 837, 8092 },
+		{ 7981, 837, 8093 },
+		{ 7982, 837, 8094 },
+		{ 7983, 837, 8095 },
+		{ 7984, 768, 7986 },
+		{ 7984, 769, 7988 },
+		{ 7984, 834, 7990 },
+		{ 7985, 768, 7987 },
+		{ 7985, 769, 7989 },
+		{ 7985, 834, 7991 },
+		{ 7992, 768, 7994 },
+		{ 7992, 769, 7996 },
+		{ 7992, 834, 7998 },
+		{ 7993, 768, 7995 },
+		{ 7993, 769, 7997 },
+		{ 7993, 834, 7999 },
+		{ 8000, 768, 8002 },
+		{ 8000, 769, 8004 },
+		{ 8001, 768, 8003 },
+		{ 8001, 769, 8005 },
+		{ 8008, 768, 8010 },
+		{ 8008, 769, 8012 },
+		{ 8009, 768, 8011 },
+		{ 8009, 769, 8013 },
+		{ 8016, 768, 8018 },
+		{ 8016, 769, 8020 },
+		{ 8016, 834, 8022 },
+		{ 8017, 768, 8019 },
+		{ 8017, 769, 8021 },
+		{ 8017, 834, 8023 },
+		{ 8025, 768, 8027 },
+		{ 8025, 769, 8029 },
+		{ 8025, 834, 8031 },
+		{ 8032, 768, 8034 },
+		{ 8032, 769, 8036 },
+		{ 8032, 834, 8038 },
+		{ 8032, 837, 8096 },
+		{ 8033, 768, 8035 },
+		{ 8033, 769, 8037 },
+		{ 8033, 834, 8039 },
+		{ 8033, 837, 8097 },
+		{ 8034, 837, 8098 },
+		{ 8035, 837, 8099 },
+		{ 8036, 837, 8100 },
+		{ 8037, 837, 8101 },
+		{ 8038, 837, 8102 },
+		{ 8039, 837, 8103 },
+		{ 8040, 768, 8042 },
+		{ 8040, 769, 8044 },
+		{ 8040, 834, 8046 },
+		{ 8040, 837, 8104 },
+		{ 8041, 768, 8043 },
+		{ 8041, 769, 8045 },
+		{ 8041, 834, 8047 },
+		{ 8041, 837, 8105 },
+		{ 8042, 837, 8106 },
+		{ 8043, 837, 8107 },
+		{ 8044, 837, 8108 },
+		{ 8045, 837, 8109 },
+		{ 8046, 837, 8110 },
+		{ 8047, 837, 8111 },
+		{ 8048, 837, 8114 },
+		{ 8052, 837, 8130 },
+		{ 8060, 837, 8178 },
+		{ 8118, 837, 8119 },
+		{ 8127, 768, 8141 },
+		{ 8127, 769, 8142 },
+		{ 8127, 834, 8143 },
+		{ 8134, 837, 8135 },
+		{ 8182, 837, 8183 },
+		{ 8190, 768, 8157 },
+		{ 8190, 769, 8158 },
+		{ 8190, 834, 8159 },
+		{ 8592, 824, 8602 },
+		{ 8594, 824, 8603 },
+		{ 8596, 824, 8622 },
+		{ 8656, 824, 8653 },
+		{ 8658, 824, 8655 },
+		{ 8660, 824, 8654 },
+		{ 8707, 824, 8708 },
+		{ 8712, 824, 8713 },
+		{ 8715, 824, 8716 },
+		{ 8739, 824, 8740 },
+		{ 8741, 824, 8742 },
+		{ 8764, 824, 8769 },
+		{ 8771, 824, 8772 },
+		{ 8773, 824, 8775 },
+		{ 8776, 824, 8777 },
+		{ 8781, 824, 8813 },
+		{ 8801, 824, 8802 },
+		{ 8804, 824, 8816 },
+		{ 8805, 824, 8817 },
+		{ 8818, 824, 8820 },
+		{ 8819, 824, 8821 },
+		{ 8822, 824, 8824 },
+		{ 8823, 824, 8825 },
+		{ 8826, 824, 8832 },
+		{ 8827, 824, 8833 },
+		{ 8828, 824, 8928 },
+		{ 8829, 824, 8929 },
+		{ 8834, 824, 8836 },
+		{ 8835, 824, 8837 },
+		{ 8838, 824, 8840 },
+		{ 8839, 824, 8841 },
+		{ 8849, 824, 8930 },
+		{ 8850, 824, 8931 },
+		{ 8866, 824, 8876 },
+		{ 8872, 824, 8877 },
+		{ 8873, 824, 8878 },
+		{ 8875, 824, 8879 },
+		{ 8882, 824, 8938 },
+		{ 8883, 824, 8939 },
+		{ 8884, 824, 8940 },
+		{ 8885, 824, 8941 },
+		{ 12358, 12441, 12436 },
+		{ 12363, 12441, 12364 },
+		{ 12365, 12441, 12366 },
+		{ 12367, 12441, 12368 },
+		{ 12369, 12441, 12370 },
+		{ 12371, 12441, 12372 },
+		{ 12373, 12441, 12374 },
+		{ 12375, 12441, 12376 },
+		{ 12377, 12441, 12378 },
+		{ 12379, 12441, 12380 },
+		{ 12381, 12441, 12382 },
+		{ 12383, 12441, 12384 },
+		{ 12385, 12441, 12386 },
+		{ 12388, 12441, 12389 },
+		{ 12390, 12441, 12391 },
+		{ 12392, 12441, 12393 },
+		{ 12399, 12441, 12400 },
+		{ 12399, 12442, 12401 },
+		{ 12402, 12441, 12403 },
+		{ 12402, 12442, 12404 },
+		{ 12405, 12441, 12406 },
+		{ 12405, 12442, 12407 },
+		{ 12408, 12441, 12409 },
+		{ 12408, 12442, 12410 },
+		{ 12411, 12441, 12412 },
+		{ 12411, 12442, 12413 },
+		{ 12445, 12441, 12446 },
+		{ 12454, 12441, 12532 },
+		{ 12459, 12441, 12460 },
+		{ 12461, 12441, 12462 },
+		{ 12463, 12441, 12464 },
+		{ 12465, 12441, 12466 },
+		{ 12467, 12441, 12468 },
+		{ 12469, 12441, 12470 },
+		{ 12471, 12441, 12472 },
+		{ 12473, 12441, 12474 },
+		{ 12475, 12441, 12476 },
+		{ 12477, 12441, 12478 },
+		{ 12479, 12441, 12480 },
+		{ 12481, 12441, 12482 },
+		{ 12484, 12441, 12485 },
+		{ 12486, 12441, 12487 },
+		{ 12488, 12441, 12489 },
+		{ 12495, 12441, 12496 },
+		{ 12495, 12442, 12497 },
+		{ 12498, 12441, 12499 },
+		{ 12498, 12442, 12500 },
+		{ 12501, 12441, 12502 },
+		{ 12501, 12442, 12503 },
+		{ 12504, 12441, 12505 },
+		{ 12504, 12442, 12506 },
+		{ 12507, 12441, 12508 },
+		{ 12507, 12442, 12509 },
+		{ 12527, 12441, 12535 },
+		{ 12528, 12441, 12536 },
+		{ 12529, 12441, 12537 },
+		{ 12530, 12441, 12538 },
+		{ 12541, 12441, 12542 },
+		{ 69785, 69818, 69786 },
+		{ 69787, 69818, 69788 },
+		{ 69797, 69818, 69803 },
+		{ 69937, 69927, 69934 },
+		{ 69938, 69927, 69935 },
+		{ 70471, 70462, 70475 },
+		{ 70471, 70487, 70476 },
+		{ 70841, 70832, 70844 },
+		{ 70841, 70842, 70843 },
+		{ 70841, 70845, 70846 },
+		{ 71096, 71087, 71098 },
+		{ 71097, 71087, 71099 },
+		{ 71989, 71984, 71992 },
+	};
+
+	//Grapheme_Cluster_Break (UAX #29)
+	enum class GraphemeBreak : uint8_t
+	{
+		Other,
+		CR,
+		LF,
+		Control,
+		Extend,
+		ZWJ,
+		RegionalIndicator,
+		Prepend,
+		SpacingMark,
+		L,
+		V,
+		T,
+		LV,
+		LVT,
+	};
+
+	inline constexpr uint8_t graphemeBreakMask = 15;
+	inline constexpr uint8_t graphemeFlagExtendedPictographic = 16;
+
+	inline constexpr uint8_t graphemePropsStage1[8704] = {
+		0, 1, 2, 2, 2, 2, 3, 2, 2, 4, 2, 5, 6, 7, 8, 9,
+		10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+		26, 27, 28, 29, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 31, 32,
+		33, 34, 35, 2, 36, 37, 38, 39, 40, 41, 2, 42, 2, 2, 2, 2,
+		43, 44, 45, 46, 2, 2, 47, 48, 2, 49, 2, 50, 51, 52, 53, 54,
+		2, 2, 55, 2, 2, 2, 56, 2, 2, 57, 58, 59, 2, 2, 2, 2,
+		60, 61, 2, 2, 2, 62, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 63, 64, 2, 2,
+		65, 66, 67, 68, 69, 70, 2, 71, 72, 73, 74, 75, 76, 77, 78, 72,
+		73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74,
+		75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76,
+		77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78,
+		72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73,
+		74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 79,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 80, 2, 2, 2, 2, 2, 81, 82, 2, 83,
+		2, 2, 2, 84, 2, 85, 86, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 87, 88, 2, 2, 2, 2, 89, 2, 2, 90, 91, 92,
+		93, 94, 95, 96, 97, 98, 99, 2, 100, 101, 2, 102, 103, 104, 105, 2,
+		106, 2, 107, 108, 109, 110, 2, 2, 111, 112, 113, 114, 2, 115, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 116, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 117, 118, 2, 2, 2, 2, 2, 2, 2, 119, 120,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 121, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 122, 2,
+		2, 2, 123, 124, 125, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 126, 127, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		128, 2, 118, 2, 2, 129, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 130, 131, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		132, 132, 133, 134, 135, 132, 132, 136, 132, 132, 137, 132, 138, 132, 139, 140,
+		141, 142, 143, 132, 132, 132, 2, 2, 132, 132, 132, 132, 132, 132, 132, 144,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		145, 146, 147, 148, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	};
+
+	inline constexpr uint8_t graphemePropsStage2[19072] = {
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 3, 16, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+		0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 3, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+		4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+		0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8, 8,
+		8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+		0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 8,
+		8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8,
+		8, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+		0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8,
+		8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+		0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4,
+		8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8,
+		4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 8, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4,
+		4, 8, 8, 8, 8, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+		8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+		8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+		8, 8, 4, 4, 4, 0, 4, 0, 8, 8, 8, 8, 8, 8, 8, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8, 8,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+		4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+		4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 8, 8,
+		8, 8, 8, 8, 8, 8, 4, 8, 8, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 3, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 8, 8, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0,
+		8, 8, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 8, 4, 8, 4, 4, 4, 4, 4, 4, 4, 0,
+		4, 0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8,
+		8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 8,
+		8, 8, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 8, 8, 8, 4, 8, 4,
+		4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+		4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 4, 0, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 3, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 0,
+		16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 0, 16, 0, 16, 0, 0, 0, 0, 0, 0, 16, 0, 0,
+		0, 16, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 16, 0, 0, 16, 0, 0, 0, 0, 16, 0, 16, 0,
+		0, 0, 0, 16, 16, 16, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+		16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 8, 8, 4, 4, 8, 0, 0, 0, 0, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+		9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+		4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8,
+		8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 8,
+		8, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+		0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 8, 8,
+		0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 8, 8, 4, 8, 8, 4, 8, 8, 0, 8, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+		13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 7, 0, 0,
+		0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 8, 4, 4, 4,
+		4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+		8, 0, 7, 7, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 8, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+		4, 4, 8, 8, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+		4, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 8, 8, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4,
+		8, 8, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4,
+		4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		8, 8, 4, 4, 4, 4, 0, 0, 8, 8, 8, 8, 4, 4, 8, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 8, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 8, 8,
+		4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+		0, 0, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 8, 8, 8, 8, 8, 0, 8, 8, 0, 0, 4, 4, 8, 4, 7,
+		8, 7, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8,
+		4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 4, 4, 4, 4, 4, 8, 7, 4, 4, 4, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+		4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 8, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 4, 4, 4, 4, 4, 4,
+		4, 8, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4,
+		4, 4, 4, 4, 4, 4, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0,
+		4, 4, 0, 8, 8, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+		3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 8, 4, 4, 4, 0, 0, 0, 8, 4, 4,
+		4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+		4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+		4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16,
+		16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0,
+		0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+		0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 4,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0,
+		0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	};
+
+	//GraphemeBreak value in graphemeBreakMask, and flags
+	constexpr uint8_t graphemePropsOf(char32_t cp) noexcept
+	{
+		constexpr unsigned mask = (1u << unicodeBlockShift) - 1;
+		return graphemePropsStage2[(unsigned(graphemePropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)];
+	}
+}
+
+#endif
@@ -0,0 +1,879 @@
+#ifndef UUTF_HPP
+#define UUTF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "usimd.hpp"
+
+//what a decoder or encoder does with malformed input
+enum class UUtfErrorMode : uint8_t
+{
+	//each maximal subpart of an invalid sequence, or unpaired surrogate, becomes U+FFFD
+	Replace,
+	//throws std::range_error
+	Strict
+};
+
+//encoding of a text file
+enum class UTextEncoding : uint8_t
+{
+	//by the byte order mark, utf-8 without one
+	Auto,
+	Utf8,
+	Utf16LE,
+	Utf16BE,
+	Latin1
+};
+
+//utf-8/utf-16/utf-32 transcoding kernels over raw buffers.
+//length functions are exact for valid input, conversion functions
+//throw std::range_error on malformed input (the same type std::wstring_convert used)
+namespace ustring_detail
+{
+	constexpr bool isHighSurrogate(char16_t c) noexcept { return (c & 0xFC00) == 0xD800; }
+	constexpr bool isLowSurrogate(char16_t c) noexcept { return (c & 0xFC00) == 0xDC00; }
+	constexpr bool isSurrogate(char16_t c) noexcept { return (c & 0xF800) == 0xD800; }
+
+	//code point ending at src[i - 1], its length in units is written to length
+	template <class Unit>
+	constexpr char32_t codePointBefore(const Unit* src, size_t i, size_t& length) noexcept
+	{
+		const char16_t c = src[i - 1];
+		if (isLowSurrogate(c) && i >= 2 && isHighSurrogate(char16_t(src[i - 2])))
+		{
+			length = 2;
+			return 0x10000 + ((char32_t(char16_t(src[i - 2])) - 0xD800) << 10) + (c - 0xDC00);
+		}
+		length = 1;
+		return c;
+	}
+
+	//code point starting at src[i], an unpaired surrogate is taken as it is
+	template <class Unit>
+	constexpr char32_t codePointAt(const Unit* src, size_t count, size_t i, size_t& length) noexcept
+	{
+		const char16_t c = src[i];
+		if (isHighSurrogate(c) && i + 1 < count && isLowSurrogate(char16_t(src[i + 1])))
+		{
+			length = 2;
+			return 0x10000 + ((char32_t(c) - 0xD800) << 10) + (char16_t(src[i + 1]) - 0xDC00);
+		}
+		length = 1;
+		return c;
+	}
+
+	[[noreturn]] inline void throwInvalidUtf8() { throw std::range_error("UString: invalid utf-8 sequence"); }
+	[[noreturn]] inline void throwInvalidUtf16() { throw std::range_error("UString: invalid utf-16 sequence"); }
+	[[noreturn]] inline void throwInvalidUtf32() { throw std::range_error("UString: invalid utf-32 code point"); }
+
+	constexpr size_t widenAsciiScalar(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		size_t i = 0;
+		for (; i < count && (unsigned char)src[i] < 0x80; ++i)
+			dst[i] = (unsigned char)src[i];
+		return i;
+	}
+
+	constexpr size_t narrowAsciiScalar(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		size_t i = 0;
+		for (; i < count && src[i] < 0x80; ++i)
+			dst[i] = (char)src[i];
+		return i;
+	}
+
+	constexpr size_t utf16LengthOfUtf8Scalar(const char* src, size_t count) noexcept
+	{
+		//without branches: the kind of the next byte is not predictable in mixed text
+		size_t res = count;
+		for (auto ptr = (const unsigned char*)src, end = ptr + count; ptr < end; ++ptr)
+			res += size_t(*ptr >= 0xF0) - size_t((*ptr & 0xC0) == 0x80);
+		return res;
+	}
+
+	constexpr size_t utf8LengthOfUtf16Scalar(const char16_t* src, size_t count) noexcept
+	{
+		size_t res = count;
+		for (auto ptr = src, end = ptr + count; ptr < end; ++ptr)
+		{
+			if (*ptr >= 0x80)
+				res += isSurrogate(*ptr) ? 1 : (*ptr >= 0x800 ? 2 : 1);
+		}
+		return res;
+	}
+
+#if defined(USTRING_SSE2)
+	inline size_t widenAsciiSse2(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+			if (_mm_movemask_epi8(v) != 0)
+				break;
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+		}
+		return i + widenAsciiScalar(src + i, count - i, dst + i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t widenAsciiAvx2(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+			if (_mm256_movemask_epi8(v) != 0)
+				break;
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+			_mm256_storeu_si256((__m256i*)(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+		}
+		return i + widenAsciiSse2(src + i, count - i, dst + i);
+	}
+
+	inline size_t narrowAsciiSse2(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+		const __m128i zero = _mm_setzero_si128();
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+			const __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 8));
+			const __m128i test = _mm_and_si128(_mm_or_si128(lo, hi), nonAscii);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(test, zero)) != 0xFFFF)
+				break;
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+		}
+		return i + narrowAsciiScalar(src + i, count - i, dst + i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t narrowAsciiAvx2(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		const __m256i nonAscii = _mm256_set1_epi16((short)0xFF80);
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i lo = _mm256_loadu_si256((const __m256i*)(src + i));
+			const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+			if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), nonAscii))
+				break;
+			//packus works per 128-bit lane, permute restores the order
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+			_mm256_storeu_si256((__m256i*)(dst + i), packed);
+		}
+		return i + narrowAsciiSse2(src + i, count - i, dst + i);
+	}
+
+	inline size_t utf16LengthOfUtf8Sse2(const char* src, size_t count) noexcept
+	{
+		const __m128i contMask = _mm_set1_epi8((char)0xC0);
+		const __m128i contVal = _mm_set1_epi8((char)0x80);
+		const __m128i leadMask = _mm_set1_epi8((char)0xF0);
+		size_t res = count;
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+			const int cont = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, contMask), contVal));
+			const int lead4 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, leadMask), leadMask));
+			res += std::popcount((unsigned)lead4);
+			res -= std::popcount((unsigned)cont);
+		}
+		return res - (count - i) + utf16LengthOfUtf8Scalar(src + i, count - i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t utf16LengthOfUtf8Avx2(const char* src, size_t count) noexcept
+	{
+		const __m256i contMask = _mm256_set1_epi8((char)0xC0);
+		const __m256i contVal = _mm256_set1_epi8((char)0x80);
+		const __m256i leadMask = _mm256_set1_epi8((char)0xF0);
+		size_t res = count;
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+			const unsigned cont = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(v, contMask), contVal));
+			const unsigned lead4 = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(v, leadMask), leadMask));
+			res += std::popcount(lead4);
+			res -= std::popcount(cont);
+		}
+		return res - (count - i) + utf16LengthOfUtf8Sse2(src + i, count - i);
+	}
+
+	inline size_t utf8LengthOfUtf16Sse2(const char16_t* src, size_t count) noexcept
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i mask80 = _mm_set1_epi16((short)0xFF80);
+		const __m128i mask800 = _mm_set1_epi16((short)0xF800);
+		const __m128i surrogate = _mm_set1_epi16((short)0xD800);
+		size_t res = count;
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+			const __m128i hi = _mm_and_si128(v, mask800);
+			//each mask contributes two bits per code unit
+			const unsigned ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask80), zero));
+			const unsigned small = _mm_movemask_epi8(_mm_cmpeq_epi16(hi, zero));
+			const unsigned surr = _mm_movemask_epi8(_mm_cmpeq_epi16(hi, surrogate));
+			res += (32 - std::popcount(ascii) - std::popcount(small) - std::popcount(surr)) / 2;
+		}
+		return res - (count - i) + utf8LengthOfUtf16Scalar(src + i, count - i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t utf8LengthOfUtf16Avx2(const char16_t* src, size_t count) noexcept
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i mask80 = _mm256_set1_epi16((short)0xFF80);
+		const __m256i mask800 = _mm256_set1_epi16((short)0xF800);
+		const __m256i surrogate = _mm256_set1_epi16((short)0xD800);
+		size_t res = count;
+		size_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+			const __m256i hi = _mm256_and_si256(v, mask800);
+			const unsigned ascii = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, mask80), zero));
+			const unsigned small = _mm256_movemask_epi8(_mm256_cmpeq_epi16(hi, zero));
+			const unsigned surr = _mm256_movemask_epi8(_mm256_cmpeq_epi16(hi, surrogate));
+			res += (64 - std::popcount(ascii) - std::popcount(small) - std::popcount(surr)) / 2;
+		}
+		return res - (count - i) + utf8LengthOfUtf16Sse2(src + i, count - i);
+	}
+#endif
+
+	//widens the leading ascii run of src, returns its length
+	inline size_t widenAscii(const char* src, size_t count, char16_t* dst) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (count >= 32 && hasAvx2())
+			return widenAsciiAvx2(src, count, dst);
+		return widenAsciiSse2(src, count, dst);
+#else
+		return widenAsciiScalar(src, count, dst);
+#endif
+	}
+
+	//narrows the leading ascii run of src, returns its length
+	inline size_t narrowAscii(const char16_t* src, size_t count, char* dst) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (count >= 32 && hasAvx2())
+			return narrowAsciiAvx2(src, count, dst);
+		return narrowAsciiSse2(src, count, dst);
+#else
+		return narrowAsciiScalar(src, count, dst);
+#endif
+	}
+
+	inline size_t utf16LengthOfUtf8(const char* src, size_t count) noexcept
+	{
+#if defined(USTRING_SSE2)
+		//short values of a column are not worth the calls to the block kernels
+		if (count < 16)
+			return utf16LengthOfUtf8Scalar(src, count);
+		if (hasAvx2())
+			return utf16LengthOfUtf8Avx2(src, count);
+		return utf16LengthOfUtf8Sse2(src, count);
+#else
+		return utf16LengthOfUtf8Scalar(src, count);
+#endif
+	}
+
+	inline size_t utf8LengthOfUtf16(const char16_t* src, size_t count) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (hasAvx2())
+			return utf8LengthOfUtf16Avx2(src, count);
+		return utf8LengthOfUtf16Sse2(src, count);
+#else
+		return utf8LengthOfUtf16Scalar(src, count);
+#endif
+	}
+
+	//converts the whole sequences at the start of src, it stops before an invalid or truncated one.
+	//read is set to the bytes converted, returns the units written
+	inline size_t utf8ToUtf16Prefix(const char* src, size_t count, char16_t* dst, size_t& read) noexcept
+	{
+		auto ptr = (const unsigned char*)src;
+		const auto end = ptr + count;
+		auto out = dst;
+
+		while (ptr < end)
+		{
+			const unsigned c = *ptr;
+			if (c < 0x80)
+			{
+				//short runs, between other letters or in short strings, stay in this loop
+				if (end - ptr >= 16 && ptr[1] < 0x80)
+				{
+					const auto n = widenAscii((const char*)ptr, end - ptr, out);
+					ptr += n;
+					out += n;
+				}
+				else
+				{
+					*out++ = char16_t(c);
+					++ptr;
+				}
+				continue;
+			}
+
+			if (c < 0xC2)
+			{
+				break;
+			}
+			else if (c < 0xE0)
+			{
+				if (end - ptr < 2 || (ptr[1] & 0xC0) != 0x80)
+					break;
+				*out++ = char16_t(((c & 0x1F) << 6) | (ptr[1] & 0x3F));
+				ptr += 2;
+			}
+			else if (c < 0xF0)
+			{
+				if (end - ptr < 3 || (ptr[1] & 0xC0) != 0x80 || (ptr[2] & 0xC0) != 0x80
+					|| (c == 0xE0 && ptr[1] < 0xA0) || (c == 0xED && ptr[1] >= 0xA0))
+					break;
+				*out++ = char16_t(((c & 0x0F) << 12) | ((ptr[1] & 0x3F) << 6) | (ptr[2] & 0x3F));
+				ptr += 3;
+			}
+			else if (c < 0xF5)
+			{
+				if (end - ptr < 4 || (ptr[1] & 0xC0) != 0x80 || (ptr[2] & 0xC0) != 0x80 || (ptr[3] & 0xC0) != 0x80
+					|| (c == 0xF0 && ptr[1] < 0x90) || (c == 0xF4 && ptr[1] >= 0x90))
+					break;
+				const char32_t cp = ((c & 0x07) << 18) | ((ptr[1] & 0x3F) << 12) | ((ptr[2] & 0x3F) << 6) | (ptr[3] & 0x3F);
+				*out++ = char16_t(0xD7C0 + (cp >> 10));
+				*out++ = char16_t(0xDC00 | (cp & 0x3FF));
+				ptr += 4;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		read = ptr - (const unsigned char*)src;
+		return out - dst;
+	}
+
+	enum class Utf8Sequence : uint8_t
+	{
+		Valid,
+		Invalid,
+		//src ends inside a sequence that is valid so far
+		Truncated
+	};
+
+	//checks the sequence at src, count >= 1. returns its length if it is valid, the bytes so far if it is truncated,
+	//and its maximal subpart if it is invalid: the bytes one U+FFFD replaces, at least 1 (Unicode 3.9, U+FFFD substitution)
+	constexpr size_t checkUtf8Sequence(const unsigned char* src, size_t count, Utf8Sequence& res) noexcept
+	{
+		const unsigned c = src[0];
+		res = Utf8Sequence::Valid;
+		if (c < 0x80)
+			return 1;
+		const size_t length = c < 0xC2 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF5 ? 4 : 0;
+		if (length == 0)
+		{
+			res = Utf8Sequence::Invalid;
+			return 1;
+		}
+
+		//the second byte excludes overlongs, surrogates and code points above U+10FFFF
+		unsigned low = c == 0xE0 ? 0xA0 : c == 0xF0 ? 0x90 : 0x80;
+		unsigned high = c == 0xED ? 0x9F : c == 0xF4 ? 0x8F : 0xBF;
+		for (size_t i = 1; i < length; ++i)
+		{
+			if (i == count)
+			{
+				res = Utf8Sequence::Truncated;
+				return i;
+			}
+			if (src[i] < low || src[i] > high)
+			{
+				res = Utf8Sequence::Invalid;
+				return i;
+			}
+			low = 0x80;
+			high = 0xBF;
+		}
+		return length;
+	}
+
+	//dst must hold utf16LengthOfUtf8(src, count) code units, returns written count
+	inline size_t utf8ToUtf16(const char* src, size_t count, char16_t* dst)
+	{
+		size_t read = 0;
+		const auto res = utf8ToUtf16Prefix(src, count, dst, read);
+		if (read != count)
+			throwInvalidUtf8();
+		return res;
+	}
+
+	//converts the start of src up to an unpaired surrogate, read is set to the units converted.
+	//returns the bytes written
+	inline size_t utf16ToUtf8Prefix(const char16_t* src, size_t count, char* dst, size_t& read) noexcept
+	{
+		auto ptr = src;
+		const auto end = ptr + count;
+		auto out = (unsigned char*)dst;
+
+		while (ptr < end)
+		{
+			const char32_t c = *ptr;
+			if (c < 0x80)
+			{
+				const auto n = narrowAscii(ptr, end - ptr, (char*)out);
+				ptr += n;
+				out += n;
+			}
+			else if (c < 0x800)
+			{
+				*out++ = (unsigned char)(0xC0 | (c >> 6));
+				*out++ = (unsigned char)(0x80 | (c & 0x3F));
+				++ptr;
+			}
+			else if (!isSurrogate(char16_t(c)))
+			{
+				*out++ = (unsigned char)(0xE0 | (c >> 12));
+				*out++ = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+				*out++ = (unsigned char)(0x80 | (c & 0x3F));
+				++ptr;
+			}
+			else
+			{
+				if (!isHighSurrogate(char16_t(c)) || end - ptr < 2 || !isLowSurrogate(ptr[1]))
+					break;
+				const char32_t cp = 0x10000 + ((c - 0xD800) << 10) + (ptr[1] - 0xDC00);
+				*out++ = (unsigned char)(0xF0 | (cp >> 18));
+				*out++ = (unsigned char)(0x80 | ((cp >> 12) & 0x3F));
+				*out++ = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+				*out++ = (unsigned char)(0x80 | (cp & 0x3F));
+				ptr += 2;
+			}
+		}
+
+		read = ptr - src;
+		return out - (unsigned char*)dst;
+	}
+
+	//dst must hold utf8LengthOfUtf16(src, count) bytes, returns written count
+	inline size_t utf16ToUtf8(const char16_t* src, size_t count, char* dst)
+	{
+		size_t read = 0;
+		const auto res = utf16ToUtf8Prefix(src, count, dst, read);
+		if (read != count)
+			throwInvalidUtf16();
+		return res;
+	}
+
+	constexpr size_t utf32LengthOfUtf16(const char16_t* src, size_t count) noexcept
+	{
+		size_t res = count;
+		for (auto ptr = src, end = ptr + count; ptr < end; ++ptr)
+			if (isHighSurrogate(*ptr))
+				--res;
+		return res;
+	}
+
+	constexpr size_t utf16LengthOfUtf32(const char32_t* src, size_t count) noexcept
+	{
+		size_t res = count;
+		for (auto ptr = src, end = ptr + count; ptr < end; ++ptr)
+			if (*ptr > 0xFFFF)
+				++res;
+		return res;
+	}
+
+	//low surrogates from i that complete a pair with the unit before them, i >= 1
+	template <class Unit>
+	constexpr size_t pairedTrailsScalar(const Unit* src, size_t count, size_t i) noexcept
+	{
+		size_t res = 0;
+		for (; i < count; ++i)
+			res += isLowSurrogate(src[i]) && isHighSurrogate(src[i - 1]);
+		return res;
+	}
+
+#if defined(USTRING_SSE2)
+	//every unit is compared with the one before it, loaded one unit back
+	inline size_t pairedTrailsSse2(const char16_t* src, size_t count, size_t i) noexcept
+	{
+		const __m128i mask = _mm_set1_epi16((short)0xFC00);
+		const __m128i high = _mm_set1_epi16((short)0xD800);
+		const __m128i low = _mm_set1_epi16((short)0xDC00);
+		size_t res = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i cur = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i)), mask);
+			const __m128i prev = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i - 1)), mask);
+			const __m128i trails = _mm_and_si128(_mm_cmpeq_epi16(cur, low), _mm_cmpeq_epi16(prev, high));
+			res += std::popcount(unsigned(_mm_movemask_epi8(trails))) / 2;
+		}
+		return res + pairedTrailsScalar(src, count, i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t pairedTrailsAvx2(const char16_t* src, size_t count, size_t i) noexcept
+	{
+		const __m256i mask = _mm256_set1_epi16((short)0xFC00);
+		const __m256i high = _mm256_set1_epi16((short)0xD800);
+		const __m256i low = _mm256_set1_epi16((short)0xDC00);
+		size_t res = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i cur = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(src + i)), mask);
+			const __m256i prev = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(src + i - 1)), mask);
+			const __m256i trails = _mm256_and_si256(_mm256_cmpeq_epi16(cur, low), _mm256_cmpeq_epi16(prev, high));
+			res += std::popcount(unsigned(_mm256_movemask_epi8(trails))) / 2;
+		}
+		return res + pairedTrailsSse2(src, count, i);
+	}
+#endif
+
+	//surrogate pairs count once, an unpaired surrogate is a code point of its own
+	template <class Unit>
+	constexpr size_t codePointCount(const Unit* src, size_t count) noexcept
+	{
+		if (count < 2)
+			return count;
+#if defined(USTRING_SSE2)
+		if (std::is_constant_evaluated() == false)
+		{
+			if (count >= 32 && hasAvx2())
+				return count - pairedTrailsAvx2((const char16_t*)src, count, 1);
+			return count - pairedTrailsSse2((const char16_t*)src, count, 1);
+		}
+#endif
+		return count - pairedTrailsScalar(src, count, 1);
+	}
+
+	//validation: each kernel returns the offset of the first invalid, truncated or unpaired sequence, count if there is none
+
+	constexpr size_t utf8ValidLengthScalar(const char* src, size_t count, size_t i) noexcept
+	{
+		while (i < count)
+		{
+			if ((unsigned char)src[i] < 0x80)
+			{
+				++i;
+				continue;
+			}
+			auto state = Utf8Sequence::Valid;
+			const auto length = checkUtf8Sequence((const unsigned char*)src + i, count - i, state);
+			if (state != Utf8Sequence::Valid)
+				return i;
+			i += length;
+		}
+		return count;
+	}
+
+	//start of the sequence src[i] may be inside of, when the bytes before i are valid but for a truncated sequence at their end
+	constexpr size_t utf8SequenceStart(const char* src, size_t i) noexcept
+	{
+		for (size_t back = 1; back <= 3 && back <= i; ++back)
+		{
+			const unsigned c = (unsigned char)src[i - back];
+			if (c >= 0xC0)
+				return size_t(c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2) > back ? i - back : i;
+			if (c < 0x80)
+				break;
+		}
+		return i;
+	}
+
+	template <class Unit>
+	constexpr size_t utf16ValidLengthScalar(const Unit* src, size_t count, size_t i) noexcept
+	{
+		for (; i < count; ++i)
+		{
+			if (isSurrogate(src[i]) == false)
+				continue;
+			if (isHighSurrogate(src[i]) == false || i + 1 == count || isLowSurrogate(src[i + 1]) == false)
+				return i;
+			++i;
+		}
+		return count;
+	}
+
+#if defined(USTRING_SSE2)
+	//sse2 has no byte shuffle for the lookup tables of the avx2 kernel: ascii blocks are skipped
+	//and the sequences starting in other blocks are checked one at a time. i is at a sequence start
+	inline size_t utf8ValidLengthSse2(const char* src, size_t count, size_t i) noexcept
+	{
+		while (i + 16 <= count)
+		{
+			if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(src + i))) == 0)
+			{
+				i += 16;
+				continue;
+			}
+			for (const auto end = i + 16; i < end;)
+			{
+				if ((unsigned char)src[i] < 0x80)
+				{
+					++i;
+					continue;
+				}
+				auto state = Utf8Sequence::Valid;
+				const auto length = checkUtf8Sequence((const unsigned char*)src + i, count - i, state);
+				if (state != Utf8Sequence::Valid)
+					return i;
+				i += length;
+			}
+		}
+		return utf8ValidLengthScalar(src, count, i);
+	}
+
+	//lookup validation (Keiser, Lemire: Validating UTF-8 In Less Than One Instruction Per Byte): the error classes
+	//of every two consecutive bytes are looked up by the high nibble of the first, its low nibble and the high nibble
+	//of the second, and an error is left where all three agree. third and fourth bytes are checked to be continuations apart.
+	//a block with an error is checked again by the scalar kernel for its offset
+	USTRING_TARGET_AVX2 inline size_t utf8ValidLengthAvx2(const char* src, size_t count) noexcept
+	{
+		constexpr uint8_t tooShort = 1 << 0;
+		constexpr uint8_t tooLong = 1 << 1;
+		constexpr uint8_t overlong3 = 1 << 2;
+		constexpr uint8_t tooLarge = 1 << 3;
+		constexpr uint8_t surrogate = 1 << 4;
+		constexpr uint8_t overlong2 = 1 << 5;
+		constexpr uint8_t tooLarge1000 = 1 << 6;
+		constexpr uint8_t overlong4 = 1 << 6;
+		constexpr uint8_t twoConts = 1 << 7;
+		constexpr uint8_t carry = tooShort | tooLong | twoConts;
+
+		alignas(16) static constexpr uint8_t byte1High[16] = {
+			tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+			twoConts, twoConts, twoConts, twoConts,
+			tooShort | overlong2, tooShort, tooShort | overlong3 | surrogate, tooShort | tooLarge | tooLarge1000 | overlong4 };
+		alignas(16) static constexpr uint8_t byte1Low[16] = {
+			carry | overlong3 | overlong2 | overlong4, carry | overlong2, carry, carry,
+			carry | tooLarge, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000 | surrogate, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000 };
+		alignas(16) static constexpr uint8_t byte2High[16] = {
+			tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+			tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+			tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+			tooLong | overlong2 | twoConts | surrogate | tooLarge,
+			tooLong | overlong2 | twoConts | surrogate | tooLarge,
+			tooShort, tooShort, tooShort, tooShort };
+		//a lead byte in the last three of a block opens a sequence the next block must continue
+		alignas(32) static constexpr uint8_t lastOpen[32] = {
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+
+		const __m256i table1High = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)byte1High));
+		const __m256i table1Low = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)byte1Low));
+		const __m256i table2High = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)byte2High));
+		const __m256i maxOpen = _mm256_load_si256((const __m256i*)lastOpen);
+		const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+		__m256i prevInput = _mm256_setzero_si256();
+		__m256i prevIncomplete = _mm256_setzero_si256();
+		size_t i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			const __m256i input = _mm256_loadu_si256((const __m256i*)(src + i));
+			__m256i error = prevIncomplete;
+			if (_mm256_movemask_epi8(input) == 0)
+			{
+				prevIncomplete = _mm256_setzero_si256();
+			}
+			else
+			{
+				//the block shifted by 1, 2 and 3 bytes, continued from the last one
+				const __m256i carried = _mm256_permute2x128_si256(prevInput, input, 0x21);
+				const __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+				const __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+				const __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+
+				const __m256i b1High = _mm256_shuffle_epi8(table1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+				const __m256i b1Low = _mm256_shuffle_epi8(table1Low, _mm256_and_si256(prev1, nibble));
+				const __m256i b2High = _mm256_shuffle_epi8(table2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+				const __m256i special = _mm256_and_si256(_mm256_and_si256(b1High, b1Low), b2High);
+
+				//saturating subtraction leaves the high bit only after 111_____ and 1111____ leads
+				const __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(char(0xE0 - 0x80)));
+				const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(char(0xF0 - 0x80)));
+				const __m256i mustContinue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(char(0x80)));
+				error = _mm256_xor_si256(mustContinue, special);
+				prevIncomplete = _mm256_subs_epu8(input, maxOpen);
+			}
+			if (_mm256_testz_si256(error, error) == 0)
+				break;
+			prevInput = input;
+		}
+		return utf8ValidLengthSse2(src, count, utf8SequenceStart(src, i));
+	}
+
+	//a unit is a low surrogate exactly when the one before it is a high surrogate, i >= 1
+	inline size_t utf16ValidLengthSse2(const char16_t* src, size_t count, size_t i) noexcept
+	{
+		const __m128i mask = _mm_set1_epi16((short)0xFC00);
+		const __m128i high = _mm_set1_epi16((short)0xD800);
+		const __m128i low = _mm_set1_epi16((short)0xDC00);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i cur = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i)), mask);
+			const __m128i prev = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i - 1)), mask);
+			if (_mm_movemask_epi8(_mm_xor_si128(_mm_cmpeq_epi16(cur, low), _mm_cmpeq_epi16(prev, high))) != 0)
+				break;
+		}
+		//a pair may start before i
+		return utf16ValidLengthScalar(src, count, isHighSurrogate(src[i - 1]) ? i - 1 : i);
+	}
+
+	USTRING_TARGET_AVX2 inline size_t utf16ValidLengthAvx2(const char16_t* src, size_t count, size_t i) noexcept
+	{
+		const __m256i mask = _mm256_set1_epi16((short)0xFC00);
+		const __m256i high = _mm256_set1_epi16((short)0xD800);
+		const __m256i low = _mm256_set1_epi16((short)0xDC00);
+		for (; i + 16 <= count; i += 16)
+		{
+			const __m256i cur = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(src + i)), mask);
+			const __m256i prev = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(src + i - 1)), mask);
+			const __m256i mismatch = _mm256_xor_si256(_mm256_cmpeq_epi16(cur, low), _mm256_cmpeq_epi16(prev, high));
+			if (_mm256_testz_si256(mismatch, mismatch) == 0)
+				break;
+		}
+		return utf16ValidLengthSse2(src, count, i);
+	}
+#endif
+
+	inline size_t utf8ValidLength(const char* src, size_t count) noexcept
+	{
+#if defined(USTRING_SSE2)
+		if (count >= 64 && hasAvx2())
+			return utf8ValidLengthAvx2(src, count);
+		return utf8ValidLengthSse2(src, count, 0);
+#else
+		return utf8ValidLengthScalar(src, count, 0);
+#endif
+	}
+
+	template <class Unit>
+	constexpr size_t utf16ValidLength(const Unit* src, size_t count) noexcept
+	{
+		if (count == 0 || isLowSurrogate(src[0]))
+			return 0;
+#if defined(USTRING_SSE2)
+		if (std::is_constant_evaluated() == false)
+		{
+			if (count >= 32 && hasAvx2())
+				return utf16ValidLengthAvx2((const char16_t*)src, count, 1);
+			return utf16ValidLengthSse2((const char16_t*)src, count, 1);
+		}
+#endif
+		return utf16ValidLengthScalar(src, count, 0);
+	}
+
+	//each maximal subpart of an invalid sequence, and a truncated one at the end, becomes U+FFFD.
+	//dst must hold count units, returns written count
+	inline size_t utf8ToUtf16Replacing(const char* src, size_t count, char16_t* dst) noexcept
+	{
+		size_t i = 0, written = 0;
+		while (i < count)
+		{
+			size_t read = 0;
+			written += utf8ToUtf16Prefix(src + i, count - i, dst + written, read);
+			i += read;
+			if (i == count)
+				break;
+			auto state = Utf8Sequence::Valid;
+			i += checkUtf8Sequence((const unsigned char*)src + i, count - i, state);
+			dst[written++] = 0xFFFD;
+		}
+		return written;
+	}
+
+	//units utf8ToUtf16Replacing writes
+	inline size_t utf16LengthOfUtf8Replacing(const char* src, size_t count) noexcept
+	{
+		size_t i = 0, res = 0;
+		while (i < count)
+		{
+			const auto valid = utf8ValidLength(src + i, count - i);
+			res += utf16LengthOfUtf8(src + i, valid);
+			i += valid;
+			if (i == count)
+				break;
+			auto state = Utf8Sequence::Valid;
+			i += checkUtf8Sequence((const unsigned char*)src + i, count - i, state);
+			++res;
+		}
+		return res;
+	}
+
+	//an unpaired surrogate becomes U+FFFD. dst must hold count * 3 bytes, returns written count
+	inline size_t utf16ToUtf8Replacing(const char16_t* src, size_t count, char* dst) noexcept
+	{
+		size_t i = 0, written = 0;
+		while (i < count)
+		{
+			size_t read = 0;
+			written += utf16ToUtf8Prefix(src + i, count - i, dst + written, read);
+			i += read;
+			if (i == count)
+				break;
+			dst[written++] = char(0xEF);
+			dst[written++] = char(0xBF);
+			dst[written++] = char(0xBD);
+			++i;
+		}
+		return written;
+	}
+
+	//dst must hold utf32LengthOfUtf16(src, count) code points, returns written count
+	inline size_t utf16ToUtf32(const char16_t* src, size_t count, char32_t* dst)
+	{
+		auto out = dst;
+		for (auto ptr = src, end = ptr + count; ptr < end; ++ptr)
+		{
+			if (!isSurrogate(*ptr))
+			{
+				*out++ = *ptr;
+			}
+			else
+			{
+				if (!isHighSurrogate(*ptr) || end - ptr < 2 || !isLowSurrogate(ptr[1]))
+					throwInvalidUtf16();
+				*out++ = 0x10000 + ((char32_t(ptr[0]) - 0xD800) << 10) + (ptr[1] - 0xDC00);
+				++ptr;
+			}
+		}
+		return out - dst;
+	}
+
+	//dst must hold utf16LengthOfUtf32(src, count) code units, returns written count
+	inline size_t utf32ToUtf16(const char32_t* src, size_t count, char16_t* dst)
+	{
+		auto out = dst;
+		for (auto ptr = src, end = ptr + count; ptr < end; ++ptr)
+		{
+			const char32_t cp = *ptr;
+			if (cp < 0x10000)
+			{
+				if (isSurrogate(char16_t(cp)))
+					throwInvalidUtf32();
+				*out++ = char16_t(cp);
+			}
+			else
+			{
+				if (cp > 0x10FFFF)
+					throwInvalidUtf32();
+				*out++ = char16_t(0xD7C0 + (cp >> 10));
+				*out++ = char16_t(0xDC00 | (cp & 0x3FF));
+			}
+		}
+		return out - dst;
+	}
+}
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef UUTF8CODEC_HPP
+#define UUTF8CODEC_HPP
+
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+#include "ustring.hpp"
+
+//utf-8 <-> UString for input that comes in chunks (sockets, file blocks): a sequence or surrogate pair
+//cut by the end of a chunk is held back and completed by the next one, so the result is the same
+//as converting the whole text at once. UUtf8Decoder dec; for (...) dec.decode(chunk, text); dec.finish(text);
+//out grows once per chunk to an upper bound and keeps its capacity, so appending is amortized.
+//with UUtfErrorMode::Strict the text before an invalid sequence is appended before the exception
+class UUtf8Decoder
+{
+	//a truncated sequence, at most 3 bytes but one more is read to check it
+	unsigned char pending[4];
+	uint8_t pendingCount = 0;
+	UUtfErrorMode mode;
+
+public:
+	explicit UUtf8Decoder(UUtfErrorMode mode = UUtfErrorMode::Replace) noexcept : mode(mode) {}
+
+	UUtfErrorMode errorMode() const noexcept { return mode; }
+	//bytes of the sequence held back at the end of the last chunk
+	size_t pendingBytes() const noexcept { return pendingCount; }
+	void reset() noexcept { pendingCount = 0; }
+
+	//appends the decoded chunk to out
+	template <class Alloc>
+	void decode(std::string_view chunk, BasicUString<Alloc>& out);
+	template <class Alloc>
+	void decode(std::u8string_view chunk, BasicUString<Alloc>& out) { decode(std::string_view((const char*)chunk.data(), chunk.size()), out); }
+
+	//end of the input: a sequence held back is incomplete. the decoder can take another text afterwards
+	template <class Alloc>
+	void finish(BasicUString<Alloc>& out);
+};
+
+//encodes UString chunks to utf-8, a high surrogate at the end of a chunk waits for its low surrogate.
+//Char is char or char8_t
+class UUtf8Encoder
+{
+	char16_t highSurrogate = 0;
+	UUtfErrorMode mode;
+
+	template <class Char, class Traits, class StrAlloc>
+	void invalid(std::basic_string<Char, Traits, StrAlloc>& out)
+	{
+		if (mode == UUtfErrorMode::Strict)
+			ustring_detail::throwInvalidUtf16();
+		out.append((const Char*)"\xEF\xBF\xBD", 3);
+	}
+
+public:
+	explicit UUtf8Encoder(UUtfErrorMode mode = UUtfErrorMode::Replace) noexcept : mode(mode) {}
+
+	UUtfErrorMode errorMode() const noexcept { return mode; }
+	bool hasPending() const noexcept { return highSurrogate != 0; }
+	void reset() noexcept { highSurrogate = 0; }
+
+	//appends the encoded chunk to out
+	template <class Char, class Traits, class StrAlloc> requires (sizeof(Char) == 1)
+	void encode(UStringView chunk, std::basic_string<Char, Traits, StrAlloc>& out);
+
+	//end of the input: a high surrogate held back is unpaired
+	template <class Char, class Traits, class StrAlloc> requires (sizeof(Char) == 1)
+	void finish(std::basic_string<Char, Traits, StrAlloc>& out)
+	{
+		if (highSurrogate == 0)
+			return;
+		highSurrogate = 0;
+		invalid(out);
+	}
+};
+
+template <class Alloc>
+inline void UUtf8Decoder::decode(std::string_view chunk, BasicUString<Alloc>& out)
+{
+	typedef ustring_detail::Utf8Sequence Sequence;
+
+	const auto src = (const unsigned char*)chunk.data();
+	const size_t count = chunk.size();
+	size_t i = 0;
+
+	//the sequence held back is completed from the start of the chunk, one byte at a time
+	char16_t head[2];
+	size_t headCount = 0;
+	if (pendingCount != 0)
+	{
+		auto state = Sequence::Truncated;
+		size_t length = 0;
+		while (state == Sequence::Truncated && i < count)
+		{
+			pending[pendingCount++] = src[i++];
+			length = ustring_detail::checkUtf8Sequence(pending, pendingCount, state);
+		}
+		if (state == Sequence::Truncated)
+			return;
+
+		if (state == Sequence::Valid)
+		{
+			size_t read = 0;
+			headCount = ustring_detail::utf8ToUtf16Prefix((const char*)pending, length, head, read);
+		}
+		else if (mode == UUtfErrorMode::Strict)
+		{
+			pendingCount = 0;
+			ustring_detail::throwInvalidUtf8();
+		}
+		else
+		{
+			head[headCount++] = 0xFFFD;
+		}
+		//the bytes read after the sequence are decoded again, the held back ones are all part of it
+		i -= pendingCount - length;
+		pendingCount = 0;
+	}
+
+	//a byte becomes at most one unit, U+FFFD included
+	const auto oldSize = out.size();
+	out.resize(oldSize + headCount + count - i);
+	const auto dst = (char16_t*)out.data() + oldSize;
+	std::copy(head, head + headCount, dst);
+	size_t written = headCount;
+	while (i < count)
+	{
+		size_t read = 0;
+		written += ustring_detail::utf8ToUtf16Prefix((const char*)src + i, count - i, dst + written, read);
+		i += read;
+		if (i == count)
+			break;
+
+		auto state = Sequence::Valid;
+		const auto length = ustring_detail::checkUtf8Sequence(src + i, count - i, state);
+		if (state == Sequence::Truncated)
+		{
+			std::copy(src + i, src + count, pending);
+			pendingCount = uint8_t(length);
+			break;
+		}
+		if (mode == UUtfErrorMode::Strict)
+		{
+			out.resize(oldSize + written);
+			ustring_detail::throwInvalidUtf8();
+		}
+		dst[written++] = 0xFFFD;
+		i += length;
+	}
+	out.resize(oldSize + written);
+}
+
+template <class Alloc>
+inline void UUtf8Decoder::finish(BasicUString<Alloc>& out)
+{
+	if (pendingCount == 0)
+		return;
+	//a truncated sequence is one maximal subpart
+	pendingCount = 0;
+	if (mode == UUtfErrorMode::Strict)
+		ustring_detail::throwInvalidUtf8();
+	out += UChar(char16_t(0xFFFD));
+}
+
+template <class Char, class Traits, class StrAlloc> requires (sizeof(Char) == 1)
+inline void UUtf8Encoder::encode(UStringView chunk, std::basic_string<Char, Traits, StrAlloc>& out)
+{
+	const auto src = (const char16_t*)chunk.data();
+	const size_t count = chunk.size();
+	size_t i = 0;
+
+	if (highSurrogate != 0 && count != 0)
+	{
+		const char16_t pair[2] = { highSurrogate, src[0] };
+		highSurrogate = 0;
+		if (ustring_detail::isLowSurrogate(src[0]))
+		{
+			char head[4];
+			size_t read = 0;
+			out.append((const Char*)head, ustring_detail::utf16ToUtf8Prefix(pair, 2, head, read));
+			i = 1;
+		}
+		else
+		{
+			invalid(out);
+		}
+	}
+
+	//a surrogate is counted as 2 bytes: a pair takes 4, U+FFFD for an unpaired one takes 3
+	const auto oldSize = out.size();
+	out.resize(oldSize + ustring_detail::utf8LengthOfUtf16(src + i, count - i));
+	size_t written = 0;
+	while (i < count)
+	{
+		size_t read = 0;
+		written += ustring_detail::utf16ToUtf8Prefix(src + i, count - i, (char*)out.data() + oldSize + written, read);
+		i += read;
+		if (i == count)
+			break;
+
+		if (ustring_detail::isHighSurrogate(src[i]) && i + 1 == count)
+		{
+			highSurrogate = src[i];
+			break;
+		}
+		if (mode == UUtfErrorMode::Strict)
+		{
+			out.resize(oldSize + written);
+			ustring_detail::throwInvalidUtf16();
+		}
+		out.resize(out.size() + 1);
+		std::copy_n("\xEF\xBF\xBD", 3, (char*)out.data() + oldSize + written);
+		written += 3;
+		++i;
+	}
+	out.resize(oldSize + written);
+}
+
+#endif
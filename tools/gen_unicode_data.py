@@ -0,0 +1,467 @@
+#!/usr/bin/env python3
+"""Generates include/usting/uunicode_data.hpp from the Unicode Character Database.
+
+Usage: gen_unicode_data.py <ucd-dir> [output]
+
+<ucd-dir> must contain the UCD text files (https://www.unicode.org/Public/<version>/ucd/):
+UnicodeData.txt, PropList.txt, DerivedCoreProperties.txt, SpecialCasing.txt, CaseFolding.txt,
+DerivedNormalizationProps.txt, auxiliary/GraphemeBreakProperty.txt, emoji/emoji-data.txt
+(the last two may also be in <ucd-dir> itself)
+"""
+
+import os
+import sys
+
+UNICODE_VERSION = "14.0.0"
+BMP_SIZE = 0x10000
+CODE_POINT_COUNT = 0x110000
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+CATEGORIES = [
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co", "Cn",
+]
+
+FLAG_WHITE_SPACE = 1
+# full case mapping or folding differs from the simple mapping: see caseSpecials
+FLAG_SPECIAL_CASE = 2
+FLAG_CASED = 4
+FLAG_CASE_IGNORABLE = 8
+
+# normalization quick check values other than Yes (DerivedNormalizationProps.txt)
+NORM_FLAGS = {
+    ("NFD_QC", "N"): 1,
+    ("NFC_QC", "N"): 2,
+    ("NFC_QC", "M"): 4,
+    ("NFKD_QC", "N"): 8,
+    ("NFKC_QC", "N"): 16,
+    ("NFKC_QC", "M"): 32,
+}
+# Grapheme_Cluster_Break values in the order of ustring_detail::GraphemeBreak, Other is 0
+GRAPHEME_BREAKS = [
+    "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+    "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT",
+]
+GRAPHEME_FLAG_EXTENDED_PICTOGRAPHIC = 16
+
+# hangul syllables are decomposed and composed in code
+HANGUL_FIRST = 0xAC00
+HANGUL_COUNT = 11172
+
+
+def parse_ranges(path):
+    """Yields (first, last, fields) for every data line of a UCD property file."""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            fields = [i.strip() for i in line.split(";")]
+            cps = fields[0].split("..")
+            first = int(cps[0], 16)
+            last = int(cps[-1], 16)
+            yield first, last, fields[1:]
+
+
+def load_unicode_data(ucd):
+    category = ["Cn"] * CODE_POINT_COUNT
+    upper = list(range(CODE_POINT_COUNT))
+    lower = list(range(CODE_POINT_COUNT))
+    range_start = None
+    with open(os.path.join(ucd, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = line.rstrip("\n").split(";")
+            if len(fields) < 15:
+                continue
+            cp = int(fields[0], 16)
+            if fields[1].endswith(", First>"):
+                range_start = cp
+                continue
+            first = range_start if fields[1].endswith(", Last>") else cp
+            range_start = None
+            for c in range(first, cp + 1):
+                category[c] = fields[2]
+                if fields[12]:
+                    upper[c] = int(fields[12], 16)
+                if fields[13]:
+                    lower[c] = int(fields[13], 16)
+    return category, upper, lower
+
+
+def load_flags(ucd):
+    flags = [0] * CODE_POINT_COUNT
+    for first, last, fields in parse_ranges(os.path.join(ucd, "PropList.txt")):
+        if fields[0] == "White_Space":
+            for c in range(first, last + 1):
+                flags[c] |= FLAG_WHITE_SPACE
+    derived = {"Cased": FLAG_CASED, "Case_Ignorable": FLAG_CASE_IGNORABLE}
+    for first, last, fields in parse_ranges(os.path.join(ucd, "DerivedCoreProperties.txt")):
+        if fields[0] in derived:
+            for c in range(first, last + 1):
+                flags[c] |= derived[fields[0]]
+    return flags
+
+
+def load_full_case(ucd, upper, lower):
+    """Full (length changing) mappings as code point tuples: upper, lower and case folding.
+    Conditional mappings of SpecialCasing are left out, final sigma is handled in code."""
+    full_upper = {}
+    full_lower = {}
+    with open(os.path.join(ucd, "SpecialCasing.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = [i.strip() for i in line.split("#", 1)[0].split(";")]
+            if len(fields) < 5 or fields[4]:
+                continue
+            c = int(fields[0], 16)
+            full_lower[c] = tuple(int(i, 16) for i in fields[1].split())
+            full_upper[c] = tuple(int(i, 16) for i in fields[3].split())
+    fold = {}
+    full_fold = {}
+    for first, _, fields in parse_ranges(os.path.join(ucd, "CaseFolding.txt")):
+        mapping = tuple(int(i, 16) for i in fields[1].split())
+        if fields[0] in ("C", "S"):
+            fold[first] = mapping
+        elif fields[0] == "F":
+            full_fold[first] = mapping
+    fold.update(full_fold)
+
+    specials = {}
+    for c in range(CODE_POINT_COUNT):
+        u = full_upper.get(c, (upper[c],))
+        l = full_lower.get(c, (lower[c],))
+        cf = fold.get(c, (c,))
+        if u == (upper[c],) and l == (lower[c],) and cf == (lower[c],):
+            continue
+        if c >= BMP_SIZE:
+            raise ValueError(f"U+{c:04X} needs a special case mapping outside the BMP")
+        if any(i >= BMP_SIZE for i in u + l + cf) or max(len(u), len(l), len(cf)) > 3:
+            raise ValueError(f"special case mapping of U+{c:04X} does not fit")
+        specials[c] = (u, l, cf)
+    return specials
+
+
+def load_normalization(ucd):
+    """Canonical combining classes, quick check flags, full decompositions and primary composites."""
+    ccc = [0] * CODE_POINT_COUNT
+    raw = {}
+    with open(os.path.join(ucd, "UnicodeData.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = line.rstrip("\n").split(";")
+            if len(fields) < 15:
+                continue
+            cp = int(fields[0], 16)
+            ccc[cp] = int(fields[3])
+            if fields[5]:
+                parts = fields[5].split()
+                compat = parts[0].startswith("<")
+                raw[cp] = (compat, tuple(int(i, 16) for i in parts[compat:]))
+
+    flags = [0] * CODE_POINT_COUNT
+    exclusions = set()
+    for first, last, fields in parse_ranges(os.path.join(ucd, "DerivedNormalizationProps.txt")):
+        if fields[0] == "Full_Composition_Exclusion":
+            exclusions.update(range(first, last + 1))
+        elif (fields[0], fields[-1]) in NORM_FLAGS:
+            for c in range(first, last + 1):
+                flags[c] |= NORM_FLAGS[(fields[0], fields[-1])]
+
+    def expand(cp, compat):
+        mapping = raw.get(cp)
+        if mapping is None or (mapping[0] and not compat):
+            return (cp,)
+        return tuple(i for c in mapping[1] for i in expand(c, compat))
+
+    decompositions = {}
+    for cp in sorted(raw):
+        canonical = expand(cp, False)
+        compat = expand(cp, True)
+        decompositions[cp] = (canonical if canonical != (cp,) else (), compat if compat != canonical else ())
+        no_flag = 1 if canonical != (cp,) else 8
+        if flags[cp] & no_flag == 0:
+            raise ValueError(f"U+{cp:04X} decomposes but its quick check is Yes")
+
+    compositions = []
+    for cp, (compat, mapping) in raw.items():
+        if not compat and len(mapping) == 2 and cp not in exclusions:
+            compositions.append((mapping[0], mapping[1], cp))
+    compositions.sort()
+    return ccc, flags, decompositions, compositions
+
+
+def find_ucd_file(ucd, subdir, name):
+    path = os.path.join(ucd, subdir, name)
+    return path if os.path.exists(path) else os.path.join(ucd, name)
+
+
+def load_grapheme_breaks(ucd):
+    """Grapheme_Cluster_Break of every code point, Extended_Pictographic as a flag."""
+    values = [0] * CODE_POINT_COUNT
+    for first, last, fields in parse_ranges(find_ucd_file(ucd, "auxiliary", "GraphemeBreakProperty.txt")):
+        value = GRAPHEME_BREAKS.index(fields[0])
+        for c in range(first, last + 1):
+            values[c] = value
+    for first, last, fields in parse_ranges(find_ucd_file(ucd, "emoji", "emoji-data.txt")):
+        if fields[0] == "Extended_Pictographic":
+            for c in range(first, last + 1):
+                values[c] |= GRAPHEME_FLAG_EXTENDED_PICTOGRAPHIC
+    return values
+
+
+def c_type(max_value):
+    if max_value < 0x100:
+        return "uint8_t"
+    if max_value < 0x10000:
+        return "uint16_t"
+    return "uint32_t"
+
+
+def two_stage(values, size):
+    """Splits values[0:size] into deduplicated blocks, returns (stage1, stage2)."""
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, size, BLOCK_SIZE):
+        block = tuple(values[start:start + BLOCK_SIZE])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def format_array(name, ctype, values, per_line=16):
+    lines = [f"\tinline constexpr {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("\t\t" + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("\t};")
+    return "\n".join(lines)
+
+
+def generate(ucd):
+    category, upper, lower = load_unicode_data(ucd)
+    flags = load_flags(ucd)
+    specials = load_full_case(ucd, upper, lower)
+    for c in specials:
+        flags[c] |= FLAG_SPECIAL_CASE
+
+    # properties of a code point: category, flags and simple case mapping deltas (mod 2^16, mappings never leave a plane)
+    records = {}
+    props = []
+    for c in range(CODE_POINT_COUNT):
+        if (upper[c] ^ c) >> 16 or (lower[c] ^ c) >> 16:
+            raise ValueError(f"case mapping of U+{c:04X} leaves its plane")
+        record = (CATEGORIES.index(category[c]), flags[c], (upper[c] - c) & 0xFFFF, (lower[c] - c) & 0xFFFF)
+        if record not in records:
+            records[record] = len(records)
+        props.append(records[record])
+    stage1, stage2 = two_stage(props, CODE_POINT_COUNT)
+
+    ccc, norm_flags, decompositions, compositions = load_normalization(ucd)
+    norm_records = {}
+    norm_props = []
+    for c in range(CODE_POINT_COUNT):
+        record = (ccc[c], norm_flags[c])
+        if record not in norm_records:
+            norm_records[record] = len(norm_records)
+        norm_props.append(norm_records[record])
+    norm_stage1, norm_stage2 = two_stage(norm_props, CODE_POINT_COUNT)
+    decomposition_pool = []
+    decomposition_entries = []
+    for cp, (canonical, compat) in sorted(decompositions.items()):
+        if len(decomposition_pool) >= 0x10000 or max(len(canonical), len(compat)) >= 0x100:
+            raise ValueError("decomposition table does not fit")
+        decomposition_entries.append((cp, len(decomposition_pool), len(canonical), len(compat)))
+        decomposition_pool.extend(canonical + compat)
+
+    grapheme_stage1, grapheme_stage2 = two_stage(load_grapheme_breaks(ucd), CODE_POINT_COUNT)
+
+    # case classes: every folded (lowered) value with all code units lowering to it
+    classes = {}
+    for c in range(BMP_SIZE):
+        f = lower[c]
+        if f < BMP_SIZE and lower[f] != f:
+            raise ValueError(f"lowercase mapping of U+{c:04X} is not idempotent")
+        classes.setdefault(f if f < BMP_SIZE else c, []).append(c)
+    class_keys = sorted(k for k, v in classes.items() if len(v) > 1)
+    class_begin = []
+    class_members = []
+    for k in class_keys:
+        class_begin.append(len(class_members))
+        class_members.extend(classes[k])
+    class_begin.append(len(class_members))
+
+    out = []
+    out.append("#ifndef UUNICODE_DATA_HPP")
+    out.append("#define UUNICODE_DATA_HPP")
+    out.append("")
+    out.append("//generated by tools/gen_unicode_data.py from the Unicode Character Database")
+    out.append(f"//version {UNICODE_VERSION}, do not edit")
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+    out.append("namespace ustring_detail")
+    out.append("{")
+    out.append("\tstruct UnicodeProps")
+    out.append("\t{")
+    out.append("\t\tuint8_t category;")
+    out.append("\t\tuint8_t flags;")
+    out.append("\t\tuint16_t upperDelta;")
+    out.append("\t\tuint16_t lowerDelta;")
+    out.append("\t};")
+    out.append("")
+    out.append(f"\tinline constexpr uint8_t unicodeFlagWhiteSpace = {FLAG_WHITE_SPACE};")
+    out.append(f"\tinline constexpr uint8_t unicodeFlagSpecialCase = {FLAG_SPECIAL_CASE};")
+    out.append(f"\tinline constexpr uint8_t unicodeFlagCased = {FLAG_CASED};")
+    out.append(f"\tinline constexpr uint8_t unicodeFlagCaseIgnorable = {FLAG_CASE_IGNORABLE};")
+    out.append(f"\tinline constexpr unsigned unicodeBlockShift = {BLOCK_SHIFT};")
+    out.append("")
+    rec_lines = ["\tinline constexpr UnicodeProps unicodeProps[%d] = {" % len(records)]
+    for r in sorted(records, key=records.get):
+        rec_lines.append("\t\t{ %d, %d, %d, %d }," % r)
+    rec_lines.append("\t};")
+    out.append("\n".join(rec_lines))
+    out.append("")
+    out.append(format_array("unicodePropsStage1", c_type(max(stage1)), stage1))
+    out.append("")
+    out.append(format_array("unicodePropsStage2", c_type(max(stage2)), stage2))
+    out.append("")
+    out.append("\tconstexpr const UnicodeProps& unicodePropsOf(char16_t c) noexcept")
+    out.append("\t{")
+    out.append("\t\tconstexpr unsigned mask = (1u << unicodeBlockShift) - 1;")
+    out.append("\t\treturn unicodeProps[unicodePropsStage2[(unsigned(unicodePropsStage1[c >> unicodeBlockShift]) << unicodeBlockShift) | (c & mask)]];")
+    out.append("\t}")
+    out.append("")
+    out.append("\t//cp must be below 0x110000, case deltas apply to its low 16 bits")
+    out.append("\tconstexpr const UnicodeProps& unicodePropsOfCodePoint(char32_t cp) noexcept")
+    out.append("\t{")
+    out.append("\t\tconstexpr unsigned mask = (1u << unicodeBlockShift) - 1;")
+    out.append("\t\treturn unicodeProps[unicodePropsStage2[(unsigned(unicodePropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)]];")
+    out.append("\t}")
+    out.append("")
+    out.append("\t//full mappings of the code units flagged unicodeFlagSpecialCase, sorted. unused units are 0")
+    out.append("\tstruct SpecialCase")
+    out.append("\t{")
+    out.append("\t\tchar16_t unit;")
+    out.append("\t\tchar16_t upper[3];")
+    out.append("\t\tchar16_t lower[3];")
+    out.append("\t\tchar16_t fold[3];")
+    out.append("\t};")
+    out.append("")
+    pad = lambda m: ", ".join(str(i) for i in m + (0,) * (3 - len(m)))
+    special_lines = ["\tinline constexpr SpecialCase caseSpecials[%d] = {" % len(specials)]
+    for c in sorted(specials):
+        u, l, cf = specials[c]
+        special_lines.append("\t\t{ %d, { %s }, { %s }, { %s } }," % (c, pad(u), pad(l), pad(cf)))
+    special_lines.append("\t};")
+    out.append("\n".join(special_lines))
+    out.append("")
+    out.append("\t//folded values having more than one code unit lowering to them, sorted")
+    out.append(format_array("caseClassKeys", "char16_t", class_keys))
+    out.append("")
+    out.append(format_array("caseClassBegin", c_type(max(class_begin)), class_begin))
+    out.append("")
+    out.append(format_array("caseClassMembers", "char16_t", class_members))
+    out.append("")
+    out.append("\tstruct NormProps")
+    out.append("\t{")
+    out.append("\t\t//canonical combining class")
+    out.append("\t\tuint8_t ccc;")
+    out.append("\t\tuint8_t flags;")
+    out.append("\t};")
+    out.append("")
+    out.append("\t//quick check values other than Yes")
+    for (prop, value), flag in NORM_FLAGS.items():
+        name = prop[:-3].capitalize() + ("No" if value == "N" else "Maybe")
+        out.append(f"\tinline constexpr uint8_t normFlag{name} = {flag};")
+    out.append("")
+    rec_lines = ["\tinline constexpr NormProps normProps[%d] = {" % len(norm_records)]
+    for r in sorted(norm_records, key=norm_records.get):
+        rec_lines.append("\t\t{ %d, %d }," % r)
+    rec_lines.append("\t};")
+    out.append("\n".join(rec_lines))
+    out.append("")
+    out.append(format_array("normPropsStage1", c_type(max(norm_stage1)), norm_stage1))
+    out.append("")
+    out.append(format_array("normPropsStage2", c_type(max(norm_stage2)), norm_stage2))
+    out.append("")
+    out.append("\tconstexpr const NormProps& normPropsOf(char32_t cp) noexcept")
+    out.append("\t{")
+    out.append("\t\tconstexpr unsigned mask = (1u << unicodeBlockShift) - 1;")
+    out.append("\t\treturn normProps[normPropsStage2[(unsigned(normPropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)]];")
+    out.append("\t}")
+    out.append("")
+    out.append("\t//full decompositions of the code points other than hangul syllables, sorted: the canonical one at offset")
+    out.append("\t//in decompositionCodePoints and the compatibility one after it. compat is 0 if both are the same, canonical is 0 if there is none")
+    out.append("\tstruct Decomposition")
+    out.append("\t{")
+    out.append("\t\tchar32_t cp;")
+    out.append("\t\tuint16_t offset;")
+    out.append("\t\tuint8_t canonical;")
+    out.append("\t\tuint8_t compat;")
+    out.append("\t};")
+    out.append("")
+    dec_lines = ["\tinline constexpr Decomposition decompositions[%d] = {" % len(decomposition_entries)]
+    for e in decomposition_entries:
+        dec_lines.append("\t\t{ %d, %d, %d, %d }," % e)
+    dec_lines.append("\t};")
+    out.append("\n".join(dec_lines))
+    out.append("")
+    out.append(format_array("decompositionCodePoints", "char32_t", decomposition_pool))
+    out.append("")
+    out.append("\t//primary composites other than hangul syllables, sorted by the pair they compose from")
+    out.append("\tstruct Composition")
+    out.append("\t{")
+    out.append("\t\tchar32_t first;")
+    out.append("\t\tchar32_t second;")
+    out.append("\t\tchar32_t composite;")
+    out.append("\t};")
+    out.append("")
+    comp_lines = ["\tinline constexpr Composition compositions[%d] = {" % len(compositions)]
+    for e in compositions:
+        comp_lines.append("\t\t{ %d, %d, %d }," % e)
+    comp_lines.append("\t};")
+    out.append("\n".join(comp_lines))
+    out.append("")
+    out.append("\t//Grapheme_Cluster_Break (UAX #29)")
+    out.append("\tenum class GraphemeBreak : uint8_t")
+    out.append("\t{")
+    for name in GRAPHEME_BREAKS:
+        out.append("\t\t%s," % name.replace("_", ""))
+    out.append("\t};")
+    out.append("")
+    out.append("\tinline constexpr uint8_t graphemeBreakMask = 15;")
+    out.append(f"\tinline constexpr uint8_t graphemeFlagExtendedPictographic = {GRAPHEME_FLAG_EXTENDED_PICTOGRAPHIC};")
+    out.append("")
+    out.append(format_array("graphemePropsStage1", c_type(max(grapheme_stage1)), grapheme_stage1))
+    out.append("")
+    out.append(format_array("graphemePropsStage2", c_type(max(grapheme_stage2)), grapheme_stage2))
+    out.append("")
+    out.append("\t//GraphemeBreak value in graphemeBreakMask, and flags")
+    out.append("\tconstexpr uint8_t graphemePropsOf(char32_t cp) noexcept")
+    out.append("\t{")
+    out.append("\t\tconstexpr unsigned mask = (1u << unicodeBlockShift) - 1;")
+    out.append("\t\treturn graphemePropsStage2[(unsigned(graphemePropsStage1[cp >> unicodeBlockShift]) << unicodeBlockShift) | (cp & mask)];")
+    out.append("\t}")
+    out.append("}")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    here = os.path.dirname(os.path.abspath(__file__))
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "..", "include", "usting", "uunicode_data.hpp")
+    with open(output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(generate(sys.argv[1]))
+
+
+if __name__ == "__main__":
+    main()